@@ -1298,9 +1298,12 @@ namespace blaze {}
 //
 //
 // The \b Blaze library currently offers three dense matrix types (\ref matrix_types_static_matrix,
-// \ref matrix_types_hybrid_matrix and \ref matrix_types_dynamic_matrix) and one sparse matrix type
-// (\ref matrix_types_compressed_matrix). All matrices can either be stored as row-major matrices
-// or column-major matrices. Per default, all matrices in \b Blaze are row-major matrices.
+// \ref matrix_types_hybrid_matrix and \ref matrix_types_dynamic_matrix) and four sparse matrix
+// types (\ref matrix_types_compressed_matrix, \ref matrix_types_sliced_ellpack_matrix,
+// \ref matrix_types_split_compressed_matrix and \ref matrix_types_block_compressed_matrix).
+// Except for the read-only blaze::SlicedEllpackMatrix, blaze::SplitCompressedMatrix and
+// blaze::BlockCompressedMatrix, all matrices can either be stored as row-major matrices or
+// column-major matrices. Per default, all matrices in \b Blaze are row-major matrices.
 //
 //
 // \n \section matrix_types_static_matrix StaticMatrix
@@ -1411,6 +1414,144 @@ namespace blaze {}
 //             The default value is blaze::rowMajor.
 //
 //
+// \n \section matrix_types_sliced_ellpack_matrix SlicedEllpackMatrix
+// <hr>
+//
+// The blaze::SlicedEllpackMatrix class template is the representation of an arbitrary sized,
+// row-major sparse matrix in the sliced ELLPACK (SELL-C-sigma) format, which is optimized for
+// fast sparse matrix/dense vector multiplications. It can be included via the header file
+
+   \code
+   #include <blaze/math/SlicedEllpackMatrix.h>
+   \endcode
+
+// The type of the elements can be specified via the single template parameter:
+
+   \code
+   template< typename Type >
+   class SlicedEllpackMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. SlicedEllpackMatrix can be used with
+//             any non-cv-qualified, non-reference, non-pointer element type.
+//
+// The rows of the matrix are grouped into chunks of as many rows as fit into a single SIMD
+// register and the non-zero elements of the rows of each chunk are stored interleaved. In order
+// to reduce the padding of the chunks, the rows are sorted by their number of non-zero elements
+// within windows of \a sigma rows. This enables the vectorized computation of several rows of a
+// multiplication with a dense vector at once. A SlicedEllpackMatrix is read-only: It is created
+// from any other matrix (for instance a fully assembled blaze::CompressedMatrix) and can be used
+// as operand in all matrix operations, but it is not possible to modify single elements:
+
+   \code
+   blaze::CompressedMatrix<double> A( 10000UL, 10000UL );
+   // ... Initialization of A
+
+   blaze::SlicedEllpackMatrix<double> S( A );  // Conversion into the sliced ELLPACK format
+
+   blaze::DynamicVector<double> x( 10000UL, 1.0 ), y;
+   y = S * x;  // Vectorized (and parallel) sparse matrix/dense vector multiplication
+   \endcode
+
+// Note that the number of columns of a SlicedEllpackMatrix is limited to \f$ 2^{31} \f$.
+//
+//
+// \n \section matrix_types_split_compressed_matrix SplitCompressedMatrix
+// <hr>
+//
+// The blaze::SplitCompressedMatrix class template is the representation of an arbitrary sized,
+// row-major sparse matrix in the compressed row storage format, which stores the values and the
+// column indices of the non-zero elements in two separate arrays. It can be included via the
+// header file
+
+   \code
+   #include <blaze/math/SplitCompressedMatrix.h>
+   \endcode
+
+// The type of the elements and the type of the column indices can be specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, typename IndexType >
+   class SplitCompressedMatrix;
+   \endcode
+
+//  - \c Type     : specifies the type of the matrix elements. SplitCompressedMatrix can be used
+//                  with any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c IndexType: specifies the unsigned integral type of the column indices. The default value
+//                  is \c uint32_t.
+//
+// In comparison to the blaze::CompressedMatrix, which stores each non-zero element as pair of
+// value and \c size_t index, the separate arrays and the smaller index type reduce the memory
+// footprint of a single precision matrix by 50% and of a double precision matrix by 25%. Since
+// large sparse matrix/dense vector multiplications are limited by the memory bandwidth, this
+// directly translates into faster multiplications, which are additionally vectorized for single
+// and double precision matrices with 32-bit indices. Like the blaze::SlicedEllpackMatrix, a
+// SplitCompressedMatrix is read-only:
+
+   \code
+   blaze::CompressedMatrix<float> A( 10000UL, 10000UL );
+   // ... Initialization of A
+
+   blaze::SplitCompressedMatrix<float> S( A );  // Conversion with 32-bit column indices
+
+   blaze::DynamicVector<float> x( 10000UL, 1.0F ), y;
+   y = S * x;  // Vectorized (and parallel) sparse matrix/dense vector multiplication
+   \endcode
+
+// In case the number of columns of the matrix cannot be represented by the index type, the
+// conversion results in a \a std::invalid_argument exception.
+//
+//
+// \n \section matrix_types_block_compressed_matrix BlockCompressedMatrix
+// <hr>
+//
+// The blaze::BlockCompressedMatrix class template is the representation of an arbitrary sized,
+// row-major sparse matrix in the block compressed row storage format, which stores small dense
+// blocks instead of single non-zero elements. It can be included via the header file
+
+   \code
+   #include <blaze/math/BlockCompressedMatrix.h>
+   \endcode
+
+// The type of the elements and the size of the blocks can be specified via the two template
+// parameters:
+
+   \code
+   template< typename Type, size_t B >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//              any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c B   : specifies the number of rows and columns of the dense \f$ B \times B \f$ blocks.
+//
+// Many sparse matrices, as for instance the system matrices of finite element discretizations
+// with several degrees of freedom per node or the contact matrices of rigid body simulations,
+// consist of small dense blocks. The BlockCompressedMatrix stores a single column index per
+// block, which reduces the index overhead by a factor of \f$ B^2 \f$, and multiplies each block
+// with a register-blocked kernel, which is vectorized for single and double precision matrices.
+// This applies to both the multiplication with dense vectors and with row-major dense matrices.
+// Like the blaze::SlicedEllpackMatrix, a BlockCompressedMatrix is read-only:
+
+   \code
+   blaze::CompressedMatrix<double> A( 3000UL, 3000UL );
+   // ... Initialization of A with 3x3 blocks
+
+   blaze::BlockCompressedMatrix<double,3UL> S( A );  // Conversion into 3x3 blocks
+
+   blaze::DynamicVector<double> x( 3000UL, 1.0 ), y;
+   y = S * x;  // Register-blocked (and parallel) sparse matrix/dense vector multiplication
+
+   blaze::DynamicMatrix<double> X( 3000UL, 6UL, 1.0 ), Y;
+   Y = S * X;  // Register-blocked sparse matrix/dense matrix multiplication
+   \endcode
+
+// Note that the number of rows and columns of the matrix has to be a multiple of the block size
+// (otherwise a \a std::invalid_argument exception is thrown) and that all elements of a non-zero
+// block, including its zero elements, are considered non-zero elements of the matrix.
+//
+//
 // \n <center> Previous: \ref vector_operations &nbsp; &nbsp; Next: \ref matrix_operations </center>
 */
 //*************************************************************************************************
@@ -1830,6 +1971,21 @@ namespace blaze {}
    M1.finalize( 2 );      // Finalizing row 2
    \endcode
 
+// In case the elements are not available in order, e.g. because they are generated by several
+// threads, a compressed matrix can be assembled from an unsorted coordinate representation via
+// the \c assemble() function. The (row,column,value) triplets may contain duplicates, which
+// are summed up. The matrix is built in a single pass with exactly the required capacity and,
+// in case shared memory parallelization is enabled, in parallel:
+
+   \code
+   const unsigned int rows   [] = { 2, 0, 1, 2 };
+   const unsigned int columns[] = { 0, 1, 1, 0 };
+   const int          values [] = { 3, 1, 2, 4 };
+
+   blaze::CompressedMatrix<int> M2( 3UL, 5UL );
+   assemble( M2, rows, columns, values, 4UL );  // Results in M2(0,1)=1, M2(1,1)=2, M2(2,0)=7
+   \endcode
+
 // \n \section matrix_operations_member_functions Member Functions
 // <hr>
 //
@@ -5217,6 +5373,26 @@ namespace blaze {}
 // are possible. Note however that the highest performance for a multiplication between two dense
 // matrices can be expected for two matrices with the same scalar element type.
 //
+// The multiplication of two row-major sparse matrices is executed in parallel in case the result
+// is assigned to a row-major compressed matrix:
+
+   \code
+   using blaze::CompressedMatrix;
+
+   CompressedMatrix<double> A, B;
+
+   // ... Resizing and initialization of the matrices
+
+   CompressedMatrix<double> C( A * B );  // Parallel execution
+   C = A * B;                            // Parallel execution
+   \endcode
+
+// In a first (symbolic) phase all threads count the non-zero elements of a range of rows of the
+// result, which are used to reserve the exact capacity of all rows of the target matrix at once.
+// In a second (numeric) phase the threads compute their ranges of rows and write them directly
+// into the target matrix. Each thread accumulates the elements of a row either in a dense array
+// or, in case of rows with few contributing products, in a small hash table.
+//
 // \n <center> Previous: \ref matrix_vector_multiplication &nbsp; &nbsp; Next: \ref openmp_parallelization </center>
 */
 //*************************************************************************************************
@@ -5649,6 +5825,101 @@ namespace blaze {}
 // have been determined using the OpenMP parallelization and require individual adaption for
 // the Boost thread parallelization.
 //
+//
+// \n \section numa_systems NUMA Systems
+// <hr>
+//
+// On systems with several NUMA nodes (i.e. several sockets with individual memory controllers)
+// the memory bandwidth only scales with the number of threads if each thread works on memory
+// that is local to its NUMA node. For this purpose, all three shared memory parallelizations
+// provide a NUMA mode, which is enabled via the \c BLAZE_USE_NUMA command line argument:
+
+   \code
+   ... -DBLAZE_USE_NUMA ...
+   \endcode
+
+// In NUMA mode, each thread always works on the same part of a vector or matrix and dense
+// vectors and matrices of built-in data type are initialized in parallel by the same threads
+// (first-touch initialization). Additionally, the threads have to be pinned to fixed CPUs. In
+// case of the OpenMP parallelization this is achieved via the \c OMP_PROC_BIND and \c OMP_PLACES
+// environment variables, in case of the C++11 and Boost thread parallelizations via the
+// environment variable \c BLAZE_THREAD_AFFINITY
+
+   \code
+   export BLAZE_THREAD_AFFINITY=0-7,16-23  // Unix systems
+   set BLAZE_THREAD_AFFINITY=0-7,16-23     // Windows systems
+   \endcode
+
+// or alternatively via the \c setThreadAffinity() function:
+
+   \code
+   std::vector<size_t> cpus( blaze::parseCpuList( "0-7,16-23" ) );
+   blaze::setThreadAffinity( cpus );
+   \endcode
+
+// The \c bandwidth program of the \b Blaze benchmark suite measures the memory bandwidth of
+// each NUMA node and of all NUMA nodes in combination.
+//
+//
+// \n \section asynchronous_assignment Asynchronous Assignment
+// <hr>
+//
+// In case of the C++11 and Boost thread parallelizations, the assignment of a vector or matrix
+// expression can also be performed asynchronously via the \c asyncAssign() function. The function
+// returns immediately and the calling thread can continue with other work while the assignment
+// is executed (in parallel) by the thread team. The returned \c Future can be used to check for
+// (\c ready()) or to wait for (\c wait()) the completion of the assignment:
+
+   \code
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL ), B( 10000UL, 10000UL );
+   blaze::DynamicVector<double> x( 10000UL ), y( 10000UL ), z( 10000UL );
+   // ... Initialization of the matrices and vectors
+
+   blaze::Future f1 = blaze::asyncAssign( y, A * x );  // Launching y = A * x
+   blaze::Future f2 = blaze::asyncAssign( z, B * x );  // Launching z = B * x
+
+   // ... Other work of the calling thread
+
+   f1.wait();  // Waiting for the completion of y = A * x
+   f2.wait();  // Waiting for the completion of z = B * x
+   \endcode
+
+// All asynchronous assignments are executed one after another in the order of their launch.
+// However, the target and all operands of the expression must not be accessed by the calling
+// thread and must not be destroyed until the assignment has been completed. Since the expression
+// is set up by the calling thread at the time of the launch, this also means that the target of
+// a pending assignment must not be used as operand of a subsequently launched assignment before
+// the according \c Future has been waited for. In case the assignment fails,
+// the exception is rethrown by the \c wait() function. In case of the OpenMP parallelization and
+// in case the shared memory parallelization is disabled, \c asyncAssign() performs the assignment
+// immediately and returns a completed \c Future.
+//
+//
+// \n \section lazy_batches Lazy Batches
+// <hr>
+//
+// Operations below the SMP thresholds are executed serially (see \ref openmp_configuration).
+// Sequences of many such operations can instead be recorded in a \c LazyBatch and be executed
+// as a whole. Based on the aliasing information of the operands the batch determines which of
+// the recorded assignments are independent of each other. In case of the C++11 and Boost thread
+// parallelizations these are executed concurrently by the threads of the thread backend:
+
+   \code
+   blaze::LazyBatch batch;
+
+   for( size_t i=0UL; i<N; ++i )
+      batch.assign( y[i], A[i] * x[i] );  // N independent matrix/vector multiplications
+
+   batch.addAssign( z, y[0] + y[1] );     // Executed after y[0] and y[1] have been computed
+
+   batch.execute();
+   \endcode
+
+// The targets and all operands of the recorded assignments must not be destroyed until the
+// batch has been executed and must already have their final sizes at the time of the recording.
+// In case of the OpenMP parallelization and in case the shared memory parallelization is
+// disabled, execute() executes the recorded assignments one after another.
+//
 // \n <center> Previous: \ref cpp_threads_parallelization &nbsp; &nbsp; Next: \ref serial_execution </center>
 */
 //*************************************************************************************************
@@ -6121,6 +6392,34 @@ namespace blaze {}
 // the OpenMP-based parallelization, are contained within the configuration file
 // <em>./blaze/config/Thresholds.h</em>.
 //
+// Since the optimal thresholds depend on the target machine, the Blaze benchmark suite provides
+// the \c thresholds autotuner (built via <tt>make thresholds</tt> in the \c blazemark directory).
+// It measures the crossover points of all SMP thresholds and (if BLAS is enabled) of all BLAS
+// thresholds on the current machine and writes a thresholds header that can replace the default
+// configuration file:
+
+   \code
+   ./bin/thresholds Thresholds.h
+   cp Thresholds.h <path-to-blaze>/blaze/config/Thresholds.h
+   \endcode
+
+// Alternatively, the thresholds can be adapted at runtime. In case the \c BLAZE_USE_RUNTIME_THRESHOLDS
+// command line argument is specified during compilation, all thresholds are initialized with the
+// values from the configuration file, but can be overridden at program start by environment
+// variables of the same name with a \c BLAZE_ prefix (as for instance printed by the autotuner)
+// or by direct assignment:
+
+   \code
+   export BLAZE_SMP_DVECASSIGN_THRESHOLD=50000
+   \endcode
+
+   \code
+   blaze::SMP_DVECASSIGN_THRESHOLD = 50000UL;
+   \endcode
+
+// Note that all translation units of a program have to be compiled with the same setting of the
+// \c BLAZE_USE_RUNTIME_THRESHOLDS switch.
+//
 //
 // \n \section streaming Streaming (Non-Temporal Stores)
 //
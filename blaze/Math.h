@@ -42,6 +42,7 @@
 
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BlockCompressedMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
@@ -51,16 +52,20 @@
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/Functors.h>
 #include <blaze/math/Infinity.h>
 #include <blaze/math/HybridMatrix.h>
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/Quaternion.h>
+#include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RotationMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
 #include <blaze/math/SMP.h>
 #include <blaze/math/Solvers.h>
+#include <blaze/math/SplitCompressedMatrix.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
@@ -51,4 +51,39 @@ namespace blaze {
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Number of tasks per thread for the C++11 and Boost thread-based parallelization.
+// \ingroup config
+//
+// This value specifies into how many tasks per thread an operation is split by the C++11 and
+// Boost thread-based parallelization. The threads of the thread team claim the tasks one by one
+// until all tasks have been executed. Therefore several tasks per thread balance the load in
+// case individual tasks take longer than others (e.g. due to an irregular sparsity pattern or
+// due to other processes running on the same cores), at the price of a slightly higher
+// scheduling overhead.
+//
+// The default setting for this value is 4. Note that the value must be at least 1.
+*/
+const size_t SMP_TASKS_PER_THREAD = 4UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of polling iterations before a thread of the thread team blocks.
+// \ingroup config
+//
+// This value specifies how often an idle thread of the C++11 and Boost thread-based
+// parallelization polls for the next operation before it blocks on a condition variable.
+// Analogously, it specifies how often the calling thread polls for the completion of an
+// operation before it blocks. Polling avoids the latency of the operating system for operations
+// issued in quick succession, but occupies the core while polling. A value of 0 disables the
+// polling and makes all threads block immediately, which is recommended in case there are
+// more threads than cores (e.g. if several processes share the cores).
+//
+// The default setting for this value is 20000, which corresponds to a few microseconds.
+*/
+const size_t SMP_SPIN_COUNT = 20000UL;
+//*************************************************************************************************
+
 } // namespace blaze
@@ -299,6 +299,28 @@ const size_t SMP_DVECDVECMULT_THRESHOLD = 38000UL;
 const size_t SMP_DVECSCALARMULT_THRESHOLD = 51000UL;
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a reduction of a dense vector (as for instance the sum(), min(),
+// or l2Norm() functions) can be executed in parallel. In case the number of elements of the
+// dense vector is larger or equal to this threshold, the operation is executed in parallel. If
+// the number of elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_DVECREDUCE_THRESHOLD = 38000UL;
+//*************************************************************************************************
+
 
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/dense vector multiplication threshold.
@@ -811,6 +833,30 @@ const size_t SMP_DMATTDMATSUB_THRESHOLD = 175UL;
 const size_t SMP_DMATSCALARMULT_THRESHOLD = 220UL;
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a reduction of a dense matrix (as for instance the sum(), min(),
+// or l2Norm() functions or their row-wise and column-wise variants) can be executed in parallel.
+// In case the number of rows (row-major matrices and row-wise reductions) or columns (column-major
+// matrices and column-wise reductions) of the dense matrix is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of rows/columns is below this threshold
+// the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 220. In case the threshold is set to 0, the operation
+// is unconditionally executed in parallel.
+*/
+const size_t SMP_DMATREDUCE_THRESHOLD = 220UL;
+//*************************************************************************************************
+
 
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/row-major dense matrix multiplication threshold.
@@ -1202,4 +1248,47 @@ const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
 const size_t SMP_DVECTDVECMULT_THRESHOLD = 290UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief SMP triplet assembly threshold.
+// \ingroup config
+//
+// This threshold specifies when the assembly of a compressed matrix from (row,column,value)
+// triplets can be executed in parallel. In case the number of triplets is larger or equal to
+// this threshold, the assembly is executed in parallel. If the number of triplets is below this
+// threshold the assembly is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 50000. In case the threshold is set to 0, the
+// assembly is unconditionally executed in parallel.
+*/
+const size_t SMP_TRIPLETASSEMBLY_THRESHOLD = 50000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP PGS threshold.
+// \ingroup config
+//
+// This threshold specifies when the sweeps of the projected Gauss-Seidel solver over the contacts
+// of a contact LCP can be executed in parallel. In case the number of contacts is larger or equal
+// to this threshold, the contacts are colored and the contacts of each color are updated in
+// parallel. If the number of contacts is below this threshold the sweeps are executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 1000. In case the threshold is set to 0, the sweeps
+// are unconditionally executed in parallel.
+*/
+const size_t SMP_PGS_THRESHOLD = 1000UL;
+//*************************************************************************************************
+
 } // namespace blaze
@@ -46,7 +46,9 @@
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/SparseMatrix.h>
 #include <blaze/system/Precision.h>
+#include <blaze/util/constraints/Integral.h>
 #include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -340,6 +342,62 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 
 
 
+//=================================================================================================
+//
+//  ASSEMBLY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assembly of a compressed matrix from (row,column,value) triplets.
+// \ingroup compressed_matrix
+//
+// \param A The target compressed matrix.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param size The total number of triplets.
+// \return void
+//
+// This function replaces the content of the given compressed matrix by the matrix described by
+// the given coordinate (COO) representation, i.e. by \a size (row,column,value) triplets. The
+// triplets may be given in arbitrary order and may contain duplicates, which are summed up in
+// the order of the triplets. Zero values and sums are stored as explicit non-zero elements. The
+// size of the matrix is preserved and all row and column indices have to be in the range of
+// the current number of rows and columns, respectively. The row and column indices can be of
+// any integral type; 32-bit indices for instance reduce the memory traffic of the assembly.
+
+   \code
+   std::vector<unsigned int> rows, columns;
+   std::vector<double> values;
+   // ... Collecting the (possibly unsorted and duplicate) triplets
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   assemble( A, &rows[0], &columns[0], &values[0], values.size() );
+   \endcode
+
+// The triplets are sorted by means of a counting sort and the resulting matrix is built in a
+// single pass with exactly the required capacity. In case shared memory parallelization is
+// enabled and the number of triplets exceeds the SMP_TRIPLETASSEMBLY_THRESHOLD, the assembly
+// is executed in parallel. The result does not depend on the number of threads.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the row and column indices
+inline void assemble( CompressedMatrix<Type,SO>& A, const IT* rows, const IT* columns,
+                      const Type* values, size_t size )
+{
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( IT );
+
+   CompressedMatrix<Type,SO> tmp( A.rows(), A.columns() );
+   smpAssemble( tmp, rows, columns, values, size );
+   A.swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  TYPE DEFINITIONS
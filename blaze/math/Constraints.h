@@ -54,11 +54,15 @@
 #include <blaze/math/constraints/EvalExpr.h>
 #include <blaze/math/constraints/Expression.h>
 #include <blaze/math/constraints/Lower.h>
+#include <blaze/math/constraints/MapExpr.h>
 #include <blaze/math/constraints/MatAbsExpr.h>
 #include <blaze/math/constraints/MatEvalExpr.h>
+#include <blaze/math/constraints/MatMapExpr.h>
 #include <blaze/math/constraints/MatMatAddExpr.h>
+#include <blaze/math/constraints/MatMatMapExpr.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/MatMatSubExpr.h>
+#include <blaze/math/constraints/MatReduceExpr.h>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/constraints/MatScalarDivExpr.h>
 #include <blaze/math/constraints/MatScalarMultExpr.h>
@@ -66,6 +70,7 @@
 #include <blaze/math/constraints/MatTransExpr.h>
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/MultExpr.h>
+#include <blaze/math/constraints/ReduceExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/Resizable.h>
 #include <blaze/math/constraints/Restricted.h>
@@ -90,6 +95,7 @@
 #include <blaze/math/constraints/Upper.h>
 #include <blaze/math/constraints/VecAbsExpr.h>
 #include <blaze/math/constraints/VecEvalExpr.h>
+#include <blaze/math/constraints/VecMapExpr.h>
 #include <blaze/math/constraints/VecScalarDivExpr.h>
 #include <blaze/math/constraints/VecScalarMultExpr.h>
 #include <blaze/math/constraints/VecSerialExpr.h>
@@ -97,6 +103,7 @@
 #include <blaze/math/constraints/VecTransExpr.h>
 #include <blaze/math/constraints/VecTVecMultExpr.h>
 #include <blaze/math/constraints/VecVecAddExpr.h>
+#include <blaze/math/constraints/VecVecMapExpr.h>
 #include <blaze/math/constraints/VecVecMultExpr.h>
 #include <blaze/math/constraints/VecVecSubExpr.h>
 #include <blaze/math/constraints/View.h>
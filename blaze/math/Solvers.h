@@ -43,7 +43,11 @@
 #include <blaze/math/solvers/CG.h>
 #include <blaze/math/solvers/CPG.h>
 #include <blaze/math/solvers/GaussianElimination.h>
+#include <blaze/math/solvers/ICPreconditioner.h>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
 #include <blaze/math/solvers/Lemke.h>
 #include <blaze/math/solvers/PGS.h>
+#include <blaze/math/solvers/SSORPreconditioner.h>
+#include <blaze/math/solvers/WarmStart.h>
 
 #endif
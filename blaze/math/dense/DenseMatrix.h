@@ -40,19 +40,31 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <blaze/math/dense/DenseVector.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatAbsExpr.h>
+#include <blaze/math/expressions/DMatDMatMapExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsNaN.h>
 #include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/CMathTrait.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
@@ -575,6 +587,24 @@ bool isLower( const DenseMatrix<MT,SO>& dm );
 template< typename MT, bool SO >
 bool isUpper( const DenseMatrix<MT,SO>& dm );
 
+template< typename MT, bool SO, typename OP >
+const typename MT::ElementType reduce( const DenseMatrix<MT,SO>& dm, OP op );
+
+template< typename MT, bool SO >
+const typename MT::ElementType sum( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+const typename MT::ElementType prod( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+const typename MT::ElementType l1Norm( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+typename CMathTrait<typename MT::ElementType>::Type l2Norm( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+const typename MT::ElementType linfNorm( const DenseMatrix<MT,SO>& dm );
+
 template< typename MT, bool SO >
 const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm );
 
@@ -922,48 +952,245 @@ bool isUpper( const DenseMatrix<MT,SO>& dm )
 
 
 //*************************************************************************************************
-/*!\brief Returns the smallest element of the dense matrix.
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the serial reduction of a dense matrix.
 // \ingroup dense_matrix
 //
-// \param dm The given dense matrix.
-// \return The smallest dense matrix element.
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
 //
-// This function returns the smallest element of the given dense matrix. This function can
-// only be used for element types that support the smaller-than relationship. In case the
-// matrix currently has either 0 rows or 0 columns, the returned value is the default value
-// (e.g. 0 in case of fundamental data types).
+// This function implements the serial reduction of a dense matrix. In case of a row-major
+// matrix the matrix is reduced row by row, in case of a column-major matrix it is reduced
+// column by column, which enables the vectorized reduction of the single rows/columns. In
+// case the matrix has either 0 rows or 0 columns, the returned value is the default value of
+// the element type (or 1 in case of a multiplicative reduction).\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors. Instead of using this function use the reduce() function.
 */
-template< typename MT  // Type of the dense matrix
-        , bool SO >    // Storage order
-const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm )
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+const typename MT::ElementType serialReduce( const DenseMatrix<MT,SO>& dm, OP op )
 {
-   using blaze::min;
-
    typedef typename MT::ElementType    ET;
    typedef typename MT::CompositeType  CT;
 
    CT A( ~dm );  // Evaluation of the dense matrix operand
 
-   if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
-
-   ET minimum( A(0,0) );
+   if( A.rows() == 0UL || A.columns() == 0UL ) return emptyReduction<ET>( op );
 
    if( SO == rowMajor ) {
-      for( size_t j=1UL; j<A.columns(); ++j )
-         minimum = min( minimum, A(0UL,j) );
+      ET redux( serialReduce( row( A, 0UL ), op ) );
       for( size_t i=1UL; i<A.rows(); ++i )
-         for( size_t j=0UL; j<A.columns(); ++j )
-            minimum = min( minimum, A(i,j) );
+         redux = op( redux, serialReduce( row( A, i ), op ) );
+      return redux;
    }
    else {
-      for( size_t i=1UL; i<A.rows(); ++i )
-         minimum = min( minimum, A(i,0UL) );
+      ET redux( serialReduce( column( A, 0UL ), op ) );
       for( size_t j=1UL; j<A.columns(); ++j )
-         for( size_t i=0UL; i<A.rows(); ++i )
-            minimum = min( minimum, A(i,j) );
+         redux = op( redux, serialReduce( column( A, j ), op ) );
+      return redux;
    }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of the given reduction operation.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces all elements of the given dense matrix \a dm by means of the given
+// reduction operation \a op:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   // ... Resizing and initialization
+
+   const double totalsum = reduce( A, blaze::Add() );
+   const double maximum  = reduce( A, blaze::Maximum() );
+   \endcode
+
+// In case the reduction operation provides an intrinsic evaluation (see the \a SIMDEnabled
+// class template and the load() function of the predefined functors), the reduction is
+// vectorized. In case the matrix is sufficiently large and the shared memory parallelization
+// is enabled, the reduction is additionally executed in parallel. Note that in this case the
+// reduction operation is required to be associative and commutative, since the order of the
+// single operations is not specified. In case the matrix has either 0 rows or 0 columns, the
+// returned value is the default value of the element type, except for the multiplicative
+// reduction via the Mult functor, which returns 1. For the row-wise and column-wise
+// reduction of a dense matrix see the reduce<rowwise>() and reduce<columnwise>() functions.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+const typename MT::ElementType reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   typedef typename MT::CompositeType  CT;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   return smpReduce( A, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of addition.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The sum of all matrix elements.
+
+   \code
+   blaze::DynamicMatrix<int> A( 2UL, 3UL );
+   // ... Initialization
+
+   const int totalsum = sum( A );
+   \endcode
+
+// In case the matrix has either 0 rows or 0 columns, the returned value is 0.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+const typename MT::ElementType sum( const DenseMatrix<MT,SO>& dm )
+{
+   return reduce( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of multiplication.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The product of all matrix elements.
+
+   \code
+   blaze::DynamicMatrix<int> A( 2UL, 3UL );
+   // ... Initialization
+
+   const int totalprod = prod( A );
+   \endcode
+
+// In case the matrix has either 0 rows or 0 columns, the returned value is 1.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+const typename MT::ElementType prod( const DenseMatrix<MT,SO>& dm )
+{
+   return reduce( ~dm, Mult() );
+}
+//*************************************************************************************************
+
 
-   return minimum;
+//*************************************************************************************************
+/*!\brief Computes the L1 norm \f$\sum_{i,j}|a_{ij}|\f$ of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The L1 norm of the dense matrix.
+//
+// Note that this function computes the entrywise L1 norm of the matrix, i.e. it treats the
+// matrix as a vector of all its elements.
+//
+// \b Note: This operation is only defined for numeric data types. In case the element type is
+// not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
+// l1Norm() function results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+const typename MT::ElementType l1Norm( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename MT::ElementType );
+
+   return reduce( abs( ~dm ), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm \f$\sqrt{\sum_{i,j}|a_{ij}|^2}\f$ of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The L2 norm of the dense matrix.
+//
+// Note that this function computes the entrywise L2 norm (i.e. the Frobenius norm) of the
+// matrix. The return type of the function depends on the element type of the matrix in the
+// same way as for the length() function of dense vectors.
+//
+// \b Note: This operation is only defined for numeric data types. In case the element type is
+// not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
+// l2Norm() function results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+typename CMathTrait<typename MT::ElementType>::Type l2Norm( const DenseMatrix<MT,SO>& dm )
+{
+   typedef typename MT::ElementType       ET;
+   typedef typename MT::CompositeType     CT;
+   typedef typename CMathTrait<ET>::Type  LengthType;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   return std::sqrt( LengthType( reduce( map( A, A, Mult() ), Add() ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the infinity norm \f$\max_{i,j}|a_{ij}|\f$ of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The infinity norm of the dense matrix.
+//
+// Note that this function computes the entrywise infinity norm of the matrix, i.e. it treats
+// the matrix as a vector of all its elements. In case the matrix has either 0 rows or 0
+// columns, the returned value is 0.
+//
+// \b Note: This operation is only defined for numeric data types. In case the element type is
+// not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
+// linfNorm() function results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+const typename MT::ElementType linfNorm( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename MT::ElementType );
+
+   return reduce( abs( ~dm ), Maximum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The smallest dense matrix element.
+//
+// This function returns the smallest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm )
+{
+   return reduce( ~dm, Minimum() );
 }
 //*************************************************************************************************
 
@@ -984,33 +1211,7 @@ template< typename MT  // Type of the dense matrix
         , bool SO >    // Transpose flag
 const typename MT::ElementType max( const DenseMatrix<MT,SO>& dm )
 {
-   using blaze::max;
-
-   typedef typename MT::ElementType    ET;
-   typedef typename MT::CompositeType  CT;
-
-   CT A( ~dm );  // Evaluation of the dense matrix operand
-
-   if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
-
-   ET maximum( A(0,0) );
-
-   if( SO == rowMajor ) {
-      for( size_t j=1UL; j<A.columns(); ++j )
-         maximum = max( maximum, A(0UL,j) );
-      for( size_t i=1UL; i<A.rows(); ++i )
-         for( size_t j=0UL; j<A.columns(); ++j )
-            maximum = max( maximum, A(i,j) );
-   }
-   else {
-      for( size_t i=1UL; i<A.rows(); ++i )
-         maximum = max( maximum, A(i,0UL) );
-      for( size_t j=1UL; j<A.columns(); ++j )
-         for( size_t i=0UL; i<A.rows(); ++i )
-            maximum = max( maximum, A(i,j) );
-   }
-
-   return maximum;
+   return reduce( ~dm, Maximum() );
 }
 //*************************************************************************************************
 
@@ -42,18 +42,29 @@
 
 #include <cmath>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecAbsExpr.h>
+#include <blaze/math/expressions/DVecDVecMapExpr.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Reduction.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsNaN.h>
-#include <blaze/math/shims/Square.h>
 #include <blaze/math/traits/CMathTrait.h>
 #include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/system/Inline.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
@@ -374,17 +385,41 @@ inline typename EnableIf< IsNumeric<T1>, bool >::Type
 template< typename VT, bool TF >
 bool isnan( const DenseVector<VT,TF>& dv );
 
+template< typename VT, bool TF, typename OP >
+const typename VT::ElementType reduce( const DenseVector<VT,TF>& dv, OP op );
+
+template< typename VT, bool TF >
+const typename VT::ElementType sum( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+const typename VT::ElementType prod( const DenseVector<VT,TF>& dv );
+
 template< typename VT, bool TF >
 typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT,TF>& dv );
 
 template< typename VT, bool TF >
 const typename VT::ElementType sqrLength( const DenseVector<VT,TF>& dv );
 
+template< typename VT, bool TF >
+const typename VT::ElementType l1Norm( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+typename CMathTrait<typename VT::ElementType>::Type l2Norm( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+const typename VT::ElementType linfNorm( const DenseVector<VT,TF>& dv );
+
 template< typename VT, bool TF >
 const typename VT::ElementType min( const DenseVector<VT,TF>& dv );
 
 template< typename VT, bool TF >
 const typename VT::ElementType max( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+size_t argmin( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+size_t argmax( const DenseVector<VT,TF>& dv );
 //@}
 //*************************************************************************************************
 
@@ -425,6 +460,376 @@ bool isnan( const DenseVector<VT,TF>& dv )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense vector reduction kernels.
+// \ingroup dense_vector
+//
+// This helper evaluates to \a true in case the given dense vector can be reduced by means of
+// intrinsic operations, i.e. in case the vector is vectorizable and the given reduction
+// operation provides an intrinsic evaluation for the element type of the vector.
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+struct DVecReduceHelper
+{
+   //**********************************************************************************************
+   enum { value = VT::vectorizable && IsSIMDEnabled<OP,typename VT::ElementType>::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the result of the reduction of an operand without elements.
+// \ingroup dense_vector
+//
+// \return The default value of the element type.
+//
+// This default implementation returns the default value of the element type (e.g. 0 in case
+// of fundamental data types), which is the identity element of the addition.
+*/
+template< typename ET    // Element type of the reduced operand
+        , typename OP >  // Type of the reduction operation
+BLAZE_ALWAYS_INLINE const ET emptyReduction( OP )
+{
+   return ET();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the result of the multiplicative reduction of an operand without elements.
+// \ingroup dense_vector
+//
+// \return The identity element of the multiplication (e.g. 1 in case of fundamental data types).
+*/
+template< typename ET >  // Element type of the reduced operand
+BLAZE_ALWAYS_INLINE const ET emptyReduction( Mult )
+{
+   return ET( 1 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal reduction of an intrinsic vector by means of the given reduction operation.
+// \ingroup dense_vector
+//
+// \param a The intrinsic vector to be reduced.
+// \param op The reduction operation.
+// \return The reduced value.
+//
+// This default implementation reduces the elements of the intrinsic vector one by one. It is
+// selected for all operations without a dedicated horizontal intrinsic reduction.
+*/
+template< typename ET    // Element type of the intrinsic vector
+        , typename T     // Type of the intrinsic vector
+        , typename OP >  // Type of the reduction operation
+BLAZE_ALWAYS_INLINE ET intrinsicReduce( const T& a, OP op )
+{
+   ET redux( a[0UL] );
+   for( size_t k=1UL; k<IntrinsicTrait<ET>::size; ++k )
+      redux = op( redux, a[k] );
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal summation of an intrinsic vector.
+// \ingroup dense_vector
+//
+// \param a The intrinsic vector to be reduced.
+// \return The sum of all elements of the intrinsic vector.
+*/
+template< typename ET   // Element type of the intrinsic vector
+        , typename T >  // Type of the intrinsic vector
+BLAZE_ALWAYS_INLINE ET intrinsicReduce( const T& a, Add )
+{
+   return sum( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal multiplication of an intrinsic vector of floating point values.
+// \ingroup dense_vector
+//
+// \param a The intrinsic vector to be reduced.
+// \return The product of all elements of the intrinsic vector.
+*/
+template< typename ET   // Element type of the intrinsic vector
+        , typename T >  // Type of the intrinsic vector
+BLAZE_ALWAYS_INLINE typename EnableIf< IsFloatingPoint<ET>, ET >::Type
+   intrinsicReduce( const T& a, Mult )
+{
+   return prod( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal minimum of an intrinsic vector.
+// \ingroup dense_vector
+//
+// \param a The intrinsic vector to be reduced.
+// \return The smallest element of the intrinsic vector.
+*/
+template< typename ET   // Element type of the intrinsic vector
+        , typename T >  // Type of the intrinsic vector
+BLAZE_ALWAYS_INLINE ET intrinsicReduce( const T& a, Minimum )
+{
+   return min( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal maximum of an intrinsic vector.
+// \ingroup dense_vector
+//
+// \param a The intrinsic vector to be reduced.
+// \return The largest element of the intrinsic vector.
+*/
+template< typename ET   // Element type of the intrinsic vector
+        , typename T >  // Type of the intrinsic vector
+BLAZE_ALWAYS_INLINE ET intrinsicReduce( const T& a, Maximum )
+{
+   return max( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend of the serial reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function implements the default serial reduction of a dense vector. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case the reduction cannot be performed by means of intrinsic operations. In case the vector
+// has a size of 0, the returned value is the default value of the element type (or 1 in case
+// of a multiplicative reduction).\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense vectors. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename DisableIf< DVecReduceHelper<VT,OP>, typename VT::ElementType >::Type
+   serialReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return emptyReduction<ET>( op );
+
+   ET redux( a[0UL] );
+   for( size_t i=1UL; i<a.size(); ++i )
+      redux = op( redux, a[i] );
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized backend of the serial reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function implements the vectorized serial reduction of a dense vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the reduction can be performed by means of intrinsic operations. In order
+// to hide the latency of the intrinsic operations, the function uses four independent partial
+// results for vectors with at least four intrinsic vectors. In case the vector has a size of 0,
+// the returned value is the default value of the element type (or 1 in case of a multiplicative
+// reduction).\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense vectors. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< DVecReduceHelper<VT,OP>, typename VT::ElementType >::Type
+   serialReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+   typedef IntrinsicTrait<ET>          IT;
+   typedef typename IT::Type           IntrinsicType;
+
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   const size_t N( a.size() );
+
+   if( N < IT::size ) {
+      if( N == 0UL ) return emptyReduction<ET>( op );
+      ET redux( a[0UL] );
+      for( size_t i=1UL; i<N; ++i )
+         redux = op( redux, a[i] );
+      return redux;
+   }
+
+   const size_t ipos( N & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % IT::size ) ) == ipos, "Invalid end calculation" );
+
+   IntrinsicType xmm1( a.load( 0UL ) );
+   size_t i( IT::size );
+
+   if( ipos >= IT::size*4UL )
+   {
+      IntrinsicType xmm2( a.load( i            ) );
+      IntrinsicType xmm3( a.load( i+IT::size   ) );
+      IntrinsicType xmm4( a.load( i+IT::size*2UL ) );
+      i += IT::size*3UL;
+
+      for( ; (i+IT::size*4UL) <= ipos; i+=IT::size*4UL ) {
+         xmm1 = op.load( xmm1, a.load( i               ) );
+         xmm2 = op.load( xmm2, a.load( i+IT::size      ) );
+         xmm3 = op.load( xmm3, a.load( i+IT::size*2UL ) );
+         xmm4 = op.load( xmm4, a.load( i+IT::size*3UL ) );
+      }
+
+      xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+   }
+
+   for( ; i<ipos; i+=IT::size ) {
+      xmm1 = op.load( xmm1, a.load( i ) );
+   }
+
+   ET redux( intrinsicReduce<ET>( xmm1, op ) );
+
+   for( ; i<N; ++i ) {
+      redux = op( redux, a[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of the given reduction operation.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of the given reduction operation
+// \a op:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+
+   const double totalsum = reduce( a, blaze::Add() );
+   const double maximum  = reduce( a, blaze::Maximum() );
+   \endcode
+
+// In case the reduction operation provides an intrinsic evaluation (see the \a SIMDEnabled
+// class template and the load() function of the predefined functors), the reduction is
+// vectorized. In case the vector is sufficiently large and the shared memory parallelization
+// is enabled, the reduction is additionally executed in parallel. Note that in this case the
+// reduction operation is required to be associative and commutative, since the order of the
+// single operations is not specified. In case the vector has a size of 0, the returned value
+// is the default value of the element type, except for the multiplicative reduction via the
+// Mult functor, which returns 1.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+const typename VT::ElementType reduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef typename VT::CompositeType  CT;
+
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   return smpReduce( a, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of addition.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction operation.
+// \return The sum of all vector elements.
+
+   \code
+   blaze::DynamicVector<int> a;
+   // ... Resizing and initialization
+
+   const int totalsum = sum( a );
+   \endcode
+
+// In case the vector has a size of 0, the returned value is 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const typename VT::ElementType sum( const DenseVector<VT,TF>& dv )
+{
+   return reduce( ~dv, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of multiplication.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction operation.
+// \return The product of all vector elements.
+
+   \code
+   blaze::DynamicVector<int> a;
+   // ... Resizing and initialization
+
+   const int totalprod = prod( a );
+   \endcode
+
+// In case the vector has a size of 0, the returned value is 1.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const typename VT::ElementType prod( const DenseVector<VT,TF>& dv )
+{
+   return reduce( ~dv, Mult() );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Calculation of the dense vector length \f$|\vec{a}|\f$.
 // \ingroup dense_vector
@@ -462,15 +867,7 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT,TF>& dv )
 {
-   typedef typename VT::ElementType                ElementType;
-   typedef typename CMathTrait<ElementType>::Type  LengthType;
-
-   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
-
-   LengthType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return std::sqrt( sum );
+   return l2Norm( ~dv );
 }
 //*************************************************************************************************
 
@@ -492,14 +889,85 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType sqrLength( const DenseVector<VT,TF>& dv )
 {
-   typedef typename VT::ElementType  ElementType;
+   typedef typename VT::ElementType    ElementType;
+   typedef typename VT::CompositeType  CT;
 
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
 
-   ElementType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return sum;
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   return reduce( map( a, a, Mult() ), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm \f$\sum_i|a_i|\f$ of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The L1 norm of the dense vector.
+//
+// \b Note: This operation is only defined for numeric data types. In case the element type is
+// not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
+// l1Norm() function results in a compile time error!
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const typename VT::ElementType l1Norm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename VT::ElementType );
+
+   return reduce( abs( ~dv ), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm \f$\sqrt{\sum_i|a_i|^2}\f$ of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The L2 norm of the dense vector.
+//
+// The return type of the l2Norm() function corresponds to the return type of the length()
+// function, i.e. it depends on the actual element type of the vector instance.
+//
+// \b Note: This operation is only defined for numeric data types. In case the element type is
+// not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
+// l2Norm() function results in a compile time error!
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+typename CMathTrait<typename VT::ElementType>::Type l2Norm( const DenseVector<VT,TF>& dv )
+{
+   typedef typename CMathTrait<typename VT::ElementType>::Type  LengthType;
+
+   return std::sqrt( LengthType( sqrLength( ~dv ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the infinity norm \f$\max_i|a_i|\f$ of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The infinity norm of the dense vector.
+//
+// In case the vector has a size of 0, the returned value is 0.
+//
+// \b Note: This operation is only defined for numeric data types. In case the element type is
+// not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
+// linfNorm() function results in a compile time error!
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const typename VT::ElementType linfNorm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename VT::ElementType );
+
+   return reduce( abs( ~dv ), Maximum() );
 }
 //*************************************************************************************************
 
@@ -520,19 +988,7 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType min( const DenseVector<VT,TF>& dv )
 {
-   using blaze::min;
-
-   typedef typename VT::ElementType    ET;
-   typedef typename VT::CompositeType  CT;
-
-   CT a( ~dv );  // Evaluation of the dense vector operand
-
-   if( a.size() == 0UL ) return ET();
-
-   ET minimum( a[0] );
-   for( size_t i=1UL; i<a.size(); ++i )
-      minimum = min( minimum, a[i] );
-   return minimum;
+   return reduce( ~dv, Minimum() );
 }
 //*************************************************************************************************
 
@@ -553,19 +1009,85 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType max( const DenseVector<VT,TF>& dv )
 {
-   using blaze::max;
+   return reduce( ~dv, Maximum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the smallest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The index of the smallest dense vector element.
+//
+// This function returns the index of the first occurrence of the smallest element of the given
+// dense vector. The smallest element is determined via the (vectorized and parallel) min()
+// function, its index by a subsequent linear search. In case the vector contains not-a-number
+// elements or currently has a size of 0, the function falls back to a single linear search
+// (returning 0 for an empty vector).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+size_t argmin( const DenseVector<VT,TF>& dv )
+{
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
 
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return 0UL;
+
+   const ET minimum( min( a ) );
+
+   for( size_t i=0UL; i<a.size(); ++i ) {
+      if( a[i] == minimum ) return i;
+   }
+
+   size_t index( 0UL );
+   for( size_t i=1UL; i<a.size(); ++i ) {
+      if( a[i] < a[index] ) index = i;
+   }
+   return index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the largest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The index of the largest dense vector element.
+//
+// This function returns the index of the first occurrence of the largest element of the given
+// dense vector. The largest element is determined via the (vectorized and parallel) max()
+// function, its index by a subsequent linear search. In case the vector contains not-a-number
+// elements or currently has a size of 0, the function falls back to a single linear search
+// (returning 0 for an empty vector).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+size_t argmax( const DenseVector<VT,TF>& dv )
+{
    typedef typename VT::ElementType    ET;
    typedef typename VT::CompositeType  CT;
 
    CT a( ~dv );  // Evaluation of the dense vector operand
 
-   if( a.size() == 0UL ) return ET();
+   if( a.size() == 0UL ) return 0UL;
 
-   ET maximum( a[0] );
-   for( size_t i=1UL; i<a.size(); ++i )
-      maximum = max( maximum, a[i] );
-   return maximum;
+   const ET maximum( max( a ) );
+
+   for( size_t i=0UL; i<a.size(); ++i ) {
+      if( a[i] == maximum ) return i;
+   }
+
+   size_t index( 0UL );
+   for( size_t i=1UL; i<a.size(); ++i ) {
+      if( a[index] < a[i] ) index = i;
+   }
+   return index;
 }
 //*************************************************************************************************
 
@@ -65,6 +65,7 @@
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
@@ -81,6 +82,7 @@
 #include <blaze/util/Null.h>
 #include <blaze/util/Template.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
@@ -472,7 +474,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix()
 // \param n The number of columns of the matrix.
 //
 // \b Note: This constructor is only responsible to allocate the required dynamic memory. No
-//          element initialization is performed!
+//          element initialization is performed! Only in NUMA mode (see the \c BLAZE_USE_NUMA
+//          command line argument), the elements of built-in data type are default initialized
+//          in parallel in order to place the memory pages on the NUMA nodes of the threads
+//          that work on them in subsequent parallel operations.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -483,6 +488,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+   if( BLAZE_NUMA_MODE && IsBuiltin<Type>::value ) {
+      smpFill( *this, Type() );
+   }
+
    if( IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j )
@@ -500,7 +509,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In NUMA mode (see the
+// \c BLAZE_USE_NUMA command line argument), the elements of built-in data type are initialized
+// in parallel in order to place the memory pages on the NUMA nodes of the threads that work on
+// them in subsequent parallel operations.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -511,13 +523,24 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j )
-         v_[i*nn_+j] = init;
+   if( BLAZE_NUMA_MODE && IsBuiltin<Type>::value ) {
+      smpFill( *this, init );
 
       if( IsVectorizable<Type>::value ) {
-         for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
+         for( size_t i=0UL; i<m_; ++i )
+            for( size_t j=n_; j<nn_; ++j )
+               v_[i*nn_+j] = Type();
+      }
+   }
+   else {
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n_; ++j )
+            v_[i*nn_+j] = init;
+
+         if( IsVectorizable<Type>::value ) {
+            for( size_t j=n_; j<nn_; ++j )
+               v_[i*nn_+j] = Type();
+         }
       }
    }
 }
@@ -622,7 +645,8 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[M][N] )
 // \param m Matrix to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. In NUMA mode (see the \c BLAZE_USE_NUMA
+// command line argument), the elements of built-in data type are copied in parallel.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -635,8 +659,19 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = m.v_[i];
+   if( BLAZE_NUMA_MODE && IsBuiltin<Type>::value ) {
+      smpAssign( *this, m );
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t i=0UL; i<m_; ++i )
+            for( size_t j=n_; j<nn_; ++j )
+               v_[i*nn_+j] = Type();
+      }
+   }
+   else {
+      for( size_t i=0UL; i<capacity_; ++i )
+         v_[i] = m.v_[i];
+   }
 }
 //*************************************************************************************************
 
@@ -645,6 +680,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
 /*!\brief Conversion constructor from different matrices.
 //
 // \param m Matrix to be copied.
+//
+// In NUMA mode (see the \c BLAZE_USE_NUMA command line argument), the elements of built-in
+// data type are initialized in parallel.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -657,14 +695,28 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( size_t j=( IsSparseMatrix<MT>::value   ? 0UL : n_ );
-                  j<( IsVectorizable<Type>::value ? nn_ : n_ ); ++j ) {
-         v_[i*nn_+j] = Type();
+   if( BLAZE_NUMA_MODE && IsBuiltin<Type>::value ) {
+      if( IsSparseMatrix<MT>::value )
+         smpFill( *this, Type() );
+
+      smpAssign( *this, ~m );
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t i=0UL; i<m_; ++i )
+            for( size_t j=n_; j<nn_; ++j )
+               v_[i*nn_+j] = Type();
       }
    }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=( IsSparseMatrix<MT>::value   ? 0UL : n_ );
+                     j<( IsVectorizable<Type>::value ? nn_ : n_ ); ++j ) {
+            v_[i*nn_+j] = Type();
+         }
+      }
 
-   smpAssign( *this, ~m );
+      smpAssign( *this, ~m );
+   }
 }
 //*************************************************************************************************
 
@@ -2697,7 +2749,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix()
 // \param n The number of columns of the matrix.
 //
 // \b Note: This constructor is only responsible to allocate the required dynamic memory. No
-//          element initialization is performed!
+//          element initialization is performed! Only in NUMA mode (see the \c BLAZE_USE_NUMA
+//          command line argument), the elements of built-in data type are default initialized
+//          in parallel in order to place the memory pages on the NUMA nodes of the threads
+//          that work on them in subsequent parallel operations.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
@@ -2707,6 +2762,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+   if( BLAZE_NUMA_MODE && IsBuiltin<Type>::value ) {
+      smpFill( *this, Type() );
+   }
+
    if( IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j )
          for( size_t i=m_; i<mm_; ++i ) {
@@ -2726,7 +2785,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In NUMA mode (see the
+// \c BLAZE_USE_NUMA command line argument), the elements of built-in data type are initialized
+// in parallel in order to place the memory pages on the NUMA nodes of the threads that work on
+// them in subsequent parallel operations.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
@@ -2736,13 +2798,24 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i )
-         v_[i+j*mm_] = init;
+   if( BLAZE_NUMA_MODE && IsBuiltin<Type>::value ) {
+      smpFill( *this, init );
 
       if( IsVectorizable<Type>::value ) {
-         for( size_t i=m_; i<mm_; ++i )
-            v_[i+j*mm_] = Type();
+         for( size_t j=0UL; j<n_; ++j )
+            for( size_t i=m_; i<mm_; ++i )
+               v_[i+j*mm_] = Type();
+      }
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i )
+            v_[i+j*mm_] = init;
+
+         if( IsVectorizable<Type>::value ) {
+            for( size_t i=m_; i<mm_; ++i )
+               v_[i+j*mm_] = Type();
+         }
       }
    }
 }
@@ -2851,7 +2924,8 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[M][N] )
 // \param m Matrix to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. In NUMA mode (see the \c BLAZE_USE_NUMA
+// command line argument), the elements of built-in data type are copied in parallel.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
@@ -2863,8 +2937,19 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = m.v_[i];
+   if( BLAZE_NUMA_MODE && IsBuiltin<Type>::value ) {
+      smpAssign( *this, m );
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t j=0UL; j<n_; ++j )
+            for( size_t i=m_; i<mm_; ++i )
+               v_[i+j*mm_] = Type();
+      }
+   }
+   else {
+      for( size_t i=0UL; i<capacity_; ++i )
+         v_[i] = m.v_[i];
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -2875,6 +2960,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
 /*!\brief Conversion constructor from different matrices.
 //
 // \param m Matrix to be copied.
+//
+// In NUMA mode (see the \c BLAZE_USE_NUMA command line argument), the elements of built-in
+// data type are initialized in parallel.
 */
 template< typename Type >  // Data type of the matrix
 template< typename MT      // Type of the foreign matrix
@@ -2886,14 +2974,28 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=( IsSparseMatrix<MT>::value   ? 0UL : m_ );
-                  i<( IsVectorizable<Type>::value ? mm_ : m_ ); ++i ) {
-         v_[i+j*mm_] = Type();
+   if( BLAZE_NUMA_MODE && IsBuiltin<Type>::value ) {
+      if( IsSparseMatrix<MT>::value )
+         smpFill( *this, Type() );
+
+      smpAssign( *this, ~m );
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t j=0UL; j<n_; ++j )
+            for( size_t i=m_; i<mm_; ++i )
+               v_[i+j*mm_] = Type();
       }
    }
+   else {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=( IsSparseMatrix<MT>::value   ? 0UL : m_ );
+                     i<( IsVectorizable<Type>::value ? mm_ : m_ ); ++i ) {
+            v_[i+j*mm_] = Type();
+         }
+      }
 
-   smpAssign( *this, ~m );
+      smpAssign( *this, ~m );
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -63,6 +63,7 @@
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
@@ -79,6 +80,7 @@
 #include <blaze/util/Null.h>
 #include <blaze/util/Template.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
@@ -475,7 +477,10 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 // \param n The size of the vector.
 // \param init The initial value of the vector elements.
 //
-// All vector elements are initialized with the specified value.
+// All vector elements are initialized with the specified value. In NUMA mode (see the
+// \c BLAZE_USE_NUMA command line argument), the elements of built-in data type are initialized
+// in parallel in order to place the memory pages on the NUMA nodes of the threads that work on
+// them in subsequent parallel operations.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -484,8 +489,13 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   if( BLAZE_NUMA_MODE && IsBuiltin<Type>::value ) {
+      smpFill( *this, init );
+   }
+   else {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+   }
 
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -577,7 +587,8 @@ inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[N] )
 // \param v Vector to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. In NUMA mode (see the \c BLAZE_USE_NUMA
+// command line argument), the elements of built-in data type are copied in parallel.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -588,8 +599,16 @@ inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= v.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = v.v_[i];
+   if( BLAZE_NUMA_MODE && IsBuiltin<Type>::value ) {
+      smpAssign( *this, v );
+
+      for( size_t i=size_; i<capacity_; ++i )
+         v_[i] = v.v_[i];
+   }
+   else {
+      for( size_t i=0UL; i<capacity_; ++i )
+         v_[i] = v.v_[i];
+   }
 }
 //*************************************************************************************************
 
@@ -0,0 +1,515 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MMM.h
+//  \brief Header file for the cache-blocked dense matrix/dense matrix multiplication kernel
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MMM_H_
+#define _BLAZE_MATH_DENSE_MMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BLOCKING PARAMETERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocking parameters of the cache-blocked dense matrix/dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// The MMMBlocking class template defines the block sizes of the cache-blocked multiplication
+// kernel for the given element type. The \a mr x \a nr register block is processed by the
+// micro kernel, \a kc determines the depth of the packed panels (which should fit into the L1
+// cache), \a mc the number of rows of the packed block of the left-hand side operand (which
+// should fit into the L2 cache), and \a nc the number of columns of the packed block of the
+// right-hand side operand (which should fit into the last level cache as specified by the
+// \a cacheSize setting).
+*/
+template< typename Type >  // Data type of the matrix elements
+struct MMMBlocking
+{
+ private:
+   //**********************************************************************************************
+   enum { kcTmp = 256UL,
+          mcTmp = cacheSize / ( 12UL * kcTmp * sizeof(Type) ),
+          ncTmp = cacheSize / (  2UL * kcTmp * sizeof(Type) ) };
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   enum { mr = 4UL,
+          nr = 2UL * IntrinsicTrait<Type>::size,
+          kc = kcTmp,
+          mc = ( mcTmp > mr )?( mcTmp - mcTmp % mr ):( mr ),
+          nc = ( ncTmp > nr )?( ncTmp - ncTmp % nr ):( nr ) };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of a row-major left-hand side multiplication operand.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side dense matrix operand.
+// \param ap Pointer to the first element of the packing buffer.
+// \param ii The index of the first row of the block.
+// \param m The number of rows of the block.
+// \param kk The index of the first column of the block.
+// \param k The number of columns of the block.
+// \return void
+//
+// This function packs the \a m x \a k block starting at element (\a ii,\a kk) into panels of
+// \a mr rows. Within each panel the elements are stored column by column. The last panel is
+// padded with zeros.
+*/
+template< typename MT    // Type of the left-hand side dense matrix
+        , typename ET >  // Type of the packed elements
+inline void mmmPackLeft( const DenseMatrix<MT,false>& A, ET* ap,
+                         size_t ii, size_t m, size_t kk, size_t k )
+{
+   const size_t mr( MMMBlocking<ET>::mr );
+
+   for( size_t i=0UL; i<m; i+=mr, ap+=mr*k )
+   {
+      const size_t rows( min( mr, m-i ) );
+
+      for( size_t r=0UL; r<rows; ++r ) {
+         for( size_t l=0UL; l<k; ++l ) {
+            ap[l*mr+r] = (~A)(ii+i+r,kk+l);
+         }
+      }
+      for( size_t r=rows; r<mr; ++r ) {
+         for( size_t l=0UL; l<k; ++l ) {
+            ap[l*mr+r] = ET();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of a column-major left-hand side multiplication operand.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side dense matrix operand.
+// \param ap Pointer to the first element of the packing buffer.
+// \param ii The index of the first row of the block.
+// \param m The number of rows of the block.
+// \param kk The index of the first column of the block.
+// \param k The number of columns of the block.
+// \return void
+//
+// This function packs the \a m x \a k block starting at element (\a ii,\a kk) into panels of
+// \a mr rows. Within each panel the elements are stored column by column. The last panel is
+// padded with zeros.
+*/
+template< typename MT    // Type of the left-hand side dense matrix
+        , typename ET >  // Type of the packed elements
+inline void mmmPackLeft( const DenseMatrix<MT,true>& A, ET* ap,
+                         size_t ii, size_t m, size_t kk, size_t k )
+{
+   const size_t mr( MMMBlocking<ET>::mr );
+
+   for( size_t i=0UL; i<m; i+=mr )
+   {
+      const size_t rows( min( mr, m-i ) );
+
+      for( size_t l=0UL; l<k; ++l, ap+=mr ) {
+         for( size_t r=0UL; r<rows; ++r ) {
+            ap[r] = (~A)(ii+i+r,kk+l);
+         }
+         for( size_t r=rows; r<mr; ++r ) {
+            ap[r] = ET();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of a row-major right-hand side multiplication operand.
+// \ingroup dense_matrix
+//
+// \param B The right-hand side dense matrix operand.
+// \param bp Pointer to the first element of the packing buffer.
+// \param kk The index of the first row of the block.
+// \param k The number of rows of the block.
+// \param jj The index of the first column of the block.
+// \param n The number of columns of the block.
+// \return void
+//
+// This function packs the \a k x \a n block starting at element (\a kk,\a jj) into panels of
+// \a nr columns. Within each panel the elements are stored row by row. The last panel is
+// padded with zeros.
+*/
+template< typename MT    // Type of the right-hand side dense matrix
+        , typename ET >  // Type of the packed elements
+inline void mmmPackRight( const DenseMatrix<MT,false>& B, ET* bp,
+                          size_t kk, size_t k, size_t jj, size_t n )
+{
+   const size_t nr( MMMBlocking<ET>::nr );
+
+   for( size_t j=0UL; j<n; j+=nr )
+   {
+      const size_t columns( min( nr, n-j ) );
+
+      for( size_t l=0UL; l<k; ++l, bp+=nr ) {
+         for( size_t c=0UL; c<columns; ++c ) {
+            bp[c] = (~B)(kk+l,jj+j+c);
+         }
+         for( size_t c=columns; c<nr; ++c ) {
+            bp[c] = ET();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of a column-major right-hand side multiplication operand.
+// \ingroup dense_matrix
+//
+// \param B The right-hand side dense matrix operand.
+// \param bp Pointer to the first element of the packing buffer.
+// \param kk The index of the first row of the block.
+// \param k The number of rows of the block.
+// \param jj The index of the first column of the block.
+// \param n The number of columns of the block.
+// \return void
+//
+// This function packs the \a k x \a n block starting at element (\a kk,\a jj) into panels of
+// \a nr columns. Within each panel the elements are stored row by row. The last panel is
+// padded with zeros.
+*/
+template< typename MT    // Type of the right-hand side dense matrix
+        , typename ET >  // Type of the packed elements
+inline void mmmPackRight( const DenseMatrix<MT,true>& B, ET* bp,
+                          size_t kk, size_t k, size_t jj, size_t n )
+{
+   const size_t nr( MMMBlocking<ET>::nr );
+
+   for( size_t j=0UL; j<n; j+=nr, bp+=nr*k )
+   {
+      const size_t columns( min( nr, n-j ) );
+
+      for( size_t c=0UL; c<columns; ++c ) {
+         for( size_t l=0UL; l<k; ++l ) {
+            bp[l*nr+c] = (~B)(kk+l,jj+j+c);
+         }
+      }
+      for( size_t c=columns; c<nr; ++c ) {
+         for( size_t l=0UL; l<k; ++l ) {
+            bp[l*nr+c] = ET();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MICRO KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register-blocked micro kernel of the cache-blocked multiplication.
+// \ingroup dense_matrix
+//
+// \param ap Pointer to the packed \a mr x \a k panel of the left-hand side operand.
+// \param bp Pointer to the packed \a k x \a nr panel of the right-hand side operand.
+// \param k The depth of the two panels.
+// \param ct Pointer to the aligned \a mr x \a nr result buffer.
+// \return void
+//
+// This function computes the product of a packed panel of the left-hand side operand and a
+// packed panel of the right-hand side operand. The resulting \a mr x \a nr block is kept in
+// registers during the computation and is finally stored row by row in the given buffer.
+*/
+template< typename ET >  // Type of the packed elements
+BLAZE_ALWAYS_INLINE void mmmKernel( const ET* ap, const ET* bp, size_t k, ET* ct )
+{
+   typedef IntrinsicTrait<ET>        IT;
+   typedef typename IT::Type         IntrinsicType;
+   typedef MMMBlocking<ET>           Blocking;
+
+   BLAZE_STATIC_ASSERT( Blocking::mr == 4UL && Blocking::nr == 2UL*IT::size );
+
+   IntrinsicType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+   for( size_t l=0UL; l<k; ++l ) {
+      const IntrinsicType b1( load( bp          ) );
+      const IntrinsicType b2( load( bp+IT::size ) );
+      const IntrinsicType a1( set( ap[0] ) );
+      const IntrinsicType a2( set( ap[1] ) );
+      const IntrinsicType a3( set( ap[2] ) );
+      const IntrinsicType a4( set( ap[3] ) );
+      xmm1 = fmadd( a1, b1, xmm1 );
+      xmm2 = fmadd( a1, b2, xmm2 );
+      xmm3 = fmadd( a2, b1, xmm3 );
+      xmm4 = fmadd( a2, b2, xmm4 );
+      xmm5 = fmadd( a3, b1, xmm5 );
+      xmm6 = fmadd( a3, b2, xmm6 );
+      xmm7 = fmadd( a4, b1, xmm7 );
+      xmm8 = fmadd( a4, b2, xmm8 );
+      ap += Blocking::mr;
+      bp += Blocking::nr;
+   }
+
+   store( ct                              , xmm1 );
+   store( ct+IT::size                     , xmm2 );
+   store( ct+Blocking::nr                 , xmm3 );
+   store( ct+Blocking::nr+IT::size        , xmm4 );
+   store( ct+Blocking::nr*2UL             , xmm5 );
+   store( ct+Blocking::nr*2UL+IT::size    , xmm6 );
+   store( ct+Blocking::nr*3UL             , xmm7 );
+   store( ct+Blocking::nr*3UL+IT::size    , xmm8 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a block of a row-major target matrix with the result of the micro kernel.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param ct Pointer to the \a mr x \a nr result buffer of the micro kernel.
+// \param i The index of the first row of the block.
+// \param rows The number of valid rows of the block.
+// \param j The index of the first column of the block.
+// \param columns The number of valid columns of the block.
+// \param alpha The scaling factor of the update.
+// \return void
+*/
+template< typename MT    // Type of the target dense matrix
+        , typename ET    // Type of the buffered elements
+        , typename ST >  // Type of the scaling factor
+inline void mmmUpdate( DenseMatrix<MT,false>& C, const ET* ct,
+                       size_t i, size_t rows, size_t j, size_t columns, ST alpha )
+{
+   const size_t nr( MMMBlocking<ET>::nr );
+
+   for( size_t r=0UL; r<rows; ++r ) {
+      for( size_t c=0UL; c<columns; ++c ) {
+         (~C)(i+r,j+c) += alpha * ct[r*nr+c];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a block of a column-major target matrix with the result of the micro kernel.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param ct Pointer to the \a mr x \a nr result buffer of the micro kernel.
+// \param i The index of the first row of the block.
+// \param rows The number of valid rows of the block.
+// \param j The index of the first column of the block.
+// \param columns The number of valid columns of the block.
+// \param alpha The scaling factor of the update.
+// \return void
+*/
+template< typename MT    // Type of the target dense matrix
+        , typename ET    // Type of the buffered elements
+        , typename ST >  // Type of the scaling factor
+inline void mmmUpdate( DenseMatrix<MT,true>& C, const ET* ct,
+                       size_t i, size_t rows, size_t j, size_t columns, ST alpha )
+{
+   const size_t nr( MMMBlocking<ET>::nr );
+
+   for( size_t c=0UL; c<columns; ++c ) {
+      for( size_t r=0UL; r<rows; ++r ) {
+         (~C)(i+r,j+c) += alpha * ct[r*nr+c];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CACHE-BLOCKED DENSE MATRIX/DENSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Cache-blocked dense matrix/dense matrix multiplication (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor.
+// \return void
+//
+// This function adds the scaled product of the two dense matrices \a A and \a B to the dense
+// matrix \a C. It follows the layered approach of Goto and van de Geijn: the right-hand side
+// operand is packed into row panels of depth \a kc and width \a nc that remain in the last level
+// cache, the left-hand side operand is packed into \a mc x \a kc blocks that remain in the L2
+// cache, and a vectorized micro kernel computes \a mr x \a nr blocks of the result from the
+// packed data while keeping them in registers. The block sizes are evaluated by MMMBlocking
+// based on the \a cacheSize setting. Blocks that are known to be zero due to triangular
+// operands are skipped. All three matrices must have the same, vectorizable element type.
+// Note that this function assumes that \a C is not aliased with either \a A or \a B.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+void mmm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+          const DenseMatrix<MT3,SO3>& B, ST alpha )
+{
+   typedef typename MT1::ElementType  ET;
+   typedef MMMBlocking<ET>            Blocking;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, typename MT2::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, typename MT3::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~C).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~B).columns() == (~C).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   const size_t M( (~A).rows()    );
+   const size_t N( (~B).columns() );
+   const size_t K( (~A).columns() );
+
+   if( M == 0UL || N == 0UL || K == 0UL )
+      return;
+
+   const size_t mr( Blocking::mr );
+   const size_t nr( Blocking::nr );
+   const size_t kc( min( size_t( Blocking::kc ), K ) );
+   const size_t mc( min( size_t( Blocking::mc ), M + ( mr - M % mr ) % mr ) );
+   const size_t nc( min( size_t( Blocking::nc ), N + ( nr - N % nr ) % nr ) );
+
+   UniqueArray<ET,Deallocate> ap( allocate<ET>( mc*kc ) );
+   UniqueArray<ET,Deallocate> bp( allocate<ET>( kc*nc ) );
+   AlignedArray<ET,Blocking::mr*Blocking::nr> ct;
+
+   for( size_t jj=0UL; jj<N; jj+=nc )
+   {
+      const size_t n( min( nc, N-jj ) );
+
+      const size_t kbegin( ( IsLower<MT3>::value )?( jj ):( 0UL ) );
+      const size_t kend  ( ( IsUpper<MT3>::value )?( min( jj+n, K ) ):( K ) );
+
+      for( size_t kk=kbegin-kbegin%kc; kk<kend; kk+=kc )
+      {
+         const size_t k( min( kc, K-kk ) );
+
+         mmmPackRight( ~B, bp.get(), kk, k, jj, n );
+
+         for( size_t ii=0UL; ii<M; ii+=mc )
+         {
+            const size_t m( min( mc, M-ii ) );
+
+            if( ( IsLower<MT2>::value && kk >= ii+m ) || ( IsUpper<MT2>::value && kk+k <= ii ) )
+               continue;
+
+            mmmPackLeft( ~A, ap.get(), ii, m, kk, k );
+
+            for( size_t j=0UL; j<n; j+=nr ) {
+               for( size_t i=0UL; i<m; i+=mr ) {
+                  mmmKernel( ap.get()+i*k, bp.get()+j*k, k, &ct[0] );
+                  mmmUpdate( C, &ct[0], ii+i, min( mr, m-i ), jj+j, min( nr, n-j ), alpha );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -645,14 +646,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -686,14 +687,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -716,10 +717,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -747,10 +748,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -769,8 +770,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -792,8 +793,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -808,7 +809,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -907,8 +908,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      reset( ~C );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -924,8 +925,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a small dense
-   // matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default assignment of a dense matrix-dense matrix
+   // multiplication expression to a column-major dense matrix. This kernel is optimized for large
+   // matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -933,7 +935,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAssignKernel( ~C, A, B );
+      reset( ~C );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1382,14 +1385,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -1430,14 +1433,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -1463,10 +1466,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -1497,10 +1500,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -1520,8 +1523,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -1544,8 +1547,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -1560,7 +1563,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1660,8 +1663,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1677,8 +1679,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the addition assignment of a small
-   // dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default addition assignment of a dense matrix-dense
+   // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
+   // large matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1686,7 +1689,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2110,14 +2113,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 - a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 - a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 - a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 - a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fnmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fnmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fnmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fnmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2158,14 +2161,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a1 * b3;
-               xmm4 = xmm4 - a1 * b4;
-               xmm5 = xmm5 - a2 * b1;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a2 * b3;
-               xmm8 = xmm8 - a2 * b4;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a1, b3, xmm3 );
+               xmm4 = fnmadd( a1, b4, xmm4 );
+               xmm5 = fnmadd( a2, b1, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a2, b3, xmm7 );
+               xmm8 = fnmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -2191,10 +2194,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2225,10 +2228,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a2 * b1;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a2, b1, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -2248,8 +2251,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j         );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size);
+               xmm1 = fnmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -2272,8 +2275,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 - set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 - set( A(i+1UL,k) ) * b1;
+               xmm1 = fnmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fnmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -2288,7 +2291,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - set( A(i,k) ) * B.load(k,j);
+               xmm1 = fnmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -2388,8 +2391,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2405,8 +2407,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a small
-   // dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default subtraction assignment of a dense matrix-
+   // dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2414,7 +2417,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3499,14 +3502,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -3540,14 +3543,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 * factor );
@@ -3570,10 +3573,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -3601,10 +3604,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 * factor );
@@ -3623,8 +3626,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 * factor );
@@ -3646,8 +3649,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 * factor );
@@ -3662,7 +3665,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -3762,8 +3765,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      reset( ~C );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -3778,8 +3781,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a small scaled
-   // dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default assignment of a scaled dense matrix-dense
+   // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
+   // large matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -3788,7 +3792,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      reset( ~C );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4207,14 +4212,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
@@ -4248,14 +4253,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , (~C).load(i    ,j             ) + xmm1 * factor );
@@ -4278,10 +4283,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
@@ -4309,10 +4314,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
             (~C).store( i    , j         , (~C).load(i    ,j         ) + xmm1 * factor );
             (~C).store( i    , j+IT::size, (~C).load(i    ,j+IT::size) + xmm2 * factor );
@@ -4330,8 +4335,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , (~C).load(i,j         ) + xmm1 * factor );
@@ -4353,8 +4358,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, (~C).load(i    ,j) + xmm1 * factor );
@@ -4369,7 +4374,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
@@ -4469,8 +4474,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4485,8 +4489,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the addition assignment of a small
-   // scaled dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default addition assignment of a scaled dense
+   // matrix-dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -4495,7 +4500,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4890,14 +4895,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
@@ -4931,14 +4936,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , (~C).load(i    ,j             ) - xmm1 * factor );
@@ -4961,10 +4966,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
@@ -4992,10 +4997,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , (~C).load(i    ,j         ) - xmm1 * factor );
@@ -5014,8 +5019,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , (~C).load(i,j         ) - xmm1 * factor );
@@ -5037,8 +5042,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, (~C).load(i    ,j) - xmm1 * factor );
@@ -5053,7 +5058,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
@@ -5152,8 +5157,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar );
    }
    //**********************************************************************************************
 
@@ -5168,8 +5172,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a small
-   // scaled dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default subtraction assignment of a scaled dense
+   // matrix-dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5178,7 +5183,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar );
    }
    //**********************************************************************************************
 
@@ -562,14 +562,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -592,10 +592,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -614,9 +614,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -634,8 +634,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -651,7 +651,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] = sum( xmm1 );
@@ -1209,14 +1209,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1239,10 +1239,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1261,9 +1261,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1281,8 +1281,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1298,7 +1298,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] += sum( xmm1 );
@@ -1832,14 +1832,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1862,10 +1862,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1884,9 +1884,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1904,8 +1904,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1921,7 +1921,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] -= sum( xmm1 );
@@ -3006,14 +3006,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3036,10 +3036,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3058,9 +3058,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3078,8 +3078,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3095,7 +3095,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] = sum( xmm1 ) * scalar;
@@ -3671,14 +3671,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3701,10 +3701,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3723,9 +3723,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3743,8 +3743,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3760,7 +3760,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] += sum( xmm1 ) * scalar;
@@ -4295,14 +4295,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4325,10 +4325,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4347,9 +4347,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4367,8 +4367,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4384,7 +4384,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] -= sum( xmm1 ) * scalar;
@@ -0,0 +1,671 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatReduceExpr.h
+//  \brief Header file for the dense matrix reduction expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dense/DenseVector.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecDVecMapExpr.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatReduceExpr.h>
+#include <blaze/math/Functors.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/views/AlignmentFlag.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DMATREDUCEEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the row-wise and column-wise reduction of dense matrices.
+// \ingroup dense_vector_expression
+//
+// The DMatReduceExpr class represents the compile time expression for the row-wise and
+// column-wise reduction of a dense matrix by means of a custom reduction operation (as for
+// instance by the sum<rowwise>() or max<columnwise>() functions). A row-wise reduction results
+// in a column vector, a column-wise reduction in a row vector.
+*/
+template< typename MT  // Type of the dense matrix
+        , typename OP  // Type of the reduction operation
+        , bool RF >    // Reduction flag
+class DMatReduceExpr : public DenseVector< DMatReduceExpr<MT,OP,RF>, !RF >
+                     , private MatReduceExpr
+                     , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ResultType     RT;  //!< Result type of the dense matrix expression.
+   typedef typename MT::CompositeType  CT;  //!< Composite type of the dense matrix expression.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DMatReduceExpr<MT,OP,RF>  This;  //!< Type of this DMatReduceExpr instance.
+
+   //! Result type for expression template evaluations.
+   typedef typename SelectType< RF, typename ColumnTrait<RT>::Type
+                                  , typename RowTrait<RT>::Type >::Type  ResultType;
+
+   typedef typename ResultType::TransposeType  TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef typename ResultType::ElementType    ElementType;    //!< Resulting element type.
+   typedef const ElementType                   ReturnType;     //!< Return type for expression template evaluations.
+   typedef const ResultType                    CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite data type of the dense matrix expression.
+   typedef typename SelectType< IsExpression<MT>::value, const MT, const MT& >::Type  Operand;
+
+   //! Data type of the custom reduction operation.
+   typedef OP  Operation;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum { vectorizable = 0 };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum { smpAssignable = MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatReduceExpr class.
+   //
+   // \param dm The dense matrix operand of the reduction expression.
+   // \param op The custom reduction operation.
+   */
+   explicit inline DMatReduceExpr( const MT& dm, OP op )
+      : dm_( dm )  // Dense matrix of the reduction expression
+      , op_( op )  // The custom reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < size(), "Invalid vector access index" );
+      if( RF == rowwise )
+         return serialReduce( row( dm_, index ), op_ );
+      else
+         return serialReduce( column( dm_, index ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const {
+      return ( RF == rowwise )?( dm_.rows() ):( dm_.columns() );
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense matrix operand.
+   //
+   // \return The dense matrix operand.
+   */
+   inline Operand operand() const {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the custom reduction operation.
+   //
+   // \return A copy of the custom reduction operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an aliasing effect is possible, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const {
+      return dm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const {
+      return dm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return ( size() > SMP_DMATREDUCE_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand   dm_;  //!< Dense matrix of the reduction expression.
+   Operation op_;  //!< The custom reduction operation.
+   //**********************************************************************************************
+
+   //**Combination of matrix columns**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Elementwise combination of all columns of the given dense matrix.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense column vector.
+   // \param A The evaluated dense matrix operand.
+   // \param op The reduction operation.
+   // \return void
+   //
+   // This function computes the row-wise reduction of a column-major dense matrix by means of
+   // an elementwise combination of its columns.
+   */
+   template< typename VT1    // Type of the target dense vector
+           , typename MT2 >  // Type of the evaluated dense matrix
+   static inline void combine( DenseVector<VT1,false>& lhs, const MT2& A, OP op )
+   {
+      assign( ~lhs, column( A, 0UL ) );
+      for( size_t j=1UL; j<A.columns(); ++j )
+         assign( ~lhs, map( ~lhs, column( A, j ), op ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Combination of matrix rows******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Elementwise combination of all rows of the given dense matrix.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense row vector.
+   // \param A The evaluated dense matrix operand.
+   // \param op The reduction operation.
+   // \return void
+   //
+   // This function computes the column-wise reduction of a row-major dense matrix by means of
+   // an elementwise combination of its rows.
+   */
+   template< typename VT1    // Type of the target dense vector
+           , typename MT2 >  // Type of the evaluated dense matrix
+   static inline void combine( DenseVector<VT1,true>& lhs, const MT2& A, OP op )
+   {
+      assign( ~lhs, row( A, 0UL ) );
+      for( size_t i=1UL; i<A.rows(); ++i )
+         assign( ~lhs, map( ~lhs, row( A, i ), op ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix reduction expression to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix reduction
+   // expression to a dense vector. In case the reduction direction matches the storage order of
+   // the matrix (i.e. a row-wise reduction of a row-major matrix or a column-wise reduction of
+   // a column-major matrix), each single row/column is reduced individually. Otherwise the
+   // rows/columns are combined elementwise, which enables the vectorization of the reduction.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,!RF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() == 0UL ) {
+         return;
+      }
+      else if( ( RF == rowwise )?( rhs.dm_.columns() == 0UL ):( rhs.dm_.rows() == 0UL ) ) {
+         for( size_t i=0UL; i<rhs.size(); ++i )
+            (~lhs)[i] = emptyReduction<ElementType>( rhs.op_ );
+         return;
+      }
+
+      CT A( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.dm_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.dm_.columns(), "Invalid number of columns" );
+
+      if( RF == rowwise && IsRowMajorMatrix<MT>::value ) {
+         for( size_t i=0UL; i<A.rows(); ++i )
+            (~lhs)[i] = serialReduce( row( A, i ), rhs.op_ );
+      }
+      else if( RF == columnwise && !IsRowMajorMatrix<MT>::value ) {
+         for( size_t j=0UL; j<A.columns(); ++j )
+            (~lhs)[j] = serialReduce( column( A, j ), rhs.op_ );
+      }
+      else {
+         combine( ~lhs, A, rhs.op_ );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix reduction expression to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix reduction
+   // expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,!RF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense matrix reduction expression to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense matrix
+   // reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,!RF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix reduction expression to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense
+   // matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,!RF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a dense matrix reduction expression to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a dense
+   // matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,!RF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Performs a row-wise or column-wise reduction of the given dense matrix \a dm.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The row-wise or column-wise reduction of the given matrix.
+//
+// This function reduces the rows or columns of the given dense matrix \a dm by means of the
+// given reduction operation \a op. In case the reduction flag \a RF is set to \a rowwise, each
+// row is reduced to a single element and the result is a column vector. In case \a RF is set
+// to \a columnwise, each column is reduced and the result is a row vector:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double,columnVector> rs;
+   blaze::DynamicVector<double,rowVector> cs;
+   // ... Resizing and initialization
+
+   rs = reduce<rowwise>( A, blaze::Add() );         // Computes the row sums
+   cs = reduce<columnwise>( A, blaze::Maximum() );  // Computes the column maxima
+   \endcode
+
+// The reduction operation has to be associative and commutative. In case it provides an
+// intrinsic evaluation (see the \a SIMDEnabled class template and the load() function of the
+// predefined functors), the reduction is vectorized.
+*/
+template< bool RF        // Reduction flag
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline const DMatReduceExpr<MT,OP,RF> reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatReduceExpr<MT,OP,RF>( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix row-wise or column-wise by means of addition.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \return The row-wise or column-wise sums of the given matrix.
+
+   \code
+   blaze::DynamicMatrix<int> A( 2UL, 3UL );
+   blaze::DynamicVector<int,columnVector> rs;
+   blaze::DynamicVector<int,rowVector> cs;
+   // ... Initialization
+
+   rs = sum<rowwise>( A );     // The sums of the two rows
+   cs = sum<columnwise>( A );  // The sums of the three columns
+   \endcode
+*/
+template< bool RF      // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatReduceExpr<MT,Add,RF> sum( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatReduceExpr<MT,Add,RF>( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix row-wise or column-wise by means of multiplication.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \return The row-wise or column-wise products of the given matrix.
+
+   \code
+   blaze::DynamicMatrix<int> A( 2UL, 3UL );
+   blaze::DynamicVector<int,columnVector> rp;
+   blaze::DynamicVector<int,rowVector> cp;
+   // ... Initialization
+
+   rp = prod<rowwise>( A );     // The products of the two rows
+   cp = prod<columnwise>( A );  // The products of the three columns
+   \endcode
+*/
+template< bool RF      // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatReduceExpr<MT,Mult,RF> prod( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatReduceExpr<MT,Mult,RF>( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of each row or column of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \return The row-wise or column-wise minima of the given matrix.
+
+   \code
+   blaze::DynamicMatrix<int> A( 2UL, 3UL );
+   blaze::DynamicVector<int,columnVector> rmin;
+   blaze::DynamicVector<int,rowVector> cmin;
+   // ... Initialization
+
+   rmin = min<rowwise>( A );     // The minima of the two rows
+   cmin = min<columnwise>( A );  // The minima of the three columns
+   \endcode
+*/
+template< bool RF      // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatReduceExpr<MT,Minimum,RF> min( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatReduceExpr<MT,Minimum,RF>( ~dm, Minimum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of each row or column of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \return The row-wise or column-wise maxima of the given matrix.
+
+   \code
+   blaze::DynamicMatrix<int> A( 2UL, 3UL );
+   blaze::DynamicVector<int,columnVector> rmax;
+   blaze::DynamicVector<int,rowVector> cmax;
+   // ... Initialization
+
+   rmax = max<rowwise>( A );     // The maxima of the two rows
+   cmax = max<columnwise>( A );  // The maxima of the three columns
+   \endcode
+*/
+template< bool RF      // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatReduceExpr<MT,Maximum,RF> max( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatReduceExpr<MT,Maximum,RF>( ~dm, Maximum() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP, bool AF >
+struct SubvectorExprTrait< DMatReduceExpr<MT,OP,rowwise>, AF >
+{
+ public:
+   //**********************************************************************************************
+   typedef DMatReduceExpr< typename SubmatrixExprTrait<const MT,unaligned>::Type, OP, rowwise >  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP, bool AF >
+struct SubvectorExprTrait< DMatReduceExpr<MT,OP,columnwise>, AF >
+{
+ public:
+   //**********************************************************************************************
+   typedef DMatReduceExpr< typename SubmatrixExprTrait<const MT,unaligned>::Type, OP, columnwise >  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
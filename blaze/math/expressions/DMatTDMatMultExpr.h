@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -623,14 +624,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -657,10 +658,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -679,8 +680,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -702,10 +703,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -724,8 +725,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -740,7 +741,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 );
@@ -799,14 +800,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -829,10 +830,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -860,10 +861,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -882,8 +883,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -905,8 +906,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -921,7 +922,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 );
@@ -977,8 +978,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      reset( ~C );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1004,8 +1005,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      reset( ~C );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1414,14 +1415,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1448,10 +1449,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1470,8 +1471,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -1492,10 +1493,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -1514,8 +1515,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -1530,7 +1531,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 );
@@ -1589,14 +1590,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1619,10 +1620,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -1650,10 +1651,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1672,8 +1673,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -1695,8 +1696,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -1711,7 +1712,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 );
@@ -1767,8 +1768,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1794,8 +1794,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2179,14 +2178,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2213,10 +2212,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2235,8 +2234,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -2258,10 +2257,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -2280,8 +2279,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -2296,7 +2295,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 );
@@ -2355,14 +2354,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2385,10 +2384,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -2416,10 +2415,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2438,8 +2437,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -2460,8 +2459,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -2476,7 +2475,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 );
@@ -2532,8 +2531,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2559,8 +2557,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3470,14 +3467,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3504,10 +3501,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3526,8 +3523,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -3549,10 +3546,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -3571,8 +3568,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -3587,7 +3584,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 ) * scalar;
@@ -3646,14 +3643,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3676,10 +3673,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -3707,10 +3704,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3729,8 +3726,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -3752,8 +3749,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -3768,7 +3765,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 ) * scalar;
@@ -3824,8 +3821,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      reset( ~C );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -3851,8 +3848,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      reset( ~C );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4238,14 +4235,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4272,10 +4269,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4294,8 +4291,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -4317,10 +4314,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -4339,8 +4336,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -4355,7 +4352,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 ) * scalar;
@@ -4414,14 +4411,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4444,10 +4441,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -4475,10 +4472,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4497,8 +4494,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -4520,8 +4517,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -4536,7 +4533,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 ) * scalar;
@@ -4592,8 +4589,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4619,8 +4615,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4983,14 +4978,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5017,10 +5012,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5039,8 +5034,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -5062,10 +5057,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -5084,8 +5079,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -5100,7 +5095,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 ) * scalar;
@@ -5160,14 +5155,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5190,10 +5185,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -5221,10 +5216,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5243,8 +5238,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -5266,8 +5261,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -5282,7 +5277,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 ) * scalar;
@@ -5338,8 +5333,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar );
    }
    //**********************************************************************************************
 
@@ -5365,8 +5359,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar );
    }
    //**********************************************************************************************
 
@@ -48,10 +48,13 @@ template< typename, bool > struct DenseMatrix;
 template< typename, bool > struct DenseVector;
 template< typename, bool > class DMatAbsExpr;
 template< typename, typename, bool > class DMatDMatAddExpr;
+template< typename, typename, typename, bool > class DMatDMatMapExpr;
 template< typename, typename > class DMatDMatMultExpr;
 template< typename, typename, bool > class DMatDMatSubExpr;
 template< typename, typename > class DMatDVecMultExpr;
 template< typename, bool > class DMatEvalExpr;
+template< typename, typename, bool > class DMatMapExpr;
+template< typename, typename, bool > class DMatReduceExpr;
 template< typename, typename, bool > class DMatScalarDivExpr;
 template< typename, typename, bool > class DMatScalarMultExpr;
 template< typename, bool > class DMatSerialExpr;
@@ -70,9 +73,11 @@ template< typename, typename > class DMatTSMatSubExpr;
 template< typename, bool > class DVecAbsExpr;
 template< typename, typename, bool > class DVecDVecAddExpr;
 template< typename, typename > class DVecDVecCrossExpr;
+template< typename, typename, typename, bool > class DVecDVecMapExpr;
 template< typename, typename, bool > class DVecDVecMultExpr;
 template< typename, typename, bool > class DVecDVecSubExpr;
 template< typename, bool > class DVecEvalExpr;
+template< typename, typename, bool > class DVecMapExpr;
 template< typename, typename, bool > class DVecScalarDivExpr;
 template< typename, typename, bool > class DVecScalarMultExpr;
 template< typename, bool > class DVecSerialExpr;
@@ -90,6 +95,7 @@ template< typename, typename > class SMatDMatMultExpr;
 template< typename, typename, bool > class SMatDMatSubExpr;
 template< typename, typename > class SMatDVecMultExpr;
 template< typename, bool > class SMatEvalExpr;
+template< typename, typename, bool > class SMatMapExpr;
 template< typename, typename, bool > class SMatScalarDivExpr;
 template< typename, typename, bool > class SMatScalarMultExpr;
 template< typename, bool > class SMatSerialExpr;
@@ -111,6 +117,7 @@ template< typename, typename > class SVecDVecCrossExpr;
 template< typename, typename, bool > class SVecDVecMultExpr;
 template< typename, typename, bool > class SVecDVecSubExpr;
 template< typename, bool > class SVecEvalExpr;
+template< typename, typename, bool > class SVecMapExpr;
 template< typename, typename, bool > class SVecScalarDivExpr;
 template< typename, typename, bool > class SVecScalarMultExpr;
 template< typename, bool > class SVecSerialExpr;
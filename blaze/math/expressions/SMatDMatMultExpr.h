@@ -65,6 +65,7 @@
 #include <blaze/math/traits/TSVecDMatMultExprTrait.h>
 #include <blaze/math/traits/TSVecSMatMultExprTrait.h>
 #include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsBlockCompressedMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
@@ -164,6 +165,19 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the left-hand side sparse matrix operand is a block compressed matrix, the
+       multiplication is delegated to its register-blocked kernel and the nested \value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseBlockKernel {
+      enum { value = IsBlockCompressedMatrix<T2>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -171,7 +185,8 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
        matrix multiplication, the nested \value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseVectorizedKernel {
-      enum { value = T1::vectorizable && T3::vectorizable &&
+      enum { value = !UseBlockKernel<T1,T2,T3>::value &&
+                     T1::vectorizable && T3::vectorizable &&
                      IsRowMajorMatrix<T1>::value &&
                      IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
                      IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
@@ -190,7 +205,8 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
        it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseOptimizedKernel {
-      enum { value = !UseVectorizedKernel<T1,T2,T3>::value &&
+      enum { value = !UseBlockKernel<T1,T2,T3>::value &&
+                     !UseVectorizedKernel<T1,T2,T3>::value &&
                      !IsResizable<typename T1::ElementType>::value &&
                      !IsResizable<ET1>::value };
    };
@@ -204,7 +220,8 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
        be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseDefaultKernel {
-      enum { value = !UseVectorizedKernel<T1,T2,T3>::value &&
+      enum { value = !UseBlockKernel<T1,T2,T3>::value &&
+                     !UseVectorizedKernel<T1,T2,T3>::value &&
                      !UseOptimizedKernel<T1,T2,T3>::value };
    };
    /*! \endcond */
@@ -671,6 +688,31 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block assignment to row-major dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block assignment of a sparse matrix-dense matrix multiplication to row-major
+   //        dense matrices (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function delegates the sparse matrix-dense matrix multiplication to the register-blocked
+   // kernel of the block compressed matrix operand.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBlockKernel<MT3,MT4,MT5> >::Type
+      selectAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      A.multiply( ~C, B, 0UL, A.blockRows(), typename MT4::Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to column-major dense matrices*******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a sparse matrix-dense matrix multiplication to column-major
@@ -1077,6 +1119,31 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block addition assignment to row-major dense matrices***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block addition assignment of a sparse matrix-dense matrix multiplication to row-major
+   //        dense matrices (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function delegates the sparse matrix-dense matrix multiplication to the register-blocked
+   // kernel of the block compressed matrix operand.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBlockKernel<MT3,MT4,MT5> >::Type
+      selectAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      A.multiply( ~C, B, 0UL, A.blockRows(), typename MT4::AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to column-major dense matrices**********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a sparse matrix-dense matrix multiplication to
@@ -1430,6 +1497,31 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block subtraction assignment to row-major dense matrices************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block subtraction assignment of a sparse matrix-dense matrix multiplication to row-major
+   //        dense matrices (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function delegates the sparse matrix-dense matrix multiplication to the register-blocked
+   // kernel of the block compressed matrix operand.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBlockKernel<MT3,MT4,MT5> >::Type
+      selectSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      A.multiply( ~C, B, 0UL, A.blockRows(), typename MT4::SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to column-major dense matrices*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a sparse matrix-dense matrix multiplication to
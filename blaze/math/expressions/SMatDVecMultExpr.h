@@ -57,9 +57,12 @@
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/IsBlockCompressedMatrix.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsSlicedEllpackMatrix.h>
+#include <blaze/math/typetraits/IsSplitCompressedMatrix.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/typetraits/Size.h>
@@ -119,9 +122,13 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
        the evaluation strategy of the multiplication expression. In case either the matrix or
        the vector operand requires an intermediate evaluation or the dense vector expression
        is a compound expression, \a useAssign will be set to \a true and the multiplication
-       expression will be evaluated via the \a assign function family. Otherwise \a useAssign
-       will be set to \a false and the expression will be evaluated via the subscript operator. */
-   enum { useAssign = evaluateMatrix || evaluateVector };
+       expression will be evaluated via the \a assign function family. The same applies in
+       case the matrix operand is a block compressed, sliced ELLPACK, or split compressed matrix,
+       which provide their own multiplication kernels. Otherwise \a useAssign will be set to
+       \a false and the expression will be evaluated via the subscript operator. */
+   enum { useAssign = evaluateMatrix || evaluateVector ||
+                      IsBlockCompressedMatrix<MT>::value || IsSlicedEllpackMatrix<MT>::value ||
+                      IsSplitCompressedMatrix<MT>::value };
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -142,7 +149,21 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
        evaluation, the nested \value will be set to 1, otherwise it will be 0. */
    template< typename T1 >
    struct UseSMPAssign {
-      enum { value = useAssign };
+      enum { value = evaluateMatrix || evaluateVector };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type is a block compressed, sliced ELLPACK, or split compressed matrix,
+       which provide their own multiplication kernels, the nested \value will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1 >
+   struct UseMultiplyKernel {
+      enum { value = IsBlockCompressedMatrix<T1>::value || IsSlicedEllpackMatrix<T1>::value ||
+                     IsSplitCompressedMatrix<T1>::value };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -388,7 +409,56 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      assign( ~lhs, A * x );
+      SMatDVecMultExpr::selectAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment kernel selection*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an assignment of a sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the default assignment of the multiplication expression.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< UseMultiplyKernel<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      assign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment kernel selection (matrices with multiplication kernel)**************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an assignment of a sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}=A*\vec{x} \f$) for sparse
+   //        matrices with a dedicated multiplication kernel.
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK or split compressed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the multiplication kernel of the sparse matrix.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseMultiplyKernel<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      A.multiply( y, x, 0UL, A.chunks(), typename MT1::Assign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -465,7 +535,56 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      addAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectAddAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment kernel selection********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an addition assignment of a sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the default addition assignment of the multiplication expression.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< UseMultiplyKernel<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      addAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment kernel selection (matrices with multiplication kernel)*****************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an addition assignment of a sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}+=A*\vec{x} \f$) for sparse
+   //        matrices with a dedicated multiplication kernel.
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK or split compressed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the multiplication kernel of the sparse matrix.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseMultiplyKernel<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      A.multiply( y, x, 0UL, A.chunks(), typename MT1::AddAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -512,7 +631,56 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      subAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectSubAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment kernel selection*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for a subtraction assignment of a sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the default subtraction assignment of the multiplication expression.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< UseMultiplyKernel<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      subAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment kernel selection (matrices with multiplication kernel)**************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for a subtraction assignment of a sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$) for sparse
+   //        matrices with a dedicated multiplication kernel.
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK or split compressed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the multiplication kernel of the sparse matrix.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseMultiplyKernel<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      A.multiply( y, x, 0UL, A.chunks(), typename MT1::SubAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -688,14 +689,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -729,14 +730,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -759,10 +760,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -790,10 +791,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -812,8 +813,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -835,8 +836,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -851,7 +852,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -902,14 +903,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -943,14 +944,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -973,10 +974,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1004,10 +1005,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -1026,8 +1027,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -1049,8 +1050,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -1065,7 +1066,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1121,8 +1122,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      reset( ~C );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1148,8 +1149,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      reset( ~C );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1612,14 +1613,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -1660,14 +1661,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -1693,10 +1694,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -1727,10 +1728,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -1750,8 +1751,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -1774,8 +1775,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -1790,7 +1791,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1848,14 +1849,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1896,14 +1897,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -1929,10 +1930,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1963,10 +1964,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -1986,8 +1987,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -2010,8 +2011,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -2026,7 +2027,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -2082,8 +2083,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2109,8 +2109,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2548,14 +2547,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 - a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 - a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 - a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 - a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fnmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fnmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fnmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fnmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2596,14 +2595,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a1 * b3;
-               xmm4 = xmm4 - a1 * b4;
-               xmm5 = xmm5 - a2 * b1;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a2 * b3;
-               xmm8 = xmm8 - a2 * b4;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a1, b3, xmm3 );
+               xmm4 = fnmadd( a1, b4, xmm4 );
+               xmm5 = fnmadd( a2, b1, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a2, b3, xmm7 );
+               xmm8 = fnmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -2629,10 +2628,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2663,10 +2662,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a2 * b1;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a2, b1, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -2686,8 +2685,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j         );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size);
+               xmm1 = fnmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -2710,8 +2709,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 - set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 - set( A(i+1UL,k) ) * b1;
+               xmm1 = fnmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fnmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -2726,7 +2725,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - set( A(i,k) ) * B.load(k,j);
+               xmm1 = fnmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -2784,14 +2783,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 - A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 - A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 - A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 - A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fnmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fnmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fnmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fnmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -2832,14 +2831,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a3 * b1;
-               xmm4 = xmm4 - a4 * b1;
-               xmm5 = xmm5 - a1 * b2;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a3 * b2;
-               xmm8 = xmm8 - a4 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a3, b1, xmm3 );
+               xmm4 = fnmadd( a4, b1, xmm4 );
+               xmm5 = fnmadd( a1, b2, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a3, b2, xmm7 );
+               xmm8 = fnmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -2865,10 +2864,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -2899,10 +2898,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a1 * b2;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a1, b2, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -2922,8 +2921,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i         ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size,k) * b1;
+               xmm1 = fnmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -2946,8 +2945,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 - a1 * set( B(k,j    ) );
-               xmm2 = xmm2 - a1 * set( B(k,j+1UL) );
+               xmm1 = fnmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fnmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -2962,7 +2961,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - A.load(i,k) * set( B(k,j) );
+               xmm1 = fnmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -3018,8 +3017,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3045,8 +3043,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -4040,14 +4037,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -4081,14 +4078,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 * factor );
@@ -4111,10 +4108,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -4142,10 +4139,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 * factor );
@@ -4164,8 +4161,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 * factor );
@@ -4187,8 +4184,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 * factor );
@@ -4203,7 +4200,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -4256,14 +4253,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -4297,14 +4294,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 * factor );
@@ -4327,10 +4324,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -4358,10 +4355,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 * factor );
@@ -4380,8 +4377,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 * factor );
@@ -4403,8 +4400,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 * factor );
@@ -4419,7 +4416,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -4475,8 +4472,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      reset( ~C );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4502,8 +4499,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      reset( ~C );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4883,14 +4880,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
@@ -4924,14 +4921,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , (~C).load(i    ,j             ) + xmm1 * factor );
@@ -4954,10 +4951,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
@@ -4985,10 +4982,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , (~C).load(i    ,j         ) + xmm1 * factor );
@@ -5007,8 +5004,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , (~C).load(i,j         ) + xmm1 * factor );
@@ -5030,8 +5027,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, (~C).load(i    ,j) + xmm1 * factor );
@@ -5046,7 +5043,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
@@ -5099,14 +5096,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
@@ -5140,14 +5137,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , (~C).load(i             ,j    ) + xmm1 * factor );
@@ -5170,10 +5167,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
@@ -5201,10 +5198,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , (~C).load(i         ,j    ) + xmm1 * factor );
@@ -5223,8 +5220,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, (~C).load(i         ,j) + xmm1 * factor );
@@ -5246,8 +5243,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
 
             }
             (~C).store( i, j    , (~C).load(i,j    ) + xmm1 * factor );
@@ -5262,7 +5259,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
@@ -5318,8 +5315,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -5345,8 +5341,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -5703,14 +5698,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
@@ -5744,14 +5739,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , (~C).load(i    ,j             ) - xmm1 * factor );
@@ -5774,10 +5769,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
@@ -5805,10 +5800,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , (~C).load(i    ,j         ) - xmm1 * factor );
@@ -5827,8 +5822,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , (~C).load(i,j         ) - xmm1 * factor );
@@ -5850,8 +5845,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, (~C).load(i    ,j) - xmm1 * factor );
@@ -5866,7 +5861,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
@@ -5919,14 +5914,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
@@ -5960,14 +5955,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , (~C).load(i             ,j    ) - xmm1 * factor );
@@ -5990,10 +5985,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
@@ -6021,10 +6016,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , (~C).load(i         ,j    ) - xmm1 * factor );
@@ -6043,8 +6038,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, (~C).load(i         ,j) - xmm1 * factor );
@@ -6066,8 +6061,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , (~C).load(i,j    ) - xmm1 * factor );
@@ -6082,7 +6077,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
@@ -6138,8 +6133,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar );
    }
    //**********************************************************************************************
 
@@ -6165,8 +6159,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar );
    }
    //**********************************************************************************************
 
@@ -595,14 +595,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -625,10 +625,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -647,9 +647,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -667,8 +667,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -684,7 +684,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -765,14 +765,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -791,10 +791,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -809,9 +809,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -825,8 +825,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1 );
@@ -838,7 +838,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1 );
@@ -1210,14 +1210,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -1243,10 +1243,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -1267,9 +1267,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -1288,8 +1288,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -1305,7 +1305,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1( y.load(i) );
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -1384,14 +1384,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1410,10 +1410,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1428,9 +1428,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1444,8 +1444,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1 );
@@ -1457,7 +1457,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1 );
@@ -1808,14 +1808,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 - A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 - A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 - A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 - A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 - A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fnmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fnmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fnmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fnmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fnmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -1841,10 +1841,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 - A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fnmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -1865,9 +1865,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -1886,8 +1886,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i         ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size,j) * x1;
+            xmm1 = fnmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -1903,7 +1903,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1( y.load(i) );
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 - A.load(i,j) * set( x[j] );
+            xmm1 = fnmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -1983,14 +1983,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2009,10 +2009,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2027,9 +2027,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2043,8 +2043,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) - xmm1 );
@@ -2056,7 +2056,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) - xmm1 );
@@ -2969,14 +2969,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1*factor );
@@ -2999,10 +2999,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1*factor );
@@ -3021,9 +3021,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1*factor );
@@ -3041,8 +3041,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1*factor );
@@ -3059,7 +3059,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i,j) * x1;
+            xmm1 = fmadd( A.load(i,j), x1, xmm1 );
          }
 
          y.store( i, xmm1*factor );
@@ -3142,14 +3142,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3168,10 +3168,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3186,9 +3186,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3202,8 +3202,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1*factor );
@@ -3215,7 +3215,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1*factor );
@@ -3563,14 +3563,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3593,10 +3593,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3615,9 +3615,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3635,8 +3635,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , y.load(i         ) + xmm1*factor );
@@ -3652,7 +3652,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, y.load(i) + xmm1*factor );
@@ -3734,14 +3734,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3760,10 +3760,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3778,9 +3778,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3794,8 +3794,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1*factor );
@@ -3807,7 +3807,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1*factor );
@@ -4135,14 +4135,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4165,10 +4165,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4187,9 +4187,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4207,8 +4207,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , y.load(i         ) - xmm1*factor );
@@ -4223,7 +4223,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, y.load(i) - xmm1*factor );
@@ -4305,14 +4305,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4331,10 +4331,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4349,9 +4349,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4365,8 +4365,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) - xmm1*factor );
@@ -4378,7 +4378,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) - xmm1*factor );
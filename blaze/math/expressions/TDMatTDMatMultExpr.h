@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -689,14 +690,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -730,14 +731,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -760,10 +761,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -791,10 +792,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -813,8 +814,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -836,8 +837,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -852,7 +853,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -908,7 +909,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAssignKernel( ~C, A, B );
+      reset( ~C );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -934,8 +936,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      reset( ~C );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1429,14 +1431,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1477,14 +1479,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -1510,10 +1512,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1544,10 +1546,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -1567,8 +1569,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -1591,8 +1593,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -1607,7 +1609,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1663,7 +1665,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1689,8 +1691,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2158,14 +2159,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 - A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 - A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 - A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 - A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fnmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fnmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fnmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fnmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -2206,14 +2207,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a3 * b1;
-               xmm4 = xmm4 - a4 * b1;
-               xmm5 = xmm5 - a1 * b2;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a3 * b2;
-               xmm8 = xmm8 - a4 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a3, b1, xmm3 );
+               xmm4 = fnmadd( a4, b1, xmm4 );
+               xmm5 = fnmadd( a1, b2, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a3, b2, xmm7 );
+               xmm8 = fnmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -2239,10 +2240,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -2273,10 +2274,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a1 * b2;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a1, b2, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -2296,8 +2297,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i         ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size,k) * b1;
+               xmm1 = fnmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -2320,8 +2321,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 - a1 * set( B(k,j    ) );
-               xmm2 = xmm2 - a1 * set( B(k,j+1UL) );
+               xmm1 = fnmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fnmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -2336,7 +2337,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - A.load(i,k) * set( B(k,j) );
+               xmm1 = fnmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -2392,7 +2393,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2418,8 +2419,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3553,14 +3553,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -3594,14 +3594,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 * factor );
@@ -3624,10 +3624,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -3655,10 +3655,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 * factor );
@@ -3677,8 +3677,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 * factor );
@@ -3700,8 +3700,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 * factor );
@@ -3716,7 +3716,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -3772,7 +3772,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      reset( ~C );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -3798,8 +3799,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      reset( ~C );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4261,14 +4262,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
@@ -4302,14 +4303,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , (~C).load(i             ,j    ) + xmm1 * factor );
@@ -4332,10 +4333,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
@@ -4363,10 +4364,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , (~C).load(i         ,j    ) + xmm1 * factor );
@@ -4385,8 +4386,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, (~C).load(i         ,j) + xmm1 * factor );
@@ -4408,8 +4409,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , (~C).load(i,j    ) + xmm1 * factor );
@@ -4424,7 +4425,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
@@ -4480,7 +4481,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4506,8 +4507,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4947,14 +4947,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
@@ -4988,14 +4988,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , (~C).load(i             ,j    ) - xmm1 * factor );
@@ -5018,10 +5018,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
@@ -5049,10 +5049,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , (~C).load(i         ,j    ) - xmm1 * factor );
@@ -5071,8 +5071,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, (~C).load(i         ,j) - xmm1 * factor );
@@ -5094,8 +5094,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , (~C).load(i,j    ) - xmm1 * factor );
@@ -5110,7 +5110,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
@@ -5166,7 +5166,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar );
    }
    //**********************************************************************************************
 
@@ -5192,8 +5192,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar );
    }
    //**********************************************************************************************
 
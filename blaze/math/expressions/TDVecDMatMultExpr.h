@@ -596,14 +596,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -626,10 +626,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -648,9 +648,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -668,8 +668,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -685,7 +685,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -766,14 +766,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -792,10 +792,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -810,9 +810,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -826,8 +826,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1 );
@@ -839,7 +839,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1 );
@@ -1211,14 +1211,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -1244,10 +1244,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -1268,9 +1268,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -1289,8 +1289,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -1306,7 +1306,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1( y.load(j) );
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -1385,14 +1385,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1411,10 +1411,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1429,9 +1429,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1445,8 +1445,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1 );
@@ -1458,7 +1458,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1 );
@@ -1809,14 +1809,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 - x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 - x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 - x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 - x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 - x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fnmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fnmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fnmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fnmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fnmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -1842,10 +1842,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 - x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fnmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -1866,9 +1866,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -1887,8 +1887,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j         );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size);
+            xmm1 = fnmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -1904,7 +1904,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1( y.load(j) );
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 - set( x[i] ) * A.load(i,j);
+            xmm1 = fnmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -1984,14 +1984,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2010,10 +2010,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2028,9 +2028,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2044,8 +2044,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) - xmm1 );
@@ -2057,7 +2057,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) - xmm1 );
@@ -2969,14 +2969,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1*factor );
@@ -2999,10 +2999,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1*factor );
@@ -3021,9 +3021,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1*factor );
@@ -3041,8 +3041,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1*factor );
@@ -3058,7 +3058,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1*factor );
@@ -3141,14 +3141,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3167,10 +3167,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3185,9 +3185,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3201,8 +3201,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1*factor );
@@ -3214,7 +3214,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1*factor );
@@ -3561,14 +3561,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3591,10 +3591,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3613,9 +3613,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3633,8 +3633,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , y.load(j         ) + xmm1*factor );
@@ -3650,7 +3650,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, y.load(j) + xmm1*factor );
@@ -3732,14 +3732,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3758,10 +3758,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3776,9 +3776,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3792,8 +3792,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1*factor );
@@ -3805,7 +3805,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1*factor );
@@ -4133,14 +4133,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4163,10 +4163,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4185,9 +4185,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4205,8 +4205,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , y.load(j         ) - xmm1*factor );
@@ -4222,7 +4222,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, y.load(j) - xmm1*factor );
@@ -4304,14 +4304,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4330,10 +4330,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4348,9 +4348,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4364,8 +4364,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) - xmm1*factor );
@@ -4377,7 +4377,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) - xmm1*factor );
@@ -212,10 +212,10 @@ inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
    const size_t end( N - N % (IT::size*4UL) );
 
    for( size_t i=0UL; i<end; i+=IT::size*4UL ) {
-      xmm1 = xmm1 + ( left.load(i             ) * right.load(i             ) );
-      xmm2 = xmm2 + ( left.load(i+IT::size    ) * right.load(i+IT::size    ) );
-      xmm3 = xmm3 + ( left.load(i+IT::size*2UL) * right.load(i+IT::size*2UL) );
-      xmm4 = xmm4 + ( left.load(i+IT::size*3UL) * right.load(i+IT::size*3UL) );
+      xmm1 = fmadd( left.load(i             ), right.load(i             ), xmm1 );
+      xmm2 = fmadd( left.load(i+IT::size    ), right.load(i+IT::size    ), xmm2 );
+      xmm3 = fmadd( left.load(i+IT::size*2UL), right.load(i+IT::size*2UL), xmm3 );
+      xmm4 = fmadd( left.load(i+IT::size*3UL), right.load(i+IT::size*3UL), xmm4 );
    }
 
    MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
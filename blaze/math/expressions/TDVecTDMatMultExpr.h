@@ -557,14 +557,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -587,10 +587,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -609,9 +609,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -629,8 +629,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -646,7 +646,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + x.load(i) * A.load(i,j);
+            xmm1 = fmadd( x.load(i), A.load(i,j), xmm1 );
          }
 
          y[j] = sum( xmm1 );
@@ -1205,14 +1205,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1235,10 +1235,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1257,9 +1257,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1277,8 +1277,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1294,7 +1294,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] += sum( xmm1 );
@@ -1830,14 +1830,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1860,10 +1860,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1882,9 +1882,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1902,8 +1902,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1919,7 +1919,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] -= sum( xmm1 );
@@ -3002,14 +3002,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3032,10 +3032,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3054,9 +3054,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3074,8 +3074,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3091,7 +3091,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] = sum( xmm1 ) * scalar;
@@ -3672,14 +3672,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3702,10 +3702,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3724,9 +3724,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3744,8 +3744,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3761,7 +3761,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] += sum( xmm1 ) * scalar;
@@ -4302,14 +4302,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4332,10 +4332,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4354,9 +4354,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4374,8 +4374,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4391,7 +4391,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] -= sum( xmm1 ) * scalar;
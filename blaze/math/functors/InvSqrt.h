@@ -0,0 +1,107 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/InvSqrt.h
+//  \brief Header file for the InvSqrt functor
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_INVSQRT_H_
+#define _BLAZE_MATH_FUNCTORS_INVSQRT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/system/Inline.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the invsqrt() function.
+// \ingroup functors
+//
+// The InvSqrt functor computes the inverse square root of a given value. In case the intrinsic
+// invsqrt() function is available for the given data type, the functor can also be applied to
+// intrinsic vectors (see the SIMDEnabled class template and the load() function).
+*/
+struct InvSqrt
+{
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Compilation switch for the vectorized evaluation of the functor.
+   template< typename T >  // Type of the operand
+   struct SIMDEnabled {
+      enum { value = IntrinsicTrait<T>::mathFunctions };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the invsqrt() function for the given value.
+   //
+   // \param a The given value.
+   // \return The result of the invsqrt() function for the given value.
+   */
+   template< typename T >  // Type of the operand
+   BLAZE_ALWAYS_INLINE T operator()( const T& a ) const
+   {
+      using std::sqrt;
+      return T(1) / sqrt( a );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the invsqrt() function for the given intrinsic vector.
+   //
+   // \param a The given intrinsic vector.
+   // \return The result of the invsqrt() function for the given intrinsic vector.
+   */
+   template< typename T >  // Type of the intrinsic operand
+   BLAZE_ALWAYS_INLINE T load( const T& a ) const
+   {
+      return invsqrt( a );
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,157 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/Pow.h
+//  \brief Header file for the Pow functor
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_POW_H_
+#define _BLAZE_MATH_FUNCTORS_POW_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the pow() function with fixed exponent.
+// \ingroup functors
+//
+// The Pow functor raises a given value to the power of the exponent specified during the
+// construction of the functor. In case the intrinsic pow() function is available for the given
+// data type and the data type matches the type of the exponent, the functor can also be applied
+// to intrinsic vectors (see the SIMDEnabled class template and the load() function).
+*/
+template< typename ET >  // Type of the exponent
+struct Pow
+{
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Compilation switch for the vectorized evaluation of the functor.
+   template< typename T >  // Type of the operand
+   struct SIMDEnabled {
+      enum { value = IsSame<T,ET>::value && IntrinsicTrait<T>::mathFunctions };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Constructor of the Pow functor.
+   //
+   // \param exp The exponent.
+   */
+   explicit inline Pow( ET exp )
+      : exp_( exp )  // The exponent
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the pow() function for the given value.
+   //
+   // \param a The given value.
+   // \return The result of the pow() function for the given value.
+   */
+   template< typename T >  // Type of the operand
+   BLAZE_ALWAYS_INLINE T operator()( const T& a ) const
+   {
+      using std::pow;
+      return pow( a, exp_ );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the pow() function for the given intrinsic vector.
+   //
+   // \param a The given intrinsic vector.
+   // \return The result of the pow() function for the given intrinsic vector.
+   */
+   template< typename T >  // Type of the intrinsic operand
+   BLAZE_ALWAYS_INLINE T load( const T& a ) const
+   {
+      return pow( a, set( exp_ ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   ET exp_;  //!< The exponent.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the exponent type of the Pow functor.
+// \ingroup functors
+//
+// In case the given element type \a T is a floating point type, the exponent is converted to
+// this type in order to enable a vectorized evaluation of the pow() function. Otherwise the
+// given exponent type \a ET is used.
+*/
+template< typename T     // Type of the elements
+        , typename ET >  // Type of the exponent
+struct PowExponent
+{
+ public:
+   //**********************************************************************************************
+   typedef typename SelectType< IsFloatingPoint<T>::value, T, ET >::Type  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
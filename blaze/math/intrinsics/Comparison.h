@@ -0,0 +1,535 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Comparison.h
+//  \brief Header file for the intrinsic comparison functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_COMPARISON_H_
+#define _BLAZE_MATH_INTRINSICS_COMPARISON_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC COMPARISON FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_float_t cmpeq( sse_float_t, sse_float_t )
+// \brief Equality comparison of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting comparison mask.
+//
+// This function tests whether the elements of \a a are equal to the according elements of \a b.
+// Each element of the resulting mask has all bits set in case the comparison yields \a true and all
+// bits cleared otherwise. The mask can be used in the select() function.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpeq( const sse_float_t& a, const sse_float_t& b )
+{
+   const __mmask16 mask( _mm512_cmp_ps_mask( a.value, b.value, _CMP_EQ_OQ ) );
+   return _mm512_castsi512_ps( _mm512_maskz_set1_epi32( mask, -1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpeq( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_EQ_OQ );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpeq( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmpeq_ps( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t cmpeq( sse_double_t, sse_double_t )
+// \brief Equality comparison of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting comparison mask.
+//
+// This function tests whether the elements of \a a are equal to the according elements of \a b.
+// Each element of the resulting mask has all bits set in case the comparison yields \a true and all
+// bits cleared otherwise. The mask can be used in the select() function.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpeq( const sse_double_t& a, const sse_double_t& b )
+{
+   const __mmask8 mask( _mm512_cmp_pd_mask( a.value, b.value, _CMP_EQ_OQ ) );
+   return _mm512_castsi512_pd( _mm512_maskz_set1_epi64( mask, -1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpeq( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_EQ_OQ );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpeq( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmpeq_pd( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t cmpneq( sse_float_t, sse_float_t )
+// \brief Inequality comparison of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting comparison mask.
+//
+// This function tests whether the elements of \a a are not equal to the according elements of \a b.
+// In case one of the two elements is not a number, the comparison yields \a true. Each element of
+// the resulting mask has all bits set in case the comparison yields \a true and all bits cleared
+// otherwise. The mask can be used in the select() function.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpneq( const sse_float_t& a, const sse_float_t& b )
+{
+   const __mmask16 mask( _mm512_cmp_ps_mask( a.value, b.value, _CMP_NEQ_UQ ) );
+   return _mm512_castsi512_ps( _mm512_maskz_set1_epi32( mask, -1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpneq( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_NEQ_UQ );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpneq( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmpneq_ps( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t cmpneq( sse_double_t, sse_double_t )
+// \brief Inequality comparison of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting comparison mask.
+//
+// This function tests whether the elements of \a a are not equal to the according elements of \a b.
+// In case one of the two elements is not a number, the comparison yields \a true. Each element of
+// the resulting mask has all bits set in case the comparison yields \a true and all bits cleared
+// otherwise. The mask can be used in the select() function.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpneq( const sse_double_t& a, const sse_double_t& b )
+{
+   const __mmask8 mask( _mm512_cmp_pd_mask( a.value, b.value, _CMP_NEQ_UQ ) );
+   return _mm512_castsi512_pd( _mm512_maskz_set1_epi64( mask, -1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpneq( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_NEQ_UQ );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpneq( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmpneq_pd( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t cmplt( sse_float_t, sse_float_t )
+// \brief Less-than comparison of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting comparison mask.
+//
+// This function tests whether the elements of \a a are smaller than the according elements of \a b.
+// Each element of the resulting mask has all bits set in case the comparison yields \a true and all
+// bits cleared otherwise. The mask can be used in the select() function.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmplt( const sse_float_t& a, const sse_float_t& b )
+{
+   const __mmask16 mask( _mm512_cmp_ps_mask( a.value, b.value, _CMP_LT_OQ ) );
+   return _mm512_castsi512_ps( _mm512_maskz_set1_epi32( mask, -1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmplt( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_LT_OQ );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmplt( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmplt_ps( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t cmplt( sse_double_t, sse_double_t )
+// \brief Less-than comparison of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting comparison mask.
+//
+// This function tests whether the elements of \a a are smaller than the according elements of \a b.
+// Each element of the resulting mask has all bits set in case the comparison yields \a true and all
+// bits cleared otherwise. The mask can be used in the select() function.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmplt( const sse_double_t& a, const sse_double_t& b )
+{
+   const __mmask8 mask( _mm512_cmp_pd_mask( a.value, b.value, _CMP_LT_OQ ) );
+   return _mm512_castsi512_pd( _mm512_maskz_set1_epi64( mask, -1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmplt( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_LT_OQ );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmplt( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmplt_pd( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t cmple( sse_float_t, sse_float_t )
+// \brief Less-or-equal comparison of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting comparison mask.
+//
+// This function tests whether the elements of \a a are smaller than or equal to the according elements of
+// \a b. Each element of the
+// resulting mask has all bits set in case the comparison yields \a true and all bits cleared
+// otherwise. The mask can be used in the select() function.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmple( const sse_float_t& a, const sse_float_t& b )
+{
+   const __mmask16 mask( _mm512_cmp_ps_mask( a.value, b.value, _CMP_LE_OQ ) );
+   return _mm512_castsi512_ps( _mm512_maskz_set1_epi32( mask, -1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmple( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_LE_OQ );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmple( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmple_ps( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t cmple( sse_double_t, sse_double_t )
+// \brief Less-or-equal comparison of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting comparison mask.
+//
+// This function tests whether the elements of \a a are smaller than or equal to the according elements of
+// \a b. Each element of the
+// resulting mask has all bits set in case the comparison yields \a true and all bits cleared
+// otherwise. The mask can be used in the select() function.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmple( const sse_double_t& a, const sse_double_t& b )
+{
+   const __mmask8 mask( _mm512_cmp_pd_mask( a.value, b.value, _CMP_LE_OQ ) );
+   return _mm512_castsi512_pd( _mm512_maskz_set1_epi64( mask, -1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmple( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_LE_OQ );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmple( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmple_pd( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t cmpunord( sse_float_t, sse_float_t )
+// \brief Unordered comparison of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting comparison mask.
+//
+// This function tests whether at least one of the two according elements of \a a and \a b is not a
+// number. Each element of the resulting mask has all bits set in case the comparison yields \a true
+// and all bits cleared otherwise. The mask can be used in the select() function.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpunord( const sse_float_t& a, const sse_float_t& b )
+{
+   const __mmask16 mask( _mm512_cmp_ps_mask( a.value, b.value, _CMP_UNORD_Q ) );
+   return _mm512_castsi512_ps( _mm512_maskz_set1_epi32( mask, -1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpunord( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_UNORD_Q );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpunord( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmpunord_ps( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t cmpunord( sse_double_t, sse_double_t )
+// \brief Unordered comparison of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting comparison mask.
+//
+// This function tests whether at least one of the two according elements of \a a and \a b is not a
+// number. Each element of the resulting mask has all bits set in case the comparison yields \a true
+// and all bits cleared otherwise. The mask can be used in the select() function.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpunord( const sse_double_t& a, const sse_double_t& b )
+{
+   const __mmask8 mask( _mm512_cmp_pd_mask( a.value, b.value, _CMP_UNORD_Q ) );
+   return _mm512_castsi512_pd( _mm512_maskz_set1_epi64( mask, -1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpunord( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_UNORD_Q );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpunord( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmpunord_pd( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC SELECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_float_t select( sse_float_t, sse_float_t, sse_float_t )
+// \brief Componentwise selection between two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param mask The selection mask (as returned by one of the comparison functions).
+// \param a The values selected for all set mask elements.
+// \param b The values selected for all cleared mask elements.
+// \return The resulting vector.
+//
+// For each element, this function returns the according element of \a a in case all bits of
+// the according mask element are set and the according element of \a b in case all bits are
+// cleared.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t select( const sse_float_t& mask, const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm512_castsi512_ps( _mm512_ternarylogic_epi32( _mm512_castps_si512( mask.value ),
+                                                          _mm512_castps_si512( a.value ),
+                                                          _mm512_castps_si512( b.value ), 0xCA ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t select( const sse_float_t& mask, const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_blendv_ps( b.value, a.value, mask.value );
+}
+#elif BLAZE_SSE4_MODE
+BLAZE_ALWAYS_INLINE sse_float_t select( const sse_float_t& mask, const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_blendv_ps( b.value, a.value, mask.value );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t select( const sse_float_t& mask, const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_or_ps( _mm_and_ps( mask.value, a.value ), _mm_andnot_ps( mask.value, b.value ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t select( sse_double_t, sse_double_t, sse_double_t )
+// \brief Componentwise selection between two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param mask The selection mask (as returned by one of the comparison functions).
+// \param a The values selected for all set mask elements.
+// \param b The values selected for all cleared mask elements.
+// \return The resulting vector.
+//
+// For each element, this function returns the according element of \a a in case all bits of
+// the according mask element are set and the according element of \a b in case all bits are
+// cleared.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t select( const sse_double_t& mask, const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm512_castsi512_pd( _mm512_ternarylogic_epi64( _mm512_castpd_si512( mask.value ),
+                                                          _mm512_castpd_si512( a.value ),
+                                                          _mm512_castpd_si512( b.value ), 0xCA ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t select( const sse_double_t& mask, const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_blendv_pd( b.value, a.value, mask.value );
+}
+#elif BLAZE_SSE4_MODE
+BLAZE_ALWAYS_INLINE sse_double_t select( const sse_double_t& mask, const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_blendv_pd( b.value, a.value, mask.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t select( const sse_double_t& mask, const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_or_pd( _mm_and_pd( mask.value, a.value ), _mm_andnot_pd( mask.value, b.value ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn bool anyOf( sse_float_t )
+// \brief Returns whether any element of the given mask of single precision values is set.
+// \ingroup intrinsics
+//
+// \param mask The mask to be tested (as returned by one of the comparison functions).
+// \return \a true in case at least one mask element is set, \a false if not.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE bool anyOf( const sse_float_t& mask )
+{
+   const __m512i tmp( _mm512_castps_si512( mask.value ) );
+   return _mm512_test_epi32_mask( tmp, tmp ) != 0;
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE bool anyOf( const sse_float_t& mask )
+{
+   return _mm256_movemask_ps( mask.value ) != 0;
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE bool anyOf( const sse_float_t& mask )
+{
+   return _mm_movemask_ps( mask.value ) != 0;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn bool anyOf( sse_double_t )
+// \brief Returns whether any element of the given mask of double precision values is set.
+// \ingroup intrinsics
+//
+// \param mask The mask to be tested (as returned by one of the comparison functions).
+// \return \a true in case at least one mask element is set, \a false if not.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE bool anyOf( const sse_double_t& mask )
+{
+   const __m512i tmp( _mm512_castpd_si512( mask.value ) );
+   return _mm512_test_epi64_mask( tmp, tmp ) != 0;
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE bool anyOf( const sse_double_t& mask )
+{
+   return _mm256_movemask_pd( mask.value ) != 0;
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE bool anyOf( const sse_double_t& mask )
+{
+   return _mm_movemask_pd( mask.value ) != 0;
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
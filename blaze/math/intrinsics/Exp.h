@@ -0,0 +1,138 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Exp.h
+//  \brief Header file for the intrinsic exponential functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_EXP_H_
+#define _BLAZE_MATH_INTRINSICS_EXP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Division.h>
+#include <blaze/math/intrinsics/FMA.h>
+#include <blaze/math/intrinsics/Ldexp.h>
+#include <blaze/math/intrinsics/Max.h>
+#include <blaze/math/intrinsics/Min.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Rounding.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC EXPONENTIAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_float_t exp( sse_float_t )
+// \brief Computes the exponential function for a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The resulting vector \f$ e^a \f$.
+//
+// The argument is reduced to \f$ a = n \cdot ln(2) + r \f$ with \f$ |r| \leq ln(2)/2 \f$ and
+// \f$ e^r \f$ is approximated by a polynomial of degree 7 (see the Cephes Math Library). The
+// maximum relative error is approximately 2 ulp.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_float_t exp( const sse_float_t& a )
+{
+   const sse_float_t x( max( set( -104.0F ), min( set( 89.0F ), a ) ) );
+   const sse_float_t n( round( x * set( 1.44269504088896341F ) ) );
+   const sse_float_t r( fnmadd( n, set( -2.12194440E-4F ), fnmadd( n, set( 0.693359375F ), x ) ) );
+
+   sse_float_t p( set( 1.9875691500E-4F ) );
+   p = fmadd( p, r, set( 1.3981999507E-3F ) );
+   p = fmadd( p, r, set( 8.3334519073E-3F ) );
+   p = fmadd( p, r, set( 4.1665795894E-2F ) );
+   p = fmadd( p, r, set( 1.6666665459E-1F ) );
+   p = fmadd( p, r, set( 5.0000001201E-1F ) );
+   p = fmadd( p, r*r, r ) + set( 1.0F );
+
+   return ldexp( p, n );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t exp( sse_double_t )
+// \brief Computes the exponential function for a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The resulting vector \f$ e^a \f$.
+//
+// The argument is reduced to \f$ a = n \cdot ln(2) + r \f$ with \f$ |r| \leq ln(2)/2 \f$ and
+// \f$ e^r \f$ is approximated by a Pade approximation of degree 5/6 (see the Cephes Math Library).
+// The maximum relative error is approximately 2 ulp.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_double_t exp( const sse_double_t& a )
+{
+   const sse_double_t x( max( set( -746.0 ), min( set( 710.0 ), a ) ) );
+   const sse_double_t n( round( x * set( 1.4426950408889634073599 ) ) );
+   const sse_double_t r( fnmadd( n, set( 1.42860682030941723212E-6 ), fnmadd( n, set( 6.93145751953125E-1 ), x ) ) );
+   const sse_double_t rr( r * r );
+
+   sse_double_t p( set( 1.26177193074810590878E-4 ) );
+   p = fmadd( p, rr, set( 3.02994407707441961300E-2 ) );
+   p = fmadd( p, rr, set( 9.99999999999999999910E-1 ) );
+   p = p * r;
+
+   sse_double_t q( set( 3.00198505138664455042E-6 ) );
+   q = fmadd( q, rr, set( 2.52448340349684104192E-3 ) );
+   q = fmadd( q, rr, set( 2.27265548208155028766E-1 ) );
+   q = fmadd( q, rr, set( 2.00000000000000000009E0 ) );
+
+   const sse_double_t tmp( p / ( q - p ) );
+
+   return ldexp( tmp + tmp + set( 1.0 ), n );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
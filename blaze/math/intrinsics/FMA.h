@@ -0,0 +1,550 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/FMA.h
+//  \brief Header file for the intrinsic fused multiply-add functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_FMA_H_
+#define _BLAZE_MATH_INTRINSICS_FMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC FUSED MULTIPLY-ADD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_int16_t fmadd( sse_int16_t, sse_int16_t, sse_int16_t )
+// \brief Fused multiply-add of three vectors of 16-bit integral values (\f$ a*b+c \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_int16_t fmadd( const sse_int16_t& a, const sse_int16_t& b, const sse_int16_t& c )
+{
+   return a * b + c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_int16_t fmsub( sse_int16_t, sse_int16_t, sse_int16_t )
+// \brief Fused multiply-subtract of three vectors of 16-bit integral values (\f$ a*b-c \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_int16_t fmsub( const sse_int16_t& a, const sse_int16_t& b, const sse_int16_t& c )
+{
+   return a * b - c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_int16_t fnmadd( sse_int16_t, sse_int16_t, sse_int16_t )
+// \brief Negated fused multiply-add of three vectors of 16-bit integral values (\f$ c-a*b \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_int16_t fnmadd( const sse_int16_t& a, const sse_int16_t& b, const sse_int16_t& c )
+{
+   return c - a * b;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_int32_t fmadd( sse_int32_t, sse_int32_t, sse_int32_t )
+// \brief Fused multiply-add of three vectors of 32-bit integral values (\f$ a*b+c \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_MIC_MODE || BLAZE_SSE4_MODE
+BLAZE_ALWAYS_INLINE sse_int32_t fmadd( const sse_int32_t& a, const sse_int32_t& b, const sse_int32_t& c )
+{
+   return a * b + c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_int32_t fmsub( sse_int32_t, sse_int32_t, sse_int32_t )
+// \brief Fused multiply-subtract of three vectors of 32-bit integral values (\f$ a*b-c \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_MIC_MODE || BLAZE_SSE4_MODE
+BLAZE_ALWAYS_INLINE sse_int32_t fmsub( const sse_int32_t& a, const sse_int32_t& b, const sse_int32_t& c )
+{
+   return a * b - c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_int32_t fnmadd( sse_int32_t, sse_int32_t, sse_int32_t )
+// \brief Negated fused multiply-add of three vectors of 32-bit integral values (\f$ c-a*b \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_MIC_MODE || BLAZE_SSE4_MODE
+BLAZE_ALWAYS_INLINE sse_int32_t fnmadd( const sse_int32_t& a, const sse_int32_t& b, const sse_int32_t& c )
+{
+   return c - a * b;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t fmadd( sse_float_t, sse_float_t, sse_float_t )
+// \brief Fused multiply-add of three vectors of single precision floating point values (\f$ a*b+c \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_SSE_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return a * b + c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t fmsub( sse_float_t, sse_float_t, sse_float_t )
+// \brief Fused multiply-subtract of three vectors of single precision floating point values (\f$ a*b-c \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fmsub( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fmsub_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fmsub( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fmsub_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_SSE_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fmsub( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return a * b - c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t fnmadd( sse_float_t, sse_float_t, sse_float_t )
+// \brief Negated fused multiply-add of three vectors of single precision floating point values (\f$ c-a*b \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fnmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fnmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_SSE_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return c - a * b;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t fmadd( sse_double_t, sse_double_t, sse_double_t )
+// \brief Fused multiply-add of three vectors of double precision floating point values (\f$ a*b+c \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return a * b + c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t fmsub( sse_double_t, sse_double_t, sse_double_t )
+// \brief Fused multiply-subtract of three vectors of double precision floating point values (\f$ a*b-c \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fmsub( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fmsub_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fmsub( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fmsub_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fmsub( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return a * b - c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t fnmadd( sse_double_t, sse_double_t, sse_double_t )
+// \brief Negated fused multiply-add of three vectors of double precision floating point values (\f$ c-a*b \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fnmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fnmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return c - a * b;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_cfloat_t fmadd( sse_cfloat_t, sse_cfloat_t, sse_cfloat_t )
+// \brief Fused multiply-add of three vectors of single precision complex values (a*b+c).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t fmadd( const sse_cfloat_t& a, const sse_cfloat_t& b, const sse_cfloat_t& c )
+{
+   __m512 x, y;
+
+   x = _mm512_shuffle_ps( a.value, a.value, 0xF5 );
+   y = _mm512_shuffle_ps( b.value, b.value, 0xB1 );
+   y = _mm512_fmaddsub_ps( x, y, c.value );
+   x = _mm512_shuffle_ps( a.value, a.value, 0xA0 );
+   return _mm512_fmaddsub_ps( x, b.value, y );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t fmadd( const sse_cfloat_t& a, const sse_cfloat_t& b, const sse_cfloat_t& c )
+{
+   __m256 x, y;
+
+   x = _mm256_shuffle_ps( a.value, a.value, 0xF5 );
+   y = _mm256_shuffle_ps( b.value, b.value, 0xB1 );
+   y = _mm256_mul_ps( x, y );
+   x = _mm256_shuffle_ps( a.value, a.value, 0xA0 );
+   return _mm256_addsub_ps( _mm256_fmadd_ps( x, b.value, c.value ), y );
+}
+#elif BLAZE_SSE3_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t fmadd( const sse_cfloat_t& a, const sse_cfloat_t& b, const sse_cfloat_t& c )
+{
+   return a * b + c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_cfloat_t fmsub( sse_cfloat_t, sse_cfloat_t, sse_cfloat_t )
+// \brief Fused multiply-subtract of three vectors of single precision complex values (a*b-c).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t fmsub( const sse_cfloat_t& a, const sse_cfloat_t& b, const sse_cfloat_t& c )
+{
+   __m512 x, y;
+
+   x = _mm512_shuffle_ps( a.value, a.value, 0xF5 );
+   y = _mm512_shuffle_ps( b.value, b.value, 0xB1 );
+   y = _mm512_fmsubadd_ps( x, y, c.value );
+   x = _mm512_shuffle_ps( a.value, a.value, 0xA0 );
+   return _mm512_fmaddsub_ps( x, b.value, y );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t fmsub( const sse_cfloat_t& a, const sse_cfloat_t& b, const sse_cfloat_t& c )
+{
+   __m256 x, y;
+
+   x = _mm256_shuffle_ps( a.value, a.value, 0xF5 );
+   y = _mm256_shuffle_ps( b.value, b.value, 0xB1 );
+   y = _mm256_mul_ps( x, y );
+   x = _mm256_shuffle_ps( a.value, a.value, 0xA0 );
+   return _mm256_addsub_ps( _mm256_fmsub_ps( x, b.value, c.value ), y );
+}
+#elif BLAZE_SSE3_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t fmsub( const sse_cfloat_t& a, const sse_cfloat_t& b, const sse_cfloat_t& c )
+{
+   return a * b - c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_cfloat_t fnmadd( sse_cfloat_t, sse_cfloat_t, sse_cfloat_t )
+// \brief Negated fused multiply-add of three vectors of single precision complex values (c-a*b).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_SSE3_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t fnmadd( const sse_cfloat_t& a, const sse_cfloat_t& b, const sse_cfloat_t& c )
+{
+   return c - a * b;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_cdouble_t fmadd( sse_cdouble_t, sse_cdouble_t, sse_cdouble_t )
+// \brief Fused multiply-add of three vectors of double precision complex values (a*b+c).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t fmadd( const sse_cdouble_t& a, const sse_cdouble_t& b, const sse_cdouble_t& c )
+{
+   __m512d x, y;
+
+   x = _mm512_shuffle_pd( a.value, a.value, 0xFF );
+   y = _mm512_shuffle_pd( b.value, b.value, 0x55 );
+   y = _mm512_fmaddsub_pd( x, y, c.value );
+   x = _mm512_shuffle_pd( a.value, a.value, 0x00 );
+   return _mm512_fmaddsub_pd( x, b.value, y );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t fmadd( const sse_cdouble_t& a, const sse_cdouble_t& b, const sse_cdouble_t& c )
+{
+   __m256d x, y;
+
+   x = _mm256_shuffle_pd( a.value, a.value, 15 );
+   y = _mm256_shuffle_pd( b.value, b.value, 5 );
+   y = _mm256_mul_pd( x, y );
+   x = _mm256_shuffle_pd( a.value, a.value, 0 );
+   return _mm256_addsub_pd( _mm256_fmadd_pd( x, b.value, c.value ), y );
+}
+#elif BLAZE_SSE3_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t fmadd( const sse_cdouble_t& a, const sse_cdouble_t& b, const sse_cdouble_t& c )
+{
+   return a * b + c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_cdouble_t fmsub( sse_cdouble_t, sse_cdouble_t, sse_cdouble_t )
+// \brief Fused multiply-subtract of three vectors of double precision complex values (a*b-c).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t fmsub( const sse_cdouble_t& a, const sse_cdouble_t& b, const sse_cdouble_t& c )
+{
+   __m512d x, y;
+
+   x = _mm512_shuffle_pd( a.value, a.value, 0xFF );
+   y = _mm512_shuffle_pd( b.value, b.value, 0x55 );
+   y = _mm512_fmsubadd_pd( x, y, c.value );
+   x = _mm512_shuffle_pd( a.value, a.value, 0x00 );
+   return _mm512_fmaddsub_pd( x, b.value, y );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t fmsub( const sse_cdouble_t& a, const sse_cdouble_t& b, const sse_cdouble_t& c )
+{
+   __m256d x, y;
+
+   x = _mm256_shuffle_pd( a.value, a.value, 15 );
+   y = _mm256_shuffle_pd( b.value, b.value, 5 );
+   y = _mm256_mul_pd( x, y );
+   x = _mm256_shuffle_pd( a.value, a.value, 0 );
+   return _mm256_addsub_pd( _mm256_fmsub_pd( x, b.value, c.value ), y );
+}
+#elif BLAZE_SSE3_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t fmsub( const sse_cdouble_t& a, const sse_cdouble_t& b, const sse_cdouble_t& c )
+{
+   return a * b - c;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_cdouble_t fnmadd( sse_cdouble_t, sse_cdouble_t, sse_cdouble_t )
+// \brief Negated fused multiply-add of three vectors of double precision complex values (c-a*b).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition/subtraction.
+// \return The result of the fused operation.
+*/
+#if BLAZE_SSE3_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t fnmadd( const sse_cdouble_t& a, const sse_cdouble_t& b, const sse_cdouble_t& c )
+{
+   return c - a * b;
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
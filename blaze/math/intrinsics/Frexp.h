@@ -0,0 +1,164 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Frexp.h
+//  \brief Header file for the intrinsic frexp functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_FREXP_H_
+#define _BLAZE_MATH_INTRINSICS_FREXP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <blaze/math/intrinsics/Abs.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Comparison.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC FREXP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_float_t frexp( sse_float_t, sse_float_t& )
+// \brief Decomposes a vector of single precision floating point values into mantissas and exponents.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \param e The resulting vector of integral exponents.
+// \return The resulting mantissas in the range [0.5..1).
+//
+// This function decomposes the given values into normalized mantissas \f$ m \f$ and integral
+// exponents \f$ e \f$ such that \f$ a = m \cdot 2^e \f$. The sign of the mantissas corresponds
+// to the sign of the given values. Subnormal values are correctly decomposed, whereas the results
+// for zero, infinite, and NaN values are unspecified.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t frexp( const sse_float_t& a, sse_float_t& e )
+{
+   e = _mm512_add_ps( _mm512_maskz_getexp_ps( 0xFFFF, a.value ), _mm512_set1_ps( 1.0F ) );
+   return _mm512_maskz_getmant_ps( 0xFFFF, a.value, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t frexp( const sse_float_t& a, sse_float_t& e )
+{
+   const sse_float_t subnormal( cmplt( abs( a ), set( std::numeric_limits<float>::min() ) ) );
+   const sse_float_t x( select( subnormal, a * set( 33554432.0F ), a ) );  // Scaling by 2^25
+   const __m256 mask( _mm256_set1_ps( std::numeric_limits<float>::infinity() ) );
+   const __m256 bits( _mm256_and_ps( x.value, mask ) );
+   e = _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_castps_si256( bits ) ), _mm256_set1_ps( 1.1920928955078125E-7F ) );
+   e = e - select( subnormal, set( 151.0F ), set( 126.0F ) );
+   return _mm256_or_ps( _mm256_andnot_ps( mask, x.value ), _mm256_set1_ps( 0.5F ) );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t frexp( const sse_float_t& a, sse_float_t& e )
+{
+   const sse_float_t subnormal( cmplt( abs( a ), set( std::numeric_limits<float>::min() ) ) );
+   const sse_float_t x( select( subnormal, a * set( 33554432.0F ), a ) );  // Scaling by 2^25
+   const __m128 mask( _mm_set1_ps( std::numeric_limits<float>::infinity() ) );
+   const __m128 bits( _mm_and_ps( x.value, mask ) );
+   e = _mm_mul_ps( _mm_cvtepi32_ps( _mm_castps_si128( bits ) ), _mm_set1_ps( 1.1920928955078125E-7F ) );
+   e = e - select( subnormal, set( 151.0F ), set( 126.0F ) );
+   return _mm_or_ps( _mm_andnot_ps( mask, x.value ), _mm_set1_ps( 0.5F ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t frexp( sse_double_t, sse_double_t& )
+// \brief Decomposes a vector of double precision floating point values into mantissas and exponents.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \param e The resulting vector of integral exponents.
+// \return The resulting mantissas in the range [0.5..1).
+//
+// This function decomposes the given values into normalized mantissas \f$ m \f$ and integral
+// exponents \f$ e \f$ such that \f$ a = m \cdot 2^e \f$. The sign of the mantissas corresponds
+// to the sign of the given values. Subnormal values are correctly decomposed, whereas the results
+// for zero, infinite, and NaN values are unspecified.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t frexp( const sse_double_t& a, sse_double_t& e )
+{
+   e = _mm512_add_pd( _mm512_maskz_getexp_pd( 0xFF, a.value ), _mm512_set1_pd( 1.0 ) );
+   return _mm512_maskz_getmant_pd( 0xFF, a.value, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t frexp( const sse_double_t& a, sse_double_t& e )
+{
+   const sse_double_t subnormal( cmplt( abs( a ), set( std::numeric_limits<double>::min() ) ) );
+   const sse_double_t x( select( subnormal, a * set( 18014398509481984.0 ), a ) );  // Scaling by 2^54
+   const __m256d mask ( _mm256_set1_pd( std::numeric_limits<double>::infinity() ) );
+   const __m256d magic( _mm256_set1_pd( 4503599627370496.0 ) );  // 2^52
+#if BLAZE_AVX2_MODE
+   const __m256i bits ( _mm256_srli_epi64( _mm256_castpd_si256( _mm256_and_pd( x.value, mask ) ), 52 ) );
+#else
+   const __m256i tmp  ( _mm256_castpd_si256( _mm256_and_pd( x.value, mask ) ) );
+   const __m128i lo   ( _mm_srli_epi64( _mm256_castsi256_si128( tmp ), 52 ) );
+   const __m128i hi   ( _mm_srli_epi64( _mm256_extractf128_si256( tmp, 1 ), 52 ) );
+   const __m256i bits ( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+#endif
+   e = _mm256_sub_pd( _mm256_or_pd( _mm256_castsi256_pd( bits ), magic ), magic );
+   e = e - select( subnormal, set( 1076.0 ), set( 1022.0 ) );
+   return _mm256_or_pd( _mm256_andnot_pd( mask, x.value ), _mm256_set1_pd( 0.5 ) );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t frexp( const sse_double_t& a, sse_double_t& e )
+{
+   const sse_double_t subnormal( cmplt( abs( a ), set( std::numeric_limits<double>::min() ) ) );
+   const sse_double_t x( select( subnormal, a * set( 18014398509481984.0 ), a ) );  // Scaling by 2^54
+   const __m128d mask ( _mm_set1_pd( std::numeric_limits<double>::infinity() ) );
+   const __m128d magic( _mm_set1_pd( 4503599627370496.0 ) );  // 2^52
+   const __m128i bits ( _mm_srli_epi64( _mm_castpd_si128( _mm_and_pd( x.value, mask ) ), 52 ) );
+   e = _mm_sub_pd( _mm_or_pd( _mm_castsi128_pd( bits ), magic ), magic );
+   e = e - select( subnormal, set( 1076.0 ), set( 1022.0 ) );
+   return _mm_or_pd( _mm_andnot_pd( mask, x.value ), _mm_set1_pd( 0.5 ) );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,145 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Gather.h
+//  \brief Header file for the intrinsic gather functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_INTRINSICS_GATHER_H_
+#define _BLAZE_MATH_INTRINSICS_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Load.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC GATHER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of a gather for instruction sets without gather instructions.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The indices of the values to be gathered.
+// \return The gathered vector of values.
+//
+// This function gathers the values \a address[indices[0]] to \a address[indices[size-1]] via
+// a properly aligned temporary array.
+*/
+template< typename T >  // Type of the values
+BLAZE_ALWAYS_INLINE typename IntrinsicTrait<T>::Type gather_backend( const T* address, const uint32_t* indices )
+{
+   AlignedArray<T,IntrinsicTrait<T>::size> array;
+   for( size_t i=0UL; i<IntrinsicTrait<T>::size; ++i )
+      array[i] = address[indices[i]];
+   return load( array.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'float' values to be gathered.
+// \param indices The indices of the 'float' values to be gathered.
+// \return The gathered vector of 'float' values.
+//
+// This function loads the 'float' values \a address[indices[0]] to \a address[indices[size-1]]
+// into a single intrinsic vector. The indices are not required to be properly aligned, but all
+// of them must be smaller than \f$ 2^{31} \f$.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, const uint32_t* indices )
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_i32gather_ps( _mm512_loadu_si512( indices ), address, 4 );
+#elif BLAZE_AVX2_MODE
+   return _mm256_i32gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), 4 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_ps( address[indices[7]], address[indices[6]], address[indices[5]], address[indices[4]],
+                         address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#elif BLAZE_SSE_MODE
+   return _mm_set_ps( address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#else
+   return gather_backend( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'double' values to be gathered.
+// \param indices The indices of the 'double' values to be gathered.
+// \return The gathered vector of 'double' values.
+//
+// This function loads the 'double' values \a address[indices[0]] to \a address[indices[size-1]]
+// into a single intrinsic vector. The indices are not required to be properly aligned, but all
+// of them must be smaller than \f$ 2^{31} \f$.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const uint32_t* indices )
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_i32gather_pd( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), address, 8 );
+#elif BLAZE_AVX2_MODE
+   return _mm256_i32gather_pd( address, _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ), 8 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_pd( address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_pd( address[indices[1]], address[indices[0]] );
+#else
+   return gather_backend( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,193 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Ldexp.h
+//  \brief Header file for the intrinsic ldexp functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_LDEXP_H_
+#define _BLAZE_MATH_INTRINSICS_LDEXP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Max.h>
+#include <blaze/math/intrinsics/Min.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Rounding.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC LDEXP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the power of two for a vector of integral single precision values.
+// \ingroup intrinsics
+//
+// \param n The vector of integral exponents in the range [-126..127].
+// \return The resulting powers of two.
+//
+// The power of two is directly assembled from the biased exponent. For this purpose the exponent
+// is moved into the lower mantissa bits by adding the magic number \f$ 2^{23}+127 \f$ and is then
+// shifted into the exponent bits.
+*/
+#if BLAZE_AVX2_MODE && !BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t exp2i( const sse_float_t& n )
+{
+   const __m256i tmp( _mm256_castps_si256( _mm256_add_ps( n.value, _mm256_set1_ps( 8388735.0F ) ) ) );
+   return _mm256_castsi256_ps( _mm256_slli_epi32( tmp, 23 ) );
+}
+#elif BLAZE_AVX_MODE && !BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t exp2i( const sse_float_t& n )
+{
+   const __m256i tmp( _mm256_castps_si256( _mm256_add_ps( n.value, _mm256_set1_ps( 8388735.0F ) ) ) );
+   const __m128i lo ( _mm_slli_epi32( _mm256_castsi256_si128( tmp ), 23 ) );
+   const __m128i hi ( _mm_slli_epi32( _mm256_extractf128_si256( tmp, 1 ), 23 ) );
+   return _mm256_castsi256_ps( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE && !BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t exp2i( const sse_float_t& n )
+{
+   const __m128i tmp( _mm_castps_si128( _mm_add_ps( n.value, _mm_set1_ps( 8388735.0F ) ) ) );
+   return _mm_castsi128_ps( _mm_slli_epi32( tmp, 23 ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the power of two for a vector of integral double precision values.
+// \ingroup intrinsics
+//
+// \param n The vector of integral exponents in the range [-1022..1023].
+// \return The resulting powers of two.
+//
+// The power of two is directly assembled from the biased exponent. For this purpose the exponent
+// is moved into the lower mantissa bits by adding the magic number \f$ 2^{52}+1023 \f$ and is
+// then shifted into the exponent bits.
+*/
+#if BLAZE_AVX2_MODE && !BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t exp2i( const sse_double_t& n )
+{
+   const __m256i tmp( _mm256_castpd_si256( _mm256_add_pd( n.value, _mm256_set1_pd( 4503599627371519.0 ) ) ) );
+   return _mm256_castsi256_pd( _mm256_slli_epi64( tmp, 52 ) );
+}
+#elif BLAZE_AVX_MODE && !BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t exp2i( const sse_double_t& n )
+{
+   const __m256i tmp( _mm256_castpd_si256( _mm256_add_pd( n.value, _mm256_set1_pd( 4503599627371519.0 ) ) ) );
+   const __m128i lo ( _mm_slli_epi64( _mm256_castsi256_si128( tmp ), 52 ) );
+   const __m128i hi ( _mm_slli_epi64( _mm256_extractf128_si256( tmp, 1 ), 52 ) );
+   return _mm256_castsi256_pd( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE && !BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t exp2i( const sse_double_t& n )
+{
+   const __m128i tmp( _mm_castpd_si128( _mm_add_pd( n.value, _mm_set1_pd( 4503599627371519.0 ) ) ) );
+   return _mm_castsi128_pd( _mm_slli_epi64( tmp, 52 ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t ldexp( sse_float_t, sse_float_t )
+// \brief Multiplies a vector of single precision floating point values by integral powers of two.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \param n The vector of integral exponents.
+// \return The resulting vector \f$ a \cdot 2^n \f$.
+//
+// The exponents \a n are expected to be integral values. In order to also handle results in the
+// subnormal range, the scaling is performed by means of two multiplications.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t ldexp( const sse_float_t& a, const sse_float_t& n )
+{
+   return _mm512_maskz_scalef_ps( 0xFFFF, a.value, n.value );
+}
+#elif BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_float_t ldexp( const sse_float_t& a, const sse_float_t& n )
+{
+   const sse_float_t tmp( max( set( -252.0F ), min( set( 252.0F ), n ) ) );
+   const sse_float_t n1 ( round( tmp * set( 0.5F ) ) );
+   return ( a * exp2i( n1 ) ) * exp2i( tmp - n1 );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t ldexp( sse_double_t, sse_double_t )
+// \brief Multiplies a vector of double precision floating point values by integral powers of two.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \param n The vector of integral exponents.
+// \return The resulting vector \f$ a \cdot 2^n \f$.
+//
+// The exponents \a n are expected to be integral values. In order to also handle results in the
+// subnormal range, the scaling is performed by means of two multiplications.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t ldexp( const sse_double_t& a, const sse_double_t& n )
+{
+   return _mm512_maskz_scalef_pd( 0xFF, a.value, n.value );
+}
+#elif BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_double_t ldexp( const sse_double_t& a, const sse_double_t& n )
+{
+   const sse_double_t tmp( max( set( -2044.0 ), min( set( 2044.0 ), n ) ) );
+   const sse_double_t n1 ( round( tmp * set( 0.5 ) ) );
+   return ( a * exp2i( n1 ) ) * exp2i( tmp - n1 );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
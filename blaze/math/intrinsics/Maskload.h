@@ -0,0 +1,334 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Maskload.h
+//  \brief Header file for the intrinsic masked load functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_MASKLOAD_H_
+#define _BLAZE_MATH_INTRINSICS_MASKLOAD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Load.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC MASKLOAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of a masked load for instruction sets without masked loads.
+// \ingroup intrinsics
+//
+// \param address The first value to be loaded.
+// \param n The number of values to be loaded \f$[0..size]\f$.
+// \return The loaded vector of values.
+//
+// This function loads the first \a n values starting at the given address via a properly
+// aligned temporary array. The remaining elements of the returned vector are set to zero.
+// No memory beyond the first \a n values is accessed.
+*/
+template< typename T >  // Type of the values
+BLAZE_ALWAYS_INLINE typename IntrinsicTrait<T>::Type maskload_backend( const T* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+   AlignedArray<T,IntrinsicTrait<T>::size> array;
+   for( size_t i=0UL; i<n; ++i )
+      array[i] = address[i];
+   for( size_t i=n; i<IntrinsicTrait<T>::size; ++i )
+      array[i] = T();
+   return load( array.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 2-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of integral values to be loaded \f$[0..size]\f$.
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n 2-byte integral values starting at the given address and
+// sets all remaining elements of the vector to zero. No memory beyond the first \a n values is
+// accessed, which enables the vectorized treatment of the remainder of unpadded data. The given
+// address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> >, sse_int16_t >::Type
+   maskload( const T* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   return _mm512_maskz_loadu_epi16( static_cast<__mmask32>( ( size_t(1) << n ) - 1UL ), address );
+#else
+   return maskload_backend( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 4-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of integral values to be loaded \f$[0..size]\f$.
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n 4-byte integral values starting at the given address and
+// sets all remaining elements of the vector to zero. No memory beyond the first \a n values is
+// accessed, which enables the vectorized treatment of the remainder of unpadded data. The given
+// address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> >, sse_int32_t >::Type
+   maskload( const T* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   return maskload_backend( address, n );
+#elif BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_epi32( static_cast<__mmask16>( ( 1U << n ) - 1U ), address );
+#elif BLAZE_AVX2_MODE
+   const __m256i mask( _mm256_cmpgt_epi32( _mm256_set1_epi32( static_cast<int>( n ) ),
+                                           _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) ) );
+   return _mm256_maskload_epi32( reinterpret_cast<const int*>( address ), mask );
+#else
+   return maskload_backend( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 8-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of integral values to be loaded \f$[0..size]\f$.
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n 8-byte integral values starting at the given address and
+// sets all remaining elements of the vector to zero. No memory beyond the first \a n values is
+// accessed, which enables the vectorized treatment of the remainder of unpadded data. The given
+// address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse_int64_t >::Type
+   maskload( const T* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   return maskload_backend( address, n );
+#elif BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_epi64( static_cast<__mmask8>( ( 1U << n ) - 1U ), address );
+#elif BLAZE_AVX2_MODE
+   const __m256i mask( _mm256_cmpgt_epi64( _mm256_set1_epi64x( static_cast<long long>( n ) ),
+                                           _mm256_setr_epi64x( 0, 1, 2, 3 ) ) );
+   return _mm256_maskload_epi64( reinterpret_cast<const long long*>( address ), mask );
+#else
+   return maskload_backend( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 'float' values.
+// \ingroup intrinsics
+//
+// \param address The first 'float' value to be loaded.
+// \param n The number of 'float' values to be loaded \f$[0..size]\f$.
+// \return The loaded vector of 'float' values.
+//
+// This function loads the first \a n 'float' values starting at the given address and sets
+// all remaining elements of the vector to zero. No memory beyond the first \a n values is
+// accessed, which enables the vectorized treatment of the remainder of unpadded data. The
+// given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t maskload( const float* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<float>::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   return maskload_backend( address, n );
+#elif BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_ps( static_cast<__mmask16>( ( 1U << n ) - 1U ), address );
+#elif BLAZE_AVX_MODE
+   const __m256 mask( _mm256_cmp_ps( _mm256_setr_ps( 0.0F, 1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F, 7.0F ),
+                                     _mm256_set1_ps( static_cast<float>( n ) ), _CMP_LT_OQ ) );
+   return _mm256_maskload_ps( address, _mm256_castps_si256( mask ) );
+#else
+   return maskload_backend( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 'double' values.
+// \ingroup intrinsics
+//
+// \param address The first 'double' value to be loaded.
+// \param n The number of 'double' values to be loaded \f$[0..size]\f$.
+// \return The loaded vector of 'double' values.
+//
+// This function loads the first \a n 'double' values starting at the given address and sets
+// all remaining elements of the vector to zero. No memory beyond the first \a n values is
+// accessed, which enables the vectorized treatment of the remainder of unpadded data. The
+// given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t maskload( const double* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<double>::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   return maskload_backend( address, n );
+#elif BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_pd( static_cast<__mmask8>( ( 1U << n ) - 1U ), address );
+#elif BLAZE_AVX_MODE
+   const __m256d mask( _mm256_cmp_pd( _mm256_setr_pd( 0.0, 1.0, 2.0, 3.0 ),
+                                      _mm256_set1_pd( static_cast<double>( n ) ), _CMP_LT_OQ ) );
+   return _mm256_maskload_pd( address, _mm256_castpd_si256( mask ) );
+#elif BLAZE_SSE2_MODE
+   return ( n == 0UL )?( _mm_setzero_pd() )
+                      :( n == 1UL )?( _mm_load_sd( address ) )
+                                   :( _mm_loadu_pd( address ) );
+#else
+   return maskload_backend( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 'complex<float>' values.
+// \ingroup intrinsics
+//
+// \param address The first 'complex<float>' value to be loaded.
+// \param n The number of 'complex<float>' values to be loaded \f$[0..size]\f$.
+// \return The loaded vector of 'complex<float>' values.
+//
+// This function loads the first \a n 'complex<float>' values starting at the given address
+// and sets all remaining elements of the vector to zero. No memory beyond the first \a n values
+// is accessed, which enables the vectorized treatment of the remainder of unpadded data. The
+// given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_cfloat_t maskload( const complex<float>* address, size_t n )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait< complex<float> >::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   return maskload_backend( address, n );
+#elif BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_ps( static_cast<__mmask16>( ( 1U << (2UL*n) ) - 1U ),
+                                 reinterpret_cast<const float*>( address ) );
+#elif BLAZE_AVX_MODE
+   const __m256 mask( _mm256_cmp_ps( _mm256_setr_ps( 0.0F, 0.0F, 1.0F, 1.0F, 2.0F, 2.0F, 3.0F, 3.0F ),
+                                     _mm256_set1_ps( static_cast<float>( n ) ), _CMP_LT_OQ ) );
+   return _mm256_maskload_ps( reinterpret_cast<const float*>( address ), _mm256_castps_si256( mask ) );
+#elif BLAZE_SSE2_MODE
+   return ( n == 0UL )?( _mm_setzero_ps() )
+                      :( n == 1UL )?( _mm_castpd_ps( _mm_load_sd( reinterpret_cast<const double*>( address ) ) ) )
+                                   :( _mm_loadu_ps( reinterpret_cast<const float*>( address ) ) );
+#else
+   return maskload_backend( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 'complex<double>' values.
+// \ingroup intrinsics
+//
+// \param address The first 'complex<double>' value to be loaded.
+// \param n The number of 'complex<double>' values to be loaded \f$[0..size]\f$.
+// \return The loaded vector of 'complex<double>' values.
+//
+// This function loads the first \a n 'complex<double>' values starting at the given address
+// and sets all remaining elements of the vector to zero. No memory beyond the first \a n values
+// is accessed, which enables the vectorized treatment of the remainder of unpadded data. The
+// given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_cdouble_t maskload( const complex<double>* address, size_t n )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait< complex<double> >::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   return maskload_backend( address, n );
+#elif BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_pd( static_cast<__mmask8>( ( 1U << (2UL*n) ) - 1U ),
+                                 reinterpret_cast<const double*>( address ) );
+#elif BLAZE_AVX_MODE
+   const __m256d mask( _mm256_cmp_pd( _mm256_setr_pd( 0.0, 0.0, 1.0, 1.0 ),
+                                      _mm256_set1_pd( static_cast<double>( n ) ), _CMP_LT_OQ ) );
+   return _mm256_maskload_pd( reinterpret_cast<const double*>( address ), _mm256_castpd_si256( mask ) );
+#else
+   return maskload_backend( address, n );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
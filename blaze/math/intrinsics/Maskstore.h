@@ -0,0 +1,335 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Maskstore.h
+//  \brief Header file for the intrinsic masked store functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_MASKSTORE_H_
+#define _BLAZE_MATH_INTRINSICS_MASKSTORE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Store.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC MASKSTORE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of a masked store for instruction sets without masked stores.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of values to be stored \f$[0..size]\f$.
+// \param value The vector to be stored.
+// \return void
+//
+// This function stores the first \a n values of the given vector via a properly aligned
+// temporary array. No memory beyond the first \a n values is accessed.
+*/
+template< typename T >  // Type of the values
+BLAZE_ALWAYS_INLINE void
+   maskstore_backend( T* address, size_t n, const typename IntrinsicTrait<T>::Type& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+   AlignedArray<T,IntrinsicTrait<T>::size> array;
+   store( array.data(), value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = array[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 2-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of integral values to be stored \f$[0..size]\f$.
+// \param value The 2-byte integral vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 2-byte integral values.
+// No memory beyond the first \a n values is accessed, which enables the vectorized treatment
+// of the remainder of unpadded data. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> > >::Type
+   maskstore( T* address, size_t n, const sse_int16_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   _mm512_mask_storeu_epi16( address, static_cast<__mmask32>( ( size_t(1) << n ) - 1UL ), value.value );
+#else
+   maskstore_backend( address, n, value );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 4-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of integral values to be stored \f$[0..size]\f$.
+// \param value The 4-byte integral vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 4-byte integral values.
+// No memory beyond the first \a n values is accessed, which enables the vectorized treatment
+// of the remainder of unpadded data. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::Type
+   maskstore( T* address, size_t n, const sse_int32_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   maskstore_backend( address, n, value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_epi32( address, static_cast<__mmask16>( ( 1U << n ) - 1U ), value.value );
+#elif BLAZE_AVX2_MODE
+   const __m256i mask( _mm256_cmpgt_epi32( _mm256_set1_epi32( static_cast<int>( n ) ),
+                                           _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) ) );
+   _mm256_maskstore_epi32( reinterpret_cast<int*>( address ), mask, value.value );
+#else
+   maskstore_backend( address, n, value );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 8-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of integral values to be stored \f$[0..size]\f$.
+// \param value The 8-byte integral vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 8-byte integral values.
+// No memory beyond the first \a n values is accessed, which enables the vectorized treatment
+// of the remainder of unpadded data. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::Type
+   maskstore( T* address, size_t n, const sse_int64_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   maskstore_backend( address, n, value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_epi64( address, static_cast<__mmask8>( ( 1U << n ) - 1U ), value.value );
+#elif BLAZE_AVX2_MODE
+   const __m256i mask( _mm256_cmpgt_epi64( _mm256_set1_epi64x( static_cast<long long>( n ) ),
+                                           _mm256_setr_epi64x( 0, 1, 2, 3 ) ) );
+   _mm256_maskstore_epi64( reinterpret_cast<long long*>( address ), mask, value.value );
+#else
+   maskstore_backend( address, n, value );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 'float' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of 'float' values to be stored \f$[0..size]\f$.
+// \param value The 'float' vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 'float' values. No memory
+// beyond the first \a n values is accessed, which enables the vectorized treatment of the
+// remainder of unpadded data. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE void maskstore( float* address, size_t n, const sse_float_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<float>::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   maskstore_backend( address, n, value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_ps( address, static_cast<__mmask16>( ( 1U << n ) - 1U ), value.value );
+#elif BLAZE_AVX_MODE
+   const __m256 mask( _mm256_cmp_ps( _mm256_setr_ps( 0.0F, 1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F, 7.0F ),
+                                     _mm256_set1_ps( static_cast<float>( n ) ), _CMP_LT_OQ ) );
+   _mm256_maskstore_ps( address, _mm256_castps_si256( mask ), value.value );
+#else
+   maskstore_backend( address, n, value );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 'double' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of 'double' values to be stored \f$[0..size]\f$.
+// \param value The 'double' vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 'double' values. No memory
+// beyond the first \a n values is accessed, which enables the vectorized treatment of the
+// remainder of unpadded data. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE void maskstore( double* address, size_t n, const sse_double_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<double>::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   maskstore_backend( address, n, value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_pd( address, static_cast<__mmask8>( ( 1U << n ) - 1U ), value.value );
+#elif BLAZE_AVX_MODE
+   const __m256d mask( _mm256_cmp_pd( _mm256_setr_pd( 0.0, 1.0, 2.0, 3.0 ),
+                                      _mm256_set1_pd( static_cast<double>( n ) ), _CMP_LT_OQ ) );
+   _mm256_maskstore_pd( address, _mm256_castpd_si256( mask ), value.value );
+#elif BLAZE_SSE2_MODE
+   if( n == 1UL )
+      _mm_store_sd( address, value.value );
+   else if( n == 2UL )
+      _mm_storeu_pd( address, value.value );
+#else
+   maskstore_backend( address, n, value );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 'complex<float>' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of 'complex<float>' values to be stored \f$[0..size]\f$.
+// \param value The 'complex<float>' vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 'complex<float>' values.
+// No memory beyond the first \a n values is accessed, which enables the vectorized treatment
+// of the remainder of unpadded data. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE void maskstore( complex<float>* address, size_t n, const sse_cfloat_t& value )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait< complex<float> >::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   maskstore_backend( address, n, value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_ps( reinterpret_cast<float*>( address ),
+                          static_cast<__mmask16>( ( 1U << (2UL*n) ) - 1U ), value.value );
+#elif BLAZE_AVX_MODE
+   const __m256 mask( _mm256_cmp_ps( _mm256_setr_ps( 0.0F, 0.0F, 1.0F, 1.0F, 2.0F, 2.0F, 3.0F, 3.0F ),
+                                     _mm256_set1_ps( static_cast<float>( n ) ), _CMP_LT_OQ ) );
+   _mm256_maskstore_ps( reinterpret_cast<float*>( address ), _mm256_castps_si256( mask ), value.value );
+#elif BLAZE_SSE2_MODE
+   if( n == 1UL )
+      _mm_store_sd( reinterpret_cast<double*>( address ), _mm_castps_pd( value.value ) );
+   else if( n == 2UL )
+      _mm_storeu_ps( reinterpret_cast<float*>( address ), value.value );
+#else
+   maskstore_backend( address, n, value );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 'complex<double>' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of 'complex<double>' values to be stored \f$[0..size]\f$.
+// \param value The 'complex<double>' vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 'complex<double>' values.
+// No memory beyond the first \a n values is accessed, which enables the vectorized treatment
+// of the remainder of unpadded data. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE void maskstore( complex<double>* address, size_t n, const sse_cdouble_t& value )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait< complex<double> >::size, "Invalid number of elements" );
+
+#if BLAZE_MIC_MODE
+   maskstore_backend( address, n, value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_pd( reinterpret_cast<double*>( address ),
+                          static_cast<__mmask8>( ( 1U << (2UL*n) ) - 1U ), value.value );
+#elif BLAZE_AVX_MODE
+   const __m256d mask( _mm256_cmp_pd( _mm256_setr_pd( 0.0, 0.0, 1.0, 1.0 ),
+                                      _mm256_set1_pd( static_cast<double>( n ) ), _CMP_LT_OQ ) );
+   _mm256_maskstore_pd( reinterpret_cast<double*>( address ), _mm256_castpd_si256( mask ), value.value );
+#else
+   maskstore_backend( address, n, value );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -62,7 +62,12 @@ namespace blaze {
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+BLAZE_ALWAYS_INLINE sse_int16_t operator*( const sse_int16_t& a, const sse_int16_t& b )
+{
+   return _mm512_mullo_epi16( a.value, b.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int16_t operator*( const sse_int16_t& a, const sse_int16_t& b )
 {
    return _mm256_mullo_epi16( a.value, b.value );
@@ -85,7 +90,7 @@ BLAZE_ALWAYS_INLINE sse_int16_t operator*( const sse_int16_t& a, const sse_int16
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
 BLAZE_ALWAYS_INLINE sse_int32_t operator*( const sse_int32_t& a, const sse_int32_t& b )
 {
    return _mm512_mullo_epi32( a.value, b.value );
@@ -113,7 +118,7 @@ BLAZE_ALWAYS_INLINE sse_int32_t operator*( const sse_int32_t& a, const sse_int32
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
 BLAZE_ALWAYS_INLINE sse_float_t operator*( const sse_float_t& a, const sse_float_t& b )
 {
    return _mm512_mul_ps( a.value, b.value );
@@ -141,7 +146,7 @@ BLAZE_ALWAYS_INLINE sse_float_t operator*( const sse_float_t& a, const sse_float
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
 BLAZE_ALWAYS_INLINE sse_double_t operator*( const sse_double_t& a, const sse_double_t& b )
 {
    return _mm512_mul_pd( a.value, b.value );
@@ -169,7 +174,29 @@ BLAZE_ALWAYS_INLINE sse_double_t operator*( const sse_double_t& a, const sse_dou
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t operator*( const sse_cfloat_t& a, const sse_cfloat_t& b )
+{
+   __m512 x, y;
+
+   x = _mm512_shuffle_ps( a.value, a.value, 0xF5 );
+   y = _mm512_shuffle_ps( b.value, b.value, 0xB1 );
+   y = _mm512_mul_ps( x, y );
+   x = _mm512_shuffle_ps( a.value, a.value, 0xA0 );
+   return _mm512_fmaddsub_ps( x, b.value, y );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t operator*( const sse_cfloat_t& a, const sse_cfloat_t& b )
+{
+   __m256 x, y;
+
+   x = _mm256_shuffle_ps( a.value, a.value, 0xF5 );
+   y = _mm256_shuffle_ps( b.value, b.value, 0xB1 );
+   y = _mm256_mul_ps( x, y );
+   x = _mm256_shuffle_ps( a.value, a.value, 0xA0 );
+   return _mm256_fmaddsub_ps( x, b.value, y );
+}
+#elif BLAZE_AVX_MODE
 BLAZE_ALWAYS_INLINE sse_cfloat_t operator*( const sse_cfloat_t& a, const sse_cfloat_t& b )
 {
    __m256 x, y, z;
@@ -206,7 +233,29 @@ BLAZE_ALWAYS_INLINE sse_cfloat_t operator*( const sse_cfloat_t& a, const sse_cfl
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t operator*( const sse_cdouble_t& a, const sse_cdouble_t& b )
+{
+   __m512d x, y;
+
+   x = _mm512_shuffle_pd( a.value, a.value, 0xFF );
+   y = _mm512_shuffle_pd( b.value, b.value, 0x55 );
+   y = _mm512_mul_pd( x, y );
+   x = _mm512_shuffle_pd( a.value, a.value, 0x00 );
+   return _mm512_fmaddsub_pd( x, b.value, y );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t operator*( const sse_cdouble_t& a, const sse_cdouble_t& b )
+{
+   __m256d x, y;
+
+   x = _mm256_shuffle_pd( a.value, a.value, 15 );
+   y = _mm256_shuffle_pd( b.value, b.value, 5 );
+   y = _mm256_mul_pd( x, y );
+   x = _mm256_shuffle_pd( a.value, a.value, 0 );
+   return _mm256_fmaddsub_pd( x, b.value, y );
+}
+#elif BLAZE_AVX_MODE
 BLAZE_ALWAYS_INLINE sse_cdouble_t operator*( const sse_cdouble_t& a, const sse_cdouble_t& b )
 {
    __m256d x, y, z;
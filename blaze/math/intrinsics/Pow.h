@@ -0,0 +1,162 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Pow.h
+//  \brief Header file for the intrinsic power functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_POW_H_
+#define _BLAZE_MATH_INTRINSICS_POW_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <blaze/math/intrinsics/Abs.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Comparison.h>
+#include <blaze/math/intrinsics/Exp.h>
+#include <blaze/math/intrinsics/Log.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Rounding.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC POWER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_double_t pow( sse_double_t, sse_double_t )
+// \brief Computes the power function for two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of bases.
+// \param b The vector of exponents.
+// \return The resulting vector \f$ a^b \f$.
+//
+// The power is computed as \f$ e^{b \cdot ln|a|} \f$. Negative bases result in NaN, unless the
+// according exponent is an integral value. Note that the relative rounding error of the product
+// \f$ b \cdot ln|a| \f$ is amplified by the exponential function, i.e. the relative error of
+// the result grows linearly with \f$ |b \cdot ln(a)| \f$ and is bounded by approximately
+// \f$ 2 \cdot (1+|b \cdot ln(a)|) \f$ ulp. The sign of negative zero bases is ignored.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_double_t pow( const sse_double_t& a, const sse_double_t& b )
+{
+   const sse_double_t zero( set( 0.0 ) );
+   const sse_double_t one ( set( 1.0 ) );
+   const sse_double_t half( b * set( 0.5 ) );
+
+   const sse_double_t negative( cmplt( a, zero ) );
+   const sse_double_t integral( cmpeq( floor( b ), b ) );
+   const sse_double_t odd     ( cmpneq( floor( half ), half ) );
+
+   const sse_double_t tmp( exp( b * log( abs( a ) ) ) );
+   const sse_double_t neg( select( integral, select( odd, tmp * set( -1.0 ), tmp ),
+                                   set( std::numeric_limits<double>::quiet_NaN() ) ) );
+
+   sse_double_t res( select( negative, neg, tmp ) );
+   res = select( cmpeq( a, one ), one, select( cmpeq( b, zero ), one, res ) );
+
+   return res;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t pow( sse_float_t, sse_float_t )
+// \brief Computes the power function for two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of bases.
+// \param b The vector of exponents.
+// \return The resulting vector \f$ a^b \f$.
+//
+// In order to prevent the amplification of rounding errors by the exponential function, the
+// power is evaluated in double precision and the result is rounded to single precision. Negative
+// bases result in NaN, unless the according exponent is an integral value. The sign of negative
+// zero bases is ignored.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t pow( const sse_float_t& a, const sse_float_t& b )
+{
+   const __m512d atmp( _mm512_castps_pd( a.value ) );
+   const __m512d btmp( _mm512_castps_pd( b.value ) );
+   const __m256 alo( _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, atmp, 0 ) ) );
+   const __m256 ahi( _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, atmp, 1 ) ) );
+   const __m256 blo( _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, btmp, 0 ) ) );
+   const __m256 bhi( _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, btmp, 1 ) ) );
+
+   const sse_double_t lo( pow( sse_double_t( _mm512_maskz_cvtps_pd( 0xFF, alo ) ),
+                               sse_double_t( _mm512_maskz_cvtps_pd( 0xFF, blo ) ) ) );
+   const sse_double_t hi( pow( sse_double_t( _mm512_maskz_cvtps_pd( 0xFF, ahi ) ),
+                               sse_double_t( _mm512_maskz_cvtps_pd( 0xFF, bhi ) ) ) );
+
+   const __m256d rlo( _mm256_castps_pd( _mm512_maskz_cvtpd_ps( 0xFF, lo.value ) ) );
+   const __m256d rhi( _mm256_castps_pd( _mm512_maskz_cvtpd_ps( 0xFF, hi.value ) ) );
+   return _mm512_castpd_ps( _mm512_maskz_insertf64x4( 0xFF, _mm512_maskz_insertf64x4( 0xFF, _mm512_setzero_pd(), rlo, 0 ), rhi, 1 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t pow( const sse_float_t& a, const sse_float_t& b )
+{
+   const sse_double_t lo( pow( sse_double_t( _mm256_cvtps_pd( _mm256_castps256_ps128( a.value ) ) ),
+                               sse_double_t( _mm256_cvtps_pd( _mm256_castps256_ps128( b.value ) ) ) ) );
+   const sse_double_t hi( pow( sse_double_t( _mm256_cvtps_pd( _mm256_extractf128_ps( a.value, 1 ) ) ),
+                               sse_double_t( _mm256_cvtps_pd( _mm256_extractf128_ps( b.value, 1 ) ) ) ) );
+
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm256_cvtpd_ps( lo.value ) ), _mm256_cvtpd_ps( hi.value ), 1 );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t pow( const sse_float_t& a, const sse_float_t& b )
+{
+   const sse_double_t lo( pow( sse_double_t( _mm_cvtps_pd( a.value ) ),
+                               sse_double_t( _mm_cvtps_pd( b.value ) ) ) );
+   const sse_double_t hi( pow( sse_double_t( _mm_cvtps_pd( _mm_movehl_ps( a.value, a.value ) ) ),
+                               sse_double_t( _mm_cvtps_pd( _mm_movehl_ps( b.value, b.value ) ) ) ) );
+
+   return _mm_movelh_ps( _mm_cvtpd_ps( lo.value ), _mm_cvtpd_ps( hi.value ) );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
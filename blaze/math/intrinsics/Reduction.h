@@ -53,6 +53,37 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Returns the sum of all elements in the 8-bit integral intrinsic vector.
+// \ingroup intrinsics
+//
+// \param a The vector to be sumed up.
+// \return The sum of all vector elements.
+*/
+BLAZE_ALWAYS_INLINE int8_t sum( const sse_int8_t& a )
+{
+#if BLAZE_AVX512BW_MODE
+   const __m512i b = _mm512_sad_epu8( a.value, _mm512_setzero_si512() );
+   const __m256i* const v( reinterpret_cast<const __m256i*>( &b ) );
+   const __m256i c = _mm256_add_epi64( v[0], v[1] );
+   const __m128i d = _mm_add_epi64( _mm256_extracti128_si256( c, 1 )
+                                  , _mm256_castsi256_si128( c ) );
+   return static_cast<int8_t>( _mm_cvtsi128_si32( d ) + _mm_extract_epi16( d, 4 ) );
+#elif BLAZE_AVX2_MODE
+   const __m256i b = _mm256_sad_epu8( a.value, _mm256_setzero_si256() );
+   const __m128i c = _mm_add_epi64( _mm256_extracti128_si256( b, 1 )
+                                  , _mm256_castsi256_si128( b ) );
+   return static_cast<int8_t>( _mm_cvtsi128_si32( c ) + _mm_extract_epi16( c, 4 ) );
+#elif BLAZE_SSE2_MODE
+   const __m128i b = _mm_sad_epu8( a.value, _mm_setzero_si128() );
+   return static_cast<int8_t>( _mm_cvtsi128_si32( b ) + _mm_extract_epi16( b, 4 ) );
+#else
+   return a.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the sum of all elements in the 16-bit integral intrinsic vector.
 // \ingroup intrinsics
@@ -62,7 +93,16 @@ namespace blaze {
 */
 BLAZE_ALWAYS_INLINE int16_t sum( const sse_int16_t& a )
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   const __m256i* const v( reinterpret_cast<const __m256i*>( &a.value ) );
+   const __m256i b = _mm256_add_epi16( v[0], v[1] );
+   const __m256i c = _mm256_hadd_epi16( b, b );
+   const __m256i d = _mm256_hadd_epi16( c, c );
+   const __m256i e = _mm256_hadd_epi16( d, d );
+   const __m128i f = _mm_add_epi16( _mm256_extracti128_si256( e, 1 )
+                                  , _mm256_castsi256_si128( e ) );
+   return _mm_extract_epi16( f, 0 );
+#elif BLAZE_AVX2_MODE
    const sse_int16_t b( _mm256_hadd_epi16( a.value, a.value ) );
    const sse_int16_t c( _mm256_hadd_epi16( b.value, b.value ) );
    const sse_int16_t d( _mm256_hadd_epi16( c.value, c.value ) );
@@ -94,6 +134,14 @@ BLAZE_ALWAYS_INLINE int32_t sum( const sse_int32_t& a )
 {
 #if BLAZE_MIC_MODE
    return _mm512_reduce_add_epi32( a.value );
+#elif BLAZE_AVX512F_MODE
+   const __m256i* const v( reinterpret_cast<const __m256i*>( &a.value ) );
+   const __m256i b = _mm256_add_epi32( v[0], v[1] );
+   const __m256i c = _mm256_hadd_epi32( b, b );
+   const __m256i d = _mm256_hadd_epi32( c, c );
+   const __m128i e = _mm_add_epi32( _mm256_extracti128_si256( d, 1 )
+                                  , _mm256_castsi256_si128( d ) );
+   return _mm_extract_epi32( e, 0 );
 #elif BLAZE_AVX2_MODE
    const sse_int32_t b( _mm256_hadd_epi32( a.value, a.value ) );
    const sse_int32_t c( _mm256_hadd_epi32( b.value, b.value ) );
@@ -124,6 +172,12 @@ BLAZE_ALWAYS_INLINE int64_t sum( const sse_int64_t& a )
 {
 #if BLAZE_MIC_MODE
    return _mm512_reduce_add_epi64( a.value );
+#elif BLAZE_AVX512F_MODE
+   const __m256i* const v( reinterpret_cast<const __m256i*>( &a.value ) );
+   const __m256i b = _mm256_add_epi64( v[0], v[1] );
+   const __m128i c = _mm_add_epi64( _mm256_extracti128_si256( b, 1 )
+                                  , _mm256_castsi256_si128( b ) );
+   return _mm_extract_epi64( c, 0 ) + _mm_extract_epi64( c, 1 );
 #elif BLAZE_AVX2_MODE
    return a[0] + a[1] + a[2] + a[3];
 #elif BLAZE_SSE2_MODE
@@ -146,6 +200,14 @@ BLAZE_ALWAYS_INLINE float sum( const sse_float_t& a )
 {
 #if BLAZE_MIC_MODE
    return _mm512_reduce_add_ps( a.value );
+#elif BLAZE_AVX512F_MODE
+   const __m256* const v( reinterpret_cast<const __m256*>( &a.value ) );
+   const __m256 b = _mm256_add_ps( v[0], v[1] );
+   const __m256 c = _mm256_hadd_ps( b, b );
+   const __m256 d = _mm256_hadd_ps( c, c );
+   const __m128 e = _mm_add_ps( _mm256_extractf128_ps( d, 1 )
+                              , _mm256_castps256_ps128( d ) );
+   return *reinterpret_cast<const float*>( &e );
 #elif BLAZE_AVX_MODE
    const sse_float_t b( _mm256_hadd_ps( a.value, a.value ) );
    const sse_float_t c( _mm256_hadd_ps( b.value, b.value ) );
@@ -176,6 +238,13 @@ BLAZE_ALWAYS_INLINE double sum( const sse_double_t& a )
 {
 #if BLAZE_MIC_MODE
    return _mm512_reduce_add_pd( a.value );
+#elif BLAZE_AVX512F_MODE
+   const __m256d* const v( reinterpret_cast<const __m256d*>( &a.value ) );
+   const __m256d b = _mm256_add_pd( v[0], v[1] );
+   const __m256d c = _mm256_hadd_pd( b, b );
+   const __m128d d = _mm_add_pd( _mm256_extractf128_pd( c, 1 )
+                               , _mm256_castpd256_pd128( c ) );
+   return *reinterpret_cast<const double*>( &d );
 #elif BLAZE_AVX_MODE
    const sse_double_t b( _mm256_hadd_pd( a.value, a.value ) );
    const __m128d c = _mm_add_pd( _mm256_extractf128_pd( b.value, 1 )
@@ -204,6 +273,8 @@ BLAZE_ALWAYS_INLINE complex<float> sum( const sse_cfloat_t& a )
 {
 #if BLAZE_MIC_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
+#elif BLAZE_AVX512F_MODE
+   return complex<float>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_AVX_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_SSE_MODE
@@ -226,6 +297,8 @@ BLAZE_ALWAYS_INLINE complex<double> sum( const sse_cdouble_t& a )
 {
 #if BLAZE_MIC_MODE
    return complex<double>( a[0] + a[1] + a[2] + a[3] );
+#elif BLAZE_AVX512F_MODE
+   return complex<double>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_AVX_MODE
    return complex<double>( a[0] + a[1] );
 #elif BLAZE_SSE2_MODE
@@ -236,6 +309,240 @@ BLAZE_ALWAYS_INLINE complex<double> sum( const sse_cdouble_t& a )
 }
 //*************************************************************************************************
 
+
+
+//=================================================================================================
+//
+//  INTRINSIC PROD OPERATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the product of all elements in the single precision floating point
+//        intrinsic vector.
+// \ingroup intrinsics
+//
+// \param a The vector to be multiplied up.
+// \return The product of all vector elements.
+*/
+BLAZE_ALWAYS_INLINE float prod( const sse_float_t& a )
+{
+#if BLAZE_MIC_MODE
+   return _mm512_reduce_mul_ps( a.value );
+#elif BLAZE_AVX512F_MODE
+   const __m256* const v( reinterpret_cast<const __m256*>( &a.value ) );
+   const __m256 b = _mm256_mul_ps( v[0], v[1] );
+   const __m128 c = _mm_mul_ps( _mm256_extractf128_ps( b, 1 )
+                              , _mm256_castps256_ps128( b ) );
+   const __m128 d = _mm_mul_ps( c, _mm_movehl_ps( c, c ) );
+   const __m128 e = _mm_mul_ss( d, _mm_shuffle_ps( d, d, 1 ) );
+   return _mm_cvtss_f32( e );
+#elif BLAZE_AVX_MODE
+   const __m128 b = _mm_mul_ps( _mm256_extractf128_ps( a.value, 1 )
+                              , _mm256_castps256_ps128( a.value ) );
+   const __m128 c = _mm_mul_ps( b, _mm_movehl_ps( b, b ) );
+   const __m128 d = _mm_mul_ss( c, _mm_shuffle_ps( c, c, 1 ) );
+   return _mm_cvtss_f32( d );
+#elif BLAZE_SSE_MODE
+   const __m128 b = _mm_mul_ps( a.value, _mm_movehl_ps( a.value, a.value ) );
+   const __m128 c = _mm_mul_ss( b, _mm_shuffle_ps( b, b, 1 ) );
+   return _mm_cvtss_f32( c );
+#else
+   return a.value;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the product of all elements in the double precision floating point
+//        intrinsic vector.
+// \ingroup intrinsics
+//
+// \param a The vector to be multiplied up.
+// \return The product of all vector elements.
+*/
+BLAZE_ALWAYS_INLINE double prod( const sse_double_t& a )
+{
+#if BLAZE_MIC_MODE
+   return _mm512_reduce_mul_pd( a.value );
+#elif BLAZE_AVX512F_MODE
+   const __m256d* const v( reinterpret_cast<const __m256d*>( &a.value ) );
+   const __m256d b = _mm256_mul_pd( v[0], v[1] );
+   const __m128d c = _mm_mul_pd( _mm256_extractf128_pd( b, 1 )
+                               , _mm256_castpd256_pd128( b ) );
+   const __m128d d = _mm_mul_sd( c, _mm_unpackhi_pd( c, c ) );
+   return _mm_cvtsd_f64( d );
+#elif BLAZE_AVX_MODE
+   const __m128d b = _mm_mul_pd( _mm256_extractf128_pd( a.value, 1 )
+                               , _mm256_castpd256_pd128( a.value ) );
+   const __m128d c = _mm_mul_sd( b, _mm_unpackhi_pd( b, b ) );
+   return _mm_cvtsd_f64( c );
+#elif BLAZE_SSE2_MODE
+   const __m128d b = _mm_mul_sd( a.value, _mm_unpackhi_pd( a.value, a.value ) );
+   return _mm_cvtsd_f64( b );
+#else
+   return a.value;
+#endif
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC MIN OPERATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the minimum of all elements in the single precision floating point
+//        intrinsic vector.
+// \ingroup intrinsics
+//
+// \param a The vector to be searched.
+// \return The minimum of all vector elements.
+*/
+BLAZE_ALWAYS_INLINE float min( const sse_float_t& a )
+{
+#if BLAZE_MIC_MODE
+   return _mm512_reduce_min_ps( a.value );
+#elif BLAZE_AVX512F_MODE
+   const __m256* const v( reinterpret_cast<const __m256*>( &a.value ) );
+   const __m256 b = _mm256_min_ps( v[0], v[1] );
+   const __m128 c = _mm_min_ps( _mm256_extractf128_ps( b, 1 )
+                              , _mm256_castps256_ps128( b ) );
+   const __m128 d = _mm_min_ps( c, _mm_movehl_ps( c, c ) );
+   const __m128 e = _mm_min_ss( d, _mm_shuffle_ps( d, d, 1 ) );
+   return _mm_cvtss_f32( e );
+#elif BLAZE_AVX_MODE
+   const __m128 b = _mm_min_ps( _mm256_extractf128_ps( a.value, 1 )
+                              , _mm256_castps256_ps128( a.value ) );
+   const __m128 c = _mm_min_ps( b, _mm_movehl_ps( b, b ) );
+   const __m128 d = _mm_min_ss( c, _mm_shuffle_ps( c, c, 1 ) );
+   return _mm_cvtss_f32( d );
+#elif BLAZE_SSE_MODE
+   const __m128 b = _mm_min_ps( a.value, _mm_movehl_ps( a.value, a.value ) );
+   const __m128 c = _mm_min_ss( b, _mm_shuffle_ps( b, b, 1 ) );
+   return _mm_cvtss_f32( c );
+#else
+   return a.value;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the minimum of all elements in the double precision floating point
+//        intrinsic vector.
+// \ingroup intrinsics
+//
+// \param a The vector to be searched.
+// \return The minimum of all vector elements.
+*/
+BLAZE_ALWAYS_INLINE double min( const sse_double_t& a )
+{
+#if BLAZE_MIC_MODE
+   return _mm512_reduce_min_pd( a.value );
+#elif BLAZE_AVX512F_MODE
+   const __m256d* const v( reinterpret_cast<const __m256d*>( &a.value ) );
+   const __m256d b = _mm256_min_pd( v[0], v[1] );
+   const __m128d c = _mm_min_pd( _mm256_extractf128_pd( b, 1 )
+                               , _mm256_castpd256_pd128( b ) );
+   const __m128d d = _mm_min_sd( c, _mm_unpackhi_pd( c, c ) );
+   return _mm_cvtsd_f64( d );
+#elif BLAZE_AVX_MODE
+   const __m128d b = _mm_min_pd( _mm256_extractf128_pd( a.value, 1 )
+                               , _mm256_castpd256_pd128( a.value ) );
+   const __m128d c = _mm_min_sd( b, _mm_unpackhi_pd( b, b ) );
+   return _mm_cvtsd_f64( c );
+#elif BLAZE_SSE2_MODE
+   const __m128d b = _mm_min_sd( a.value, _mm_unpackhi_pd( a.value, a.value ) );
+   return _mm_cvtsd_f64( b );
+#else
+   return a.value;
+#endif
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC MAX OPERATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the maximum of all elements in the single precision floating point
+//        intrinsic vector.
+// \ingroup intrinsics
+//
+// \param a The vector to be searched.
+// \return The maximum of all vector elements.
+*/
+BLAZE_ALWAYS_INLINE float max( const sse_float_t& a )
+{
+#if BLAZE_MIC_MODE
+   return _mm512_reduce_max_ps( a.value );
+#elif BLAZE_AVX512F_MODE
+   const __m256* const v( reinterpret_cast<const __m256*>( &a.value ) );
+   const __m256 b = _mm256_max_ps( v[0], v[1] );
+   const __m128 c = _mm_max_ps( _mm256_extractf128_ps( b, 1 )
+                              , _mm256_castps256_ps128( b ) );
+   const __m128 d = _mm_max_ps( c, _mm_movehl_ps( c, c ) );
+   const __m128 e = _mm_max_ss( d, _mm_shuffle_ps( d, d, 1 ) );
+   return _mm_cvtss_f32( e );
+#elif BLAZE_AVX_MODE
+   const __m128 b = _mm_max_ps( _mm256_extractf128_ps( a.value, 1 )
+                              , _mm256_castps256_ps128( a.value ) );
+   const __m128 c = _mm_max_ps( b, _mm_movehl_ps( b, b ) );
+   const __m128 d = _mm_max_ss( c, _mm_shuffle_ps( c, c, 1 ) );
+   return _mm_cvtss_f32( d );
+#elif BLAZE_SSE_MODE
+   const __m128 b = _mm_max_ps( a.value, _mm_movehl_ps( a.value, a.value ) );
+   const __m128 c = _mm_max_ss( b, _mm_shuffle_ps( b, b, 1 ) );
+   return _mm_cvtss_f32( c );
+#else
+   return a.value;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum of all elements in the double precision floating point
+//        intrinsic vector.
+// \ingroup intrinsics
+//
+// \param a The vector to be searched.
+// \return The maximum of all vector elements.
+*/
+BLAZE_ALWAYS_INLINE double max( const sse_double_t& a )
+{
+#if BLAZE_MIC_MODE
+   return _mm512_reduce_max_pd( a.value );
+#elif BLAZE_AVX512F_MODE
+   const __m256d* const v( reinterpret_cast<const __m256d*>( &a.value ) );
+   const __m256d b = _mm256_max_pd( v[0], v[1] );
+   const __m128d c = _mm_max_pd( _mm256_extractf128_pd( b, 1 )
+                               , _mm256_castpd256_pd128( b ) );
+   const __m128d d = _mm_max_sd( c, _mm_unpackhi_pd( c, c ) );
+   return _mm_cvtsd_f64( d );
+#elif BLAZE_AVX_MODE
+   const __m128d b = _mm_max_pd( _mm256_extractf128_pd( a.value, 1 )
+                               , _mm256_castpd256_pd128( a.value ) );
+   const __m128d c = _mm_max_sd( b, _mm_unpackhi_pd( b, b ) );
+   return _mm_cvtsd_f64( c );
+#elif BLAZE_SSE2_MODE
+   const __m128d b = _mm_max_sd( a.value, _mm_unpackhi_pd( a.value, a.value ) );
+   return _mm_cvtsd_f64( b );
+#else
+   return a.value;
+#endif
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,201 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Rounding.h
+//  \brief Header file for the intrinsic rounding functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_ROUNDING_H_
+#define _BLAZE_MATH_INTRINSICS_ROUNDING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC ROUNDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_float_t round( sse_float_t )
+// \brief Rounds a vector of single precision floating point values to the nearest integers.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values to be rounded.
+// \return The rounded values.
+//
+// Halfway cases are rounded to the nearest even integer.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t round( const sse_float_t& a )
+{
+   return _mm512_maskz_roundscale_ps( 0xFFFF, a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t round( const sse_float_t& a )
+{
+   return _mm256_round_ps( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+#elif BLAZE_SSE4_MODE
+BLAZE_ALWAYS_INLINE sse_float_t round( const sse_float_t& a )
+{
+   return _mm_round_ps( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t round( const sse_float_t& a )
+{
+   const __m128 limit( _mm_set1_ps( 8388608.0F ) );  // 2^23
+   const __m128 sign ( _mm_and_ps( a.value, _mm_set1_ps( -0.0F ) ) );
+   const __m128 magic( _mm_or_ps( limit, sign ) );
+   const __m128 tmp  ( _mm_sub_ps( _mm_add_ps( a.value, magic ), magic ) );
+   const __m128 mask ( _mm_cmplt_ps( _mm_andnot_ps( sign, a.value ), limit ) );
+   return _mm_or_ps( _mm_and_ps( mask, tmp ), _mm_andnot_ps( mask, a.value ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t round( sse_double_t )
+// \brief Rounds a vector of double precision floating point values to the nearest integers.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values to be rounded.
+// \return The rounded values.
+//
+// Halfway cases are rounded to the nearest even integer.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t round( const sse_double_t& a )
+{
+   return _mm512_maskz_roundscale_pd( 0xFF, a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t round( const sse_double_t& a )
+{
+   return _mm256_round_pd( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+#elif BLAZE_SSE4_MODE
+BLAZE_ALWAYS_INLINE sse_double_t round( const sse_double_t& a )
+{
+   return _mm_round_pd( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t round( const sse_double_t& a )
+{
+   const __m128d limit( _mm_set1_pd( 4503599627370496.0 ) );  // 2^52
+   const __m128d sign ( _mm_and_pd( a.value, _mm_set1_pd( -0.0 ) ) );
+   const __m128d magic( _mm_or_pd( limit, sign ) );
+   const __m128d tmp  ( _mm_sub_pd( _mm_add_pd( a.value, magic ), magic ) );
+   const __m128d mask ( _mm_cmplt_pd( _mm_andnot_pd( sign, a.value ), limit ) );
+   return _mm_or_pd( _mm_and_pd( mask, tmp ), _mm_andnot_pd( mask, a.value ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t floor( sse_float_t )
+// \brief Rounds a vector of single precision floating point values downward.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values to be rounded.
+// \return The largest integral values not greater than the given values.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t floor( const sse_float_t& a )
+{
+   return _mm512_maskz_roundscale_ps( 0xFFFF, a.value, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t floor( const sse_float_t& a )
+{
+   return _mm256_floor_ps( a.value );
+}
+#elif BLAZE_SSE4_MODE
+BLAZE_ALWAYS_INLINE sse_float_t floor( const sse_float_t& a )
+{
+   return _mm_floor_ps( a.value );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t floor( const sse_float_t& a )
+{
+   const __m128 tmp( round( a ).value );
+   return _mm_sub_ps( tmp, _mm_and_ps( _mm_cmplt_ps( a.value, tmp ), _mm_set1_ps( 1.0F ) ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t floor( sse_double_t )
+// \brief Rounds a vector of double precision floating point values downward.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values to be rounded.
+// \return The largest integral values not greater than the given values.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t floor( const sse_double_t& a )
+{
+   return _mm512_maskz_roundscale_pd( 0xFF, a.value, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t floor( const sse_double_t& a )
+{
+   return _mm256_floor_pd( a.value );
+}
+#elif BLAZE_SSE4_MODE
+BLAZE_ALWAYS_INLINE sse_double_t floor( const sse_double_t& a )
+{
+   return _mm_floor_pd( a.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t floor( const sse_double_t& a )
+{
+   const __m128d tmp( round( a ).value );
+   return _mm_sub_pd( tmp, _mm_and_pd( _mm_cmplt_pd( a.value, tmp ), _mm_set1_pd( 1.0 ) ) );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
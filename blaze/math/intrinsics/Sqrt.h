@@ -0,0 +1,171 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Sqrt.h
+//  \brief Header file for the intrinsic square root functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_SQRT_H_
+#define _BLAZE_MATH_INTRINSICS_SQRT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC SQUARE ROOT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_float_t sqrt( sse_float_t )
+// \brief Computes the square root of a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The square roots of the given values.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t sqrt( const sse_float_t& a )
+{
+   return _mm512_maskz_sqrt_ps( 0xFFFF, a.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t sqrt( const sse_float_t& a )
+{
+   return _mm256_sqrt_ps( a.value );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t sqrt( const sse_float_t& a )
+{
+   return _mm_sqrt_ps( a.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t sqrt( sse_double_t )
+// \brief Computes the square root of a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The square roots of the given values.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t sqrt( const sse_double_t& a )
+{
+   return _mm512_maskz_sqrt_pd( 0xFF, a.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t sqrt( const sse_double_t& a )
+{
+   return _mm256_sqrt_pd( a.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t sqrt( const sse_double_t& a )
+{
+   return _mm_sqrt_pd( a.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t invsqrt( sse_float_t )
+// \brief Computes the inverse square root of a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The inverse square roots of the given values.
+//
+// The inverse square root is computed by a full precision square root and division. Therefore the
+// result is identical to the scalar computation 1/sqrt(x).
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t invsqrt( const sse_float_t& a )
+{
+   return _mm512_div_ps( _mm512_set1_ps( 1.0F ), _mm512_maskz_sqrt_ps( 0xFFFF, a.value ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t invsqrt( const sse_float_t& a )
+{
+   return _mm256_div_ps( _mm256_set1_ps( 1.0F ), _mm256_sqrt_ps( a.value ) );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t invsqrt( const sse_float_t& a )
+{
+   return _mm_div_ps( _mm_set1_ps( 1.0F ), _mm_sqrt_ps( a.value ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t invsqrt( sse_double_t )
+// \brief Computes the inverse square root of a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The inverse square roots of the given values.
+//
+// The inverse square root is computed by a full precision square root and division. Therefore the
+// result is identical to the scalar computation 1/sqrt(x).
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t invsqrt( const sse_double_t& a )
+{
+   return _mm512_div_pd( _mm512_set1_pd( 1.0 ), _mm512_maskz_sqrt_pd( 0xFF, a.value ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t invsqrt( const sse_double_t& a )
+{
+   return _mm256_div_pd( _mm256_set1_pd( 1.0 ), _mm256_sqrt_pd( a.value ) );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t invsqrt( const sse_double_t& a )
+{
+   return _mm_div_pd( _mm_set1_pd( 1.0 ), _mm_sqrt_pd( a.value ) );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -73,7 +73,7 @@ namespace blaze {
 //
 // This function stores a vector of 2-byte integral values. The given address must be aligned
 // according to the enabled instruction set (16-byte alignment in case of SSE, 32-byte alignment
-// in case of AVX, and 64-byte alignment in case of MIC.
+// in case of AVX, and 64-byte alignment in case of AVX-512 or MIC.
 */
 template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> > >::Type
@@ -81,7 +81,9 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> > >::T
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_store_si512( address, value.value );
+#elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
    _mm_store_si128( reinterpret_cast<__m128i*>( address ), value.value );
@@ -102,7 +104,7 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> > >::T
 //
 // This function stores a vector of 4-byte integral values. The given address must be aligned
 // according to the enabled instruction set (16-byte alignment in case of SSE, 32-byte alignment
-// in case of AVX, and 64-byte alignment in case of MIC.
+// in case of AVX, and 64-byte alignment in case of AVX-512 or MIC.
 */
 template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::Type
@@ -110,7 +112,7 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::T
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    _mm512_store_epi32( address, value.value );
 #elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
@@ -133,7 +135,7 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::T
 //
 // This function stores a vector of 8-byte integral values. The given address must be aligned
 // according to the enabled instruction set (16-byte alignment in case of SSE, 32-byte alignment
-// in case of AVX, and 64-byte alignment in case of MIC.
+// in case of AVX, and 64-byte alignment in case of AVX-512 or MIC.
 */
 template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::Type
@@ -141,7 +143,7 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::T
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    _mm512_store_epi64( address, value.value );
 #elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
@@ -164,13 +166,13 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::T
 //
 // This function stores a vector of 'float' values. The given address must be aligned according
 // to the enabled instruction set (16-byte alignment in case of SSE, 32-byte alignment in case of
-// AVX, and 64-byte alignment in case of MIC.
+// AVX, and 64-byte alignment in case of AVX-512 or MIC.
 */
 BLAZE_ALWAYS_INLINE void store( float* address, const sse_float_t& value )
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    _mm512_store_ps( address, value.value );
 #elif BLAZE_AVX_MODE
    _mm256_store_ps( address, value.value );
@@ -193,13 +195,13 @@ BLAZE_ALWAYS_INLINE void store( float* address, const sse_float_t& value )
 //
 // This function stores a vector of 'double' values. The given address must be aligned according
 // to the enabled instruction set (16-byte alignment in case of SSE, 32-byte alignment in case of
-// AVX, and 64-byte alignment in case of MIC.
+// AVX, and 64-byte alignment in case of AVX-512 or MIC.
 */
 BLAZE_ALWAYS_INLINE void store( double* address, const sse_double_t& value )
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    _mm512_store_pd( address, value.value );
 #elif BLAZE_AVX_MODE
    _mm256_store_pd( address, value.value );
@@ -222,14 +224,14 @@ BLAZE_ALWAYS_INLINE void store( double* address, const sse_double_t& value )
 //
 // This function stores a vector of 'complex<float>' values. The given address must be aligned
 // according to the enabled instruction set (16-byte alignment in case of SSE, 32-byte alignment
-// in case of AVX, and 64-byte alignment in case of MIC.
+// in case of AVX, and 64-byte alignment in case of AVX-512 or MIC.
 */
 BLAZE_ALWAYS_INLINE void store( complex<float>* address, const sse_cfloat_t& value )
 {
    BLAZE_STATIC_ASSERT  ( sizeof( complex<float> ) == 2UL*sizeof( float ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    _mm512_store_ps( reinterpret_cast<float*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_store_ps( reinterpret_cast<float*>( address ), value.value );
@@ -252,14 +254,14 @@ BLAZE_ALWAYS_INLINE void store( complex<float>* address, const sse_cfloat_t& val
 //
 // This function stores a vector of 'complex<double>' values. The given address must be aligned
 // according to the enabled instruction set (16-byte alignment in case of SSE, 32-byte alignment
-// in case of AVX, and 64-byte alignment in case of MIC.
+// in case of AVX, and 64-byte alignment in case of AVX-512 or MIC.
 */
 BLAZE_ALWAYS_INLINE void store( complex<double>* address, const sse_cdouble_t& value )
 {
    BLAZE_STATIC_ASSERT  ( sizeof( complex<double> ) == 2UL*sizeof( double ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    _mm512_store_pd( reinterpret_cast<double*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_store_pd( reinterpret_cast<double*>( address ), value.value );
@@ -77,7 +77,9 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> > >::T
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_stream_si512( reinterpret_cast<__m512i*>( address ), value.value );
+#elif BLAZE_AVX2_MODE
    _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
    _mm_stream_si128( reinterpret_cast<__m128i*>( address ), value.value );
@@ -104,6 +106,8 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::T
 
 #if BLAZE_MIC_MODE
    _mm512_store_epi32( address, value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_stream_si512( reinterpret_cast<__m512i*>( address ), value.value );
 #elif BLAZE_AVX2_MODE
    _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
@@ -131,6 +135,8 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::T
 
 #if BLAZE_MIC_MODE
    _mm512_store_epi64( address, value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_stream_si512( reinterpret_cast<__m512i*>( address ), value.value );
 #elif BLAZE_AVX2_MODE
    _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
@@ -156,6 +162,8 @@ BLAZE_ALWAYS_INLINE void stream( float* address, const sse_float_t& value )
 
 #if BLAZE_MIC_MODE
    _mm512_storenr_ps( address, value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_stream_ps( address, value.value );
 #elif BLAZE_AVX_MODE
    _mm256_stream_ps( address, value.value );
 #elif BLAZE_SSE_MODE
@@ -181,6 +189,8 @@ BLAZE_ALWAYS_INLINE void stream( double* address, const sse_double_t& value )
 
 #if BLAZE_MIC_MODE
    _mm512_storenr_pd( address, value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_stream_pd( address, value.value );
 #elif BLAZE_AVX_MODE
    _mm256_stream_pd( address, value.value );
 #elif BLAZE_SSE2_MODE
@@ -207,6 +217,8 @@ BLAZE_ALWAYS_INLINE void stream( complex<float>* address, const sse_cfloat_t& va
 
 #if BLAZE_MIC_MODE
    _mm512_storenr_ps( reinterpret_cast<float*>( address ), value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_stream_ps( reinterpret_cast<float*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_stream_ps( reinterpret_cast<float*>( address ), value.value );
 #elif BLAZE_SSE_MODE
@@ -233,6 +245,8 @@ BLAZE_ALWAYS_INLINE void stream( complex<double>* address, const sse_cdouble_t&
 
 #if BLAZE_MIC_MODE
    _mm512_storenr_pd( reinterpret_cast<double*>( address ), value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_stream_pd( reinterpret_cast<double*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_stream_pd( reinterpret_cast<double*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
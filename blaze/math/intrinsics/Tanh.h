@@ -0,0 +1,139 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Tanh.h
+//  \brief Header file for the intrinsic hyperbolic tangent functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_TANH_H_
+#define _BLAZE_MATH_INTRINSICS_TANH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/Abs.h>
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Comparison.h>
+#include <blaze/math/intrinsics/Division.h>
+#include <blaze/math/intrinsics/Exp.h>
+#include <blaze/math/intrinsics/FMA.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC HYPERBOLIC TANGENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_float_t tanh( sse_float_t )
+// \brief Computes the hyperbolic tangent for a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The resulting vector \f$ tanh(a) \f$.
+//
+// For \f$ |a| \leq 0.625 \f$ the hyperbolic tangent is approximated by a polynomial of degree 11
+// (see the Cephes Math Library), for larger values it is computed as \f$ 1-2/(e^{2|a|}+1) \f$.
+// The maximum relative error is approximately 2 ulp.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_float_t tanh( const sse_float_t& a )
+{
+   const sse_float_t x ( abs( a ) );
+   const sse_float_t one( set( 1.0F ) );
+
+   const sse_float_t tmp( one - set( 2.0F ) / ( exp( x + x ) + one ) );
+   const sse_float_t large( select( cmplt( a, set( 0.0F ) ), set( -1.0F ), one ) * tmp );
+
+   const sse_float_t zz( a * a );
+   sse_float_t small( set( -5.70498872745E-3F ) );
+   small = fmadd( small, zz, set(  2.06390887954E-2F ) );
+   small = fmadd( small, zz, set( -5.37397155531E-2F ) );
+   small = fmadd( small, zz, set(  1.33314422036E-1F ) );
+   small = fmadd( small, zz, set( -3.33332819422E-1F ) );
+   small = fmadd( small * zz, a, a );
+
+   return select( cmplt( set( 0.625F ), x ), large, small );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t tanh( sse_double_t )
+// \brief Computes the hyperbolic tangent for a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The resulting vector \f$ tanh(a) \f$.
+//
+// For \f$ |a| \leq 0.625 \f$ the hyperbolic tangent is approximated by a rational approximation
+// of degree 2/3 in \f$ a^2 \f$ (see the Cephes Math Library), for larger values it is computed
+// as \f$ 1-2/(e^{2|a|}+1) \f$. The maximum relative error is approximately 2 ulp.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_double_t tanh( const sse_double_t& a )
+{
+   const sse_double_t x ( abs( a ) );
+   const sse_double_t one( set( 1.0 ) );
+
+   const sse_double_t tmp( one - set( 2.0 ) / ( exp( x + x ) + one ) );
+   const sse_double_t large( select( cmplt( a, set( 0.0 ) ), set( -1.0 ), one ) * tmp );
+
+   const sse_double_t zz( a * a );
+   sse_double_t p( set( -9.64399179425052238628E-1 ) );
+   p = fmadd( p, zz, set( -9.92877231001918586564E1 ) );
+   p = fmadd( p, zz, set( -1.61468768441708447952E3 ) );
+
+   sse_double_t q( zz + set( 1.12811678491632931402E2 ) );
+   q = fmadd( q, zz, set( 2.23548839060100448583E3 ) );
+   q = fmadd( q, zz, set( 4.84406305325125486048E3 ) );
+
+   const sse_double_t small( fmadd( a * zz, p / q, a ) );
+
+   return select( cmplt( set( 0.625 ), x ), large, small );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
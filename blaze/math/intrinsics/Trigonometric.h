@@ -0,0 +1,310 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Trigonometric.h
+//  \brief Header file for the intrinsic trigonometric functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_TRIGONOMETRIC_H_
+#define _BLAZE_MATH_INTRINSICS_TRIGONOMETRIC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/intrinsics/Abs.h>
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Comparison.h>
+#include <blaze/math/intrinsics/FMA.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Load.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Rounding.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Store.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC TRIGONOMETRIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar fallback for the trigonometric functions.
+// \ingroup intrinsics
+//
+// \param a The vector of floating point values.
+// \param f The scalar trigonometric function.
+// \return The resulting vector.
+//
+// This function applies the given scalar function to each element of the given vector. It is
+// used for arguments that are too large in magnitude for the vectorized argument reduction.
+*/
+template< typename T     // Type of the elements
+        , typename IT >  // Type of the intrinsic vector
+BLAZE_ALWAYS_INLINE IT trigonometric_backend( const IT& a, T (*f)( T ) )
+{
+   AlignedArray<T,IntrinsicTrait<T>::size> array;
+   store( array.data(), a );
+   for( size_t i=0UL; i<IntrinsicTrait<T>::size; ++i )
+      array[i] = f( array[i] );
+   return load( array.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t sin( sse_float_t )
+// \brief Computes the sine for a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The resulting vector \f$ sin(a) \f$.
+//
+// The argument is reduced to the interval \f$ [-\pi/4..\pi/4] \f$ by means of an extended precision
+// modular arithmetic and the result is approximated by polynomials of degree 7 (see the Cephes
+// Math Library). The maximum relative error is approximately 2 ulp. In case any of the given values
+// exceeds 8192 in magnitude, the entire vector is computed by means of \c std::sin().
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_float_t sin( const sse_float_t& a )
+{
+   const sse_float_t x( abs( a ) );
+
+   if( anyOf( cmplt( set( 8192.0F ), x ) ) ) {
+      return trigonometric_backend<float>( a, std::sin );
+   }
+
+   const sse_float_t k( floor( fmadd( x, set( 0.636619772367581343F ), set( 0.5F ) ) ) );
+   const sse_float_t q( fnmadd( floor( k * set( 0.25F ) ), set( 4.0F ), k ) );
+   const sse_float_t y( k + k );
+   sse_float_t z( fnmadd( y, set( 0.78515625F ), x ) );
+   z = fnmadd( y, set( 2.4187564849853515625E-4F ), z );
+   z = fnmadd( y, set( 3.77489497744594108E-8F ), z );
+   const sse_float_t zz( z * z );
+
+   sse_float_t s( set( -1.9515295891E-4F ) );
+   s = fmadd( s, zz, set( 8.3321608736E-3F ) );
+   s = fmadd( s, zz, set( -1.6666654611E-1F ) );
+   s = fmadd( s * zz, z, z );
+
+   sse_float_t c( set( 2.443315711809948E-5F ) );
+   c = fmadd( c, zz, set( -1.388731625493765E-3F ) );
+   c = fmadd( c, zz, set( 4.166664568298827E-2F ) );
+   c = fnmadd( set( 0.5F ), zz, fmadd( c * zz, zz, set( 1.0F ) ) );
+
+   const sse_float_t h( q * set( 0.5F ) );
+   const sse_float_t odd( cmpneq( floor( h ), h ) );
+   const sse_float_t sign( select( cmplt( a, set( 0.0F ) ), set( -1.0F ), set( 1.0F ) ) );
+   const sse_float_t flip( cmple( set( 2.0F ), q ) );
+
+   return select( odd, c, s ) * select( flip, sign * set( -1.0F ), sign );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t sin( sse_double_t )
+// \brief Computes the sine for a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The resulting vector \f$ sin(a) \f$.
+//
+// The argument is reduced to the interval \f$ [-\pi/4..\pi/4] \f$ by means of an extended precision
+// modular arithmetic and the result is approximated by polynomials of degree 13 (see the Cephes
+// Math Library). The maximum relative error is approximately 2 ulp. In case any of the given values
+// exceeds \f$ 2^{30} \f$ in magnitude, the entire vector is computed by means of \c std::sin().
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_double_t sin( const sse_double_t& a )
+{
+   const sse_double_t x( abs( a ) );
+
+   if( anyOf( cmplt( set( 1.073741824E9 ), x ) ) ) {
+      return trigonometric_backend<double>( a, std::sin );
+   }
+
+   const sse_double_t k( floor( fmadd( x, set( 0.636619772367581343076 ), set( 0.5 ) ) ) );
+   const sse_double_t q( fnmadd( floor( k * set( 0.25 ) ), set( 4.0 ), k ) );
+   const sse_double_t y( k + k );
+   sse_double_t z( fnmadd( y, set( 7.85398125648498535156E-1 ), x ) );
+   z = fnmadd( y, set( 3.77489470793079817668E-8 ), z );
+   z = fnmadd( y, set( 2.69515142907905952645E-15 ), z );
+   const sse_double_t zz( z * z );
+
+   sse_double_t s( set( 1.58962301576546568060E-10 ) );
+   s = fmadd( s, zz, set( -2.50507477628578072866E-8 ) );
+   s = fmadd( s, zz, set( 2.75573136213857245213E-6 ) );
+   s = fmadd( s, zz, set( -1.98412698295895385996E-4 ) );
+   s = fmadd( s, zz, set( 8.33333333332211858878E-3 ) );
+   s = fmadd( s, zz, set( -1.66666666666666307295E-1 ) );
+   s = fmadd( s * zz, z, z );
+
+   sse_double_t c( set( -1.13585365213876817300E-11 ) );
+   c = fmadd( c, zz, set( 2.08757008419747316778E-9 ) );
+   c = fmadd( c, zz, set( -2.75573141792967388112E-7 ) );
+   c = fmadd( c, zz, set( 2.48015872888517045348E-5 ) );
+   c = fmadd( c, zz, set( -1.38888888888730564116E-3 ) );
+   c = fmadd( c, zz, set( 4.16666666666665929218E-2 ) );
+   c = fnmadd( set( 0.5 ), zz, fmadd( c * zz, zz, set( 1.0 ) ) );
+
+   const sse_double_t h( q * set( 0.5 ) );
+   const sse_double_t odd( cmpneq( floor( h ), h ) );
+   const sse_double_t sign( select( cmplt( a, set( 0.0 ) ), set( -1.0 ), set( 1.0 ) ) );
+   const sse_double_t flip( cmple( set( 2.0 ), q ) );
+
+   return select( odd, c, s ) * select( flip, sign * set( -1.0 ), sign );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t cos( sse_float_t )
+// \brief Computes the cosine for a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The resulting vector \f$ cos(a) \f$.
+//
+// The argument is reduced to the interval \f$ [-\pi/4..\pi/4] \f$ by means of an extended precision
+// modular arithmetic and the result is approximated by polynomials of degree 7 (see the Cephes
+// Math Library). The maximum relative error is approximately 2 ulp. In case any of the given values
+// exceeds 8192 in magnitude, the entire vector is computed by means of \c std::cos().
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_float_t cos( const sse_float_t& a )
+{
+   const sse_float_t x( abs( a ) );
+
+   if( anyOf( cmplt( set( 8192.0F ), x ) ) ) {
+      return trigonometric_backend<float>( a, std::cos );
+   }
+
+   const sse_float_t k( floor( fmadd( x, set( 0.636619772367581343F ), set( 0.5F ) ) ) );
+   const sse_float_t q( fnmadd( floor( k * set( 0.25F ) ), set( 4.0F ), k ) );
+   const sse_float_t y( k + k );
+   sse_float_t z( fnmadd( y, set( 0.78515625F ), x ) );
+   z = fnmadd( y, set( 2.4187564849853515625E-4F ), z );
+   z = fnmadd( y, set( 3.77489497744594108E-8F ), z );
+   const sse_float_t zz( z * z );
+
+   sse_float_t s( set( -1.9515295891E-4F ) );
+   s = fmadd( s, zz, set( 8.3321608736E-3F ) );
+   s = fmadd( s, zz, set( -1.6666654611E-1F ) );
+   s = fmadd( s * zz, z, z );
+
+   sse_float_t c( set( 2.443315711809948E-5F ) );
+   c = fmadd( c, zz, set( -1.388731625493765E-3F ) );
+   c = fmadd( c, zz, set( 4.166664568298827E-2F ) );
+   c = fnmadd( set( 0.5F ), zz, fmadd( c * zz, zz, set( 1.0F ) ) );
+
+   const sse_float_t h( q * set( 0.5F ) );
+   const sse_float_t odd( cmpneq( floor( h ), h ) );
+   const sse_float_t flip( cmpeq( floor( h + set( 0.5F ) ), set( 1.0F ) ) );
+
+   return select( odd, s, c ) * select( flip, set( -1.0F ), set( 1.0F ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t cos( sse_double_t )
+// \brief Computes the cosine for a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The resulting vector \f$ cos(a) \f$.
+//
+// The argument is reduced to the interval \f$ [-\pi/4..\pi/4] \f$ by means of an extended precision
+// modular arithmetic and the result is approximated by polynomials of degree 13 (see the Cephes
+// Math Library). The maximum relative error is approximately 2 ulp. In case any of the given values
+// exceeds \f$ 2^{30} \f$ in magnitude, the entire vector is computed by means of \c std::cos().
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+BLAZE_ALWAYS_INLINE sse_double_t cos( const sse_double_t& a )
+{
+   const sse_double_t x( abs( a ) );
+
+   if( anyOf( cmplt( set( 1.073741824E9 ), x ) ) ) {
+      return trigonometric_backend<double>( a, std::cos );
+   }
+
+   const sse_double_t k( floor( fmadd( x, set( 0.636619772367581343076 ), set( 0.5 ) ) ) );
+   const sse_double_t q( fnmadd( floor( k * set( 0.25 ) ), set( 4.0 ), k ) );
+   const sse_double_t y( k + k );
+   sse_double_t z( fnmadd( y, set( 7.85398125648498535156E-1 ), x ) );
+   z = fnmadd( y, set( 3.77489470793079817668E-8 ), z );
+   z = fnmadd( y, set( 2.69515142907905952645E-15 ), z );
+   const sse_double_t zz( z * z );
+
+   sse_double_t s( set( 1.58962301576546568060E-10 ) );
+   s = fmadd( s, zz, set( -2.50507477628578072866E-8 ) );
+   s = fmadd( s, zz, set( 2.75573136213857245213E-6 ) );
+   s = fmadd( s, zz, set( -1.98412698295895385996E-4 ) );
+   s = fmadd( s, zz, set( 8.33333333332211858878E-3 ) );
+   s = fmadd( s, zz, set( -1.66666666666666307295E-1 ) );
+   s = fmadd( s * zz, z, z );
+
+   sse_double_t c( set( -1.13585365213876817300E-11 ) );
+   c = fmadd( c, zz, set( 2.08757008419747316778E-9 ) );
+   c = fmadd( c, zz, set( -2.75573141792967388112E-7 ) );
+   c = fmadd( c, zz, set( 2.48015872888517045348E-5 ) );
+   c = fmadd( c, zz, set( -1.38888888888730564116E-3 ) );
+   c = fmadd( c, zz, set( 4.16666666666665929218E-2 ) );
+   c = fnmadd( set( 0.5 ), zz, fmadd( c * zz, zz, set( 1.0 ) ) );
+
+   const sse_double_t h( q * set( 0.5 ) );
+   const sse_double_t odd( cmpneq( floor( h ), h ) );
+   const sse_double_t flip( cmpeq( floor( h + set( 0.5 ) ), set( 1.0 ) ) );
+
+   return select( odd, s, c ) * select( flip, set( -1.0 ), set( 1.0 ) );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
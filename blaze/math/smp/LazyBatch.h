@@ -0,0 +1,744 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/LazyBatch.h
+//  \brief Header file for the LazyBatch class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_LAZYBATCH_H_
+#define _BLAZE_MATH_SMP_LAZYBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <boost/exception_ptr.hpp>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/PtrVector.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniquePtr.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lazy batch of vector and matrix assignments.
+// \ingroup smp
+//
+// The LazyBatch class records a sequence of assignments and executes them as a whole. The
+// assignments are not executed when they are recorded, but only by the execute() function.
+// Based on the aliasing information of the involved operands (see the \c isAliased() function
+// of vectors, matrices and expressions) each recorded assignment is assigned to a level of the
+// dependency graph of the batch: An assignment that reads or writes the target of a previously
+// recorded assignment, or that writes an operand read by a previously recorded assignment, is
+// assigned to a higher level than this assignment. All assignments of the same level are
+// independent of each other:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   blaze::DynamicVector<double> x, y1, y2, y3, z;
+   // ... Resizing and initialization
+
+   blaze::LazyBatch batch;
+
+   batch.assign   ( y1, A * x );    // Level 0
+   batch.assign   ( y2, B * x );    // Level 0
+   batch.addAssign( y3, C * x );    // Level 0
+   batch.assign   ( z , y1 + y2 );  // Level 1, since it reads y1 and y2
+   batch.subAssign( y1, x );        // Level 2, since it writes y1, which is read on level 1
+
+   batch.execute();  // Executing all five assignments
+   \endcode
+
+// The execute() function executes the levels one after another. In case of the C++11 and Boost
+// thread parallelizations, the assignments of a level that would individually be executed
+// serially (i.e. all assignments below the according SMP thresholds) are executed concurrently
+// by the thread team, one thread per assignment. All other assignments are executed one after
+// another, each of them in parallel as usual. Therefore a sequence of many small and medium
+// sized operations benefits from the available threads, even if none of the operations can
+// be parallelized by itself. In case of the OpenMP parallelization, in case the shared memory
+// parallelization is disabled, and in case execute() is called inside a serial section, all
+// assignments are executed one after another.
+//
+// Since views and adaptors only provide the aliasing information for their underlying vector or
+// matrix, an assignment to a view or adaptor is conservatively treated as dependent on all
+// previously and subsequently recorded assignments. Note that the targets and all operands of
+// the recorded assignments are referenced by the batch. Therefore they must not be destroyed
+// until the batch has been executed. Operands modified between the recording and the execution
+// of the batch are used with their values at the time of the execution. However, since the
+// expressions are created (and their operands are checked) at the time of the recording, the
+// operands must already have their final sizes.
+*/
+class LazyBatch : private NonCopyable
+{
+ private:
+   //**Private struct Statement********************************************************************
+   /*!\brief Base class for a single recorded assignment.
+   */
+   struct Statement
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Statement class.
+      //
+      // \param barrier \a true in case the assignment depends on all other assignments.
+      */
+      explicit inline Statement( bool barrier )
+         : level_  ( 0UL     )  // The level of the assignment within the dependency graph
+         , barrier_( barrier )  // Dependency flag for all other assignments
+         , error_  ()           // The exception thrown by the assignment
+      {}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor of the Statement class.
+      */
+      virtual ~Statement() {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      virtual void        run       ()                        = 0;
+      virtual const void* target    ()                  const = 0;
+      virtual bool        writes    ( const void* alias ) const = 0;
+      virtual bool        reads     ( const void* alias ) const = 0;
+      virtual bool        isParallel()                  const = 0;
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      size_t level_;                //!< The level of the assignment within the dependency graph.
+      bool barrier_;                //!< Dependency flag for all other assignments.
+      boost::exception_ptr error_;  //!< The exception thrown by the assignment.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private struct TypedStatement***************************************************************
+   /*!\brief Implementation of a single recorded assignment.
+   //
+   // The target of the assignment is stored by reference. The right-hand side operand is stored
+   // by value in case it is an expression (i.e. the expression object, which in turn refers to
+   // its operands) and by reference otherwise.
+   */
+   template< typename T1    // Type of the left-hand side operand
+           , typename T2    // Type of the right-hand side operand
+           , typename OP >  // Type of the assignment operation
+   struct TypedStatement : public Statement
+   {
+      //**Type definitions*************************************************************************
+      //! Storage type of the right-hand side operand.
+      typedef typename If< IsExpression<T2>, const T2, const T2& >::Type  Operand;
+
+      //! Compilation switch for the parallel execution of the assignment.
+      typedef typename IfTrue< ( IsDenseVector<T1>::value || IsDenseMatrix<T1>::value ) &&
+                               IsSMPAssignable<T1>::value && IsSMPAssignable<T2>::value
+                             , TrueType, FalseType >::Type  SMPAssignable;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the TypedStatement class template.
+      //
+      // \param lhs The target left-hand side operand.
+      // \param rhs The right-hand side operand.
+      */
+      explicit inline TypedStatement( T1& lhs, const T2& rhs )
+         : Statement( IsView<T1>::value || IsAdaptor<T1>::value )  // Initialization of the base class
+         , lhs_( lhs )  // The target left-hand side operand
+         , rhs_( rhs )  // The right-hand side operand
+      {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Performs the assignment.
+      //
+      // \return void
+      */
+      virtual void run() {
+         OP::apply( lhs_, rhs_ );
+      }
+
+      /*!\brief Returns the address of the target of the assignment.
+      //
+      // \return The address of the target.
+      */
+      virtual const void* target() const {
+         return &lhs_;
+      }
+
+      /*!\brief Returns whether the assignment writes to the given address.
+      //
+      // \param alias The address to be checked.
+      // \return \a true in case the target is aliased with the address, \a false if not.
+      */
+      virtual bool writes( const void* alias ) const {
+         return lhs_.isAliased( alias );
+      }
+
+      /*!\brief Returns whether the assignment reads from the given address.
+      //
+      // \param alias The address to be checked.
+      // \return \a true in case the right-hand side is aliased with the address, \a false if not.
+      */
+      virtual bool reads( const void* alias ) const {
+         return rhs_.isAliased( alias );
+      }
+
+      /*!\brief Returns whether the assignment would be executed in parallel.
+      //
+      // \return \a true in case the assignment is executed in parallel, \a false if not.
+      */
+      virtual bool isParallel() const {
+         return canSMPAssign( SMPAssignable() );
+      }
+      //*******************************************************************************************
+
+      //**SMP assignment functions*****************************************************************
+      /*!\brief Returns whether the SMP-assignable assignment exceeds the SMP threshold.
+      //
+      // \return \a true in case the assignment is executed in parallel, \a false if not.
+      */
+      inline bool canSMPAssign( TrueType ) const {
+         return rhs_.canSMPAssign();
+      }
+
+      /*!\brief Returns \a false for assignments that are not SMP-assignable.
+      //
+      // \return \a false.
+      */
+      inline bool canSMPAssign( FalseType ) const {
+         return false;
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      T1&     lhs_;  //!< The target left-hand side operand.
+      Operand rhs_;  //!< The right-hand side operand.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private struct Assign***********************************************************************
+   /*!\brief Plain assignment operation.
+   */
+   struct Assign
+   {
+      template< typename T1, typename T2 >
+      static inline void apply( T1& lhs, const T2& rhs ) { lhs = rhs; }
+   };
+   //**********************************************************************************************
+
+   //**Private struct AddAssign********************************************************************
+   /*!\brief Addition assignment operation.
+   */
+   struct AddAssign
+   {
+      template< typename T1, typename T2 >
+      static inline void apply( T1& lhs, const T2& rhs ) { lhs += rhs; }
+   };
+   //**********************************************************************************************
+
+   //**Private struct SubAssign********************************************************************
+   /*!\brief Subtraction assignment operation.
+   */
+   struct SubAssign
+   {
+      template< typename T1, typename T2 >
+      static inline void apply( T1& lhs, const T2& rhs ) { lhs -= rhs; }
+   };
+   //**********************************************************************************************
+
+   //**Private struct Executor*********************************************************************
+   /*!\brief Auxiliary functor for the execution of a recorded assignment.
+   */
+   struct Executor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Executor class.
+      //
+      // \param statement The assignment to be executed.
+      */
+      explicit inline Executor( Statement* statement )
+         : statement_( statement )  // The assignment to be executed
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Performs the assignment and stores any thrown exception.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         try {
+            statement_->run();
+         }
+         catch( ... ) {
+            statement_->error_ = boost::current_exception();
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Statement* statement_;  //!< The assignment to be executed.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef PtrVector<Statement>     Statements;  //!< Type of the container for the assignments.
+   typedef std::vector<Statement*>  Level;       //!< Type of a single level of assignments.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline LazyBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Recording functions*************************************************************************
+   /*!\name Recording functions */
+   //@{
+   template< typename VT1, bool TF, typename VT2 >
+   inline void assign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void addAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void subAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void addAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void subAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size   () const;
+   inline size_t levels () const;
+   inline void   execute();
+   inline void   clear  ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename OP, typename T1, typename T2 >
+   inline void record( T1& lhs, const T2& rhs );
+
+   inline void executeLevel( const Level& level );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Statements statements_;  //!< The recorded assignments in the order of their recording.
+   size_t levels_;          //!< The number of levels of the dependency graph.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for LazyBatch.
+*/
+inline LazyBatch::LazyBatch()
+   : statements_()       // The recorded assignments in the order of their recording
+   , levels_    ( 0UL )  // The number of levels of the dependency graph
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RECORDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Recording the assignment of a vector to a vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+//
+// This function records the assignment \f$ lhs = rhs \f$ for the execution via execute().
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+inline void LazyBatch::assign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   record<Assign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recording the addition assignment of a vector to a vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be added.
+// \return void
+//
+// This function records the addition assignment \f$ lhs += rhs \f$ for the execution via
+// execute().
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+inline void LazyBatch::addAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   record<AddAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recording the subtraction assignment of a vector to a vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be subtracted.
+// \return void
+//
+// This function records the subtraction assignment \f$ lhs -= rhs \f$ for the execution via
+// execute().
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+inline void LazyBatch::subAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   record<SubAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recording the assignment of a matrix to a matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function records the assignment \f$ lhs = rhs \f$ for the execution via execute().
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void LazyBatch::assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   record<Assign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recording the addition assignment of a matrix to a matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function records the addition assignment \f$ lhs += rhs \f$ for the execution via
+// execute().
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void LazyBatch::addAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   record<AddAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recording the subtraction assignment of a matrix to a matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function records the subtraction assignment \f$ lhs -= rhs \f$ for the execution via
+// execute().
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void LazyBatch::subAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   record<SubAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of recorded assignments.
+//
+// \return The number of assignments recorded since the last execution.
+*/
+inline size_t LazyBatch::size() const
+{
+   return statements_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels of the dependency graph.
+//
+// \return The number of levels of the assignments recorded since the last execution.
+//
+// The number of levels corresponds to the length of the longest chain of dependent assignments,
+// i.e. the number of steps required by execute().
+*/
+inline size_t LazyBatch::levels() const
+{
+   return levels_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes all recorded assignments.
+//
+// \return void
+//
+// This function executes all recorded assignments level by level (see the class description)
+// and empties the batch. In case an assignment throws an exception, the execution is aborted
+// after the current level and the exception of the first failed assignment of the level is
+// rethrown. Note that all remaining assignments are discarded in this case.
+*/
+inline void LazyBatch::execute()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   Statements statements;
+   statements.swap( statements_ );
+
+   const size_t levels( levels_ );
+   levels_ = 0UL;
+
+   Level level;
+   level.reserve( statements.size() );
+
+   for( size_t l=0UL; l<levels; ++l )
+   {
+      level.clear();
+
+      for( size_t i=0UL; i<statements.size(); ++i ) {
+         if( statements[i]->level_ == l )
+            level.push_back( statements[i] );
+      }
+
+      executeLevel( level );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Discards all recorded assignments.
+//
+// \return void
+*/
+inline void LazyBatch::clear()
+{
+   statements_.clear();
+   levels_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the given assignment and determines its level within the dependency graph.
+//
+// \param lhs The target left-hand side operand.
+// \param rhs The right-hand side operand.
+// \return void
+//
+// The level of the assignment is one higher than the level of the last previously recorded
+// assignment it depends on. An assignment depends on a previously recorded assignment in case
+// it reads or writes the target of the previous assignment (read-after-write, write-after-write)
+// or in case it writes an operand read by the previous assignment (write-after-read).
+*/
+template< typename OP    // Type of the assignment operation
+        , typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+inline void LazyBatch::record( T1& lhs, const T2& rhs )
+{
+   UniquePtr<Statement> statement( new TypedStatement<T1,T2,OP>( lhs, rhs ) );
+
+   for( size_t i=0UL; i<statements_.size(); ++i )
+   {
+      const Statement* previous( statements_[i] );
+
+      if( previous->level_ < statement->level_ )
+         continue;
+
+      if( statement->barrier_ || previous->barrier_ ||
+          statement->reads( previous->target() ) || statement->writes( previous->target() ) ||
+          previous->reads( &lhs ) || previous->writes( &lhs ) ) {
+         statement->level_ = previous->level_ + 1UL;
+      }
+   }
+
+   if( statement->level_ >= levels_ )
+      levels_ = statement->level_ + 1UL;
+
+   statements_.pushBack( statement.get() );
+   statement.release();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the assignments of a single level of the dependency graph.
+//
+// \param level The independent assignments of the level.
+// \return void
+//
+// In case of the C++11 and Boost thread parallelizations, the assignments that would be executed
+// serially are executed concurrently by the thread team, all remaining assignments are executed
+// one after another. Otherwise all assignments are executed one after another. In both cases
+// all assignments of the level are executed before the exception of the first failed assignment
+// (in the order of recording) is rethrown.
+*/
+inline void LazyBatch::executeLevel( const Level& level )
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   Level concurrent, sequential;
+
+   for( size_t i=0UL; i<level.size(); ++i ) {
+      if( isSerialSectionActive() || level[i]->isParallel() )
+         sequential.push_back( level[i] );
+      else
+         concurrent.push_back( level[i] );
+   }
+
+   if( concurrent.size() > 1UL )
+   {
+      BLAZE_SERIAL_SECTION
+      {
+         for( size_t i=0UL; i<concurrent.size(); ++i ) {
+            TheThreadBackend::schedule( Executor( concurrent[i] ) );
+         }
+         TheThreadBackend::wait();
+      }
+   }
+   else if( concurrent.size() == 1UL )
+   {
+      Executor executor( concurrent[0] );
+      executor();
+   }
+
+   for( size_t i=0UL; i<sequential.size(); ++i ) {
+      Executor executor( sequential[i] );
+      executor();
+   }
+#else
+   for( size_t i=0UL; i<level.size(); ++i ) {
+      Executor executor( level[i] );
+      executor();
+   }
+#endif
+
+   for( size_t i=0UL; i<level.size(); ++i ) {
+      if( level[i]->error_ )
+         boost::rethrow_exception( level[i]->error_ );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,163 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Partition.h
+//  \brief Header file for the partitioning of sparse matrices for parallel operations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_PARTITION_H_
+#define _BLAZE_MATH_SMP_PARTITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits the rows/columns of the given sparse matrix into ranges of balanced work.
+// \ingroup smp
+//
+// \param sm The sparse matrix to be partitioned.
+// \param parts The maximum number of ranges.
+// \param bounds The resulting boundaries of the ranges.
+// \return void
+//
+// This function splits the rows (in case of a row-major matrix) or the columns (in case of
+// a column-major matrix) of the given sparse matrix into at most \a parts consecutive ranges,
+// which contain approximately the same number of non-zero elements. In order to account for
+// the overhead of each single row/column, each row/column is weighted by its number of non-zero
+// elements plus one. The boundaries of the \f$ k \f$ resulting ranges are stored in \a bounds
+// (\f$ k+1 \f$ values starting with 0 and ending with the number of rows/columns). All ranges
+// are non-empty, except for a matrix without any rows/columns, which results in a single empty
+// range.\n
+// This function must \b NOT be called explicitly! It is used internally for the SMP assignment
+// of sparse matrix expressions.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+void partitionNonZeros( const SparseMatrix<MT,SO>& sm, size_t parts, std::vector<size_t>& bounds )
+{
+   const size_t n( SO ? (~sm).columns() : (~sm).rows() );
+   const size_t total( (~sm).nonZeros() + n );
+
+   if( parts > n ) parts = n;
+
+   bounds.clear();
+   bounds.push_back( 0UL );
+
+   size_t sum( 0UL );
+   size_t k  ( 1UL );
+
+   for( size_t i=0UL; i+1UL<n && k<parts; ++i )
+   {
+      sum += (~sm).nonZeros(i) + 1UL;
+
+      if( sum*parts >= k*total ) {
+         bounds.push_back( i+1UL );
+         while( k < parts && sum*parts >= k*total ) ++k;
+      }
+   }
+
+   bounds.push_back( n );
+
+   BLAZE_INTERNAL_ASSERT( bounds.size() >= 2UL, "Invalid number of ranges" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits a sequence of weighted rows/columns into ranges of balanced work.
+// \ingroup smp
+//
+// \param weights The amount of work of each single row/column.
+// \param parts The maximum number of ranges.
+// \param bounds The resulting boundaries of the ranges.
+// \return void
+//
+// This function splits the rows/columns into at most \a parts consecutive ranges, which contain
+// approximately the same amount of work as given by \a weights. In analogy to the partitioning
+// of sparse matrices, each row/column is weighted by its given amount of work plus one. The
+// boundaries of the resulting ranges are stored in \a bounds.\n
+// This function must \b NOT be called explicitly! It is used internally for the SMP assignment
+// of sparse matrix expressions.
+*/
+inline void partitionNonZeros( const std::vector<size_t>& weights, size_t parts, std::vector<size_t>& bounds )
+{
+   const size_t n( weights.size() );
+
+   size_t total( n );
+   for( size_t i=0UL; i<n; ++i )
+      total += weights[i];
+
+   if( parts > n ) parts = n;
+
+   bounds.clear();
+   bounds.push_back( 0UL );
+
+   size_t sum( 0UL );
+   size_t k  ( 1UL );
+
+   for( size_t i=0UL; i+1UL<n && k<parts; ++i )
+   {
+      sum += weights[i] + 1UL;
+
+      if( sum*parts >= k*total ) {
+         bounds.push_back( i+1UL );
+         while( k < parts && sum*parts >= k*total ) ++k;
+      }
+   }
+
+   bounds.push_back( n );
+
+   BLAZE_INTERNAL_ASSERT( bounds.size() >= 2UL, "Invalid number of ranges" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,129 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ThreadMapping.h
+//  \brief Header file for the mapping of threads onto two-dimensional matrix partitions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADMAPPING_H_
+#define _BLAZE_MATH_SMP_THREADMAPPING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The number of threads in row and column direction of a two-dimensional partitioning.
+// \ingroup smp
+*/
+typedef std::pair<size_t,size_t>  ThreadMapping;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a two-dimensional mapping of the given number of threads onto the given matrix.
+// \ingroup smp
+//
+// \param threads The total number of threads.
+// \param A The matrix to be partitioned.
+// \return The number of threads in row direction (first) and in column direction (second).
+//
+// This function arranges the given number of threads in a two-dimensional grid of
+// \f$ m \times n \f$ threads (with \f$ m \cdot n = threads \f$), which is used to partition the
+// given matrix into tiles. The grid is chosen such that the tiles are as square as possible,
+// i.e. such that the extent of each tile (rows plus columns) is minimal. On the one hand this
+// provides every thread with work in case of tall and skinny or short and wide matrices, on the
+// other hand this minimizes the amount of data each thread has to load in case of a matrix
+// multiplication (a block of rows of the left-hand side and a block of columns of the right-hand
+// side operand). In case several grids result in the same extent, the grid with the larger
+// number of threads along the major dimension of the matrix is preferred, such that each thread
+// works on contiguous memory.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
+{
+   const size_t M( (~A).rows()    );
+   const size_t N( (~A).columns() );
+
+   if( threads == 0UL )
+      return ThreadMapping( 1UL, 1UL );
+
+   ThreadMapping mapping( SO ? ThreadMapping( 1UL, threads ) : ThreadMapping( threads, 1UL ) );
+   size_t extent( M + N + 1UL );
+
+   for( size_t k=1UL; k<=threads; ++k )
+   {
+      if( threads % k != 0UL ) continue;
+
+      const size_t m( SO ? threads/k : k );
+      const size_t n( threads / m );
+
+      const size_t rowsPerThread( ( M + m - 1UL ) / m );
+      const size_t colsPerThread( ( N + n - 1UL ) / n );
+
+      if( rowsPerThread + colsPerThread <= extent ) {
+         mapping = ThreadMapping( m, n );
+         extent  = rowsPerThread + colsPerThread;
+      }
+   }
+
+   return mapping;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
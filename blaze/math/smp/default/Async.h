@@ -0,0 +1,263 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/Async.h
+//  \brief Header file for the default asynchronous SMP assignment
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_ASYNC_H_
+#define _BLAZE_MATH_SMP_DEFAULT_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/exception_ptr.hpp>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle for the completion of an asynchronous assignment.
+// \ingroup smp
+//
+// The Future class represents the completion of an assignment launched via asyncAssign(). In
+// case neither the C++11 nor the Boost thread-based parallelization is active, the assignment
+// is executed immediately by asyncAssign() and the Future always represents a completed
+// assignment. Any exception thrown by the assignment is rethrown by the wait() function.
+*/
+class Future
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline Future();
+   explicit inline Future( const boost::exception_ptr& error );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool ready() const;
+   inline void wait () const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   boost::exception_ptr error_;  //!< The exception thrown by the assignment.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the Future class.
+//
+// A default constructed Future represents a completed assignment.
+*/
+inline Future::Future()
+   : error_()  // The exception thrown by the assignment
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the Future class.
+//
+// \param error The exception thrown by the assignment.
+*/
+inline Future::Future( const boost::exception_ptr& error )
+   : error_( error )  // The exception thrown by the assignment
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the asynchronous assignment has been completed.
+//
+// \return \a true in case the assignment has been completed, \a false if not.
+*/
+inline bool Future::ready() const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the completion of the asynchronous assignment.
+//
+// \return void
+//
+// This function blocks until the asynchronous assignment has been completed. In case the
+// assignment has been terminated by an exception, the exception is rethrown.
+*/
+inline void Future::wait() const
+{
+   if( error_ )
+      boost::rethrow_exception( error_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF, typename VT2 >
+inline Future asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return The handle for the completion of the assignment.
+//
+// This function performs the assignment \f$ lhs = rhs \f$ asynchronously and returns a Future
+// for the completion of the assignment:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x, y, z;
+   // ... Resizing and initialization
+
+   blaze::Future f1 = blaze::asyncAssign( y, A * x );
+   blaze::Future f2 = blaze::asyncAssign( z, B * x );
+
+   // ... Independent work, e.g. I/O or operations on other operands
+
+   f1.wait();
+   f2.wait();
+   \endcode
+
+// Since neither the C++11 nor the Boost thread-based parallelization is active, the assignment
+// is executed immediately. Any exception thrown by the assignment is rethrown by Future::wait().
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+inline Future asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   try {
+      ~lhs = ~rhs;
+   }
+   catch( ... ) {
+      return Future( boost::current_exception() );
+   }
+
+   return Future();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return The handle for the completion of the assignment.
+//
+// This function performs the assignment \f$ lhs = rhs \f$ asynchronously and returns a Future
+// for the completion of the assignment. Since neither the C++11 nor the Boost thread-based
+// parallelization is active, the assignment is executed immediately. Any exception thrown by
+// the assignment is rethrown by Future::wait().
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   try {
+      ~lhs = ~rhs;
+   }
+   catch( ... ) {
+      return Future( boost::current_exception() );
+   }
+
+   return Future();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
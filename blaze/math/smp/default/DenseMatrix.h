@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
@@ -72,6 +73,12 @@ inline typename EnableIf< IsDenseMatrix<MT1> >::Type
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline typename EnableIf< IsDenseMatrix<MT1> >::Type
    smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT, bool SO, typename OP >
+inline const typename MT::ElementType smpReduce( const DenseMatrix<MT,SO>& dm, OP op );
+
+template< typename MT, bool SO >
+inline void smpFill( DenseMatrix<MT,SO>& lhs, const typename MT::ElementType& value );
 //@}
 //*************************************************************************************************
 
@@ -169,6 +176,65 @@ inline typename EnableIf< IsDenseMatrix<MT1> >::Type
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function implements the default SMP reduction of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense matrices. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline const typename MT::ElementType smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return serialReduce( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP homogeneous assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The value to be assigned to all elements of the dense matrix.
+// \return void
+//
+// This function implements the default SMP assignment of the given value to all elements of
+// a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void smpFill( DenseMatrix<MT,SO>& lhs, const typename MT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( SO ) {
+      for( size_t j=0UL; j<(~lhs).columns(); ++j )
+         for( size_t i=0UL; i<(~lhs).rows(); ++i )
+            (~lhs)(i,j) = value;
+   }
+   else {
+      for( size_t i=0UL; i<(~lhs).rows(); ++i )
+         for( size_t j=0UL; j<(~lhs).columns(); ++j )
+            (~lhs)(i,j) = value;
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
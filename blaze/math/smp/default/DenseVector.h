@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/dense/DenseVector.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -76,6 +77,12 @@ inline typename EnableIf< IsDenseVector<VT1> >::Type
 template< typename VT1, bool TF1, typename VT2, bool TF2 >
 inline typename EnableIf< IsDenseVector<VT1> >::Type
    smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT, bool TF, typename OP >
+inline const typename VT::ElementType smpReduce( const DenseVector<VT,TF>& dv, OP op );
+
+template< typename VT, bool TF >
+inline void smpFill( DenseVector<VT,TF>& lhs, const typename VT::ElementType& value );
 //@}
 //*************************************************************************************************
 
@@ -196,6 +203,57 @@ inline typename EnableIf< IsDenseVector<VT1> >::Type
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function implements the default SMP reduction of a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense vectors. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline const typename VT::ElementType smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return serialReduce( ~dv, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP homogeneous assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The value to be assigned to all elements of the dense vector.
+// \return void
+//
+// This function implements the default SMP assignment of the given value to all elements of
+// a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline void smpFill( DenseVector<VT,TF>& lhs, const typename VT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   for( size_t i=0UL; i<(~lhs).size(); ++i )
+      (~lhs)[i] = value;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
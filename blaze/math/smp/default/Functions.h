@@ -40,8 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <stdexcept>
+#include <vector>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/Affinity.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/Unused.h>
@@ -58,9 +61,10 @@ namespace blaze {
 //*************************************************************************************************
 /*!\name SMP utility functions */
 //@{
-BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
-BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
-BLAZE_ALWAYS_INLINE void   shutDownThreads();
+BLAZE_ALWAYS_INLINE size_t getNumThreads    ();
+BLAZE_ALWAYS_INLINE void   setNumThreads    ( size_t number );
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( const std::vector<size_t>& cpus );
+BLAZE_ALWAYS_INLINE void   shutDownThreads  ();
 //@}
 //*************************************************************************************************
 
@@ -101,6 +105,29 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pins the threads used for thread parallel operations to the given CPUs.
+// \ingroup smp
+//
+// \param cpus The list of CPUs.
+// \return void
+// \exception std::invalid_argument Invalid list of CPUs.
+//
+// Via this function the threads used for thread parallel operations can be pinned to the given
+// list of CPUs (see parseCpuList()). In case no parallelization is active, the function pins the
+// calling thread to the first given CPU. In case the given list of CPUs is empty, a
+// \a std::invalid_argument exception is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   if( cpus.empty() )
+      throw std::invalid_argument( "Invalid list of CPUs" );
+
+   pinThread( cpus[0] );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
 // \ingroup smp
@@ -42,11 +42,13 @@
 
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/TripletAssembly.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -71,6 +73,10 @@ inline typename EnableIf< IsSparseMatrix<MT1> >::Type
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline typename EnableIf< IsSparseMatrix<MT1> >::Type
    smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT, bool SO, typename IT, typename Type >
+inline void smpAssemble( SparseMatrix<MT,SO>& lhs, const IT* rows, const IT* columns,
+                         const Type* values, size_t size );
 //@}
 //*************************************************************************************************
 
@@ -167,6 +173,39 @@ inline typename EnableIf< IsSparseMatrix<MT1> >::Type
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP assembly of a sparse matrix from (row,column,value)
+//        triplets.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param size The total number of triplets.
+// \return void
+//
+// This function implements the default SMP assembly of a sparse matrix from triplets. Due to
+// the lack of parallelism, the triplets are assembled serially (see tripletAssembly()).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized assembly of compressed matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assemble() function.
+*/
+template< typename MT      // Type of the target sparse matrix
+        , bool SO          // Storage order of the target sparse matrix
+        , typename IT      // Type of the row and column indices
+        , typename Type >  // Data type of the triplet values
+inline void smpAssemble( SparseMatrix<MT,SO>& lhs, const IT* rows, const IT* columns,
+                         const Type* values, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   tripletAssembly( lhs, rows, columns, values, size );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -41,20 +41,24 @@
 //*************************************************************************************************
 
 #include <omp.h>
+#include <vector>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -76,24 +80,26 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP assignment of a row-major dense matrix to a dense matrix.
+/*!\brief Backend of the OpenMP-based SMP assignment of a dense matrix to a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be assigned.
+// \param rhs The right-hand side dense matrix to be assigned.
 // \return void
 //
-// This function is the backend implementation of the OpenMP-based SMP assignment of a row-major
-// dense matrix to a dense matrix.\n
+// This function is the backend implementation of the OpenMP-based SMP assignment of a dense
+// matrix to a dense matrix. The matrices are partitioned into two-dimensional tiles according to
+// the thread grid determined by createThreadMapping().\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -109,110 +115,45 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const ThreadMapping threads( createThreadMapping( omp_get_num_threads(), ~rhs ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
+   const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1  ( (~rhs).rows() / threads.first + addon1 );
+   const size_t rest1        ( equalShare1 & ( IT::size - 1UL ) );
+   const size_t rowsPerThread( ( vectorizable && rest1 )?( equalShare1 - rest1 + IT::size ):( equalShare1 ) );
 
-      if( row >= (~lhs).rows() )
-         continue;
+   const size_t addon2       ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2  ( (~rhs).columns() / threads.second + addon2 );
+   const size_t rest2        ( equalShare2 & ( IT::size - 1UL ) );
+   const size_t colsPerThread( ( vectorizable && rest2 )?( equalShare2 - rest2 + IT::size ):( equalShare2 ) );
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP assignment of a column-major dense matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be assigned.
-// \return void
-//
-// This function is the backend implementation of the OpenMP-based SMP assignment of a column-major
-// dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int k=0; k<int( threads.first*threads.second ); ++k )
    {
-      const size_t column( i*colsPerThread );
+      const size_t row( ( k / threads.second ) * rowsPerThread );
+      const size_t column( ( k % threads.second ) * colsPerThread );
 
-      if( column >= (~lhs).columns() )
+      if( row >= (~rhs).rows() || column >= (~rhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t m( min( rowsPerThread, (~rhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -253,7 +194,7 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajo
    const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~lhs).rows() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t row( i*rowsPerThread );
@@ -303,7 +244,7 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnM
    const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~lhs).columns() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t column( i*colsPerThread );
@@ -418,25 +359,26 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP addition assignment of a row-major dense matrix
-//        to a dense matrix.
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a dense matrix to a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be added.
+// \param rhs The right-hand side dense matrix to be added.
 // \return void
 //
 // This function is the backend implementation of the OpenMP-based SMP addition assignment of a
-// row-major dense matrix to a dense matrix.\n
+// dense matrix to a dense matrix. The matrices are partitioned into two-dimensional tiles
+// according to the thread grid determined by createThreadMapping().\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -452,111 +394,45 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const ThreadMapping threads( createThreadMapping( omp_get_num_threads(), ~rhs ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
+   const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1  ( (~rhs).rows() / threads.first + addon1 );
+   const size_t rest1        ( equalShare1 & ( IT::size - 1UL ) );
+   const size_t rowsPerThread( ( vectorizable && rest1 )?( equalShare1 - rest1 + IT::size ):( equalShare1 ) );
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+   const size_t addon2       ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2  ( (~rhs).columns() / threads.second + addon2 );
+   const size_t rest2        ( equalShare2 & ( IT::size - 1UL ) );
+   const size_t colsPerThread( ( vectorizable && rest2 )?( equalShare2 - rest2 + IT::size ):( equalShare2 ) );
 
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP addition assignment of a column-major dense matrix
-//        to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be added.
-// \return void
-//
-// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
-// column-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int k=0; k<int( threads.first*threads.second ); ++k )
    {
-      const size_t column( i*colsPerThread );
+      const size_t row( ( k / threads.second ) * rowsPerThread );
+      const size_t column( ( k % threads.second ) * colsPerThread );
 
-      if( column >= (~lhs).columns() )
+      if( row >= (~rhs).rows() || column >= (~rhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t m( min( rowsPerThread, (~rhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -598,7 +474,7 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~lhs).rows() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t row( i*rowsPerThread );
@@ -649,7 +525,7 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~lhs).columns() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t column( i*colsPerThread );
@@ -764,25 +640,27 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a row-major dense matrix
-//        to a dense matrix.
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a dense matrix to a dense
+//        matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be subtracted.
+// \param rhs The right-hand side dense matrix to be subtracted.
 // \return void
 //
-// This function is the backend implementation of the OpenMP-based SMP subtraction assignment
-// of a row-major dense matrix to a dense matrix.\n
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// dense matrix to a dense matrix. The matrices are partitioned into two-dimensional tiles
+// according to the thread grid determined by createThreadMapping().\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -798,111 +676,45 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+   const ThreadMapping threads( createThreadMapping( omp_get_num_threads(), ~rhs ) );
 
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
+   const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1  ( (~rhs).rows() / threads.first + addon1 );
+   const size_t rest1        ( equalShare1 & ( IT::size - 1UL ) );
+   const size_t rowsPerThread( ( vectorizable && rest1 )?( equalShare1 - rest1 + IT::size ):( equalShare1 ) );
 
+   const size_t addon2       ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2  ( (~rhs).columns() / threads.second + addon2 );
+   const size_t rest2        ( equalShare2 & ( IT::size - 1UL ) );
+   const size_t colsPerThread( ( vectorizable && rest2 )?( equalShare2 - rest2 + IT::size ):( equalShare2 ) );
 
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a column-major dense matrix
-//        to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be subtracted.
-// \return void
-//
-// This function is the backend implementation of the OpenMP-based SMP subtraction assignment
-// of a column-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int k=0; k<int( threads.first*threads.second ); ++k )
    {
-      const size_t column( i*colsPerThread );
+      const size_t row( ( k / threads.second ) * rowsPerThread );
+      const size_t column( ( k % threads.second ) * colsPerThread );
 
-      if( column >= (~lhs).columns() )
+      if( row >= (~rhs).rows() || column >= (~rhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t m( min( rowsPerThread, (~rhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -944,7 +756,7 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~lhs).rows() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t row( i*rowsPerThread );
@@ -995,7 +807,7 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~lhs).columns() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t column( i*colsPerThread );
@@ -1144,6 +956,319 @@ inline typename EnableIf< IsDenseMatrix<MT1> >::Type
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \param partials The partial results of the single threads.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of a dense
+// matrix. A row-major matrix is split into blocks of rows, a column-major matrix into blocks
+// of columns. The blocks are reduced in parallel and the partial results are stored in the
+// given vector \a partials.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense matrices. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+void smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op
+                      , std::vector<typename MT::ElementType>& partials )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const bool vectorizable( MT::vectorizable );
+   const bool dmAligned   ( (~dm).isAligned() );
+
+   const size_t M( ( SO == rowMajor )?( (~dm).rows() ):( (~dm).columns() ) );
+   const size_t N( ( SO == rowMajor )?( (~dm).columns() ):( (~dm).rows() ) );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( M % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( M / threads + addon );
+   const int    parts        ( ( M - 1UL ) / sizePerThread + 1UL );
+
+#pragma omp single
+   partials.resize( parts );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+   for( int i=0; i<parts; ++i )
+   {
+      const size_t index( i*sizePerThread );
+      const size_t size ( min( sizePerThread, M - index ) );
+
+      if( SO == rowMajor && vectorizable && dmAligned ) {
+         partials[i] = serialReduce( submatrix<aligned>( ~dm, index, 0UL, size, N ), op );
+      }
+      else if( SO == rowMajor ) {
+         partials[i] = serialReduce( submatrix<unaligned>( ~dm, index, 0UL, size, N ), op );
+      }
+      else if( vectorizable && dmAligned ) {
+         partials[i] = serialReduce( submatrix<aligned>( ~dm, 0UL, index, N, size ), op );
+      }
+      else {
+         partials[i] = serialReduce( submatrix<unaligned>( ~dm, 0UL, index, N, size ), op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function implements the default OpenMP-based SMP reduction of a dense
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense matrices. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< Not< IsSMPAssignable<MT> >, const typename MT::ElementType >::Type
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return serialReduce( ~dm, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function performs the OpenMP-based SMP reduction of a dense matrix. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the matrix is SMP-assignable and its element type is not SMP-assignable.
+// Row-major matrices with no more rows than the \a SMP_DMATREDUCE_THRESHOLD (column-major
+// matrices with no more columns) are reduced serially, as are all matrices within serial or
+// parallel sections.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense matrices. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< IsSMPAssignable<MT>, const typename MT::ElementType >::Type
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT::ElementType );
+
+   typedef typename MT::ElementType  ET;
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dm).rows() == 0UL || (~dm).columns() == 0UL ||
+       ( ( SO == rowMajor )?( (~dm).rows() ):( (~dm).columns() ) ) <= SMP_DMATREDUCE_THRESHOLD ) {
+      return serialReduce( ~dm, op );
+   }
+
+   std::vector<ET> partials;
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( dm, partials )
+      smpReduce_backend( ~dm, op, partials );
+   }
+
+   ET redux( partials[0UL] );
+   for( size_t i=1UL; i<partials.size(); ++i )
+      redux = op( redux, partials[i] );
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HOMOGENEOUS ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP homogeneous assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The value to be assigned to all elements of the dense matrix.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of the given
+// value to all elements of a dense matrix. The matrix is partitioned into the same
+// two-dimensional tiles as for the SMP assignment of a dense matrix, i.e. in NUMA mode each tile
+// is initialized by the same thread that works on it in subsequent operations.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void smpFill_backend( DenseMatrix<MT,SO>& lhs, const typename MT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename MT::ElementType>         IT;
+   typedef typename SubmatrixExprTrait<MT,aligned>::Type    AlignedTarget;
+   typedef typename SubmatrixExprTrait<MT,unaligned>::Type  UnalignedTarget;
+
+   const bool vectorizable( MT::vectorizable );
+   const bool lhsAligned  ( (~lhs).isAligned() );
+
+   const ThreadMapping threads( createThreadMapping( omp_get_num_threads(), ~lhs ) );
+
+   const size_t addon1       ( ( ( (~lhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1  ( (~lhs).rows() / threads.first + addon1 );
+   const size_t rest1        ( equalShare1 & ( IT::size - 1UL ) );
+   const size_t rowsPerThread( ( vectorizable && rest1 )?( equalShare1 - rest1 + IT::size ):( equalShare1 ) );
+
+   const size_t addon2       ( ( ( (~lhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2  ( (~lhs).columns() / threads.second + addon2 );
+   const size_t rest2        ( equalShare2 & ( IT::size - 1UL ) );
+   const size_t colsPerThread( ( vectorizable && rest2 )?( equalShare2 - rest2 + IT::size ):( equalShare2 ) );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int k=0; k<int( threads.first*threads.second ); ++k )
+   {
+      const size_t row( ( k / threads.second ) * rowsPerThread );
+      const size_t column( ( k % threads.second ) * colsPerThread );
+
+      if( row >= (~lhs).rows() || column >= (~lhs).columns() )
+         continue;
+
+      const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+
+      if( vectorizable && lhsAligned ) {
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         target = value;
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         target = value;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP homogeneous assignment to a dense
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The value to be assigned to all elements of the dense matrix.
+// \return void
+//
+// This function implements the default OpenMP-based SMP assignment of the given value to all
+// elements of a dense matrix. Due to the explicit application of the SFINAE principle, this
+// function can only be selected by the compiler in case the matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename EnableIf< Not< IsSMPAssignable<MT> > >::Type
+   smpFill( DenseMatrix<MT,SO>& lhs, const typename MT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   for( size_t i=0UL; i<(~lhs).rows(); ++i )
+      for( size_t j=0UL; j<(~lhs).columns(); ++j )
+         (~lhs)(i,j) = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP homogeneous assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The value to be assigned to all elements of the dense matrix.
+// \return void
+//
+// This function performs the OpenMP-based SMP assignment of the given value to all elements of
+// a dense matrix. Due to the explicit application of the SFINAE principle, this function can
+// only be selected by the compiler in case the matrix is SMP-assignable and its element type
+// is not SMP-assignable. Matrices that cannot be assigned in parallel (see the
+// \a SMP_DMATASSIGN_THRESHOLD) are assigned serially, as are all matrices within serial or
+// parallel sections.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename EnableIf< IsSMPAssignable<MT> >::Type
+   smpFill( DenseMatrix<MT,SO>& lhs, const typename MT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT::ElementType );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~lhs).canSMPAssign() ) {
+      for( size_t i=0UL; i<(~lhs).rows(); ++i )
+         for( size_t j=0UL; j<(~lhs).columns(); ++j )
+            (~lhs)(i,j) = value;
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( lhs, value )
+      smpFill_backend( ~lhs, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
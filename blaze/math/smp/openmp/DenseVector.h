@@ -41,19 +41,26 @@
 //*************************************************************************************************
 
 #include <omp.h>
+#include <vector>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/DenseSubvector.h>
+#include <blaze/math/dense/DenseVector.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/SparseSubvector.h>
+#include <blaze/math/sparse/Forward.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -67,6 +74,158 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  TRANSPOSE SPARSE MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based SMP evaluation of a transpose sparse matrix/dense vector multiplication.
+// \ingroup smp
+//
+// \param rhs The transpose sparse matrix/dense vector multiplication to be evaluated.
+// \param bounds The boundaries of the column ranges.
+// \param partials The partial results of the multiplication (one per column range).
+// \return void
+//
+// This function evaluates the given multiplication of a column-major sparse matrix and a dense
+// vector in parallel. Each column range (see partitionNonZeros()) is multiplied with the
+// according part of the vector and the result is stored in a separate partial result, which
+// avoids any synchronization of the scattered updates. Subsequently the partial results are
+// summed up pairwise in parallel, such that on return the first partial result contains the
+// result of the multiplication. This function has to be called by all threads of the current
+// team.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT    // Type of the left-hand side sparse matrix
+        , typename VT >  // Type of the right-hand side dense vector
+void smpTSMatDVecMult_backend( const TSMatDVecMultExpr<MT,VT>& rhs
+                             , const std::vector<size_t>& bounds
+                             , std::vector< typename TSMatDVecMultExpr<MT,VT>::ResultType >& partials )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( partials.size() + 1UL == bounds.size(), "Invalid number of partial results" );
+
+   typedef typename TSMatDVecMultExpr<MT,VT>::ResultType    RT;
+   typedef IntrinsicTrait<typename RT::ElementType>         IT;
+   typedef typename SubvectorExprTrait<RT,aligned>::Type    AlignedTarget;
+   typedef typename SubvectorExprTrait<RT,unaligned>::Type  UnalignedTarget;
+
+   const int    threads( omp_get_num_threads() );
+   const size_t rows   ( rhs.size() );
+   const int    parts  ( partials.size() );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+   for( int i=0; i<parts; ++i )
+   {
+      const size_t column( bounds[i] );
+      const size_t n     ( bounds[i+1] - column );
+
+      UnalignedTarget target( subvector<unaligned>( partials[i], 0UL, rows ) );
+      assign( target, submatrix<unaligned>( rhs.leftOperand(), 0UL, column, rows, n ) *
+                      subvector<unaligned>( rhs.rightOperand(), column, n ) );
+   }
+
+   const size_t addon        ( ( ( rows % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( rows / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks       ( ( rows - 1UL ) / sizePerThread + 1UL );
+
+   for( int step=1; step<parts; step*=2 )
+   {
+      const int pairs( ( parts - step - 1 ) / ( 2*step ) + 1 );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+      for( int k=0; k<pairs*blocks; ++k )
+      {
+         const size_t i    ( ( k / blocks ) * 2 * step );
+         const size_t index( ( k % blocks ) * sizePerThread );
+         const size_t size ( min( sizePerThread, rows - index ) );
+
+         AlignedTarget target( subvector<aligned>( partials[i], index, size ) );
+         addAssign( target, subvector<aligned>( partials[i+step], index, size ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based SMP evaluation of a sparse matrix/dense vector multiplication via the
+//        multiplication kernel of the sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The sparse matrix/dense vector multiplication to be evaluated.
+// \param op The assignment operation.
+// \return void
+//
+// This function evaluates the given multiplication of a sparse matrix with a dedicated
+// multiplication kernel (i.e. a BlockCompressedMatrix, a SlicedEllpackMatrix, or a
+// SplitCompressedMatrix) and a dense vector in parallel. The chunks of the matrix are split
+// into ranges with approximately the same number of stored elements (see partitionNonZeros())
+// and each range is computed via the vectorized kernel of the matrix. Since the rows of the
+// matrix might be permuted, the target vector is not split into subvectors, but each thread
+// directly updates the elements of the rows stored in its chunks. This function has to be
+// called by all threads of the current team.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename MT    // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2   // Type of the right-hand side dense vector of the multiplication
+        , typename OP >  // Type of the assignment operation
+void smpMultiplyKernel_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const MT&  A( rhs.leftOperand()  );
+   const VT2& x( rhs.rightOperand() );
+
+   const size_t chunks( A.chunks() );
+
+   std::vector<size_t> weights( chunks );
+   for( size_t c=0UL; c<chunks; ++c )
+      weights[c] = A.chunkCapacity( c );
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( weights, omp_get_num_threads(), bounds );
+
+   const int parts( bounds.size() - 1UL );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0; i<parts; ++i ) {
+      A.multiply( ~lhs, x, bounds[i], bounds[i+1], op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  PLAIN ASSIGNMENT
@@ -115,7 +274,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const size_t rest         ( equalShare & ( IT::size - 1UL ) );
    const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -181,7 +340,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -198,6 +357,151 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a sparse matrix/dense vector
+//        multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a row-major
+// sparse matrix/dense vector multiplication to a dense vector. In contrast to the default
+// partitioning into parts of equal size, the rows are split into ranges with approximately the
+// same number of non-zero elements (see partitionNonZeros()), which balances the work in case of
+// irregular sparsity patterns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( rhs.leftOperand(), omp_get_num_threads(), bounds );
+
+   const int parts( bounds.size() - 1UL );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1] - index );
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      assign( target, subvector<unaligned>( rhs, index, size ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a sliced ELLPACK matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a
+// sliced ELLPACK matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SlicedEllpackMatrix<Type>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SlicedEllpackMatrix<Type>::Assign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a split compressed matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a
+// split compressed matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the split compressed matrix
+        , typename IT     // Index type of the split compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SplitCompressedMatrix<Type,IT>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SplitCompressedMatrix<Type,IT>::Assign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a block compressed matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a
+// block compressed matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the block compressed matrix
+        , size_t B        // Block size of the block compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<BlockCompressedMatrix<Type,B>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename BlockCompressedMatrix<Type,B>::Assign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the OpenMP-based SMP assignment to a dense vector.
@@ -284,6 +588,67 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment of a transpose sparse matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function performs the OpenMP-based SMP assignment of a column-major sparse matrix/dense
+// vector multiplication to a dense vector. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case both operands are
+// SMP-assignable and the element type of the target vector is not SMP-assignable. The
+// multiplication is evaluated by means of the smpTSMatDVecMult_backend() function, the result is
+// subsequently assigned to the target vector in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+inline typename EnableIf< And< IsSMPAssignable<VT1>
+                             , IsSMPAssignable< TSMatDVecMultExpr<MT,VT2> > > >::Type
+   smpAssign( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+   typedef typename TSMatDVecMultExpr<MT,VT2>::ResultType  RT;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+      }
+      else {
+         std::vector<size_t> bounds;
+         partitionNonZeros( rhs.leftOperand(), omp_get_max_threads(), bounds );
+
+         std::vector<RT> partials( bounds.size() - 1UL );
+         for( size_t i=0UL; i<partials.size(); ++i )
+            partials[i].resize( rhs.size(), false );
+
+#pragma omp parallel shared( lhs, rhs, bounds, partials )
+         {
+            smpTSMatDVecMult_backend( rhs, bounds, partials );
+            smpAssign_backend( ~lhs, partials[0] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -334,7 +699,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( IT::size - 1UL ) );
    const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -400,7 +765,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -419,36 +784,49 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the OpenMP-based SMP addition assignment to a dense vector.
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a sparse matrix/dense vector
+//        multiplication to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side vector to be added.
+// \param rhs The right-hand side multiplication expression to be added.
 // \return void
 //
-// This function implements the default OpenMP-based SMP addition assignment to a dense vector.
-// Due to the explicit application of the SFINAE principle, this function can only be selected
-// by the compiler in case both operands are SMP-assignable and the element types of both operands
-// are not SMP-assignable.\n
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// row-major sparse matrix/dense vector multiplication to a dense vector. In contrast to the
+// default partitioning into parts of equal size, the rows are split into ranges with
+// approximately the same number of non-zero elements (see partitionNonZeros()), which balances
+// the work in case of irregular sparsity patterns.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename VT1  // Type of the left-hand side dense vector
-        , bool TF1      // Transpose flag of the left-hand side dense vector
-        , typename VT2  // Type of the right-hand side vector
-        , bool TF2 >    // Transpose flag of the right-hand side vector
-inline typename EnableIf< And< IsDenseVector<VT1>
-                             , Or< Not< IsSMPAssignable<VT1> >
-                                 , Not< IsSMPAssignable<VT2> > > > >::Type
-   smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   addAssign( ~lhs, ~rhs );
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( rhs.leftOperand(), omp_get_num_threads(), bounds );
+
+   const int parts( bounds.size() - 1UL );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1] - index );
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      addAssign( target, subvector<unaligned>( rhs, index, size ) );
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -456,130 +834,62 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Implementation of the OpenMP-based SMP addition assignment to a dense vector.
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a sliced ELLPACK matrix/dense
+//        vector multiplication to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side sparse vector to be added.
+// \param rhs The right-hand side multiplication expression to be added.
 // \return void
 //
-// This function implements the OpenMP-based SMP addition assignment to a dense vector. Due to
-// the explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case both operands are SMP-assignable and the element types of both operands are
-// not SMP-assignable.\n
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// sliced ELLPACK matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename VT1  // Type of the left-hand side dense vector
-        , bool TF1      // Transpose flag of the left-hand side dense vector
-        , typename VT2  // Type of the right-hand side vector
-        , bool TF2 >    // Transpose flag of the right-hand side vector
-inline typename EnableIf< And< IsDenseVector<VT1>
-                             , IsSMPAssignable<VT1>
-                             , IsSMPAssignable<VT2> > >::Type
-   smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SlicedEllpackMatrix<Type>,VT2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
-
-   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
-
-   BLAZE_PARALLEL_SECTION
-   {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
-         addAssign( ~lhs, ~rhs );
-      }
-      else {
-#pragma omp parallel shared( lhs, rhs )
-         smpAddAssign_backend( ~lhs, ~rhs );
-      }
-   }
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SlicedEllpackMatrix<Type>::AddAssign() );
 }
 /*! \endcond */
 //*************************************************************************************************
 
 
-
-
-//=================================================================================================
-//
-//  SUBTRACTION ASSIGNMENT
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a dense vector to a dense vector.
-// \ingroup smp
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a split compressed matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side dense vector to be subtracted.
+// \param rhs The right-hand side multiplication expression to be added.
 // \return void
 //
-// This function is the backend implementation the OpenMP-based SMP subtraction assignment of a
-// dense vector to a dense vector.\n
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// split compressed matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename VT1  // Type of the left-hand side dense vector
-        , bool TF1      // Transpose flag of the left-hand side dense vector
-        , typename VT2  // Type of the right-hand side dense vector
-        , bool TF2 >    // Transpose flag of the right-hand side dense vector
-void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the split compressed matrix
+        , typename IT     // Index type of the split compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SplitCompressedMatrix<Type,IT>,VT2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename VT1::ElementType                         ET1;
-   typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
-   typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
-   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( VT1::vectorizable && VT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         subAssign( target, subvector<aligned>( ~rhs, index, size ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         subAssign( target, subvector<unaligned>( ~rhs, index, size ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         subAssign( target, subvector<aligned>( ~rhs, index, size ) );
-      }
-      else {
-         UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         subAssign( target, subvector<unaligned>( ~rhs, index, size ) );
-      }
-   }
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SplitCompressedMatrix<Type,IT>::AddAssign() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -587,50 +897,31 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a sparse vector to a dense vector.
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a block compressed matrix/dense
+//        vector multiplication to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side sparse vector to be subtracted.
+// \param rhs The right-hand side multiplication expression to be added.
 // \return void
 //
-// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of
-// a sparse vector to a dense vector.\n
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// block compressed matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename VT1  // Type of the left-hand side dense vector
-        , bool TF1      // Transpose flag of the left-hand side dense vector
-        , typename VT2  // Type of the right-hand side sparse vector
-        , bool TF2 >    // Transpose flag of the right-hand side sparse vector
-void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs )
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the block compressed matrix
+        , size_t B        // Block size of the block compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<BlockCompressedMatrix<Type,B>,VT2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename VT1::ElementType                         ET1;
-   typedef typename VT2::ElementType                         ET2;
-   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
-
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
-
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-      subAssign( target, subvector<unaligned>( ~rhs, index, size ) );
-   }
+   smpMultiplyKernel_backend( ~lhs, rhs, typename BlockCompressedMatrix<Type,B>::AddAssign() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -638,17 +929,17 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the OpenMP-based SMP subtraction assignment to a dense vector.
+/*!\brief Default implementation of the OpenMP-based SMP addition assignment to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side vector to be subtracted.
+// \param rhs The right-hand side vector to be added.
 // \return void
 //
-// This function implements the default OpenMP-based SMP subtraction assignment of a vector to
-// a dense vector. Due to the explicit application of the SFINAE principle, this function can
-// only be selected by the compiler in case both operands are SMP-assignable and the element
-// types of both operands are not SMP-assignable.\n
+// This function implements the default OpenMP-based SMP addition assignment to a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case both operands are SMP-assignable and the element types of both operands
+// are not SMP-assignable.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -661,13 +952,13 @@ template< typename VT1  // Type of the left-hand side dense vector
 inline typename EnableIf< And< IsDenseVector<VT1>
                              , Or< Not< IsSMPAssignable<VT1> >
                                  , Not< IsSMPAssignable<VT2> > > > >::Type
-   smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+   smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   subAssign( ~lhs, ~rhs );
+   addAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -675,17 +966,17 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Implementation of the OpenMP-based SMP subtraction assignment to a dense vector.
+/*!\brief Implementation of the OpenMP-based SMP addition assignment to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side sparse vector to be subtracted.
+// \param rhs The right-hand side sparse vector to be added.
 // \return void
 //
-// This function implements the OpenMP-based SMP subtraction assignment to a dense vector. Due
-// to the explicit application of the SFINAE principle, this function can only be selected by
-// the compiler in case both operands are SMP-assignable and the element types of both operands
-// are not SMP-assignable.\n
+// This function implements the OpenMP-based SMP addition assignment to a dense vector. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case both operands are SMP-assignable and the element types of both operands are
+// not SMP-assignable.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -698,7 +989,7 @@ template< typename VT1  // Type of the left-hand side dense vector
 inline typename EnableIf< And< IsDenseVector<VT1>
                              , IsSMPAssignable<VT1>
                              , IsSMPAssignable<VT2> > >::Type
-   smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+   smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -710,11 +1001,72 @@ inline typename EnableIf< And< IsDenseVector<VT1>
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
-         subAssign( ~lhs, ~rhs );
+         addAssign( ~lhs, ~rhs );
       }
       else {
 #pragma omp parallel shared( lhs, rhs )
-         smpSubAssign_backend( ~lhs, ~rhs );
+         smpAddAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP addition assignment of a transpose sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be added.
+// \return void
+//
+// This function performs the OpenMP-based SMP addition assignment of a column-major sparse
+// matrix/dense vector multiplication to a dense vector. Due to the explicit application of the
+// SFINAE principle, this function can only be selected by the compiler in case both operands are
+// SMP-assignable and the element type of the target vector is not SMP-assignable. The
+// multiplication is evaluated by means of the smpTSMatDVecMult_backend() function, the result is
+// subsequently added to the target vector in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+inline typename EnableIf< And< IsSMPAssignable<VT1>
+                             , IsSMPAssignable< TSMatDVecMultExpr<MT,VT2> > > >::Type
+   smpAddAssign( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+   typedef typename TSMatDVecMultExpr<MT,VT2>::ResultType  RT;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         addAssign( ~lhs, rhs );
+      }
+      else {
+         std::vector<size_t> bounds;
+         partitionNonZeros( rhs.leftOperand(), omp_get_max_threads(), bounds );
+
+         std::vector<RT> partials( bounds.size() - 1UL );
+         for( size_t i=0UL; i<partials.size(); ++i )
+            partials[i].resize( rhs.size(), false );
+
+#pragma omp parallel shared( lhs, rhs, bounds, partials )
+         {
+            smpTSMatDVecMult_backend( rhs, bounds, partials );
+            smpAddAssign_backend( ~lhs, partials[0] );
+         }
       }
    }
 }
@@ -726,22 +1078,21 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
 //=================================================================================================
 //
-//  MULTIPLICATION ASSIGNMENT
+//  SUBTRACTION ASSIGNMENT
 //
 //=================================================================================================
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP multiplication assignment of a dense vector to a
-//        dense vector.
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a dense vector to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side dense vector to be multiplied.
+// \param rhs The right-hand side dense vector to be subtracted.
 // \return void
 //
-// This function is the backend implementation of the OpenMP-based SMP multiplication assignment
-// of a dense vector to a dense vector.\n
+// This function is the backend implementation the OpenMP-based SMP subtraction assignment of a
+// dense vector to a dense vector.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -751,7 +1102,7 @@ template< typename VT1  // Type of the left-hand side dense vector
         , bool TF1      // Transpose flag of the left-hand side dense vector
         , typename VT2  // Type of the right-hand side dense vector
         , bool TF2 >    // Transpose flag of the right-hand side dense vector
-void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -773,7 +1124,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const size_t rest         ( equalShare & ( IT::size - 1UL ) );
    const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -785,19 +1136,19 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         multAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         subAssign( target, subvector<aligned>( ~rhs, index, size ) );
       }
       else if( vectorizable && lhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         multAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         subAssign( target, subvector<unaligned>( ~rhs, index, size ) );
       }
       else if( vectorizable && rhsAligned ) {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         multAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         subAssign( target, subvector<aligned>( ~rhs, index, size ) );
       }
       else {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         multAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         subAssign( target, subvector<unaligned>( ~rhs, index, size ) );
       }
    }
 }
@@ -807,16 +1158,15 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the OpenMP-based SMP multiplication assignment of a sparse vector to a
-//        dense vector.
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a sparse vector to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side sparse vector to be multiplied.
+// \param rhs The right-hand side sparse vector to be subtracted.
 // \return void
 //
-// This function is the backend implementation of the OpenMP-based SMP multiplication assignment
-// of a sparse vector to a dense vector.\n
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of
+// a sparse vector to a dense vector.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -826,7 +1176,7 @@ template< typename VT1  // Type of the left-hand side dense vector
         , bool TF1      // Transpose flag of the left-hand side dense vector
         , typename VT2  // Type of the right-hand side sparse vector
         , bool TF2 >    // Transpose flag of the right-hand side sparse vector
-void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs )
+void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -840,7 +1190,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -850,7 +1200,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-      multAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      subAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
 }
 /*! \endcond */
@@ -859,36 +1209,49 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the OpenMP-based SMP multiplication assignment to a dense vector.
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a sparse matrix/dense vector
+//        multiplication to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side vector to be multiplied.
+// \param rhs The right-hand side multiplication expression to be subtracted.
 // \return void
 //
-// This function implements the default OpenMP-based SMP multiplication assignment to a dense
-// vector. Due to the explicit application of the SFINAE principle, this function can only be
-// selected by the compiler in case both operands are SMP-assignable and the element types of
-// both operands are not SMP-assignable.\n
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// row-major sparse matrix/dense vector multiplication to a dense vector. In contrast to the
+// default partitioning into parts of equal size, the rows are split into ranges with
+// approximately the same number of non-zero elements (see partitionNonZeros()), which balances
+// the work in case of irregular sparsity patterns.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename VT1  // Type of the left-hand side dense vector
-        , bool TF1      // Transpose flag of the left-hand side dense vector
-        , typename VT2  // Type of the right-hand side vector
-        , bool TF2 >    // Transpose flag of the right-hand side vector
-inline typename EnableIf< And< IsDenseVector<VT1>
-                             , Or< Not< IsSMPAssignable<VT1> >
-                                 , Not< IsSMPAssignable<VT2> > > > >::Type
-   smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   multAssign( ~lhs, ~rhs );
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( rhs.leftOperand(), omp_get_num_threads(), bounds );
+
+   const int parts( bounds.size() - 1UL );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1] - index );
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      subAssign( target, subvector<unaligned>( rhs, index, size ) );
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -896,47 +1259,962 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Implementation of the OpenMP-based SMP multiplication assignment to a dense vector.
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a sliced ELLPACK matrix/dense
+//        vector multiplication to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side dense vector to be multiplied.
+// \param rhs The right-hand side multiplication expression to be subtracted.
 // \return void
 //
-// This function implements the OpenMP-based SMP multiplication assignment to a dense vector.
-// Due to the explicit application of the SFINAE principle, this function can only be selected
-// by the compiler in case both operands are SMP-assignable and the element types of both
-// operands are not SMP-assignable.\n
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// sliced ELLPACK matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename VT1  // Type of the left-hand side dense vector
-        , bool TF1      // Transpose flag of the left-hand side dense vector
-        , typename VT2  // Type of the right-hand side vector
-        , bool TF2 >    // Transpose flag of the right-hand side vector
-inline typename EnableIf< And< IsDenseVector<VT1>
-                             , IsSMPAssignable<VT1>
-                             , IsSMPAssignable<VT2> > >::Type
-   smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SlicedEllpackMatrix<Type>,VT2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SlicedEllpackMatrix<Type>::SubAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   BLAZE_PARALLEL_SECTION
-   {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
-         multAssign( ~lhs, ~rhs );
-      }
-      else {
-#pragma omp parallel shared( lhs, rhs )
-         smpMultAssign_backend( ~lhs, ~rhs );
-      }
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a split compressed matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// split compressed matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the split compressed matrix
+        , typename IT     // Index type of the split compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SplitCompressedMatrix<Type,IT>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SplitCompressedMatrix<Type,IT>::SubAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a block compressed matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// block compressed matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the block compressed matrix
+        , size_t B        // Block size of the block compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<BlockCompressedMatrix<Type,B>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename BlockCompressedMatrix<Type,B>::SubAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP subtraction assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be subtracted.
+// \return void
+//
+// This function implements the default OpenMP-based SMP subtraction assignment of a vector to
+// a dense vector. Due to the explicit application of the SFINAE principle, this function can
+// only be selected by the compiler in case both operands are SMP-assignable and the element
+// types of both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , Or< Not< IsSMPAssignable<VT1> >
+                                 , Not< IsSMPAssignable<VT2> > > > >::Type
+   smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP subtraction assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function implements the OpenMP-based SMP subtraction assignment to a dense vector. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case both operands are SMP-assignable and the element types of both operands
+// are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , IsSMPAssignable<VT1>
+                             , IsSMPAssignable<VT2> > >::Type
+   smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         subAssign( ~lhs, ~rhs );
+      }
+      else {
+#pragma omp parallel shared( lhs, rhs )
+         smpSubAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP subtraction assignment of a transpose sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function performs the OpenMP-based SMP subtraction assignment of a column-major sparse
+// matrix/dense vector multiplication to a dense vector. Due to the explicit application of the
+// SFINAE principle, this function can only be selected by the compiler in case both operands are
+// SMP-assignable and the element type of the target vector is not SMP-assignable. The
+// multiplication is evaluated by means of the smpTSMatDVecMult_backend() function, the result is
+// subsequently subtracted to the target vector in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+inline typename EnableIf< And< IsSMPAssignable<VT1>
+                             , IsSMPAssignable< TSMatDVecMultExpr<MT,VT2> > > >::Type
+   smpSubAssign( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+   typedef typename TSMatDVecMultExpr<MT,VT2>::ResultType  RT;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         subAssign( ~lhs, rhs );
+      }
+      else {
+         std::vector<size_t> bounds;
+         partitionNonZeros( rhs.leftOperand(), omp_get_max_threads(), bounds );
+
+         std::vector<RT> partials( bounds.size() - 1UL );
+         for( size_t i=0UL; i<partials.size(); ++i )
+            partials[i].resize( rhs.size(), false );
+
+#pragma omp parallel shared( lhs, rhs, bounds, partials )
+         {
+            smpTSMatDVecMult_backend( rhs, bounds, partials );
+            smpSubAssign_backend( ~lhs, partials[0] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP multiplication assignment of a dense vector to a
+//        dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP multiplication assignment
+// of a dense vector to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename VT1::ElementType                         ET1;
+   typedef typename VT2::ElementType                         ET2;
+   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
+   typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+   const bool vectorizable( VT1::vectorizable && VT2::vectorizable && IsSame<ET1,ET2>::value );
+   const bool lhsAligned  ( (~lhs).isAligned() );
+   const bool rhsAligned  ( (~rhs).isAligned() );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).size() / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+
+      if( vectorizable && lhsAligned && rhsAligned ) {
+         AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
+         multAssign( target, subvector<aligned>( ~rhs, index, size ) );
+      }
+      else if( vectorizable && lhsAligned ) {
+         AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
+         multAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      }
+      else if( vectorizable && rhsAligned ) {
+         UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+         multAssign( target, subvector<aligned>( ~rhs, index, size ) );
+      }
+      else {
+         UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+         multAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP multiplication assignment of a sparse vector to a
+//        dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side sparse vector to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP multiplication assignment
+// of a sparse vector to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side sparse vector
+        , bool TF2 >    // Transpose flag of the right-hand side sparse vector
+void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename VT1::ElementType                         ET1;
+   typedef typename VT2::ElementType                         ET2;
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( (~lhs).size() / threads + addon );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      multAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP multiplication assignment of a sparse matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP multiplication assignment
+// of a row-major sparse matrix/dense vector multiplication to a dense vector. In contrast to the
+// default partitioning into parts of equal size, the rows are split into ranges with
+// approximately the same number of non-zero elements (see partitionNonZeros()), which balances
+// the work in case of irregular sparsity patterns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpMultAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( rhs.leftOperand(), omp_get_num_threads(), bounds );
+
+   const int parts( bounds.size() - 1UL );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1] - index );
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      multAssign( target, subvector<unaligned>( rhs, index, size ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP multiplication assignment of a sliced ELLPACK matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP multiplication assignment of a
+// sliced ELLPACK matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpMultAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SlicedEllpackMatrix<Type>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SlicedEllpackMatrix<Type>::MultAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP multiplication assignment of a split compressed matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP multiplication assignment of a
+// split compressed matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the split compressed matrix
+        , typename IT     // Index type of the split compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpMultAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SplitCompressedMatrix<Type,IT>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SplitCompressedMatrix<Type,IT>::MultAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP multiplication assignment of a block compressed matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP multiplication assignment of a
+// block compressed matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the block compressed matrix
+        , size_t B        // Block size of the block compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpMultAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<BlockCompressedMatrix<Type,B>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename BlockCompressedMatrix<Type,B>::MultAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP multiplication assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be multiplied.
+// \return void
+//
+// This function implements the default OpenMP-based SMP multiplication assignment to a dense
+// vector. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of
+// both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , Or< Not< IsSMPAssignable<VT1> >
+                                 , Not< IsSMPAssignable<VT2> > > > >::Type
+   smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   multAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP multiplication assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function implements the OpenMP-based SMP multiplication assignment to a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case both operands are SMP-assignable and the element types of both
+// operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , IsSMPAssignable<VT1>
+                             , IsSMPAssignable<VT2> > >::Type
+   smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         multAssign( ~lhs, ~rhs );
+      }
+      else {
+#pragma omp parallel shared( lhs, rhs )
+         smpMultAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP multiplication assignment of a transpose sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be multiplied.
+// \return void
+//
+// This function performs the OpenMP-based SMP multiplication assignment of a column-major sparse
+// matrix/dense vector multiplication to a dense vector. Due to the explicit application of the
+// SFINAE principle, this function can only be selected by the compiler in case both operands are
+// SMP-assignable and the element type of the target vector is not SMP-assignable. The
+// multiplication is evaluated by means of the smpTSMatDVecMult_backend() function, the result is
+// subsequently multiplied to the target vector in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+inline typename EnableIf< And< IsSMPAssignable<VT1>
+                             , IsSMPAssignable< TSMatDVecMultExpr<MT,VT2> > > >::Type
+   smpMultAssign( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+   typedef typename TSMatDVecMultExpr<MT,VT2>::ResultType  RT;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         multAssign( ~lhs, rhs );
+      }
+      else {
+         std::vector<size_t> bounds;
+         partitionNonZeros( rhs.leftOperand(), omp_get_max_threads(), bounds );
+
+         std::vector<RT> partials( bounds.size() - 1UL );
+         for( size_t i=0UL; i<partials.size(); ++i )
+            partials[i].resize( rhs.size(), false );
+
+#pragma omp parallel shared( lhs, rhs, bounds, partials )
+         {
+            smpTSMatDVecMult_backend( rhs, bounds, partials );
+            smpMultAssign_backend( ~lhs, partials[0] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \param partials The partial results of the single threads.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of a dense
+// vector. The vector is split into one part per thread and the parts are reduced in parallel.
+// The partial results are stored in the given vector \a partials.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense vectors. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+void smpReduce_backend( const DenseVector<VT,TF>& dv, OP op
+                      , std::vector<typename VT::ElementType>& partials )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename VT::ElementType>  IT;
+
+   const bool vectorizable( VT::vectorizable );
+   const bool dvAligned   ( (~dv).isAligned() );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( (~dv).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~dv).size() / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    parts        ( ( (~dv).size() - 1UL ) / sizePerThread + 1UL );
+
+#pragma omp single
+   partials.resize( parts );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+   for( int i=0; i<parts; ++i )
+   {
+      const size_t index( i*sizePerThread );
+      const size_t size ( min( sizePerThread, (~dv).size() - index ) );
+
+      if( vectorizable && dvAligned ) {
+         partials[i] = serialReduce( subvector<aligned>( ~dv, index, size ), op );
+      }
+      else {
+         partials[i] = serialReduce( subvector<unaligned>( ~dv, index, size ), op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function implements the default OpenMP-based SMP reduction of a dense
+// vector. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense vectors. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< Not< IsSMPAssignable<VT> >, const typename VT::ElementType >::Type
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return serialReduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function performs the OpenMP-based SMP reduction of a dense vector. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the vector is SMP-assignable and its element type is not SMP-assignable.
+// Vectors not exceeding the \a SMP_DVECREDUCE_THRESHOLD are reduced serially, as are all
+// vectors within serial or parallel sections.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense vectors. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< IsSMPAssignable<VT>, const typename VT::ElementType >::Type
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT::ElementType );
+
+   typedef typename VT::ElementType  ET;
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dv).size() <= SMP_DVECREDUCE_THRESHOLD ) {
+      return serialReduce( ~dv, op );
+   }
+
+   std::vector<ET> partials;
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( dv, partials )
+      smpReduce_backend( ~dv, op, partials );
+   }
+
+   ET redux( partials[0UL] );
+   for( size_t i=1UL; i<partials.size(); ++i )
+      redux = op( redux, partials[i] );
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HOMOGENEOUS ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP homogeneous assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The value to be assigned to all elements of the dense vector.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of the given
+// value to all elements of a dense vector. The vector is partitioned in the same way as for the
+// SMP assignment of a dense vector, i.e. in NUMA mode each part is initialized by the same
+// thread that works on it in subsequent operations.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+void smpFill_backend( DenseVector<VT,TF>& lhs, const typename VT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename VT::ElementType>         IT;
+   typedef typename SubvectorExprTrait<VT,aligned>::Type    AlignedTarget;
+   typedef typename SubvectorExprTrait<VT,unaligned>::Type  UnalignedTarget;
+
+   const bool vectorizable( VT::vectorizable );
+   const bool lhsAligned  ( (~lhs).isAligned() );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).size() / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+
+      if( vectorizable && lhsAligned ) {
+         AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
+         target = value;
+      }
+      else {
+         UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+         target = value;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP homogeneous assignment to a dense
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The value to be assigned to all elements of the dense vector.
+// \return void
+//
+// This function implements the default OpenMP-based SMP assignment of the given value to all
+// elements of a dense vector. Due to the explicit application of the SFINAE principle, this
+// function can only be selected by the compiler in case the vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename EnableIf< Not< IsSMPAssignable<VT> > >::Type
+   smpFill( DenseVector<VT,TF>& lhs, const typename VT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   for( size_t i=0UL; i<(~lhs).size(); ++i )
+      (~lhs)[i] = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP homogeneous assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The value to be assigned to all elements of the dense vector.
+// \return void
+//
+// This function performs the OpenMP-based SMP assignment of the given value to all elements of
+// a dense vector. Due to the explicit application of the SFINAE principle, this function can
+// only be selected by the compiler in case the vector is SMP-assignable and its element type
+// is not SMP-assignable. Vectors that cannot be assigned in parallel (see the
+// \a SMP_DVECASSIGN_THRESHOLD) are assigned serially, as are all vectors within serial or
+// parallel sections.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename EnableIf< IsSMPAssignable<VT> >::Type
+   smpFill( DenseVector<VT,TF>& lhs, const typename VT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT::ElementType );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~lhs).canSMPAssign() ) {
+      for( size_t i=0UL; i<(~lhs).size(); ++i )
+         (~lhs)[i] = value;
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( lhs, value )
+      smpFill_backend( ~lhs, value );
    }
 }
 /*! \endcond */
@@ -41,9 +41,11 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <vector>
 #include <omp.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/Affinity.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -88,7 +90,7 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 // Note that the given \a number must be in the range \f$[1..infty)\f$. In case an invalid
 // number of threads is specified, a \a std::invalid_argument exception is thrown.
 */
-BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
    if( number == 0UL )
       throw std::invalid_argument( "Invalid number of threads" );
@@ -99,6 +101,37 @@ BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for OpenMP parallel operations to the given CPUs.
+// \ingroup smp
+//
+// \param cpus The list of CPUs.
+// \return void
+// \exception std::invalid_argument Invalid list of CPUs.
+//
+// Via this function the threads of the OpenMP thread team can be pinned to the given list of
+// CPUs (see parseCpuList()). The \a i-th thread of the team is pinned to the CPU \f$ i \bmod k \f$
+// of the given list of \a k CPUs. Note that the pinning only persists as long as the OpenMP
+// runtime reuses its threads for subsequent parallel regions, which is the case for all common
+// implementations as long as the number of threads is not changed. Alternatively, the threads
+// can be pinned via the \c OMP_PROC_BIND and \c OMP_PLACES environment variables. In case the
+// given list of CPUs is empty, a \a std::invalid_argument exception is thrown.
+*/
+inline void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   if( cpus.empty() )
+      throw std::invalid_argument( "Invalid list of CPUs" );
+
+#pragma omp parallel shared( cpus )
+   {
+      pinThread( cpus[ omp_get_thread_num() % cpus.size() ] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -0,0 +1,332 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/SparseMatrix.h
+//  \brief Header file for the OpenMP-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_OPENMP_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <vector>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/smp/default/SparseMatrix.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SpGEMM.h>
+#include <blaze/math/sparse/TripletAssembly.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/SPARSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a sparse matrix/sparse matrix
+//        multiplication to a row-major compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param A The evaluated left-hand side sparse matrix operand.
+// \param B The evaluated right-hand side sparse matrix operand.
+// \param nonzeros The numbers of non-zero elements of the rows of the result.
+// \param bounds The row ranges of the symbolic phase.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a sparse
+// matrix/sparse matrix multiplication to a row-major compressed matrix. The product is computed
+// in two phases by means of Gustavson's algorithm: In the symbolic phase the threads count the
+// non-zero elements of each row of the result, which are used to reserve the exact capacity of
+// each row of the target matrix in a single step. In the numeric phase the threads compute the
+// rows and append them directly to the target matrix. Both phases operate on ranges of rows of
+// approximately the same amount of work (see partitionNonZeros()) and each thread uses its own
+// hash/SPA accumulator (see SpGEMMAccumulator).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the left-hand side compressed matrix
+        , typename MT1    // Type of the left-hand side sparse matrix operand
+        , typename MT2 >  // Type of the right-hand side sparse matrix operand
+void smpSMatSMatMult_backend( CompressedMatrix<Type,false>& lhs, const MT1& A, const MT2& B
+                            , std::vector<size_t>& nonzeros, std::vector<size_t>& bounds )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename MultTrait<typename MT1::ElementType,typename MT2::ElementType>::Type  ET;
+
+   SpGEMMAccumulator<ET> acc( B.columns() );
+
+   // Symbolic phase: counting the non-zero elements of each row of the result
+   const int symbolicParts( bounds.size() - 1UL );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+   for( int i=0; i<symbolicParts; ++i ) {
+      spgemmSymbolic( A, B, bounds[i], bounds[i+1], nonzeros, acc );
+   }
+
+#pragma omp single
+   {
+      lhs.reserve( nonzeros );
+      partitionNonZeros( nonzeros, omp_get_num_threads()*SMP_TASKS_PER_THREAD, bounds );
+   }
+
+   // Numeric phase: computing the rows of the result
+   const int numericParts( bounds.size() - 1UL );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+   for( int i=0; i<numericParts; ++i ) {
+      spgemmNumeric( lhs, A, B, bounds[i], bounds[i+1], acc );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment of a sparse matrix/sparse matrix
+//        multiplication to a row-major compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function implements the OpenMP-based SMP assignment of a sparse matrix/sparse matrix
+// multiplication to a row-major compressed matrix. The target matrix is expected to be empty.
+// Since compressed matrices are also assigned via this function during their construction,
+// which may happen within another parallel operation, the multiplication is executed serially
+// within both serial and parallel sections.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the left-hand side compressed matrix
+        , typename MT1    // Type of the left-hand side sparse matrix of the multiplication
+        , typename MT2 >  // Type of the right-hand side sparse matrix of the multiplication
+inline typename EnableIf< And< IsSMPAssignable< CompressedMatrix<Type,false> >
+                             , IsSMPAssignable< SMatSMatMultExpr<MT1,MT2> > > >::Type
+   smpAssign( CompressedMatrix<Type,false>& lhs, const SMatSMatMultExpr<MT1,MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( lhs.rows()    == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.columns(), "Invalid number of columns" );
+
+   typedef typename MT1::CompositeType  CT1;
+   typedef typename MT2::CompositeType  CT2;
+
+   if( isParallelSectionActive() || isSerialSectionActive() || !rhs.canSMPAssign() ) {
+      assign( lhs, rhs );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      CT1 A( serial( rhs.leftOperand()  ) );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( serial( rhs.rightOperand() ) );  // Evaluation of the right-hand side sparse matrix operand
+
+      std::vector<size_t> nonzeros( lhs.rows(), 0UL );
+      std::vector<size_t> bounds;
+      partitionNonZeros( A, omp_get_max_threads()*SMP_TASKS_PER_THREAD, bounds );
+
+#pragma omp parallel shared( lhs, A, B, nonzeros, bounds )
+      smpSMatSMatMult_backend( lhs, A, B, nonzeros, bounds );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIPLET ASSEMBLY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assembly of a compressed matrix from (row,column,value)
+//        triplets.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param assembler The triplet assembler.
+// \param bounds The ranges of rows/columns of the compress and append phase.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assembly of a compressed
+// matrix from triplets. Each thread counts and scatters the triplets of its parts of the triplet
+// sequence into the segments of the rows/columns (counting sort). Afterwards the threads sort
+// the segments and sum up duplicates on ranges of rows/columns of balanced work (see
+// partitionNonZeros()). The resulting numbers of non-zero elements are used to reserve the exact
+// capacity of all rows/columns of the target matrix in a single step, before the threads append
+// the rows/columns to the target matrix (see TripletAssembler).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized assembly of compressed matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assemble() function.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO        // Storage order of the left-hand side compressed matrix
+        , typename IT >  // Type of the row and column indices
+void smpAssemble_backend( CompressedMatrix<Type,SO>& lhs, TripletAssembler<Type,IT,SO>& assembler
+                        , std::vector<size_t>& bounds )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int parts( assembler.parts() );
+
+   // Counting sort of the triplets by their rows/columns
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+   for( int part=0; part<parts; ++part ) {
+      assembler.count( part );
+   }
+
+#pragma omp single
+   assembler.prefix();
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+   for( int part=0; part<parts; ++part ) {
+      assembler.scatter( part );
+   }
+
+#pragma omp single
+   partitionNonZeros( assembler.nonZeros(), omp_get_num_threads()*SMP_TASKS_PER_THREAD, bounds );
+
+   // Sorting of the rows/columns and summation of duplicates
+   const int compressRanges( bounds.size() - 1UL );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+   for( int i=0; i<compressRanges; ++i ) {
+      assembler.compress( bounds[i], bounds[i+1] );
+   }
+
+#pragma omp single
+   {
+      lhs.reserve( assembler.nonZeros() );
+      partitionNonZeros( assembler.nonZeros(), omp_get_num_threads()*SMP_TASKS_PER_THREAD, bounds );
+   }
+
+   // Appending the rows/columns to the target matrix
+   const int appendRanges( bounds.size() - 1UL );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+   for( int i=0; i<appendRanges; ++i ) {
+      assembler.append( lhs, bounds[i], bounds[i+1] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assembly of a compressed matrix from
+//        (row,column,value) triplets.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param size The total number of triplets.
+// \return void
+//
+// This function implements the OpenMP-based SMP assembly of a compressed matrix from triplets.
+// The target matrix is expected to be empty. In case the number of triplets is below the
+// SMP_TRIPLETASSEMBLY_THRESHOLD or in case the function is called within a serial or parallel
+// section, the triplets are assembled serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized assembly of compressed matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assemble() function.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO        // Storage order of the left-hand side compressed matrix
+        , typename IT >  // Type of the row and column indices
+inline void smpAssemble( CompressedMatrix<Type,SO>& lhs, const IT* rows, const IT* columns,
+                         const Type* values, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isParallelSectionActive() || isSerialSectionActive() ||
+       size < SMP_TRIPLETASSEMBLY_THRESHOLD ) {
+      tripletAssembly( lhs, rows, columns, values, size );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      TripletAssembler<Type,IT,SO> assembler( lhs.rows(), lhs.columns(), rows, columns, values,
+                                              size, omp_get_max_threads()*SMP_TASKS_PER_THREAD );
+      std::vector<size_t> bounds;
+
+#pragma omp parallel shared( lhs, assembler, bounds )
+      smpAssemble_backend( lhs, assembler, bounds );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
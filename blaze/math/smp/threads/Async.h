@@ -0,0 +1,275 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Async.h
+//  \brief Header file for the C++11/Boost thread-based asynchronous SMP assignment
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_ASYNC_H_
+#define _BLAZE_MATH_SMP_THREADS_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle for the completion of an asynchronous assignment.
+// \ingroup smp
+//
+// The Future class represents the completion of an assignment launched via asyncAssign(). The
+// ready() function returns whether the assignment has been completed, the wait() function
+// blocks until the assignment has been completed and rethrows any exception thrown by the
+// assignment. Copies of a Future refer to the same assignment.
+*/
+typedef TheThreadBackend::Future  Future;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the asynchronous execution of an assignment.
+// \ingroup smp
+//
+// The AsyncAssigner class template stores the target of the assignment by reference. The
+// right-hand side operand is stored by value in case it is an expression (i.e. the expression
+// object, which in turn refers to its operands) and by reference otherwise.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+struct AsyncAssigner
+{
+   //**Type definitions****************************************************************************
+   //! Storage type of the right-hand side operand.
+   typedef typename If< IsExpression<T2>, const T2, const T2& >::Type  Operand;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncAssigner class template.
+   //
+   // \param lhs The target left-hand side operand.
+   // \param rhs The right-hand side operand to be assigned.
+   // \param serial \a true in case the assignment has to be executed serially, \a false if not.
+   */
+   explicit inline AsyncAssigner( T1& lhs, const T2& rhs, bool serial )
+      : lhs_   ( lhs    )  // The target left-hand side operand
+      , rhs_   ( rhs    )  // The right-hand side operand
+      , serial_( serial )  // Serial execution flag
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      if( serial_ ) {
+         BLAZE_SERIAL_SECTION {
+            lhs_ = rhs_;
+         }
+      }
+      else {
+         lhs_ = rhs_;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   T1&     lhs_;     //!< The target left-hand side operand.
+   Operand rhs_;     //!< The right-hand side operand.
+   bool    serial_;  //!< Serial execution flag.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF, typename VT2 >
+inline Future asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return The handle for the completion of the assignment.
+//
+// This function launches the assignment \f$ lhs = rhs \f$ for asynchronous execution and
+// returns a Future for the completion of the assignment:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x, y, z;
+   // ... Resizing and initialization
+
+   blaze::Future f1 = blaze::asyncAssign( y, A * x );
+   blaze::Future f2 = blaze::asyncAssign( z, B * x );
+
+   // ... Independent work, e.g. I/O or operations on other operands
+
+   f1.wait();
+   f2.wait();
+   \endcode
+
+// The asynchronous assignments are executed one after another in the order of their launch by
+// the executor thread of the thread backend. The assignment itself is parallelized by means of
+// the thread team as usual, i.e. no additional threads compete for the cores. Parallel
+// operations issued by the calling thread in the meantime are interleaved with the parallel
+// parts of the asynchronous assignment. In case asyncAssign() is called within a serial
+// section, the assignment is executed serially.
+//
+// The target vector and all operands of the right-hand side expression are referenced by the
+// asynchronous assignment. Therefore they must neither be destroyed nor modified, and the
+// target vector must not be accessed, until the assignment has been completed. Note that the
+// right-hand side expression (including the size checks of its operands) is set up by the
+// calling thread at the time of the launch. Therefore the target of a pending assignment must
+// not be used as operand of a subsequently launched assignment before the according Future
+// has been waited for:
+
+   \code
+   blaze::Future f1 = blaze::asyncAssign( y, A * x );
+
+   f1.wait();  // Required since y is an operand of the following assignment
+
+   blaze::Future f2 = blaze::asyncAssign( z, B * y );
+   \endcode
+
+// Any exception thrown by the assignment is rethrown by Future::wait().
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+inline Future asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return TheThreadBackend::launch(
+      AsyncAssigner<VT1,VT2>( ~lhs, ~rhs, isSerialSectionActive() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return The handle for the completion of the assignment.
+//
+// This function launches the assignment \f$ lhs = rhs \f$ for asynchronous execution and
+// returns a Future for the completion of the assignment. The assignment is executed in the same
+// way as the asynchronous assignment of vectors (see asyncAssign()). The target matrix and all
+// operands of the right-hand side expression must neither be destroyed nor modified, and the
+// target matrix must not be accessed, until the assignment has been completed. In particular,
+// the target matrix must not be used as operand of a subsequently launched assignment before
+// the according Future has been waited for.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return TheThreadBackend::launch(
+      AsyncAssigner<MT1,MT2>( ~lhs, ~rhs, isSerialSectionActive() ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
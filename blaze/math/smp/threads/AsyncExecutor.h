@@ -0,0 +1,337 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/AsyncExecutor.h
+//  \brief Header file for the executor of the asynchronous operations of the thread backend
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_ASYNCEXECUTOR_H_
+#define _BLAZE_MATH_SMP_THREADS_ASYNCEXECUTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <deque>
+#include <boost/bind.hpp>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniquePtr.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executor of the asynchronous operations of the C++11 and Boost thread backend.
+// \ingroup smp
+//
+// The AsyncExecutor class template executes the scheduled tasks one after another in the order
+// of their scheduling by means of a single thread. In contrast to the ThreadPool, which executes
+// independent tasks in arbitrary order, the executor therefore guarantees that a task only
+// starts after all previously scheduled tasks have been completed. The thread is created upon
+// the first call to schedule(), i.e. no thread is created unless asynchronous operations are
+// used at all.
+//
+// The AsyncExecutor class template is parametrized by the type of the encapsulated thread
+// (\a TT), the types of the mutex and the mutex lock (\a MT and \a LT), and the type of the
+// condition variable (\a CT). The schedule() function can be called from several threads
+// concurrently.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class AsyncExecutor : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef UniquePtr<TT>      Thread;     //!< Type of the executing thread.
+   typedef threadpool::Task   Task;       //!< Type of a single task.
+   typedef std::deque<Task>   Tasks;      //!< Type of the task queue.
+   typedef MT                 Mutex;      //!< Type of the mutex.
+   typedef LT                 Lock;       //!< Type of a locking object.
+   typedef CT                 Condition;  //!< Condition variable type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit AsyncExecutor();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~AsyncExecutor();
+   //@}
+   //**********************************************************************************************
+
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename Callable >
+   void schedule( Callable func );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void shutdown();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void work( size_t epoch );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Tasks tasks_;          //!< The scheduled tasks in the order of their scheduling.
+   size_t epoch_;         //!< Generation of the executing thread.
+   Thread thread_;        //!< The thread executing the scheduled tasks.
+   Mutex mutex_;          //!< Synchronization mutex for the task queue.
+   Condition scheduled_;  //!< Wait condition for the executing thread.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default constructor for the AsyncExecutor class.
+//
+// The executing thread is not created before the first task is scheduled.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+AsyncExecutor<TT,MT,LT,CT>::AsyncExecutor()
+   : tasks_    ()         // The scheduled tasks in the order of their scheduling
+   , epoch_    ( 0UL   )  // Generation of the executing thread
+   , thread_   ()         // The thread executing the scheduled tasks
+   , mutex_    ()         // Synchronization mutex for the task queue
+   , scheduled_()         // Wait condition for the executing thread
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Destructor for the AsyncExecutor class.
+//
+// The destructor waits for the completion of the currently executed task and terminates the
+// executing thread. Tasks that have not been started yet are discarded.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+AsyncExecutor<TT,MT,LT,CT>::~AsyncExecutor()
+{
+   shutdown();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given task for execution.
+//
+// \param func The given function or functor.
+// \return void
+//
+// This function appends the given function/functor to the task queue. It is executed as soon as
+// all previously scheduled tasks have been completed. Note that the given function/functor must
+// be copyable.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename Callable >
+void AsyncExecutor<TT,MT,LT,CT>::schedule( Callable func )
+{
+   Lock lock( mutex_ );
+
+   tasks_.push_back( Task( func ) );
+
+   if( thread_.get() == NULL ) {
+      thread_.reset( new TT( boost::bind( &AsyncExecutor::work, this, epoch_ ) ) );
+   }
+
+   scheduled_.notify_one();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Terminating and destroying the executing thread.
+//
+// \return void
+//
+// This function blocks until the currently executed task has been completed and until the
+// executing thread has been destroyed. Tasks that have not been started yet are discarded.
+// A subsequent call to schedule() creates a new executing thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void AsyncExecutor<TT,MT,LT,CT>::shutdown()
+{
+   Thread thread;
+
+   {
+      Lock lock( mutex_ );
+
+      if( thread_.get() == NULL )
+         return;
+
+      ++epoch_;
+      tasks_.clear();
+      thread.reset( thread_.release() );
+      scheduled_.notify_one();
+   }
+
+   thread->join();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Main function of the executing thread.
+//
+// \param epoch The generation of the executing thread.
+// \return void
+//
+// The executing thread removes the scheduled tasks one by one from the front of the task queue
+// and executes them. In case the task queue is empty, it blocks until the next task is scheduled
+// or until it is terminated. A thread is terminated as soon as the generation of the executor
+// differs from its own generation.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void AsyncExecutor<TT,MT,LT,CT>::work( size_t epoch )
+{
+   while( true )
+   {
+      Task task;
+
+      {
+         Lock lock( mutex_ );
+
+         while( tasks_.empty() && epoch == epoch_ ) {
+            scheduled_.wait( lock );
+         }
+
+         if( epoch != epoch_ )
+            return;
+
+         task = tasks_.front();
+         tasks_.pop_front();
+      }
+
+      task();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,14 +40,17 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StorageOrder.h>
@@ -55,6 +58,7 @@
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -76,25 +80,27 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a row-major dense matrix to a
-//        dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a dense matrix to a dense
+//        matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be assigned.
+// \param rhs The right-hand side dense matrix to be assigned.
 // \return void
 //
-// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a row-major dense matrix to a dense matrix.\n
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// dense matrix to a dense matrix. The matrices are partitioned into two-dimensional tiles
+// according to the task grid determined by createThreadMapping().\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -110,111 +116,51 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a column-major dense matrix
-//        to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be assigned.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a column-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   const ThreadMapping tasks( createThreadMapping( TheThreadBackend::size()*SMP_TASKS_PER_THREAD, ~rhs ) );
 
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
+   const size_t addon1     ( ( ( (~rhs).rows() % tasks.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~rhs).rows() / tasks.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( IT::size - 1UL ) );
+   const size_t rowsPerTask( ( vectorizable && rest1 )?( equalShare1 - rest1 + IT::size ):( equalShare1 ) );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t addon2     ( ( ( (~rhs).columns() % tasks.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~rhs).columns() / tasks.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( IT::size - 1UL ) );
+   const size_t colsPerTask( ( vectorizable && rest2 )?( equalShare2 - rest2 + IT::size ):( equalShare2 ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks.first; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t row( i*rowsPerTask );
 
-      if( column >= (~lhs).columns() )
+      if( row >= (~rhs).rows() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<tasks.second; ++j )
+      {
+         const size_t column( j*colsPerTask );
+
+         if( column >= (~rhs).columns() )
+            continue;
+
+         const size_t m( min( rowsPerTask, (~rhs).rows()    - row    ) );
+         const size_t n( min( colsPerTask, (~rhs).columns() - column ) );
+
+         if( vectorizable && lhsAligned && rhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && lhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && rhsAligned ) {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
       }
    }
 
@@ -254,18 +200,18 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajo
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).rows() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerTask( (~lhs).rows() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerTask );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerTask, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -306,18 +252,18 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).columns() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t colsPerTask( (~lhs).columns() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerTask );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerTask, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -425,25 +371,27 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a row-major dense
-//        matrix to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a dense matrix to a
+//        dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be added.
+// \param rhs The right-hand side dense matrix to be added.
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP addition
-// assignment of a row-major dense matrix to a dense matrix.\n
+// assignment of a dense matrix to a dense matrix. The matrices are partitioned into
+// two-dimensional tiles according to the task grid determined by createThreadMapping().\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -459,111 +407,51 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
+   const ThreadMapping tasks( createThreadMapping( TheThreadBackend::size()*SMP_TASKS_PER_THREAD, ~rhs ) );
 
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
+   const size_t addon1     ( ( ( (~rhs).rows() % tasks.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~rhs).rows() / tasks.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( IT::size - 1UL ) );
+   const size_t rowsPerTask( ( vectorizable && rest1 )?( equalShare1 - rest1 + IT::size ):( equalShare1 ) );
 
+   const size_t addon2     ( ( ( (~rhs).columns() % tasks.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~rhs).columns() / tasks.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( IT::size - 1UL ) );
+   const size_t colsPerTask( ( vectorizable && rest2 )?( equalShare2 - rest2 + IT::size ):( equalShare2 ) );
 
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a column-major dense
-//        matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be added.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP addition
-// assignment of a column-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
-
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks.first; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t row( i*rowsPerTask );
 
-      if( column >= (~lhs).columns() )
+      if( row >= (~rhs).rows() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<tasks.second; ++j )
+      {
+         const size_t column( j*colsPerTask );
+
+         if( column >= (~rhs).columns() )
+            continue;
+
+         const size_t m( min( rowsPerTask, (~rhs).rows()    - row    ) );
+         const size_t n( min( colsPerTask, (~rhs).columns() - column ) );
+
+         if( vectorizable && lhsAligned && rhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && lhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && rhsAligned ) {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
       }
    }
 
@@ -603,18 +491,18 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).rows() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerTask( (~lhs).rows() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerTask );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerTask, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -655,18 +543,18 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).columns() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t colsPerTask( (~lhs).columns() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerTask );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerTask, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -775,25 +663,27 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a row-major dense
-//        matrix to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a dense matrix to
+//        a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be subtracted.
+// \param rhs The right-hand side dense matrix to be subtracted.
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
-// assignment of a row-major dense matrix to a dense matrix.\n
+// assignment of a dense matrix to a dense matrix. The matrices are partitioned into
+// two-dimensional tiles according to the task grid determined by createThreadMapping().\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -809,111 +699,51 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a column-major
-//        dense matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be subtracted.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
-// assignment of a column-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
+   const ThreadMapping tasks( createThreadMapping( TheThreadBackend::size()*SMP_TASKS_PER_THREAD, ~rhs ) );
 
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
+   const size_t addon1     ( ( ( (~rhs).rows() % tasks.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~rhs).rows() / tasks.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( IT::size - 1UL ) );
+   const size_t rowsPerTask( ( vectorizable && rest1 )?( equalShare1 - rest1 + IT::size ):( equalShare1 ) );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t addon2     ( ( ( (~rhs).columns() % tasks.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~rhs).columns() / tasks.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( IT::size - 1UL ) );
+   const size_t colsPerTask( ( vectorizable && rest2 )?( equalShare2 - rest2 + IT::size ):( equalShare2 ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks.first; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t row( i*rowsPerTask );
 
-      if( column >= (~lhs).columns() )
+      if( row >= (~rhs).rows() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<tasks.second; ++j )
+      {
+         const size_t column( j*colsPerTask );
+
+         if( column >= (~rhs).columns() )
+            continue;
+
+         const size_t m( min( rowsPerTask, (~rhs).rows()    - row    ) );
+         const size_t n( min( colsPerTask, (~rhs).columns() - column ) );
+
+         if( vectorizable && lhsAligned && rhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && lhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && rhsAligned ) {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
       }
    }
 
@@ -953,18 +783,18 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).rows() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerTask( (~lhs).rows() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerTask );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerTask, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -1005,18 +835,18 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).columns() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t colsPerTask( (~lhs).columns() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerTask );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerTask, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -1161,6 +991,329 @@ inline typename EnableIf< IsDenseMatrix<MT1> >::Type
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction
+// of a dense matrix. A row-major matrix is split into blocks of rows, a column-major matrix
+// into blocks of columns. The blocks are reduced in parallel and the partial results are
+// finally combined via the given reduction operation.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense matrices. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+const typename MT::ElementType smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename MT::ElementType  ET;
+
+   const bool vectorizable( MT::vectorizable );
+   const bool dmAligned   ( (~dm).isAligned() );
+
+   const size_t M( ( SO == rowMajor )?( (~dm).rows() ):( (~dm).columns() ) );
+   const size_t N( ( SO == rowMajor )?( (~dm).columns() ):( (~dm).rows() ) );
+
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( M % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( M / tasks + addon );
+   const size_t parts      ( ( M - 1UL ) / sizePerTask + 1UL );
+
+   std::vector<ET> partials( parts );
+
+   for( size_t i=0UL; i<parts; ++i )
+   {
+      const size_t index( i*sizePerTask );
+      const size_t size ( min( sizePerTask, M - index ) );
+
+      if( SO == rowMajor && vectorizable && dmAligned ) {
+         TheThreadBackend::scheduleReduce( submatrix<aligned>( ~dm, index, 0UL, size, N ), partials[i], op );
+      }
+      else if( SO == rowMajor ) {
+         TheThreadBackend::scheduleReduce( submatrix<unaligned>( ~dm, index, 0UL, size, N ), partials[i], op );
+      }
+      else if( vectorizable && dmAligned ) {
+         TheThreadBackend::scheduleReduce( submatrix<aligned>( ~dm, 0UL, index, N, size ), partials[i], op );
+      }
+      else {
+         TheThreadBackend::scheduleReduce( submatrix<unaligned>( ~dm, 0UL, index, N, size ), partials[i], op );
+      }
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( partials[0UL] );
+   for( size_t i=1UL; i<parts; ++i )
+      redux = op( redux, partials[i] );
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function implements the default C++11/Boost thread-based SMP reduction of a dense
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense matrices. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< Not< IsSMPAssignable<MT> >, const typename MT::ElementType >::Type
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return serialReduce( ~dm, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function performs the C++11/Boost thread-based SMP reduction of a dense matrix. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the matrix is SMP-assignable and its element type is not SMP-assignable.
+// Row-major matrices with no more rows than the \a SMP_DMATREDUCE_THRESHOLD (column-major
+// matrices with no more columns) are reduced serially, as are all matrices within serial or
+// parallel sections.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense matrices. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< IsSMPAssignable<MT>, const typename MT::ElementType >::Type
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT::ElementType );
+
+   typedef typename MT::ElementType  ET;
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dm).rows() == 0UL || (~dm).columns() == 0UL ||
+       ( ( SO == rowMajor )?( (~dm).rows() ):( (~dm).columns() ) ) <= SMP_DMATREDUCE_THRESHOLD ) {
+      return serialReduce( ~dm, op );
+   }
+
+   ET redux = ET();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( ~dm, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HOMOGENEOUS ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP homogeneous assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The value to be assigned to all elements of the dense matrix.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of
+// the given value to all elements of a dense matrix. The matrix is partitioned into the same
+// two-dimensional tiles as for the SMP assignment of a dense matrix, i.e. in NUMA mode each tile
+// is initialized by the same thread that works on it in subsequent operations.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void smpFill_backend( DenseMatrix<MT,SO>& lhs, const typename MT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename MT::ElementType>         IT;
+   typedef typename SubmatrixExprTrait<MT,aligned>::Type    AlignedTarget;
+   typedef typename SubmatrixExprTrait<MT,unaligned>::Type  UnalignedTarget;
+
+   const bool vectorizable( MT::vectorizable );
+   const bool lhsAligned  ( (~lhs).isAligned() );
+
+   const ThreadMapping tasks( createThreadMapping( TheThreadBackend::size()*SMP_TASKS_PER_THREAD, ~lhs ) );
+
+   const size_t addon1     ( ( ( (~lhs).rows() % tasks.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~lhs).rows() / tasks.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( IT::size - 1UL ) );
+   const size_t rowsPerTask( ( vectorizable && rest1 )?( equalShare1 - rest1 + IT::size ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~lhs).columns() % tasks.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~lhs).columns() / tasks.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( IT::size - 1UL ) );
+   const size_t colsPerTask( ( vectorizable && rest2 )?( equalShare2 - rest2 + IT::size ):( equalShare2 ) );
+
+   for( size_t i=0UL; i<tasks.first; ++i )
+   {
+      const size_t row( i*rowsPerTask );
+
+      if( row >= (~lhs).rows() )
+         continue;
+
+      for( size_t j=0UL; j<tasks.second; ++j )
+      {
+         const size_t column( j*colsPerTask );
+
+         if( column >= (~lhs).columns() )
+            continue;
+
+         const size_t m( min( rowsPerTask, (~lhs).rows()    - row    ) );
+         const size_t n( min( colsPerTask, (~lhs).columns() - column ) );
+
+         if( vectorizable && lhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleFill( target, value );
+         }
+         else {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleFill( target, value );
+         }
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP homogeneous assignment to
+//        a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The value to be assigned to all elements of the dense matrix.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP assignment of the given
+// value to all elements of a dense matrix. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case the matrix is not
+// SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename EnableIf< Not< IsSMPAssignable<MT> > >::Type
+   smpFill( DenseMatrix<MT,SO>& lhs, const typename MT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   for( size_t i=0UL; i<(~lhs).rows(); ++i )
+      for( size_t j=0UL; j<(~lhs).columns(); ++j )
+         (~lhs)(i,j) = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP homogeneous assignment to a dense
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The value to be assigned to all elements of the dense matrix.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP assignment of the given value to all
+// elements of a dense matrix. Due to the explicit application of the SFINAE principle, this
+// function can only be selected by the compiler in case the matrix is SMP-assignable and its
+// element type is not SMP-assignable. Matrices that cannot be assigned in parallel (see the
+// \a SMP_DMATASSIGN_THRESHOLD) are assigned serially, as are all matrices within serial or
+// parallel sections.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename EnableIf< IsSMPAssignable<MT> >::Type
+   smpFill( DenseMatrix<MT,SO>& lhs, const typename MT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT::ElementType );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~lhs).canSMPAssign() ) {
+      for( size_t i=0UL; i<(~lhs).rows(); ++i )
+         for( size_t j=0UL; j<(~lhs).columns(); ++j )
+            (~lhs)(i,j) = value;
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFill_backend( ~lhs, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -40,20 +40,27 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/DenseSubvector.h>
+#include <blaze/math/dense/DenseVector.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/SparseSubvector.h>
+#include <blaze/math/sparse/Forward.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -67,6 +74,218 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  TRANSPOSE SPARSE MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based SMP evaluation of a transpose sparse matrix/dense vector
+//        multiplication.
+// \ingroup smp
+//
+// \param rhs The transpose sparse matrix/dense vector multiplication to be evaluated.
+// \param partials The partial results of the multiplication.
+// \return void
+//
+// This function evaluates the given multiplication of a column-major sparse matrix and a dense
+// vector in parallel. The columns of the matrix are split into one range per thread with
+// approximately the same number of non-zero elements (see partitionNonZeros()). Each thread
+// multiplies its range of columns with the according part of the vector and stores the result
+// in a separate partial result, which avoids any synchronization of the scattered updates.
+// Subsequently the partial results are summed up pairwise in parallel, such that on return the
+// first partial result contains the result of the multiplication.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT    // Type of the left-hand side sparse matrix
+        , typename VT >  // Type of the right-hand side dense vector
+void smpTSMatDVecMult_backend( const TSMatDVecMultExpr<MT,VT>& rhs
+                             , std::vector< typename TSMatDVecMultExpr<MT,VT>::ResultType >& partials )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename TSMatDVecMultExpr<MT,VT>::ResultType    RT;
+   typedef IntrinsicTrait<typename RT::ElementType>         IT;
+   typedef typename SubvectorExprTrait<RT,aligned>::Type    AlignedTarget;
+   typedef typename SubvectorExprTrait<RT,unaligned>::Type  UnalignedTarget;
+
+   const size_t threads( TheThreadBackend::size() );
+   const size_t rows   ( rhs.size() );
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( rhs.leftOperand(), threads, bounds );
+
+   const size_t parts( bounds.size() - 1UL );
+
+   partials.resize( parts );
+
+   for( size_t i=0UL; i<parts; ++i )
+   {
+      const size_t column( bounds[i] );
+      const size_t n     ( bounds[i+1UL] - column );
+
+      partials[i].resize( rows, false );
+
+      UnalignedTarget target( subvector<unaligned>( partials[i], 0UL, rows ) );
+      TheThreadBackend::scheduleAssign( target,
+                                        submatrix<unaligned>( rhs.leftOperand(), 0UL, column, rows, n ) *
+                                        subvector<unaligned>( rhs.rightOperand(), column, n ) );
+   }
+
+   TheThreadBackend::wait();
+
+   const size_t addon        ( ( ( rows % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( rows / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+   for( size_t step=1UL; step<parts; step*=2UL )
+   {
+      for( size_t i=0UL; i+step<parts; i+=2UL*step ) {
+         for( size_t index=0UL; index<rows; index+=sizePerThread ) {
+            const size_t size( min( sizePerThread, rows - index ) );
+            AlignedTarget target( subvector<aligned>( partials[i], index, size ) );
+            TheThreadBackend::scheduleAddAssign( target,
+                                                 subvector<aligned>( partials[i+step], index, size ) );
+         }
+      }
+
+      TheThreadBackend::wait();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded multiplication of a sparse matrix with dedicated
+//        multiplication kernel and a dense vector.
+// \ingroup smp
+//
+// The MultiplyKernelTask class template computes the rows of a sparse matrix/dense vector
+// multiplication that are stored in a range of chunks of the matrix and combines them with
+// the target vector via the given assignment operation (see BlockCompressedMatrix::multiply(),
+// SlicedEllpackMatrix::multiply(), and SplitCompressedMatrix::multiply()).
+*/
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2   // Type of the right-hand side dense vector
+        , typename OP >  // Type of the assignment operation
+struct MultiplyKernelTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MultiplyKernelTask class template.
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param begin The index of the first chunk of the range.
+   // \param end The index one past the last chunk of the range.
+   */
+   explicit inline MultiplyKernelTask( VT1& y, const MT& A, const VT2& x, size_t begin, size_t end )
+      : y_    ( &y )     // The target left-hand side dense vector
+      , A_    ( &A )     // The sparse matrix operand
+      , x_    ( &x )     // The right-hand side dense vector operand
+      , begin_( begin )  // The index of the first chunk of the range
+      , end_  ( end )    // The index one past the last chunk of the range
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the range of chunks.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      A_->multiply( *y_, *x_, begin_, end_, OP() );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT1* y_;        //!< The target left-hand side dense vector.
+   const MT* A_;   //!< The sparse matrix operand.
+   const VT2* x_;  //!< The right-hand side dense vector operand.
+   size_t begin_;  //!< The index of the first chunk of the range.
+   size_t end_;    //!< The index one past the last chunk of the range.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based SMP evaluation of a sparse matrix/dense vector multiplication
+//        via the multiplication kernel of the sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The sparse matrix/dense vector multiplication to be evaluated.
+// \param op The assignment operation.
+// \return void
+//
+// This function evaluates the given multiplication of a sparse matrix with a dedicated
+// multiplication kernel (i.e. a BlockCompressedMatrix, a SlicedEllpackMatrix, or a
+// SplitCompressedMatrix) and a dense vector in parallel. The chunks of the matrix are split
+// into ranges with approximately the same number of stored elements (see partitionNonZeros())
+// and each range is computed by a separate task via the vectorized kernel of the matrix. Since
+// the rows of the matrix might be permuted, the target vector is not split into subvectors,
+// but each task directly updates the elements of the rows stored in its chunks.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename MT    // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2   // Type of the right-hand side dense vector of the multiplication
+        , typename OP >  // Type of the assignment operation
+void smpMultiplyKernel_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs, OP )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const MT&  A( rhs.leftOperand()  );
+   const VT2& x( rhs.rightOperand() );
+
+   const size_t chunks( A.chunks() );
+
+   std::vector<size_t> weights( chunks );
+   for( size_t c=0UL; c<chunks; ++c )
+      weights[c] = A.chunkCapacity( c );
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( weights, TheThreadBackend::size()*SMP_TASKS_PER_THREAD, bounds );
+
+   for( size_t i=0UL; i+1UL<bounds.size(); ++i ) {
+      TheThreadBackend::schedule( MultiplyKernelTask<VT1,MT,VT2,OP>( ~lhs, A, x, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  PLAIN ASSIGNMENT
@@ -109,20 +328,20 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -179,18 +398,18 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( (~lhs).size() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -201,6 +420,187 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a sparse matrix/dense vector
+//        multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// row-major sparse matrix/dense vector multiplication to a dense vector. In contrast to the
+// default partitioning into parts of equal size, the rows are split into ranges with
+// approximately the same number of non-zero elements (see partitionNonZeros()), which balances
+// the work in case of irregular sparsity patterns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( rhs.leftOperand(), TheThreadBackend::size()*SMP_TASKS_PER_THREAD, bounds );
+
+   for( size_t i=0UL; i+1UL<bounds.size(); ++i )
+   {
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      TheThreadBackend::scheduleAssign( target, subvector<unaligned>( rhs, index, size ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
+// of a sliced ELLPACK matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SlicedEllpackMatrix<Type>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SlicedEllpackMatrix<Type>::Assign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a split compressed
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
+// of a split compressed matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the split compressed matrix
+        , typename IT     // Index type of the split compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SplitCompressedMatrix<Type,IT>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SplitCompressedMatrix<Type,IT>::Assign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a block compressed
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
+// of a block compressed matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the block compressed matrix
+        , size_t B        // Block size of the block compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<BlockCompressedMatrix<Type,B>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename BlockCompressedMatrix<Type,B>::Assign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a transpose sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// column-major sparse matrix/dense vector multiplication to a dense vector. The multiplication is
+// evaluated by means of the smpTSMatDVecMult_backend() function, the result is subsequently
+// assigned to the target vector in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   std::vector< typename TSMatDVecMultExpr<MT,VT2>::ResultType > partials;
+
+   smpTSMatDVecMult_backend( rhs, partials );
+   smpAssign_backend( ~lhs, partials[0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the C++11/Boost thread-based SMP assignment to a dense vector.
@@ -331,20 +731,20 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -401,18 +801,18 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( (~lhs).size() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -425,37 +825,48 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the C++11/Boost thread-based SMP addition assignment to a
-//        dense vector.
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a sparse matrix/dense
+//        vector multiplication to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side vector to be assigned.
+// \param rhs The right-hand side multiplication expression to be added.
 // \return void
 //
-// This function implements the default C++11/Boost thread-based SMP addition assignment to a
-// dense vector. Due to the explicit application of the SFINAE principle, this function can only
-// be selected by the compiler in case both operands are SMP-assignable and the element types of
-// both operands are not SMP-assignable.\n
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition
+// assignment of a row-major sparse matrix/dense vector multiplication to a dense vector. In
+// contrast to the default partitioning into parts of equal size, the rows are split into ranges
+// with approximately the same number of non-zero elements (see partitionNonZeros()), which
+// balances the work in case of irregular sparsity patterns.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename VT1  // Type of the left-hand side dense vector
-        , bool TF1      // Transpose flag of the left-hand side dense vector
-        , typename VT2  // Type of the right-hand side vector
-        , bool TF2 >    // Transpose flag of the right-hand side vector
-inline typename EnableIf< And< IsDenseVector<VT1>
-                             , Or< Not< IsSMPAssignable<VT1> >
-                                 , Not< IsSMPAssignable<VT2> > > > >::Type
-   smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   addAssign( ~lhs, ~rhs );
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( rhs.leftOperand(), TheThreadBackend::size()*SMP_TASKS_PER_THREAD, bounds );
+
+   for( size_t i=0UL; i+1UL<bounds.size(); ++i )
+   {
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( rhs, index, size ) );
+   }
+
+   TheThreadBackend::wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -463,35 +874,205 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment to a dense vector.
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication to a dense vector.
 // \ingroup smp
 //
 // \param lhs The target left-hand side dense vector.
-// \param rhs The right-hand side sparse vector to be added.
+// \param rhs The right-hand side multiplication expression to be added.
 // \return void
 //
-// This function performs the C++11/Boost thread-based SMP addition assignment to a dense vector.
-// Due to the explicit application of the SFINAE principle, this function can only be selected by
-// the compiler in case both operands are SMP-assignable and the element types of both operands
-// are not SMP-assignable.\n
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition assignment
+// of a sliced ELLPACK matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename VT1  // Type of the left-hand side dense vector
-        , bool TF1      // Transpose flag of the left-hand side dense vector
-        , typename VT2  // Type of the right-hand side vector
-        , bool TF2 >    // Transpose flag of the right-hand side vector
-inline typename EnableIf< And< IsDenseVector<VT1>
-                             , IsSMPAssignable<VT1>
-                             , IsSMPAssignable<VT2> > >::Type
-   smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SlicedEllpackMatrix<Type>,VT2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SlicedEllpackMatrix<Type>::AddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a split compressed
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be added.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition assignment
+// of a split compressed matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the split compressed matrix
+        , typename IT     // Index type of the split compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SplitCompressedMatrix<Type,IT>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SplitCompressedMatrix<Type,IT>::AddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a block compressed
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be added.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition assignment
+// of a block compressed matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the block compressed matrix
+        , size_t B        // Block size of the block compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<BlockCompressedMatrix<Type,B>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename BlockCompressedMatrix<Type,B>::AddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a transpose sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be added.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition
+// assignment of a column-major sparse matrix/dense vector multiplication to a dense vector. The
+// multiplication is evaluated by means of the smpTSMatDVecMult_backend() function, the result is
+// subsequently added to the target vector in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   std::vector< typename TSMatDVecMultExpr<MT,VT2>::ResultType > partials;
+
+   smpTSMatDVecMult_backend( rhs, partials );
+   smpAddAssign_backend( ~lhs, partials[0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP addition assignment to a
+//        dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP addition assignment to a
+// dense vector. Due to the explicit application of the SFINAE principle, this function can only
+// be selected by the compiler in case both operands are SMP-assignable and the element types of
+// both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , Or< Not< IsSMPAssignable<VT1> >
+                                 , Not< IsSMPAssignable<VT2> > > > >::Type
+   smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP addition assignment to a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case both operands are SMP-assignable and the element types of both operands
+// are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsDenseVector<VT1>
+                             , IsSMPAssignable<VT1>
+                             , IsSMPAssignable<VT2> > >::Type
+   smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -554,20 +1135,20 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -624,18 +1205,18 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( (~lhs).size() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -646,6 +1227,187 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
+// assignment of a row-major sparse matrix/dense vector multiplication to a dense vector. In
+// contrast to the default partitioning into parts of equal size, the rows are split into ranges
+// with approximately the same number of non-zero elements (see partitionNonZeros()), which
+// balances the work in case of irregular sparsity patterns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( rhs.leftOperand(), TheThreadBackend::size()*SMP_TASKS_PER_THREAD, bounds );
+
+   for( size_t i=0UL; i+1UL<bounds.size(); ++i )
+   {
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( rhs, index, size ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction assignment
+// of a sliced ELLPACK matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SlicedEllpackMatrix<Type>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SlicedEllpackMatrix<Type>::SubAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a split compressed
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction assignment
+// of a split compressed matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the split compressed matrix
+        , typename IT     // Index type of the split compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SplitCompressedMatrix<Type,IT>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SplitCompressedMatrix<Type,IT>::SubAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a block compressed
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction assignment
+// of a block compressed matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the block compressed matrix
+        , size_t B        // Block size of the block compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<BlockCompressedMatrix<Type,B>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename BlockCompressedMatrix<Type,B>::SubAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a transpose sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
+// assignment of a column-major sparse matrix/dense vector multiplication to a dense vector. The
+// multiplication is evaluated by means of the smpTSMatDVecMult_backend() function, the result is
+// subsequently subtracted to the target vector in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   std::vector< typename TSMatDVecMultExpr<MT,VT2>::ResultType > partials;
+
+   smpTSMatDVecMult_backend( rhs, partials );
+   smpSubAssign_backend( ~lhs, partials[0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the C++11/Boost thread-based SMP subtraction assignment to a
@@ -778,20 +1540,20 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -848,18 +1610,18 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( (~lhs).size() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -870,6 +1632,187 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP multiplication assignment of a sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP multiplication
+// assignment of a row-major sparse matrix/dense vector multiplication to a dense vector. In
+// contrast to the default partitioning into parts of equal size, the rows are split into ranges
+// with approximately the same number of non-zero elements (see partitionNonZeros()), which
+// balances the work in case of irregular sparsity patterns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpMultAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+   std::vector<size_t> bounds;
+   partitionNonZeros( rhs.leftOperand(), TheThreadBackend::size()*SMP_TASKS_PER_THREAD, bounds );
+
+   for( size_t i=0UL; i+1UL<bounds.size(); ++i )
+   {
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( rhs, index, size ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP multiplication assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP multiplication assignment
+// of a sliced ELLPACK matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpMultAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SlicedEllpackMatrix<Type>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SlicedEllpackMatrix<Type>::MultAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP multiplication assignment of a split compressed
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP multiplication assignment
+// of a split compressed matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the split compressed matrix
+        , typename IT     // Index type of the split compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpMultAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<SplitCompressedMatrix<Type,IT>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename SplitCompressedMatrix<Type,IT>::MultAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP multiplication assignment of a block compressed
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP multiplication assignment
+// of a block compressed matrix/dense vector multiplication to a dense vector. The multiplication
+// is evaluated by means of the smpMultiplyKernel_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename Type   // Data type of the block compressed matrix
+        , size_t B        // Block size of the block compressed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpMultAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<BlockCompressedMatrix<Type,B>,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpMultiplyKernel_backend( ~lhs, rhs, typename BlockCompressedMatrix<Type,B>::MultAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP multiplication assignment of a transpose
+//        sparse matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be multiplied.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP multiplication
+// assignment of a column-major sparse matrix/dense vector multiplication to a dense vector. The
+// multiplication is evaluated by means of the smpTSMatDVecMult_backend() function, the result is
+// subsequently multiplied to the target vector in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix of the multiplication
+        , typename VT2 >  // Type of the right-hand side dense vector of the multiplication
+void smpMultAssign_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   std::vector< typename TSMatDVecMultExpr<MT,VT2>::ResultType > partials;
+
+   smpTSMatDVecMult_backend( rhs, partials );
+   smpMultAssign_backend( ~lhs, partials[0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the C++11/Boost thread-based SMP multiplication assignment
@@ -959,6 +1902,303 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction
+// of a dense vector. The vector is split into several parts per thread, the parts are reduced in
+// parallel and the partial results are finally combined via the given reduction operation.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense vectors. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+const typename VT::ElementType smpReduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename VT::ElementType  ET;
+   typedef IntrinsicTrait<ET>        IT;
+
+   const bool vectorizable( VT::vectorizable );
+   const bool dvAligned   ( (~dv).isAligned() );
+
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~dv).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~dv).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t parts      ( ( (~dv).size() - 1UL ) / sizePerTask + 1UL );
+
+   std::vector<ET> partials( parts );
+
+   for( size_t i=0UL; i<parts; ++i )
+   {
+      const size_t index( i*sizePerTask );
+      const size_t size ( min( sizePerTask, (~dv).size() - index ) );
+
+      if( vectorizable && dvAligned ) {
+         TheThreadBackend::scheduleReduce( subvector<aligned>( ~dv, index, size ), partials[i], op );
+      }
+      else {
+         TheThreadBackend::scheduleReduce( subvector<unaligned>( ~dv, index, size ), partials[i], op );
+      }
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( partials[0UL] );
+   for( size_t i=1UL; i<parts; ++i )
+      redux = op( redux, partials[i] );
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function implements the default C++11/Boost thread-based SMP reduction of a dense
+// vector. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense vectors. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< Not< IsSMPAssignable<VT> >, const typename VT::ElementType >::Type
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return serialReduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function performs the C++11/Boost thread-based SMP reduction of a dense vector. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the vector is SMP-assignable and its element type is not SMP-assignable.
+// Vectors not exceeding the \a SMP_DVECREDUCE_THRESHOLD are reduced serially, as are all
+// vectors within serial or parallel sections.\n
+// This function must \b NOT be called explicitly! It is used internally for the reduction of
+// dense vectors. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< IsSMPAssignable<VT>, const typename VT::ElementType >::Type
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT::ElementType );
+
+   typedef typename VT::ElementType  ET;
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dv).size() <= SMP_DVECREDUCE_THRESHOLD ) {
+      return serialReduce( ~dv, op );
+   }
+
+   ET redux = ET();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( ~dv, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HOMOGENEOUS ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP homogeneous assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The value to be assigned to all elements of the dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of
+// the given value to all elements of a dense vector. The vector is partitioned in the same way
+// as for the SMP assignment of a dense vector, i.e. in NUMA mode each part is initialized by the
+// same thread that works on it in subsequent operations.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+void smpFill_backend( DenseVector<VT,TF>& lhs, const typename VT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename VT::ElementType>         IT;
+   typedef typename SubvectorExprTrait<VT,aligned>::Type    AlignedTarget;
+   typedef typename SubvectorExprTrait<VT,unaligned>::Type  UnalignedTarget;
+
+   const bool vectorizable( VT::vectorizable );
+   const bool lhsAligned  ( (~lhs).isAligned() );
+
+   const size_t tasks      ( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+   for( size_t i=0UL; i<tasks; ++i )
+   {
+      const size_t index( i*sizePerTask );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
+
+      if( vectorizable && lhsAligned ) {
+         AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
+         TheThreadBackend::scheduleFill( target, value );
+      }
+      else {
+         UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+         TheThreadBackend::scheduleFill( target, value );
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP homogeneous assignment to
+//        a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The value to be assigned to all elements of the dense vector.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP assignment of the given
+// value to all elements of a dense vector. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case the vector is not
+// SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename EnableIf< Not< IsSMPAssignable<VT> > >::Type
+   smpFill( DenseVector<VT,TF>& lhs, const typename VT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   for( size_t i=0UL; i<(~lhs).size(); ++i )
+      (~lhs)[i] = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP homogeneous assignment to a dense
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The value to be assigned to all elements of the dense vector.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP assignment of the given value to all
+// elements of a dense vector. Due to the explicit application of the SFINAE principle, this
+// function can only be selected by the compiler in case the vector is SMP-assignable and its
+// element type is not SMP-assignable. Vectors that cannot be assigned in parallel (see the
+// \a SMP_DVECASSIGN_THRESHOLD) are assigned serially, as are all vectors within serial or
+// parallel sections.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename EnableIf< IsSMPAssignable<VT> >::Type
+   smpFill( DenseVector<VT,TF>& lhs, const typename VT::ElementType& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT::ElementType );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~lhs).canSMPAssign() ) {
+      for( size_t i=0UL; i<(~lhs).size(); ++i )
+         (~lhs)[i] = value;
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFill_backend( ~lhs, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
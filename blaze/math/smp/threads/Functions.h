@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <vector>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
@@ -86,7 +87,7 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 // Note that the given \a number must be in the range \f$[1..\infty)\f$. In case an invalid
 // number of threads is specified, a \a std::invalid_argument exception is thrown.
 */
-BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
    if( number == 0UL )
       throw std::invalid_argument( "Invalid number of threads" );
@@ -97,6 +98,30 @@ BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for thread parallel operations to the given CPUs.
+// \ingroup smp
+//
+// \param cpus The list of CPUs.
+// \return void
+// \exception std::invalid_argument Invalid list of CPUs.
+//
+// Via this function the threads used for thread parallel operations can be pinned to the given
+// list of CPUs (see parseCpuList()). The calling thread, which participates in all parallel
+// operations, is pinned to the first CPU, the remaining threads are pinned to the following
+// CPUs. In case there are more threads than CPUs, the list of CPUs is used cyclically. The
+// initial affinity can be specified via the \c BLAZE_THREAD_AFFINITY environment variable. In
+// case the given list of CPUs is empty, a \a std::invalid_argument exception is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   TheThreadBackend::setAffinity( cpus );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -0,0 +1,511 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SparseMatrix.h
+//  \brief Header file for the C++11/Boost thread-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/smp/default/SparseMatrix.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SpGEMM.h>
+#include <blaze/math/sparse/TripletAssembly.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/SPARSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded symbolic phase of a sparse matrix multiplication.
+// \ingroup smp
+//
+// The SpGEMMSymbolicTask class template counts the non-zero elements of a range of rows of the
+// product of two row-major sparse matrices (see spgemmSymbolic()).
+*/
+template< typename MT1   // Type of the left-hand side sparse matrix
+        , typename MT2   // Type of the right-hand side sparse matrix
+        , typename ET >  // Element type of the result
+struct SpGEMMSymbolicTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SpGEMMSymbolicTask class template.
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param begin The index of the first row of the range.
+   // \param end The index one past the last row of the range.
+   // \param nonzeros The resulting numbers of non-zero elements of the rows.
+   */
+   explicit inline SpGEMMSymbolicTask( const MT1& A, const MT2& B, size_t begin, size_t end,
+                                       std::vector<size_t>& nonzeros )
+      : A_       ( &A )         // The left-hand side sparse matrix operand
+      , B_       ( &B )         // The right-hand side sparse matrix operand
+      , begin_   ( begin )      // The index of the first row of the range
+      , end_     ( end )        // The index one past the last row of the range
+      , nonzeros_( &nonzeros )  // The resulting numbers of non-zero elements
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Counts the non-zero elements of the range of rows.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      SpGEMMAccumulator<ET> acc( B_->columns() );
+      spgemmSymbolic( *A_, *B_, begin_, end_, *nonzeros_, acc );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT1* A_;                   //!< The left-hand side sparse matrix operand.
+   const MT2* B_;                   //!< The right-hand side sparse matrix operand.
+   size_t begin_;                   //!< The index of the first row of the range.
+   size_t end_;                     //!< The index one past the last row of the range.
+   std::vector<size_t>* nonzeros_;  //!< The resulting numbers of non-zero elements.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded numeric phase of a sparse matrix multiplication.
+// \ingroup smp
+//
+// The SpGEMMNumericTask class template computes a range of rows of the product of two row-major
+// sparse matrices and appends them to the according rows of the target matrix (see
+// spgemmNumeric()).
+*/
+template< typename MT    // Type of the target sparse matrix
+        , typename MT1   // Type of the left-hand side sparse matrix
+        , typename MT2   // Type of the right-hand side sparse matrix
+        , typename ET >  // Element type of the result
+struct SpGEMMNumericTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SpGEMMNumericTask class template.
+   //
+   // \param C The target sparse matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param begin The index of the first row of the range.
+   // \param end The index one past the last row of the range.
+   */
+   explicit inline SpGEMMNumericTask( MT& C, const MT1& A, const MT2& B, size_t begin, size_t end )
+      : C_    ( &C )     // The target sparse matrix
+      , A_    ( &A )     // The left-hand side sparse matrix operand
+      , B_    ( &B )     // The right-hand side sparse matrix operand
+      , begin_( begin )  // The index of the first row of the range
+      , end_  ( end )    // The index one past the last row of the range
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the range of rows.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      SpGEMMAccumulator<ET> acc( B_->columns() );
+      spgemmNumeric( *C_, *A_, *B_, begin_, end_, acc );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT* C_;         //!< The target sparse matrix.
+   const MT1* A_;  //!< The left-hand side sparse matrix operand.
+   const MT2* B_;  //!< The right-hand side sparse matrix operand.
+   size_t begin_;  //!< The index of the first row of the range.
+   size_t end_;    //!< The index one past the last row of the range.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a sparse matrix/sparse matrix
+//        multiplication to a row-major compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of
+// a sparse matrix/sparse matrix multiplication to a row-major compressed matrix. The product is
+// computed in two phases by means of Gustavson's algorithm: In the symbolic phase the thread
+// team counts the non-zero elements of each row of the result, which are used to reserve the
+// exact capacity of each row of the target matrix in a single step. In the numeric phase the
+// thread team computes the rows and appends them directly to the target matrix. Both phases
+// operate on ranges of rows of approximately the same amount of work (see partitionNonZeros())
+// and each task uses its own hash/SPA accumulator (see SpGEMMAccumulator).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the left-hand side compressed matrix
+        , typename MT1    // Type of the left-hand side sparse matrix of the multiplication
+        , typename MT2 >  // Type of the right-hand side sparse matrix of the multiplication
+void smpAssign_backend( CompressedMatrix<Type,false>& lhs, const SMatSMatMultExpr<MT1,MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CompressedMatrix<Type,false>                     MT;
+   typedef typename SMatSMatMultExpr<MT1,MT2>::ElementType  ET;
+   typedef typename MT1::CompositeType                      CT1;
+   typedef typename MT2::CompositeType                      CT2;
+   typedef typename RemoveReference<CT1>::Type              LT;
+   typedef typename RemoveReference<CT2>::Type              RT;
+
+   CT1 A( serial( rhs.leftOperand()  ) );  // Evaluation of the left-hand side sparse matrix operand
+   CT2 B( serial( rhs.rightOperand() ) );  // Evaluation of the right-hand side sparse matrix operand
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == lhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == lhs.columns(), "Invalid number of columns" );
+
+   const size_t tasks( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+
+   std::vector<size_t> nonzeros( lhs.rows(), 0UL );
+   std::vector<size_t> bounds;
+
+   // Symbolic phase: counting the non-zero elements of each row of the result
+   partitionNonZeros( A, tasks, bounds );
+
+   for( size_t i=0UL; i+1UL<bounds.size(); ++i ) {
+      TheThreadBackend::schedule( SpGEMMSymbolicTask<LT,RT,ET>( A, B, bounds[i], bounds[i+1UL], nonzeros ) );
+   }
+
+   TheThreadBackend::wait();
+
+   lhs.reserve( nonzeros );
+
+   // Numeric phase: computing the rows of the result
+   partitionNonZeros( nonzeros, tasks, bounds );
+
+   for( size_t i=0UL; i+1UL<bounds.size(); ++i ) {
+      TheThreadBackend::schedule( SpGEMMNumericTask<MT,LT,RT,ET>( lhs, A, B, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment of a sparse matrix/sparse
+//        matrix multiplication to a row-major compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assignment of a sparse matrix/sparse
+// matrix multiplication to a row-major compressed matrix. The target matrix is expected to be
+// empty. Since compressed matrices are also assigned via this function during their construction,
+// which may happen within the tasks of another parallel operation, the multiplication is executed
+// serially within both serial and parallel sections.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the left-hand side compressed matrix
+        , typename MT1    // Type of the left-hand side sparse matrix of the multiplication
+        , typename MT2 >  // Type of the right-hand side sparse matrix of the multiplication
+inline typename EnableIf< And< IsSMPAssignable< CompressedMatrix<Type,false> >
+                             , IsSMPAssignable< SMatSMatMultExpr<MT1,MT2> > > >::Type
+   smpAssign( CompressedMatrix<Type,false>& lhs, const SMatSMatMultExpr<MT1,MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( lhs.rows()    == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.columns(), "Invalid number of columns" );
+
+   if( isParallelSectionActive() || isSerialSectionActive() || !rhs.canSMPAssign() ) {
+      assign( lhs, rhs );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpAssign_backend( lhs, rhs );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIPLET ASSEMBLY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded assembly of a compressed matrix from triplets.
+// \ingroup smp
+//
+// The TripletAssemblyTask class template executes a single phase of a TripletAssembler for a
+// range of parts of the triplet sequence (count and scatter phase) or for a range of keys
+// (compress and append phase).
+*/
+template< typename MT    // Type of the target sparse matrix
+        , typename TA >  // Type of the triplet assembler
+struct TripletAssemblyTask
+{
+   //**Phases**************************************************************************************
+   enum Phase { count = 0, scatter = 1, compress = 2, append = 3 };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TripletAssemblyTask class template.
+   //
+   // \param A The target sparse matrix.
+   // \param assembler The triplet assembler.
+   // \param phase The phase to be executed.
+   // \param begin The index of the first part/key of the range.
+   // \param end The index one past the last part/key of the range.
+   */
+   explicit inline TripletAssemblyTask( MT& A, TA& assembler, Phase phase, size_t begin, size_t end )
+      : A_        ( &A )          // The target sparse matrix
+      , assembler_( &assembler )  // The triplet assembler
+      , phase_    ( phase )       // The phase to be executed
+      , begin_    ( begin )       // The index of the first part/key of the range
+      , end_      ( end )         // The index one past the last part/key of the range
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Executes the phase for the range of parts/keys.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      switch( phase_ ) {
+         case count:
+            for( size_t part=begin_; part<end_; ++part ) assembler_->count( part );
+            break;
+         case scatter:
+            for( size_t part=begin_; part<end_; ++part ) assembler_->scatter( part );
+            break;
+         case compress:
+            assembler_->compress( begin_, end_ );
+            break;
+         case append:
+            assembler_->append( *A_, begin_, end_ );
+            break;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT* A_;          //!< The target sparse matrix.
+   TA* assembler_;  //!< The triplet assembler.
+   Phase phase_;    //!< The phase to be executed.
+   size_t begin_;   //!< The index of the first part/key of the range.
+   size_t end_;     //!< The index one past the last part/key of the range.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assembly of a compressed matrix from
+//        (row,column,value) triplets.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param size The total number of triplets.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assembly of
+// a compressed matrix from triplets. Each thread counts and scatters the triplets of its parts
+// of the triplet sequence into the segments of the rows/columns (counting sort). Afterwards the
+// thread team sorts the segments and sums up duplicates on ranges of rows/columns of balanced
+// work (see partitionNonZeros()). The resulting numbers of non-zero elements are used to reserve
+// the exact capacity of all rows/columns of the target matrix in a single step, before the
+// thread team appends the rows/columns to the target matrix (see TripletAssembler).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized assembly of compressed matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assemble() function.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO        // Storage order of the left-hand side compressed matrix
+        , typename IT >  // Type of the row and column indices
+void smpAssemble_backend( CompressedMatrix<Type,SO>& lhs, const IT* rows, const IT* columns,
+                          const Type* values, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CompressedMatrix<Type,SO>     MT;
+   typedef TripletAssembler<Type,IT,SO>  TA;
+   typedef TripletAssemblyTask<MT,TA>    Task;
+
+   const size_t tasks( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+
+   TA assembler( lhs.rows(), lhs.columns(), rows, columns, values, size, tasks );
+
+   std::vector<size_t> bounds;
+
+   // Counting sort of the triplets by their rows/columns
+   for( size_t part=0UL; part<assembler.parts(); ++part ) {
+      TheThreadBackend::schedule( Task( lhs, assembler, Task::count, part, part+1UL ) );
+   }
+
+   TheThreadBackend::wait();
+
+   assembler.prefix();
+
+   for( size_t part=0UL; part<assembler.parts(); ++part ) {
+      TheThreadBackend::schedule( Task( lhs, assembler, Task::scatter, part, part+1UL ) );
+   }
+
+   TheThreadBackend::wait();
+
+   // Sorting of the rows/columns and summation of duplicates
+   partitionNonZeros( assembler.nonZeros(), tasks, bounds );
+
+   for( size_t i=0UL; i+1UL<bounds.size(); ++i ) {
+      TheThreadBackend::schedule( Task( lhs, assembler, Task::compress, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+
+   lhs.reserve( assembler.nonZeros() );
+
+   // Appending the rows/columns to the target matrix
+   partitionNonZeros( assembler.nonZeros(), tasks, bounds );
+
+   for( size_t i=0UL; i+1UL<bounds.size(); ++i ) {
+      TheThreadBackend::schedule( Task( lhs, assembler, Task::append, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assembly of a compressed matrix from
+//        (row,column,value) triplets.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param size The total number of triplets.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assembly of a compressed matrix from
+// triplets. The target matrix is expected to be empty. In case the number of triplets is below
+// the SMP_TRIPLETASSEMBLY_THRESHOLD or in case the function is called within a serial or parallel
+// section, the triplets are assembled serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized assembly of compressed matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assemble() function.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO        // Storage order of the left-hand side compressed matrix
+        , typename IT >  // Type of the row and column indices
+inline void smpAssemble( CompressedMatrix<Type,SO>& lhs, const IT* rows, const IT* columns,
+                         const Type* values, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isParallelSectionActive() || isSerialSectionActive() ||
+       size < SMP_TRIPLETASSEMBLY_THRESHOLD ) {
+      tripletAssembly( lhs, rows, columns, values, size );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpAssemble_backend( lhs, rows, columns, values, size );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,23 +41,33 @@
 //*************************************************************************************************
 
 #if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <atomic>
 #  include <condition_variable>
 #  include <mutex>
 #  include <thread>
 #elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/atomic.hpp>
 #  include <boost/thread/condition.hpp>
 #  include <boost/thread/mutex.hpp>
 #  include <boost/thread/thread.hpp>
 #endif
 
 #include <cstdlib>
+#include <string>
+#include <stdexcept>
+#include <vector>
+#include <boost/exception_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 #include <blaze/math/constraints/Expression.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/smp/threads/AsyncExecutor.h>
+#include <blaze/math/smp/threads/ThreadTeam.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/Affinity.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
-#include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -74,24 +84,81 @@ namespace blaze {
 // \ingroup smp
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
-// thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// thread-based parallelization. It provides the functionality to manage a team of active
+// threads and to schedule (compound) assignment tasks for execution. All tasks scheduled
+// before a call to wait() are executed as a single batch by the thread team (see ThreadTeam).
+// Additionally, complete operations can be launched asynchronously (see launch()). These are
+// executed one after another by a single executor thread, which in turn uses the thread team
+// for the parallel execution of the operation.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
-        , typename CT >  // Type of the condition variable
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
 class ThreadBackend
 {
+ private:
+   //**Type definitions****************************************************************************
+   struct AsyncState;
+   //**********************************************************************************************
+
  public:
+   //**Class Future********************************************************************************
+   /*!\brief Handle for the completion of an asynchronously executed operation.
+   //
+   // The Future class represents the completion of an operation launched via launch(). Copies
+   // of a Future refer to the same operation. A default constructed Future represents a
+   // completed operation.
+   */
+   class Future
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\name Constructor */
+      //@{
+      inline Future();
+      //@}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\name Utility functions */
+      //@{
+      inline bool ready() const;
+      inline void wait () const;
+      //@}
+      //*******************************************************************************************
+
+    private:
+      //**Constructor******************************************************************************
+      /*!\name Constructor */
+      //@{
+      explicit inline Future( const boost::shared_ptr<AsyncState>& state );
+      //@}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      /*!\name Member variables */
+      //@{
+      boost::shared_ptr<AsyncState> state_;  //!< The shared state of the asynchronous operation.
+      //@}
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      friend class ThreadBackend;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline size_t size  ();
-   static inline void   resize( size_t n, bool block=false );
-   static inline void   wait  ();
+   static inline size_t size       ();
+   static inline void   resize     ( size_t n, bool block=false );
+   static inline void   setAffinity( const std::vector<size_t>& cpus );
+   static inline void   wait       ();
    //@}
    //**********************************************************************************************
 
@@ -109,10 +176,99 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleMultAssign( Target& target, const Source& source );
+
+   template< typename Source, typename Result, typename OP >
+   static inline void scheduleReduce( const Source& source, Result& result, OP op );
+
+   template< typename Target, typename Value >
+   static inline void scheduleFill( Target& target, const Value& value );
+
+   template< typename Callable >
+   static inline void schedule( Callable func );
+   //@}
+   //**********************************************************************************************
+
+   //**Asynchronous execution functions************************************************************
+   /*!\name Asynchronous execution functions */
+   //@{
+   template< typename Callable >
+   static inline Future launch( Callable func );
    //@}
    //**********************************************************************************************
 
  private:
+   //**Private struct AsyncState*******************************************************************
+   /*!\brief Shared state of an asynchronously executed operation.
+   */
+   struct AsyncState
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the AsyncState struct.
+      */
+      inline AsyncState()
+         : done_     ( false )  // Completion flag of the operation
+         , error_    ()         // The exception thrown by the operation
+         , mutex_    ()         // Synchronization mutex
+         , completed_()         // Wait condition for the completion of the operation
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      bool                 done_;       //!< Completion flag of the operation.
+      boost::exception_ptr error_;      //!< The exception thrown by the operation.
+      MT                   mutex_;      //!< Synchronization mutex.
+      CT                   completed_;  //!< Wait condition for the completion of the operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Launcher**********************************************************************
+   /*!\brief Auxiliary functor for the asynchronous execution of an operation.
+   */
+   template< typename Callable >  // Type of the function/functor
+   struct Launcher
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Launcher class template.
+      //
+      // \param func The operation to be executed.
+      // \param state The shared state of the operation.
+      */
+      explicit inline Launcher( Callable func, const boost::shared_ptr<AsyncState>& state )
+         : func_ ( func  )  // The operation to be executed
+         , state_( state )  // The shared state of the operation
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the operation and signals its completion.
+      //
+      // \return void
+      //
+      // Any exception thrown by the operation is stored in the shared state and rethrown by
+      // Future::wait().
+      */
+      inline void operator()() {
+         try {
+            func_();
+         }
+         catch( ... ) {
+            state_->error_ = boost::current_exception();
+         }
+
+         LT lock( state_->mutex_ );
+         state_->done_ = true;
+         state_->completed_.notify_all();
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Callable                      func_;   //!< The operation to be executed.
+      boost::shared_ptr<AsyncState> state_;  //!< The shared state of the operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Private class Assigner**********************************************************************
    /*!\brief Auxiliary functor for the threaded execution of a plain assignment.
    */
@@ -277,22 +433,114 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class Reducer***********************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a reduction.
+   */
+   template< typename Source  // Type of the source operand
+           , typename Result  // Type of the reduction result
+           , typename OP >    // Type of the reduction operation
+   struct Reducer
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Reducer class template.
+      //
+      // \param source The source operand to be reduced.
+      // \param result The reference to the result of the reduction.
+      // \param op The reduction operation.
+      */
+      explicit inline Reducer( const Source& source, Result& result, OP op )
+         : source_( source )  // The source operand
+         , result_( result )  // The result of the reduction
+         , op_    ( op     )  // The reduction operation
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Performs the reduction of the source operand.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         result_ = serialReduce( source_, op_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const Source source_;  //!< The source operand.
+      Result&      result_;  //!< The result of the reduction.
+      OP           op_;      //!< The reduction operation.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Source );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Filler************************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a homogeneous assignment.
+   */
+   template< typename Target   // Type of the target operand
+           , typename Value >  // Type of the assigned value
+   struct Filler
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Filler class template.
+      //
+      // \param target The target operand to be assigned to.
+      // \param value The value to be assigned to all elements of the target.
+      */
+      explicit inline Filler( Target& target, const Value& value )
+         : target_( target )  // The target operand
+         , value_ ( value  )  // The assigned value
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Performs the homogeneous assignment to the target operand.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         target_ = value_;
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target target_;  //!< The target operand.
+      Value  value_;   //!< The value to be assigned to all elements of the target.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
-   static inline size_t initPool();
+   static inline size_t              initPool    ();
+   static inline std::vector<size_t> initAffinity();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static ThreadTeam<TT,MT,LT,CT,AT> threadteam_;  //!< The thread team of the backend system.
+                                                   /*!< It is initialized with the number of threads
+                                                        specified via the environment variable
+                                                        \c BLAZE_NUM_THREADS and pinned to the CPUs
+                                                        specified via the environment variable
+                                                        \c BLAZE_THREAD_AFFINITY. However, it can be
+                                                        explicitly resized to arbitrary numbers of
+                                                        threads. */
+
+   static AsyncExecutor<TT,MT,LT,CT> executor_;  //!< The executor of the asynchronous operations.
+                                                 /*!< It consists of a single thread, which executes
+                                                      the operations launched via launch() in the
+                                                      order of their launch. */
    //@}
    //**********************************************************************************************
 };
@@ -310,8 +558,11 @@ class ThreadBackend
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+template< typename TT, typename MT, typename LT, typename CT, typename AT >
+ThreadTeam<TT,MT,LT,CT,AT> ThreadBackend<TT,MT,LT,CT,AT>::threadteam_( initPool(), initAffinity() );
+
+template< typename TT, typename MT, typename LT, typename CT, typename AT >
+AsyncExecutor<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT,AT>::executor_;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -333,10 +584,11 @@ ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
-        , typename CT >  // Type of the condition variable
-inline size_t ThreadBackend<TT,MT,LT,CT>::size()
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline size_t ThreadBackend<TT,MT,LT,CT,AT>::size()
 {
-   return threadpool_.size();
+   return threadteam_.size();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -351,20 +603,54 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 // \return void
 // \exception std::invalid_argument Invalid number of threads.
 //
-// This function changes the total number of threads managed by the thread backend system. If
-// \a n is smaller than the current size of the thread pool, the according number of threads is
-// removed from the backend system, otherwise new threads are added to the backend system. In
+// This function changes the total number of threads managed by the thread backend system. In
 // case an invalid number of threads is specified, an \a std::invalid_argument exception is
-// thrown. Via the \a block flag it is possible to block the function until the desired
-// number of threads is available.
+// thrown. Note that the function always blocks until the currently executed operation has
+// been completed and until the new worker threads have been created. The \a block flag is
+// therefore without effect. A size of 0 additionally terminates the executor of the asynchronous
+// operations (see the shutDownThreads() function).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline void ThreadBackend<TT,MT,LT,CT,AT>::resize( size_t n, bool block )
+{
+   UNUSED_PARAMETER( block );
+
+   if( n == 0UL )
+      executor_.shutdown();
+
+   threadteam_.resize( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads managed by the thread backend system to the given CPUs.
+//
+// \param cpus The list of CPUs.
+// \return void
+// \exception std::invalid_argument Invalid list of CPUs.
+//
+// This function pins the calling thread to the first given CPU and all other threads of the
+// thread backend system to the following CPUs (see ThreadTeam::setAffinity()). In case the
+// given list of CPUs is empty, a \a std::invalid_argument exception is thrown.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
-        , typename CT >  // Type of the condition variable
-inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline void ThreadBackend<TT,MT,LT,CT,AT>::setAffinity( const std::vector<size_t>& cpus )
 {
-   return threadpool_.resize( n, block );
+   if( cpus.empty() )
+      throw std::invalid_argument( "Invalid list of CPUs" );
+
+   threadteam_.setAffinity( cpus );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -376,15 +662,17 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function executes all scheduled tasks by means of the thread team and blocks until all
+// tasks have been completed.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
-        , typename CT >  // Type of the condition variable
-inline void ThreadBackend<TT,MT,LT,CT>::wait()
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline void ThreadBackend<TT,MT,LT,CT,AT>::wait()
 {
-   threadpool_.wait();
+   threadteam_.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -411,13 +699,14 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
         , typename LT        // Type of the mutex lock
-        , typename CT >      // Type of the condition variable
+        , typename CT        // Type of the condition variable
+        , typename AT >      // Type of the atomic counter
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT,AT>::scheduleAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source>( target, source ) );
+   threadteam_.schedule( Assigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -436,13 +725,14 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const So
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
         , typename LT        // Type of the mutex lock
-        , typename CT >      // Type of the condition variable
+        , typename CT        // Type of the condition variable
+        , typename AT >      // Type of the atomic counter
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT,AT>::scheduleAddAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( AddAssigner<Target,Source>( target, source ) );
+   threadteam_.schedule( AddAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -461,13 +751,14 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
         , typename LT        // Type of the mutex lock
-        , typename CT >      // Type of the condition variable
+        , typename CT        // Type of the condition variable
+        , typename AT >      // Type of the atomic counter
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT,AT>::scheduleSubAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SubAssigner<Target,Source>( target, source ) );
+   threadteam_.schedule( SubAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -486,13 +777,234 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
         , typename LT        // Type of the mutex lock
-        , typename CT >      // Type of the condition variable
+        , typename CT        // Type of the condition variable
+        , typename AT >      // Type of the atomic counter
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT,AT>::scheduleMultAssign( Target& target, const Source& source )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   threadteam_.schedule( MultAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a reduction of the given operand for execution.
+//
+// \param source The source operand to be reduced.
+// \param result The reference to the result of the reduction.
+// \param op The reduction operation.
+// \return void
+//
+// This function schedules a reduction of the given operand for execution. The result of the
+// reduction is stored in \a result, which must remain valid until the task has been completed.
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT      // Type of the condition variable
+        , typename AT >    // Type of the atomic counter
+template< typename Source  // Type of the source operand
+        , typename Result  // Type of the reduction result
+        , typename OP >    // Type of the reduction operation
+inline void ThreadBackend<TT,MT,LT,CT,AT>::scheduleReduce( const Source& source, Result& result, OP op )
+{
+   threadteam_.schedule( Reducer<Source,Result,OP>( source, result, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a homogeneous assignment to the given operand for execution.
+//
+// \param target The target operand to be assigned to.
+// \param value The value to be assigned to all elements of the target.
+// \return void
+//
+// This function schedules the assignment of the given value to all elements of the given
+// operand for execution.
+*/
+template< typename TT       // Type of the encapsulated thread
+        , typename MT       // Type of the synchronization mutex
+        , typename LT       // Type of the mutex lock
+        , typename CT       // Type of the condition variable
+        , typename AT >     // Type of the atomic counter
+template< typename Target   // Type of the target operand
+        , typename Value >  // Type of the assigned value
+inline void ThreadBackend<TT,MT,LT,CT,AT>::scheduleFill( Target& target, const Value& value )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( MultAssigner<Target,Source>( target, source ) );
+   threadteam_.schedule( Filler<Target,Value>( target, value ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function or functor.
+// \return void
+//
+// This function schedules the given function/functor for execution by the thread team. Note
+// that the function/functor must be copyable. Since the worker threads are permanently inside
+// a serial section, the calling thread also has to be inside a serial section in order to
+// guarantee that all operations issued by the function/functor are executed serially.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT          // Type of the condition variable
+        , typename AT >        // Type of the atomic counter
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT,AT>::schedule( Callable func )
+{
+   threadteam_.schedule( func );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Launching the given function/functor for asynchronous execution.
+//
+// \param func The given function/functor.
+// \return The handle for the completion of the operation.
+//
+// This function schedules the given function/functor for the execution by the executor thread
+// of the backend system and returns immediately. The operations are executed one after another
+// in the order of their launch. Parallel operations issued by the function/functor are executed
+// by the thread team, interleaved with the parallel operations issued by other threads. The
+// given function/functor must be copyable, must be callable without arguments and must not
+// return a value. It must not wait for the completion of another asynchronous operation.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT          // Type of the condition variable
+        , typename AT >        // Type of the atomic counter
+template< typename Callable >  // Type of the function/functor
+inline typename ThreadBackend<TT,MT,LT,CT,AT>::Future
+   ThreadBackend<TT,MT,LT,CT,AT>::launch( Callable func )
+{
+   const boost::shared_ptr<AsyncState> state( new AsyncState() );
+   executor_.schedule( Launcher<Callable>( func, state ) );
+   return Future( state );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUTURE MEMBER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The default constructor for the Future class.
+//
+// A default constructed Future represents a completed operation.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline ThreadBackend<TT,MT,LT,CT,AT>::Future::Future()
+   : state_()  // The shared state of the asynchronous operation
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the Future class.
+//
+// \param state The shared state of the asynchronous operation.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline ThreadBackend<TT,MT,LT,CT,AT>::Future::Future( const boost::shared_ptr<AsyncState>& state )
+   : state_( state )  // The shared state of the asynchronous operation
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the asynchronous operation has been completed.
+//
+// \return \a true in case the operation has been completed, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline bool ThreadBackend<TT,MT,LT,CT,AT>::Future::ready() const
+{
+   if( !state_ )
+      return true;
+
+   LT lock( state_->mutex_ );
+   return state_->done_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waiting for the completion of the asynchronous operation.
+//
+// \return void
+//
+// This function blocks until the asynchronous operation has been completed. In case the
+// operation has been terminated by an exception, the exception is rethrown.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline void ThreadBackend<TT,MT,LT,CT,AT>::Future::wait() const
+{
+   if( !state_ )
+      return;
+
+   {
+      LT lock( state_->mutex_ );
+      while( !state_->done_ ) {
+         state_->completed_.wait( lock );
+      }
+   }
+
+   if( state_->error_ )
+      boost::rethrow_exception( state_->error_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -523,8 +1035,9 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, cons
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
-        , typename CT >  // Type of the condition variable
-inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline size_t ThreadBackend<TT,MT,LT,CT,AT>::initPool()
 {
    const char* env = std::getenv( "BLAZE_NUM_THREADS" );
 
@@ -539,6 +1052,48 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial list of CPUs the threads are pinned to.
+//
+// \return The initial list of CPUs.
+//
+// This function determines the initial list of CPUs based on the \c BLAZE_THREAD_AFFINITY
+// environment variable, which contains a comma-separated list of CPU numbers and CPU ranges
+// (e.g. "0-7,16-23", see parseCpuList()). In case the environment variable is not defined or
+// does not contain a valid list of CPUs, the function returns an empty list, i.e. the threads
+// are not pinned.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT,AT>::initAffinity()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+
+   if( env == NULL )
+      return std::vector<size_t>();
+
+   try {
+      return parseCpuList( env );
+   }
+   catch( std::invalid_argument& ) {
+      return std::vector<size_t>();
+   }
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -561,12 +1116,14 @@ typedef ThreadBackend< std::thread
                      , std::mutex
                      , std::unique_lock< std::mutex >
                      , std::condition_variable
+                     , std::atomic<size_t>
                      >  TheThreadBackend;
 #elif BLAZE_BOOST_THREADS_PARALLEL_MODE
 typedef ThreadBackend< boost::thread
                      , boost::mutex
                      , boost::unique_lock< boost::mutex >
                      , boost::condition_variable
+                     , boost::atomic<size_t>
                      >  TheThreadBackend;
 #endif
 /*! \endcond */
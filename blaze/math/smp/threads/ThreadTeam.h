@@ -0,0 +1,704 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ThreadTeam.h
+//  \brief Header file for the fork-join thread team of the C++11 and Boost thread backend
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_THREADTEAM_H_
+#define _BLAZE_MATH_SMP_THREADS_THREADTEAM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <boost/bind.hpp>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Affinity.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/PtrVector.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fork-join thread team of the C++11 and Boost thread backend.
+// \ingroup smp
+//
+// The ThreadTeam class template represents a team of persistent threads that execute batches of
+// tasks in a fork-join manner. In contrast to the ThreadPool, which is designed for independent
+// tasks of arbitrary granularity, the thread team is designed for the short-lived, regular tasks
+// of the shared memory parallelization and keeps the synchronization overhead per operation in
+// the range of microseconds:
+//
+//  - The tasks of an operation are collected by schedule() and dispatched as a single batch by
+//    wait(). The batch is published via a single dispatch slot, which is guarded by an atomic
+//    sequence number. The calling thread participates in the execution of the batch, i.e. a team
+//    of size \a n consists of the calling thread and \a n-1 worker threads.
+//  - All team members claim tasks from the batch by an atomic counter. Therefore faster threads
+//    automatically execute more tasks. Only in NUMA mode (see the \c BLAZE_USE_NUMA command
+//    line argument) the tasks are assigned statically, i.e. the \a i-th member of a team of
+//    size \a n executes the tasks \a i, \a i+n, \a i+2n, and so on.
+//  - The completion of a batch is detected by a barrier, at which all worker threads arrive.
+//  - Idle worker threads poll the dispatch slot and the calling thread polls the barrier for
+//    \a SMP_SPIN_COUNT iterations (see the <em>./blaze/config/SMP.h</em> configuration file)
+//    before blocking on a condition variable. Thus operations issued in quick succession don't
+//    involve the operating system at all.
+//  - Optionally, the members of the team are pinned to a given list of CPUs (see setAffinity()).
+//
+// The ThreadTeam class template is parametrized by the type of the encapsulated thread (\a TT),
+// the types of the mutex and the mutex lock (\a MT and \a LT), the type of the condition
+// variable (\a CT), and the type of an atomic counter of type \a size_t (\a AT). The schedule()
+// and wait() functions can be called from several threads concurrently. However, the batches
+// are executed one after another.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+class ThreadTeam : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef PtrVector<TT>       Threads;    //!< Type of the thread container.
+   typedef threadpool::Task    Task;       //!< Type of a single task.
+   typedef std::vector<Task>   Batch;      //!< Type of a batch of tasks.
+   typedef MT                  Mutex;      //!< Type of the mutex.
+   typedef LT                  Lock;       //!< Type of a locking object.
+   typedef CT                  Condition;  //!< Condition variable type.
+   typedef AT                  Counter;    //!< Type of the atomic counters.
+   typedef std::vector<size_t> CPUs;       //!< Type of a list of CPUs.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit ThreadTeam( size_t n, const CPUs& cpus = CPUs() );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~ThreadTeam();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename Callable >
+   void schedule( Callable func );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void resize     ( size_t n );
+   void setAffinity( const CPUs& cpus );
+   void wait       ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void spawn    ( size_t n );
+   void work     ( size_t epoch, size_t member );
+   void publish  ();
+   void execute  ( size_t member );
+   void arrive   ();
+   void join     ();
+   void terminate();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Batch scheduled_;       //!< The tasks scheduled for the next batch.
+   Batch batch_;           //!< The batch of tasks currently being executed.
+   size_t tasks_;          //!< The number of tasks of the current batch.
+   bool terminate_;        //!< Termination flag for the worker threads.
+   Counter epoch_;         //!< Sequence number of the dispatch slot.
+   Counter next_;          //!< Index of the next task of the current batch to be claimed.
+   Counter arrived_;       //!< Number of worker threads that arrived at the barrier.
+   Counter sleeping_;      //!< Number of worker threads blocked on the dispatch slot.
+   Counter joining_;       //!< Indicates whether the calling thread is blocked on the barrier.
+   Threads threads_;       //!< The worker threads of the thread team.
+   CPUs cpus_;             //!< The CPUs the members of the thread team are pinned to.
+   Mutex scheduleMutex_;   //!< Synchronization mutex for the scheduling of tasks.
+   Mutex dispatchMutex_;   //!< Synchronization mutex for the execution of batches.
+   Mutex mutex_;           //!< Synchronization mutex for the condition variables.
+   Condition dispatched_;  //!< Wait condition for idle worker threads.
+   Condition completed_;   //!< Wait condition for the calling thread.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the ThreadTeam class.
+//
+// \param n Initial size of the thread team \f$[1..\infty)\f$.
+// \param cpus The CPUs the members of the thread team are pinned to (optional).
+//
+// This constructor creates a thread team of size \a n, i.e. \a n-1 worker threads are created.
+// In case a non-empty list of CPUs is given, the members of the thread team are pinned to the
+// given CPUs (see setAffinity()).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+ThreadTeam<TT,MT,LT,CT,AT>::ThreadTeam( size_t n, const CPUs& cpus )
+   : scheduled_    ()         // The tasks scheduled for the next batch
+   , batch_        ()         // The batch of tasks currently being executed
+   , tasks_        ( 0UL   )  // The number of tasks of the current batch
+   , terminate_    ( false )  // Termination flag for the worker threads
+   , epoch_        ( 0UL   )  // Sequence number of the dispatch slot
+   , next_         ( 0UL   )  // Index of the next task of the current batch to be claimed
+   , arrived_      ( 0UL   )  // Number of worker threads that arrived at the barrier
+   , sleeping_     ( 0UL   )  // Number of worker threads blocked on the dispatch slot
+   , joining_      ( 0UL   )  // Indicates whether the calling thread is blocked on the barrier
+   , threads_      ()         // The worker threads of the thread team
+   , cpus_         ( cpus  )  // The CPUs the members of the thread team are pinned to
+   , scheduleMutex_()         // Synchronization mutex for the scheduling of tasks
+   , dispatchMutex_()         // Synchronization mutex for the execution of batches
+   , mutex_        ()         // Synchronization mutex for the condition variables
+   , dispatched_   ()         // Wait condition for idle worker threads
+   , completed_    ()         // Wait condition for the calling thread
+{
+   if( !cpus_.empty() )
+      pinThread( cpus_[0] );
+
+   resize( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Destructor for the ThreadTeam class.
+//
+// The destructor waits for the completion of the currently executed batch and terminates all
+// worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+ThreadTeam<TT,MT,LT,CT,AT>::~ThreadTeam()
+{
+   Lock lock( dispatchMutex_ );
+   terminate();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the thread team.
+//
+// \return The number of worker threads plus one for the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+inline size_t ThreadTeam<TT,MT,LT,CT,AT>::size() const
+{
+   return threads_.size() + 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for the next batch.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function adds the given function/functor to the next batch of tasks. The batch is
+// executed by the next call to the wait() function. The given function/functor must be
+// copyable, must be callable without arguments and must not return a value.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT          // Type of the condition variable
+        , typename AT >        // Type of the atomic counter
+template< typename Callable >  // Type of the function/functor
+void ThreadTeam<TT,MT,LT,CT,AT>::schedule( Callable func )
+{
+   Lock lock( scheduleMutex_ );
+   scheduled_.push_back( Task( func ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changes the size of the thread team.
+//
+// \param n The new size of the thread team \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function waits for the completion of the currently executed batch, terminates all
+// worker threads and creates \a n-1 new worker threads. Note that for Visual Studio compilers
+// it is possible to specify a size of 0 (see the shutDownThreads() function), in which case
+// all worker threads are terminated and the calling thread executes all tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+void ThreadTeam<TT,MT,LT,CT,AT>::resize( size_t n )
+{
+#if !(defined _MSC_VER)
+   if( n == 0UL )
+      throw std::invalid_argument( "Invalid number of threads" );
+#endif
+
+   Lock lock( dispatchMutex_ );
+
+   if( n == size() || ( n == 0UL && threads_.isEmpty() ) )
+      return;
+
+   terminate();
+   spawn( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the members of the thread team to the given CPUs.
+//
+// \param cpus The non-empty list of CPUs.
+// \return void
+//
+// This function pins the calling thread to the first given CPU and the \a i-th worker thread
+// to the CPU \f$ i \bmod k \f$ of the given list of \a k CPUs. For that purpose it waits for
+// the completion of the currently executed batch and recreates all worker threads. Note that
+// the calling thread of this function is expected to be the thread that issues the parallel
+// operations, since this thread participates in the execution of all batches.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+void ThreadTeam<TT,MT,LT,CT,AT>::setAffinity( const CPUs& cpus )
+{
+   BLAZE_INTERNAL_ASSERT( !cpus.empty(), "Invalid list of CPUs" );
+
+   Lock lock( dispatchMutex_ );
+
+   const size_t n( size() );
+
+   terminate();
+
+   cpus_ = cpus;
+   pinThread( cpus_[0] );
+
+   spawn( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executing all scheduled tasks.
+//
+// \return void
+//
+// This function dispatches all scheduled tasks to the thread team, participates in their
+// execution, and blocks until all tasks have been completed. In case another thread is
+// executing a batch at the same time, the function blocks until the execution of that batch
+// has been completed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+void ThreadTeam<TT,MT,LT,CT,AT>::wait()
+{
+   Lock dispatchLock( dispatchMutex_ );
+
+   {
+      Lock scheduleLock( scheduleMutex_ );
+      batch_.swap( scheduled_ );
+   }
+
+   if( batch_.empty() )
+      return;
+
+   tasks_ = batch_.size();
+
+   if( threads_.isEmpty() ) {
+      for( size_t i=0UL; i<tasks_; ++i )
+         batch_[i]();
+   }
+   else {
+      publish();
+      execute( 0UL );
+      join();
+   }
+
+   batch_.clear();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating the worker threads of a thread team of the given size.
+//
+// \param n The size of the thread team.
+// \return void
+//
+// This function must only be called by the thread holding the dispatch mutex and while the
+// thread team has no worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+void ThreadTeam<TT,MT,LT,CT,AT>::spawn( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( threads_.isEmpty(), "Invalid worker threads detected" );
+
+   terminate_ = false;
+
+   for( size_t i=1UL; i<n; ++i ) {
+      threads_.pushBack( new TT( boost::bind( &ThreadTeam::work, this, epoch_.load(), i ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Execution loop of a worker thread.
+//
+// \param epoch The sequence number of the dispatch slot at the creation of the worker thread.
+// \param member The index of the worker thread within the thread team \f$[1..size())\f$.
+// \return void
+//
+// Each worker thread polls the dispatch slot for a new batch for \a SMP_SPIN_COUNT iterations
+// and blocks afterwards. As soon as a new batch has been published, the worker thread claims
+// and executes tasks until the batch is exhausted and finally arrives at the barrier. Since the
+// serial section is tracked per thread, the worker thread permanently enters a serial section
+// in order to execute all operations issued by tasks serially instead of in parallel.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+void ThreadTeam<TT,MT,LT,CT,AT>::work( size_t epoch, size_t member )
+{
+   if( !cpus_.empty() )
+      pinThread( cpus_[member % cpus_.size()] );
+
+   SerialSection<int> section( true );
+
+   for( ;; )
+   {
+      for( size_t i=0UL; i<SMP_SPIN_COUNT && epoch_.load() == epoch; ++i ) {}
+
+      if( epoch_.load() == epoch ) {
+         Lock lock( mutex_ );
+         ++sleeping_;
+         while( epoch_.load() == epoch ) {
+            dispatched_.wait( lock );
+         }
+         --sleeping_;
+      }
+
+      epoch = epoch_.load();
+
+      if( terminate_ )
+         return;
+
+      execute( member );
+      arrive();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Publishing the current batch in the dispatch slot.
+//
+// \return void
+//
+// This function must only be called by the thread holding the dispatch mutex and while no
+// worker thread is working on a batch.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+void ThreadTeam<TT,MT,LT,CT,AT>::publish()
+{
+   next_.store( 0UL );
+   arrived_.store( 0UL );
+   ++epoch_;
+
+   if( sleeping_.load() > 0UL ) {
+      Lock lock( mutex_ );
+      dispatched_.notify_all();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Claiming and executing tasks of the current batch until the batch is exhausted.
+//
+// \param member The index of the executing thread within the thread team \f$[0..size())\f$.
+// \return void
+//
+// In NUMA mode the tasks are not claimed dynamically, but the given member of the thread team
+// executes every size()-th task, starting with the task \a member.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+void ThreadTeam<TT,MT,LT,CT,AT>::execute( size_t member )
+{
+#if BLAZE_NUMA_MODE
+   const size_t members( size() );
+
+   for( size_t i=member; i<tasks_; i+=members ) {
+      batch_[i]();
+   }
+#else
+   UNUSED_PARAMETER( member );
+
+   for( size_t i=next_++; i<tasks_; i=next_++ ) {
+      batch_[i]();
+   }
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Arrival of a worker thread at the barrier.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+void ThreadTeam<TT,MT,LT,CT,AT>::arrive()
+{
+   if( ++arrived_ == threads_.size() && joining_.load() > 0UL ) {
+      Lock lock( mutex_ );
+      completed_.notify_one();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waiting for all worker threads at the barrier.
+//
+// \return void
+//
+// The calling thread polls the barrier for \a SMP_SPIN_COUNT iterations and blocks afterwards
+// until all worker threads have arrived.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+void ThreadTeam<TT,MT,LT,CT,AT>::join()
+{
+   const size_t workers( threads_.size() );
+
+   for( size_t i=0UL; i<SMP_SPIN_COUNT && arrived_.load() != workers; ++i ) {}
+
+   if( arrived_.load() != workers ) {
+      Lock lock( mutex_ );
+      joining_.store( 1UL );
+      while( arrived_.load() != workers ) {
+         completed_.wait( lock );
+      }
+      joining_.store( 0UL );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Terminating and destroying all worker threads.
+//
+// \return void
+//
+// This function must only be called by the thread holding the dispatch mutex.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT    // Type of the condition variable
+        , typename AT >  // Type of the atomic counter
+void ThreadTeam<TT,MT,LT,CT,AT>::terminate()
+{
+   if( threads_.isEmpty() )
+      return;
+
+   terminate_ = true;
+   publish();
+
+   for( size_t i=0UL; i<threads_.size(); ++i ) {
+      threads_[i]->join();
+   }
+
+   threads_.clear();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
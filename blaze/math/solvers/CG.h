@@ -40,10 +40,20 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <stdexcept>
+#include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
 #include <blaze/math/problems/LSE.h>
+#include <blaze/math/solvers/ICPreconditioner.h>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
 #include <blaze/math/solvers/Solver.h>
+#include <blaze/math/solvers/SSORPreconditioner.h>
+#include <blaze/util/ColorMacros.h>
+#include <blaze/util/logging/DebugSection.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -60,6 +70,24 @@ namespace blaze {
 //
 // TODO: description
 // TODO: Problem formulation: \f$ A \cdot x + b = 0 \f$ !!
+//
+// In addition to the plain conjugate gradient method, the solver provides a preconditioned
+// conjugate gradient method for ill-conditioned systems. The preconditioner is passed as
+// additional argument to the \a solve() functions and has to be set up for the system matrix
+// beforehand. The Blaze library provides the JacobiPreconditioner, the SSORPreconditioner and
+// the ICPreconditioner. Any other preconditioner has to provide the same interface, i.e. a
+// \a size() function returning the size of the system matrix it is set up for and an \a apply()
+// function computing the preconditioned residual \f$ z = M^{-1} r \f$:
+
+   \code
+   blaze::CMatMxN A;
+   blaze::VecN b, x;
+   // ... Initialization of the system matrix and the right-hand side vector
+
+   blaze::ICPreconditioner pc( A );
+   blaze::CG solver;
+   solver.solve( A, b, x, pc );
+   \endcode
 */
 class CG : public Solver
 {
@@ -76,16 +104,39 @@ public:
    //@{
    bool solve( LSE& lse );
    bool solve( const CMatMxN& A, const VecN& b, VecN& x );
+
+   template< typename PC > inline bool solve( LSE& lse, const PC& pc );
+   template< typename PC >        bool solve( const CMatMxN& A, const VecN& b, VecN& x, const PC& pc );
    //@}
    //**********************************************************************************************
 
 private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   real multiply( const CMatMxN& A );
+   real update  ( real alpha, VecN& x, bool dot );
+
+   static real multiply( const CMatMxN& A, const VecN& d, VecN& h, size_t begin, size_t end );
+   static real update  ( real alpha, const VecN& d, const VecN& h, VecN& x, VecN& r,
+                         size_t begin, size_t end, bool dot, real& norm );
+   //@}
+   //**********************************************************************************************
+
+   //**Private class KernelTask********************************************************************
+   struct KernelTask;
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
    VecN r_;  //!< TODO
    VecN d_;  //!< TODO
    VecN h_;  //!< TODO
+   VecN z_;  //!< The preconditioned residual of the preconditioned conjugate gradient method.
+   std::vector<real> partials_;  //!< The partial results of the parallel CG kernels.
+                                 /*!< The vector contains the partial dot product and the partial
+                                      maximum norm of each part of the vectors. */
    //@}
    //**********************************************************************************************
 };
@@ -114,6 +165,150 @@ inline bool CG::solve( LSE& lse ) {
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations by means of the preconditioned CG method.
+//
+// \param lse The linear system of equations to solve.
+// \param pc The preconditioner for the system matrix.
+// \return Returns \a true if the solution is sufficiently accurate, otherwise it returns \a false.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument System matrix is not symmetric.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+// \exception std::invalid_argument Invalid preconditioner size.
+*/
+template< typename PC >  // Type of the preconditioner
+inline bool CG::solve( LSE& lse, const PC& pc ) {
+   return solve( lse.A_, lse.b_, lse.x_, pc );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations by means of the preconditioned CG method.
+//
+// \param A The symmetric positive definite system matrix.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns.
+// \param pc The preconditioner for the system matrix.
+// \return Returns \a true if the solution is sufficiently accurate, otherwise it returns \a false.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument System matrix is not symmetric.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+// \exception std::invalid_argument Invalid preconditioner size.
+//
+// This function solves the linear system \f$ A \cdot x + b = 0 \f$ by means of the conjugate
+// gradient method applied to the preconditioned system, where the given preconditioner \a pc
+// approximates the system matrix. In each iteration the preconditioner is applied once to the
+// residual. As for the plain CG method, the precision of the solution is the maximum norm of
+// the (unpreconditioned) residual. Except for the application of the preconditioner, each
+// iteration uses the same fused kernels as the plain CG method (see multiply() and update()).
+// Since the preconditioned method requires the dot product of the residual and the
+// preconditioned residual, which is only available after the application of the preconditioner,
+// the update kernel skips the dot product of the residual with itself.
+*/
+template< typename PC >  // Type of the preconditioner
+bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x, const PC& pc )
+{
+   const size_t n( b.size() );
+   bool converged( false );
+   real alpha, beta, delta;
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "System matrix is not square" );
+
+   if( !isSymmetric( A ) )
+      throw std::invalid_argument( "System matrix is not symmetric" );
+
+   if( A.rows() != b.size() )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   if( pc.size() != n )
+      throw std::invalid_argument( "Invalid preconditioner size" );
+
+   // Allocating helper data
+   r_.resize( n, false );
+   d_.resize( n, false );
+   h_.resize( n, false );
+   z_.resize( n, false );
+
+   // Preparing the vector of unknowns
+   x.resize( n, false );
+   x.reset();
+
+   // Computing the initial residual
+   r_ = A * x + b;
+
+   // Initial convergence test
+   lastPrecision_ = 0;
+   for( size_t i=0; i<n; ++i ) {
+      lastPrecision_ = max( lastPrecision_, std::fabs( r_[i] ) );
+   }
+
+   if( lastPrecision_ < threshold_ )
+      converged = true;
+
+   pc.apply( r_, z_ );
+
+   delta = trans(r_) * z_;
+
+   d_ = -z_;
+
+   // Performing the preconditioned CG iterations
+   size_t it( 0 );
+
+   for( ; !converged && it<maxIterations_; ++it )
+   {
+      alpha = delta / multiply( A );
+
+      update( alpha, x, false );
+
+      if( lastPrecision_ < threshold_ ) {
+         converged = true;
+         break;
+      }
+
+      pc.apply( r_, z_ );
+
+      beta = trans(r_) * z_;
+
+      d_ = ( beta / delta ) * d_ - z_;
+
+      delta = beta;
+   }
+
+   BLAZE_LOG_DEBUG_SECTION( log ) {
+      if( converged )
+         log << "      Solved the linear system in " << it << " preconditioned CG iterations.";
+      else
+         log << BLAZE_YELLOW << "      WARNING: Did not solve the linear system within accuracy. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
+   }
+
+   lastIterations_ = it;
+
+   return converged;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPLICIT TEMPLATE INSTANTIATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !defined(_MSC_VER)
+extern template bool CG::solve<JacobiPreconditioner>( const CMatMxN&, const VecN&, VecN&, const JacobiPreconditioner& );
+extern template bool CG::solve<SSORPreconditioner>( const CMatMxN&, const VecN&, VecN&, const SSORPreconditioner& );
+extern template bool CG::solve<ICPreconditioner>( const CMatMxN&, const VecN&, VecN&, const ICPreconditioner& );
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
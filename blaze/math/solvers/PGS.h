@@ -40,18 +40,31 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/problems/BoxLCP.h>
 #include <blaze/math/problems/ContactLCP.h>
 #include <blaze/math/problems/LCP.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/solvers/Solver.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/logging/DebugSection.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
 
 
 namespace blaze {
@@ -69,6 +82,14 @@ namespace blaze {
 // TODO: description of the PGS solver
 // TODO: capabilities of the PGS solver (which LCP problems, etc)
 // TODO: known issues of the PGS solver
+//
+// In case shared memory parallelization is enabled, contact LCPs with at least
+// SMP_PGS_THRESHOLD contacts are solved in parallel: The contacts are colored such that no two
+// contacts of the same color are coupled by the system matrix. The contacts of a single color
+// are independent of each other and are updated concurrently, whereas the colors are processed
+// one after another. Therefore the result does not depend on the number of threads, but due to
+// the different order of the contacts it may slightly differ from the result of the serial
+// solver.
 */
 class PGS : public Solver
 {
@@ -91,16 +112,62 @@ class PGS : public Solver
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+   template< typename CP > inline void setup( const CP& cp );
    template< typename CP > inline real sweep( CP& cp ) const;
+
+   inline bool useParallelSweep( size_t contacts ) const;
+   inline void color           ( const ContactLCP& cp );
+   inline real parallelSweep   ( ContactLCP& cp ) const;
+   inline real update          ( ContactLCP& cp, size_t index ) const;
    //@}
    //**********************************************************************************************
 
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   //**Private class ContactTask*******************************************************************
+   /*!\brief Auxiliary functor for the threaded update of a range of contacts of a single color.
+   */
+   struct ContactTask
+   {
+      explicit inline ContactTask( const PGS& pgs, ContactLCP& cp,
+                                   const size_t* begin, const size_t* end, real& rmax )
+         : pgs_  ( &pgs  )  // The solver
+         , cp_   ( &cp   )  // The contact LCP to solve
+         , begin_( begin )  // Pointer to the first contact of the range
+         , end_  ( end   )  // Pointer one past the last contact of the range
+         , rmax_ ( &rmax )  // The maximum change of an unknown
+      {}
+
+      inline void operator()() {
+         for( const size_t* contact=begin_; contact!=end_; ++contact )
+            *rmax_ = max( *rmax_, pgs_->update( *cp_, *contact ) );
+      }
+
+      const PGS*    pgs_;    //!< The solver.
+      ContactLCP*   cp_;     //!< The contact LCP to solve.
+      const size_t* begin_;  //!< Pointer to the first contact of the range.
+      const size_t* end_;    //!< Pointer one past the last contact of the range.
+      real*         rmax_;   //!< The maximum change of an unknown.
+   };
+   //**********************************************************************************************
+#endif
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
    VecN diagonal_;  //!< Vector for the diagonal entries of the LCP matrix.
                     /*!< For performance reasons, the vector contains the inverse of the
                          diagonal elements. */
+   VecN blocks_;    //!< Vector for the diagonal entries or the 3x3 diagonal blocks of the LCP matrix.
+                    /*!< In case of contact LCPs each block is stored as 9 consecutive elements
+                         in row-major order. The vector is used to detect unmodified diagonal
+                         entries and blocks in subsequent solution processes. */
+   VecN inverses_;  //!< Vector for the inverse 3x3 diagonal blocks of contact LCP matrices.
+                    /*!< Each block is stored as 9 consecutive elements in row-major order. */
+   std::vector<size_t> colors_;    //!< The offsets of the colors within the contact list.
+                                   /*!< The vector is empty in case the contacts are updated
+                                        serially. */
+   std::vector<size_t> contacts_;  //!< The list of contacts sorted by color.
    //@}
    //**********************************************************************************************
 };
@@ -127,18 +194,10 @@ template< typename CP >  // Type of the complementarity problem
 bool PGS::solve( CP& cp )
 {
    const size_t n( cp.size() );
-   const CMatMxN& A( cp.A_ );
    bool converged( false );
 
-   // Allocating the helper data
-   diagonal_.resize( n, false );
-
-   // Locating the diagonal entries in system matrix and precomputing the inverse values
-   for( size_t i=0; i<n; ++i ) {
-      const real tmp( A(i,i) );
-      BLAZE_INTERNAL_ASSERT( tmp != real(0), "Invalid diagonal element in the LCP matrix" );
-      diagonal_[i] = real(1) / tmp;
-   }
+   // Precomputing the inverse diagonal of the system matrix
+   setup( cp );
 
    // Projecting the initial solution to a feasible region
    for( size_t i=0; i<n; ++i ) {
@@ -173,6 +232,126 @@ bool PGS::solve( CP& cp )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Precomputes the inverse diagonal of the system matrix of the given problem.
+//
+// \param cp The complementarity problem to solve.
+// \return void
+//
+// This function locates the diagonal entries in the system matrix and stores their inverse
+// values in the \a diagonal_ vector. The diagonal entries themselves are stored in the \a blocks_
+// vector. In case the solver is reused for a problem of the same size (as for instance in case
+// of a warm start), only the inverse values of modified diagonal entries are recomputed.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline void PGS::setup( const CP& cp )
+{
+   const size_t n( cp.size() );
+   const CMatMxN& A( cp.A_ );
+
+   const bool cached( diagonal_.size() == n && blocks_.size() == n );
+
+   if( !cached ) {
+      diagonal_.resize( n, false );
+      blocks_.resize( n, false );
+   }
+
+   for( size_t i=0; i<n; ++i )
+   {
+      const real tmp( A(i,i) );
+
+      if( cached && blocks_[i] == tmp )
+         continue;
+
+      BLAZE_INTERNAL_ASSERT( tmp != real(0), "Invalid diagonal element in the LCP matrix" );
+      blocks_[i]   = tmp;
+      diagonal_[i] = real(1) / tmp;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Precomputes the 3x3 diagonal blocks of the system matrix of a contact LCP.
+//
+// \param cp The contact LCP to solve.
+// \return void
+//
+// This function extracts the 3x3 diagonal block of each contact (i.e. the coupling between the
+// normal and the two tangential unknowns of the contact) and stores it in the \a blocks_ vector.
+// Additionally, it stores the inverse of each block, which is computed by means of its
+// adjugate, in the \a inverses_ vector and the inverse diagonal elements in the \a diagonal_
+// vector. In case the solver is reused for a contact LCP with the same number of contacts (as
+// for instance in case of a warm start), only the inverses of modified blocks are recomputed.
+// In case the contacts are updated in parallel, the contacts are finally colored (see color()).
+*/
+template<>
+inline void PGS::setup( const ContactLCP& cp )
+{
+   const size_t n( cp.size() );
+   const size_t N( n / 3 );
+   const CMatMxN& A( cp.A_ );
+
+   const bool cached( diagonal_.size() == n && blocks_.size() == 9*N && inverses_.size() == 9*N );
+
+   if( !cached ) {
+      diagonal_.resize( n, false );
+      blocks_.resize( 9*N, false );
+      inverses_.resize( 9*N, false );
+   }
+
+   for( size_t i=0; i<N; ++i )
+   {
+      const size_t j( i * 3 );
+
+      real* const blk( &blocks_[9*i] );
+      real* const inv( &inverses_[9*i] );
+      real tmp[9];
+
+      for( size_t k=0; k<3; ++k ) {
+         for( size_t l=0; l<3; ++l ) {
+            tmp[3*k+l] = A(j+k,j+l);
+         }
+      }
+
+      if( cached && std::equal( tmp, tmp+9, blk ) )
+         continue;
+
+      std::copy( tmp, tmp+9, blk );
+
+      for( size_t k=0; k<3; ++k ) {
+         BLAZE_INTERNAL_ASSERT( blk[4*k] != real(0), "Invalid diagonal element in the LCP matrix" );
+         diagonal_[j+k] = real(1) / blk[4*k];
+      }
+
+      inv[0] = blk[4]*blk[8] - blk[5]*blk[7];
+      inv[1] = blk[2]*blk[7] - blk[1]*blk[8];
+      inv[2] = blk[1]*blk[5] - blk[2]*blk[4];
+      inv[3] = blk[5]*blk[6] - blk[3]*blk[8];
+      inv[4] = blk[0]*blk[8] - blk[2]*blk[6];
+      inv[5] = blk[2]*blk[3] - blk[0]*blk[5];
+      inv[6] = blk[3]*blk[7] - blk[4]*blk[6];
+      inv[7] = blk[1]*blk[6] - blk[0]*blk[7];
+      inv[8] = blk[0]*blk[4] - blk[1]*blk[3];
+
+      const real det( blk[0]*inv[0] + blk[1]*inv[3] + blk[2]*inv[6] );
+      BLAZE_INTERNAL_ASSERT( det != real(0), "Invalid diagonal block in the LCP matrix" );
+
+      const real idet( real(1) / det );
+      for( size_t k=0; k<9; ++k )
+         inv[k] *= idet;
+   }
+
+   // Coloring the contacts for the parallel sweep
+   colors_.clear();
+   contacts_.clear();
+
+   if( useParallelSweep( N ) )
+      color( cp );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief TODO
 //
@@ -208,46 +387,294 @@ inline real PGS::sweep( CP& cp ) const
 
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Performs a block Gauss-Seidel sweep over all contacts of a contact LCP.
 //
-// \param cp The complementarity problem to solve.
-// \return TODO
+// \param cp The contact LCP to solve.
+// \return The maximum change of an unknown during the sweep.
 //
-// TODO: specialization for contact LCPs
-// TODO: more infos
+// In contrast to the scalar sweep, this specialization for contact LCPs treats the normal and
+// the two tangential unknowns of a contact as a single 3x3 block (see update()). The contacts
+// are either updated in order or, in case the contacts have been colored, color by color in
+// parallel (see parallelSweep()).
 */
 template<>
 inline real PGS::sweep( ContactLCP& cp ) const
 {
+   if( !colors_.empty() )
+      return parallelSweep( cp );
+
+   const size_t N( cp.size() / 3 );
+   real rmax( 0 );
+
+   for( size_t i=0; i<N; ++i ) {
+      rmax = max( rmax, update( cp, i ) );
+   }
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the contacts of a contact LCP are updated in parallel.
+//
+// \param contacts The number of contacts.
+// \return \a true in case the contacts are updated in parallel, \a false if not.
+*/
+inline bool PGS::useParallelSweep( size_t contacts ) const
+{
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   return !isParallelSectionActive() && !isSerialSectionActive() && contacts >= SMP_PGS_THRESHOLD;
+#else
+   UNUSED_PARAMETER( contacts );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Colors the contacts of a contact LCP for the parallel sweep.
+//
+// \param cp The contact LCP to solve.
+// \return void
+//
+// This function assigns a color to each contact by means of a greedy graph coloring such that
+// no two contacts that are coupled by the system matrix share the same color. Two contacts are
+// coupled in case the block row of one contact contains a non-zero element in a column of the
+// other contact. Since the sparsity pattern of the system matrix is not required to be symmetric,
+// the coupling is considered in both directions. The contacts are sorted by their color into the
+// \a contacts_ list, the offsets of the colors are stored in the \a colors_ vector.
+*/
+inline void PGS::color( const ContactLCP& cp )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
    const size_t N( cp.size() / 3 );
-   real rmax( 0 ), residual, flimit, aux;
-   size_t j;
+   const CMatMxN& A( cp.A_ );
+
+   // Collecting for each contact the preceding contacts whose block rows refer to it
+   std::vector<size_t> offsets( N+1, 0 );
+
+   for( size_t i=0; i<N; ++i ) {
+      for( size_t k=3*i; k<3*i+3; ++k ) {
+         const ConstIterator end( A.end( k ) );
+         for( ConstIterator element=A.begin( k ); element!=end; ++element ) {
+            const size_t neighbor( element->index() / 3 );
+            if( neighbor > i ) ++offsets[neighbor+1];
+         }
+      }
+   }
+
+   for( size_t i=0; i<N; ++i )
+      offsets[i+1] += offsets[i];
+
+   std::vector<size_t> predecessors( offsets[N] );
+   std::vector<size_t> pos( offsets.begin(), offsets.end()-1 );
+
+   for( size_t i=0; i<N; ++i ) {
+      for( size_t k=3*i; k<3*i+3; ++k ) {
+         const ConstIterator end( A.end( k ) );
+         for( ConstIterator element=A.begin( k ); element!=end; ++element ) {
+            const size_t neighbor( element->index() / 3 );
+            if( neighbor > i ) predecessors[pos[neighbor]++] = i;
+         }
+      }
+   }
+
+   std::vector<size_t> colorOf( N, 0 );
+   std::vector<size_t> marks;
+
+   for( size_t i=0; i<N; ++i )
+   {
+      // Marking the colors of all previously colored neighbors
+      for( size_t k=3*i; k<3*i+3; ++k ) {
+         const ConstIterator end( A.end( k ) );
+         for( ConstIterator element=A.begin( k ); element!=end; ++element ) {
+            const size_t neighbor( element->index() / 3 );
+            if( neighbor < i ) marks[colorOf[neighbor]] = i+1;
+         }
+      }
+
+      for( size_t p=offsets[i]; p<offsets[i+1]; ++p ) {
+         marks[colorOf[predecessors[p]]] = i+1;
+      }
+
+      // Selecting the smallest color that is not used by any neighbor
+      size_t c( 0 );
+      while( c < marks.size() && marks[c] == i+1 ) ++c;
+      if( c == marks.size() ) marks.push_back( 0 );
+
+      colorOf[i] = c;
+   }
+
+   // Sorting the contacts by color
+   colors_.assign( marks.size()+1, 0 );
+   contacts_.resize( N );
+
+   for( size_t i=0; i<N; ++i )
+      ++colors_[colorOf[i]+1];
+
+   for( size_t c=0; c<marks.size(); ++c ) {
+      colors_[c+1] += colors_[c];
+      marks[c] = colors_[c];
+   }
+
+   for( size_t i=0; i<N; ++i )
+      contacts_[marks[colorOf[i]]++] = i;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a parallel block Gauss-Seidel sweep over all colored contacts of a contact LCP.
+//
+// \param cp The contact LCP to solve.
+// \return The maximum change of an unknown during the sweep.
+//
+// This function processes the colors one after another and updates the contacts of each color
+// concurrently. Since contacts of the same color are not coupled, every contact sees the same
+// values of its neighbors as in a serial sweep in the order of the \a contacts_ list.
+*/
+inline real PGS::parallelSweep( ContactLCP& cp ) const
+{
+   BLAZE_INTERNAL_ASSERT( !colors_.empty(), "Uncolored contacts detected" );
+
+   const size_t colors( colors_.size() - 1 );
+   real rmax( 0 );
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( cp, rmax )
+      {
+         real local( 0 );
+
+         for( size_t c=0; c<colors; ++c )
+         {
+            const int begin( colors_[c] );
+            const int end  ( colors_[c+1] );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE)
+            for( int k=begin; k<end; ++k ) {
+               local = max( local, update( cp, contacts_[k] ) );
+            }
+         }
+
+#pragma omp critical
+         rmax = max( rmax, local );
+      }
+   }
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   const size_t tasks( TheThreadBackend::size()*SMP_TASKS_PER_THREAD );
+   std::vector<real> local( tasks, real(0) );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t c=0; c<colors; ++c )
+      {
+         const size_t* const first( &contacts_[0] + colors_[c] );
+         const size_t size ( colors_[c+1] - colors_[c] );
+         const size_t parts( min( tasks, size ) );
+
+         for( size_t part=0; part<parts; ++part ) {
+            TheThreadBackend::schedule( ContactTask( *this, cp, first + ( part*size )/parts,
+                                                     first + ( (part+1)*size )/parts, local[part] ) );
+         }
+
+         TheThreadBackend::wait();
+      }
+   }
+
+   for( size_t part=0; part<tasks; ++part ) {
+      rmax = max( rmax, local[part] );
+   }
+#else
+   for( size_t c=0; c<colors; ++c ) {
+      for( size_t k=colors_[c]; k<colors_[c+1]; ++k ) {
+         rmax = max( rmax, update( cp, contacts_[k] ) );
+      }
+   }
+#endif
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a block update of the unknowns of a single contact of a contact LCP.
+//
+// \param cp The contact LCP to solve.
+// \param index The index of the contact.
+// \return The maximum change of an unknown of the contact.
+//
+// The residuals of the normal and the two tangential unknowns of the contact are computed in a
+// single pass over the block row of the contact. The update is given by the product of the
+// inverse 3x3 diagonal block (see setup()) and the residuals and therefore takes the coupling
+// between the normal and tangential directions into account. In case the updated unknowns lie
+// within the friction box spanned by the coefficient of friction and the updated normal unknown
+// (i.e. the contact is sticking), they are the exact solution of the local problem of the
+// contact and are accepted. Otherwise (i.e. in case the contact separates or slides), the block
+// update is replaced by consecutive projected updates of the normal and tangential unknowns,
+// which reuse the residuals of the contact. Note that a projection of the block update would
+// not converge to the solution of the LCP, since the inverse block and the friction box are not
+// aligned.
+*/
+inline real PGS::update( ContactLCP& cp, size_t index ) const
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   real rmax( 0 ), residual[3], delta[3], flimit;
 
    const CMatMxN& A( cp.A_ );
    const VecN&  b( cp.b_ );
    VecN& x( cp.x_ );
 
-   for( size_t i=0; i<N; ++i )
+   const size_t i( index );
+   const size_t j( i * 3 );
+
+   // Computing the residuals of the normal and tangential unknowns of the contact
+   for( size_t k=0; k<3; ++k )
    {
-      j = i * 3;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( 0, x[j] + diagonal_[j] * residual );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
-
-      flimit = cp.cof_[i] * x[j];
-
-      ++j;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
-
-      ++j;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
+      real tmp( -b[j+k] );
+
+      const ConstIterator end( A.end( j+k ) );
+      for( ConstIterator element=A.begin( j+k ); element!=end; ++element )
+         tmp -= element->value() * x[element->index()];
+
+      residual[k] = tmp;
+   }
+
+   // Applying the inverse diagonal block
+   const real* const blk( &blocks_[9*i] );
+   const real* const inv( &inverses_[9*i] );
+
+   for( size_t k=0; k<3; ++k ) {
+      delta[k] = inv[3*k]*residual[0] + inv[3*k+1]*residual[1] + inv[3*k+2]*residual[2];
+   }
+
+   flimit = cp.cof_[i] * ( x[j] + delta[0] );
+
+   // Projected updates of the single unknowns in case of a separating or sliding contact
+   if( x[j] + delta[0] < real(0) ||
+       std::fabs( x[j+1] + delta[1] ) > flimit || std::fabs( x[j+2] + delta[2] ) > flimit )
+   {
+      delta[0] = max( 0, x[j] + diagonal_[j] * residual[0] ) - x[j];
+      residual[1] -= blk[3] * delta[0];
+      residual[2] -= blk[6] * delta[0];
+
+      flimit = cp.cof_[i] * ( x[j] + delta[0] );
+
+      delta[1] = max( -flimit, min( flimit, x[j+1] + diagonal_[j+1] * residual[1] ) ) - x[j+1];
+      residual[2] -= blk[7] * delta[1];
+
+      delta[2] = max( -flimit, min( flimit, x[j+2] + diagonal_[j+2] * residual[2] ) ) - x[j+2];
+   }
+
+   for( size_t k=0; k<3; ++k ) {
+      x[j+k] += delta[k];
+      rmax = max( rmax, std::fabs( delta[k] ) );
    }
 
    return rmax;
@@ -47,8 +47,11 @@ namespace blaze {
 class CG;
 class CPG;
 class GaussianElimination;
+class ICPreconditioner;
+class JacobiPreconditioner;
 class Lemke;
 class PGS;
+class SSORPreconditioner;
 
 } // namespace blaze
 
@@ -0,0 +1,362 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/WarmStart.h
+//  \brief Header file for the warm start cache of complementarity problems
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_WARMSTART_H_
+#define _BLAZE_MATH_SOLVERS_WARMSTART_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/problems/ContactLCP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Cache for the warm start of complementarity problems.
+// \ingroup solver
+//
+// The WarmStart class propagates the solution of a complementarity problem to the initial guess
+// of a subsequent, similar problem (as for instance the contact problems of two consecutive time
+// steps of a simulation). Since the unknowns of two problems generally don't correspond by index,
+// the solution is keyed by the identity of the single contacts: The \a store() function caches
+// the solution of a solved problem along with the given contact IDs, the \a load() function
+// initializes the unknowns of a new problem from the cached values of the contacts with matching
+// IDs. The unknowns of contacts that are not contained in the cache are reset to zero:
+
+   \code
+   blaze::ContactLCP cp;
+   std::vector<size_t> ids;
+   blaze::PGS solver;
+   blaze::WarmStart cache;
+
+   for( ... )  // Time stepping
+   {
+      // ... Setting up the contact problem and the contact IDs
+
+      cache.load( cp, ids );
+      solver.solve( cp );
+      cache.store( cp, ids );
+   }
+   \endcode
+
+// In case of a ContactLCP each ID refers to the three consecutive unknowns of a contact, in case
+// of any other complementarity problem each ID refers to a single unknown. Therefore a cache can
+// only be used for problems with the same number of unknowns per contact as the stored problem.
+// The statistics of the last call to \a load() are available via the \a getLastHits() and
+// \a getLastMisses() functions. The according savings can be assessed by comparing the number
+// of iterations spent by the solver (see Solver::getLastIterations()) to the number of iterations
+// of a cold start.
+*/
+class WarmStart
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline WarmStart();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size         () const;
+   inline size_t getLastHits  () const;
+   inline size_t getLastMisses() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                           inline void clear();
+   template< typename CP > inline void store( const CP& cp, const std::vector<size_t>& ids );
+   template< typename CP > inline void load ( CP& cp, const std::vector<size_t>& ids );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private class Entry*************************************************************************
+   /*!\brief A single cache entry, associating a contact ID with its cached unknowns.
+   */
+   struct Entry
+   {
+      inline bool operator< ( const Entry& rhs ) const { return id_ <  rhs.id_; }
+      inline bool operator==( const Entry& rhs ) const { return id_ == rhs.id_; }
+
+      size_t id_;      //!< The ID of the contact.
+      size_t offset_;  //!< The offset of the first unknown of the contact in the cached values.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename CP > static inline size_t unknowns( const CP& cp );
+                           static inline size_t unknowns( const ContactLCP& cp );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<Entry> entries_;  //!< The cache entries sorted by their contact IDs.
+   VecN values_;                 //!< The cached unknowns.
+   size_t unknowns_;             //!< The number of unknowns per contact of the cached problem.
+   size_t hits_;                 //!< The number of contacts initialized from the cache during the last load.
+   size_t misses_;               //!< The number of contacts not contained in the cache during the last load.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the WarmStart class.
+*/
+inline WarmStart::WarmStart()
+   : entries_ ()     // The cache entries sorted by their contact IDs
+   , values_  ()     // The cached unknowns
+   , unknowns_( 0 )  // The number of unknowns per contact of the cached problem
+   , hits_    ( 0 )  // The number of contacts initialized from the cache during the last load
+   , misses_  ( 0 )  // The number of contacts not contained in the cache during the last load
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of contacts contained in the cache.
+//
+// \return The number of cached contacts.
+*/
+inline size_t WarmStart::size() const
+{
+   return entries_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of contacts initialized from the cache during the last load.
+//
+// \return The number of contacts found in the cache.
+*/
+inline size_t WarmStart::getLastHits() const
+{
+   return hits_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of contacts not contained in the cache during the last load.
+//
+// \return The number of contacts that have been reset to zero.
+*/
+inline size_t WarmStart::getLastMisses() const
+{
+   return misses_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Removes all contacts from the cache.
+//
+// \return void
+*/
+inline void WarmStart::clear()
+{
+   entries_.clear();
+   values_.clear();
+   unknowns_ = 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the current unknowns of the given complementarity problem in the cache.
+//
+// \param cp The (solved) complementarity problem.
+// \param ids The IDs of the contacts of the complementarity problem.
+// \return void
+//
+// This function replaces the content of the cache by the current unknowns of the given problem.
+// The number of IDs has to match the number of contacts of the problem and each ID must be
+// unique.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline void WarmStart::store( const CP& cp, const std::vector<size_t>& ids )
+{
+   const size_t m( unknowns( cp ) );
+
+   BLAZE_USER_ASSERT( ids.size() * m == cp.size(), "Invalid number of contact IDs" );
+
+   entries_.resize( ids.size() );
+   values_   = cp.x_;
+   unknowns_ = m;
+
+   for( size_t i=0; i<ids.size(); ++i ) {
+      entries_[i].id_     = ids[i];
+      entries_[i].offset_ = i * m;
+   }
+
+   std::sort( entries_.begin(), entries_.end() );
+
+   BLAZE_USER_ASSERT( std::adjacent_find( entries_.begin(), entries_.end() ) == entries_.end(),
+                      "Duplicate contact IDs detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes the unknowns of the given complementarity problem from the cache.
+//
+// \param cp The complementarity problem to be initialized.
+// \param ids The IDs of the contacts of the complementarity problem.
+// \return void
+// \exception std::invalid_argument Mismatching number of unknowns per contact.
+//
+// This function initializes the unknowns of all contacts whose IDs are contained in the cache
+// by the cached values and resets the unknowns of all other contacts to zero. The number of IDs
+// has to match the number of contacts of the problem. In case the number of unknowns per contact
+// of the given problem differs from the number of unknowns per contact of the cached problem
+// (e.g. in case the solution of a ContactLCP is loaded into an LCP), a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline void WarmStart::load( CP& cp, const std::vector<size_t>& ids )
+{
+   const size_t m( unknowns( cp ) );
+
+   BLAZE_USER_ASSERT( ids.size() * m == cp.size(), "Invalid number of contact IDs" );
+
+   if( !entries_.empty() && m != unknowns_ )
+      throw std::invalid_argument( "Mismatching number of unknowns per contact" );
+
+   hits_   = 0;
+   misses_ = 0;
+
+   Entry key;
+
+   for( size_t i=0; i<ids.size(); ++i )
+   {
+      key.id_ = ids[i];
+
+      const std::vector<Entry>::const_iterator pos(
+         std::lower_bound( entries_.begin(), entries_.end(), key ) );
+
+      if( pos != entries_.end() && pos->id_ == ids[i] ) {
+         for( size_t k=0; k<m; ++k )
+            cp.x_[i*m+k] = values_[pos->offset_+k];
+         ++hits_;
+      }
+      else {
+         for( size_t k=0; k<m; ++k )
+            cp.x_[i*m+k] = real(0);
+         ++misses_;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of unknowns per contact of the given complementarity problem.
+//
+// \param cp The complementarity problem.
+// \return The number of unknowns per contact.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline size_t WarmStart::unknowns( const CP& /*cp*/ )
+{
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of unknowns per contact of the given contact LCP.
+//
+// \param cp The contact LCP.
+// \return The number of unknowns per contact (the normal and the two tangential unknowns).
+*/
+inline size_t WarmStart::unknowns( const ContactLCP& /*cp*/ )
+{
+   return 3UL;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
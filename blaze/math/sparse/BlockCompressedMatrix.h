@@ -0,0 +1,1806 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a MxN block compressed matrix with small dense blocks
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsBlockCompressedMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ sparse matrix consisting of small
+//        dense \f$ B \times B \f$ blocks.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template is the representation of an arbitrary sized,
+// row-major sparse matrix in the block compressed row storage (BCSR) format. Many sparse
+// matrices, as for instance the system matrices of finite element discretizations with several
+// degrees of freedom per node or the contact matrices of rigid body simulations, consist of
+// small dense blocks. Instead of storing every non-zero element along with its own column
+// index, the BlockCompressedMatrix stores the non-zero \f$ B \times B \f$ blocks as dense
+// arrays along with a single block column index per block. This reduces the index overhead by
+// a factor of \f$ B^2 \f$ and enables register-blocked and vectorized multiplication kernels
+// with a considerably higher arithmetic intensity. The type of the elements and the size of
+// the blocks can be specified via the two template parameters:
+
+   \code
+   template< typename Type, size_t B >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type. The vectorized
+//          multiplication kernels are used for single and double precision element types.
+//  - B   : specifies the number of rows and columns of the dense blocks.
+//
+// The number of rows and columns of a BlockCompressedMatrix has to be a multiple of the block
+// size \a B. Each block is stored in column-major order and, in case the vectorized kernels
+// are used, each block column is padded to a multiple of the intrinsic vector size (analogous
+// to the blaze::StaticMatrix). Note that all elements of the non-zero blocks are considered
+// non-zero elements, including the zero elements within the blocks.
+//
+// A BlockCompressedMatrix is read-only: It is created from (or assigned) any other dense or
+// sparse matrix and provides read access to all elements, but does not allow to modify single
+// elements. The following example demonstrates the use of BlockCompressedMatrix:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::BlockCompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 3000UL, 3000UL );
+   // ... Initialization of A with 3x3 blocks
+
+   BlockCompressedMatrix<double,3UL> S( A );  // Conversion into 3x3 blocks
+
+   DynamicVector<double> x( 3000UL, 1.0 ), y;
+   DynamicMatrix<double> X( 3000UL, 16UL, 1.0 ), Y;
+
+   y = S * x;  // Register-blocked sparse matrix/dense vector multiplication
+   Y = S * X;  // Register-blocked sparse matrix/dense matrix multiplication
+
+   const double d( S(2,3) );  // Read access to the element (2,3)
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+class BlockCompressedMatrix : public SparseMatrix< BlockCompressedMatrix<Type,B>, false >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;             //!< Intrinsic trait for the matrix element type.
+   typedef typename IT::Type     IntrinsicType;  //!< Intrinsic type of the matrix elements.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<Type,B>  This;            //!< Type of this BlockCompressedMatrix instance.
+   typedef CompressedMatrix<Type,false>   ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>    OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>    TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                           ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                    ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                    CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                    Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                    ConstReference;  //!< Reference to a constant sparse matrix value.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BlockCompressedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef BlockCompressedMatrix<ET,B>  Other;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the vectorized multiplication kernels.
+   /*! The \a vectorizable compilation flag indicates whether the blocks are padded and the
+       vectorized multiplication kernels are used. */
+   enum { vectorizable = ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                         IT::addition && IT::multiplication };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+
+   //! The number of rows and columns of a single block.
+   enum { blockSize = B };
+
+   //! The padded number of rows of a single block column.
+   enum { blockSpacing = ( vectorizable )?( B + ( IT::size - ( B % IT::size ) ) % IT::size ):( B ) };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a single row of the block compressed matrix.
+   //
+   // The ConstIterator traverses all elements of a single row of the non-zero blocks in the
+   // according block row, including the zero elements within the blocks.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef ValueIndexPair<Type>  Element;  //!< Element type of the block compressed matrix.
+
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying elements.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator()
+         : value_ ( NULL )  // Pointer to the value of the current element
+         , block_ ( NULL )  // Pointer to the block column index of the current element
+         , column_( 0UL  )  // The column of the current element within its block
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the value of the current element.
+      // \param block Pointer to the block column index of the current element.
+      // \param column The column of the current element within its block.
+      */
+      inline ConstIterator( const Type* value, const size_t* block, size_t column )
+         : value_ ( value  )  // Pointer to the value of the current element
+         , block_ ( block  )  // Pointer to the block column index of the current element
+         , column_( column )  // The column of the current element within its block
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         value_ += blockSpacing;
+         if( ++column_ == B ) {
+            column_ = 0UL;
+            ++block_;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The element at the current iterator position.
+      */
+      inline const Element operator*() const {
+         return Element( *value_, index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline ReturnType value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const {
+         return (*block_)*B + column_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return ( value_ - rhs.value_ ) / DifferenceType( blockSpacing );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type*   value_;   //!< Pointer to the value of the current element.
+      const size_t* block_;   //!< Pointer to the block column index of the current element.
+      size_t        column_;  //!< The column of the current element within its block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef ConstIterator  Iterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Assignment operations***********************************************************************
+   /*!\brief Plain assignment operation for the multiply() functions.
+   */
+   struct Assign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] = value; }
+
+      template< typename MT, typename T >
+      static inline void apply( MT& C, size_t i, size_t j, const T& value ) { C(i,j) = value; }
+
+      template< typename MT >
+      static inline void store( MT& C, size_t i, size_t j, const IntrinsicType& value ) { C.store( i, j, value ); }
+   };
+
+   /*!\brief Addition assignment operation for the multiply() functions.
+   */
+   struct AddAssign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] += value; }
+
+      template< typename MT, typename T >
+      static inline void apply( MT& C, size_t i, size_t j, const T& value ) { C(i,j) += value; }
+
+      template< typename MT >
+      static inline void store( MT& C, size_t i, size_t j, const IntrinsicType& value ) { C.store( i, j, C.load(i,j) + value ); }
+   };
+
+   /*!\brief Subtraction assignment operation for the multiply() functions.
+   */
+   struct SubAssign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] -= value; }
+
+      template< typename MT, typename T >
+      static inline void apply( MT& C, size_t i, size_t j, const T& value ) { C(i,j) -= value; }
+
+      template< typename MT >
+      static inline void store( MT& C, size_t i, size_t j, const IntrinsicType& value ) { C.store( i, j, C.load(i,j) - value ); }
+   };
+
+   /*!\brief Multiplication assignment operation for the multiply() function.
+   */
+   struct MultAssign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] *= value; }
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockCompressedMatrix();
+   explicit inline BlockCompressedMatrix( size_t m, size_t n );
+            inline BlockCompressedMatrix( const BlockCompressedMatrix& sm );
+
+   template< typename MT, bool SO >
+   inline BlockCompressedMatrix( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BlockCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                    inline BlockCompressedMatrix& operator=( const BlockCompressedMatrix& rhs );
+   template< typename MT, bool SO > inline BlockCompressedMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   clear();
+   inline void   swap( BlockCompressedMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline size_t blockRows    () const;
+   inline size_t blockColumns () const;
+   inline size_t nonZeroBlocks() const;
+   inline size_t nonZeroBlocks( size_t ib ) const;
+   inline size_t chunks       () const;
+   inline size_t chunkCapacity( size_t c ) const;
+
+   template< typename VT1, typename VT2, typename OP >
+   inline void multiply( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x,
+                         size_t begin, size_t end, OP op ) const;
+
+   template< typename MT1, typename MT2, typename OP >
+   inline void multiply( DenseMatrix<MT1,false>& C, const DenseMatrix<MT2,false>& X,
+                         size_t begin, size_t end, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the element type of the matrix and the element type of the given dense vector
+       are suited for the vectorized matrix/vector multiplication kernel, the nested \a value
+       will be set to 1, otherwise it will be 0. */
+   template< typename VT >
+   struct UseVectorizedVectorKernel {
+      enum { value = vectorizable && IsSame< typename VT::ElementType, Type >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the element type of the matrix and the two given dense matrix types are suited
+       for the vectorized matrix/matrix multiplication kernel, the nested \a value will be set
+       to 1, otherwise it will be 0. */
+   template< typename MT1, typename MT2 >
+   struct UseVectorizedMatrixKernel {
+      enum { value = vectorizable && MT1::vectorizable && MT2::vectorizable &&
+                     IsSame< typename MT1::ElementType, Type >::value &&
+                     IsSame< typename MT2::ElementType, Type >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! The number of elements of a single (padded) block.
+   enum { blockCapacity = blockSpacing * B };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns a pointer to the first block column index.
+   //
+   // \return Pointer to the first block column index (\c NULL in case of no non-zero blocks).
+   */
+   inline const size_t* indices() const {
+      return ( columns_.empty() )?( NULL ):( &columns_[0] );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Build functions*****************************************************************************
+   /*!\name Build functions */
+   //@{
+   template< typename MT >           void build( const SparseMatrix<MT,false>& sm );
+   template< typename MT, bool SO >  void build( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Multiplication kernels**********************************************************************
+   /*!\name Multiplication kernels */
+   //@{
+   template< typename VT1, typename VT2, typename OP >
+   inline typename DisableIf< UseVectorizedVectorKernel<VT2> >::Type
+      multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP op ) const;
+
+   template< typename VT1, typename VT2, typename OP >
+   inline typename EnableIf< UseVectorizedVectorKernel<VT2> >::Type
+      multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP op ) const;
+
+   template< typename MT1, typename MT2, typename OP >
+   inline typename DisableIf< UseVectorizedMatrixKernel<MT1,MT2> >::Type
+      multiplyMatrix_backend( MT1& C, const MT2& X, size_t begin, size_t end, OP op ) const;
+
+   template< typename MT1, typename MT2, typename OP >
+   inline typename EnableIf< UseVectorizedMatrixKernel<MT1,MT2> >::Type
+      multiplyMatrix_backend( MT1& C, const MT2& X, size_t begin, size_t end, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                     //!< The current number of rows of the sparse matrix.
+   size_t n_;                     //!< The current number of columns of the sparse matrix.
+   std::vector<size_t> offset_;   //!< The offsets of the block rows within the block arrays.
+   std::vector<size_t> columns_;  //!< The block column indices of the non-zero blocks.
+   Type* values_;                 //!< The column-major elements of the non-zero blocks.
+
+   static const Type zero_;       //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( B > 0UL );
+   BLAZE_STATIC_ASSERT( !vectorizable || blockSpacing % IT::size == 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+const Type BlockCompressedMatrix<Type,B>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix()
+   : m_      ( 0UL )       // The current number of rows of the sparse matrix
+   , n_      ( 0UL )       // The current number of columns of the sparse matrix
+   , offset_ ( 1UL, 0UL )  // The offsets of the block rows
+   , columns_()            // The block column indices of the non-zero blocks
+   , values_ ( NULL )      // The elements of the non-zero blocks
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a block compressed matrix of size \f$ m \times n \f$ without any
+//        non-zero blocks.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid matrix size for the block size.
+//
+// In case the number of rows or columns is not a multiple of the block size, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( size_t m, size_t n )
+   : m_      ( 0UL )       // The current number of rows of the sparse matrix
+   , n_      ( 0UL )       // The current number of columns of the sparse matrix
+   , offset_ ( 1UL, 0UL )  // The offsets of the block rows
+   , columns_()            // The block column indices of the non-zero blocks
+   , values_ ( NULL )      // The elements of the non-zero blocks
+{
+   build( CompressedMatrix<Type,false>( m, n ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BlockCompressedMatrix.
+//
+// \param sm Block compressed matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( const BlockCompressedMatrix& sm )
+   : m_      ( sm.m_ )        // The current number of rows of the sparse matrix
+   , n_      ( sm.n_ )        // The current number of columns of the sparse matrix
+   , offset_ ( sm.offset_ )   // The offsets of the block rows
+   , columns_( sm.columns_ )  // The block column indices of the non-zero blocks
+   , values_ ( NULL )         // The elements of the non-zero blocks
+{
+   const size_t capacity( columns_.size() * blockCapacity );
+
+   if( capacity != 0UL ) {
+      values_ = allocate<Type>( capacity );
+      std::copy( sm.values_, sm.values_+capacity, values_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted.
+// \exception std::invalid_argument Invalid matrix size for the block size.
+//
+// This constructor converts the given dense or sparse matrix into the block compressed format.
+// All \f$ B \times B \f$ blocks containing at least a single non-zero element of the given
+// matrix are stored as dense blocks. In case the number of rows or columns of the given matrix
+// is not a multiple of the block size, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( const Matrix<MT,SO>& m )
+   : m_      ( 0UL )       // The current number of rows of the sparse matrix
+   , n_      ( 0UL )       // The current number of columns of the sparse matrix
+   , offset_ ( 1UL, 0UL )  // The offsets of the block rows
+   , columns_()            // The block column indices of the non-zero blocks
+   , values_ ( NULL )      // The elements of the non-zero blocks
+{
+   build( ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>::~BlockCompressedMatrix()
+{
+   deallocate( values_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstReference
+   BlockCompressedMatrix<Type,B>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+
+   const size_t k( offset_[i/B] );
+   return ConstIterator( values_+k*blockCapacity+i%B, indices()+k, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+
+   const size_t k( offset_[i/B+1UL] );
+   return ConstIterator( values_+k*blockCapacity+i%B, indices()+k, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BlockCompressedMatrix.
+//
+// \param rhs Block compressed matrix to be copied.
+// \return Reference to the assigned block compressed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>&
+   BlockCompressedMatrix<Type,B>::operator=( const BlockCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BlockCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be assigned.
+// \return Reference to the assigned block compressed matrix.
+// \exception std::invalid_argument Invalid matrix size for the block size.
+//
+// The block compressed matrix is rebuilt from the given matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline BlockCompressedMatrix<Type,B>&
+   BlockCompressedMatrix<Type,B>::operator=( const Matrix<MT,SO>& rhs )
+{
+   BlockCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// Note that all elements of the non-zero blocks are considered non-zero elements, i.e. the
+// function returns the number of non-zero blocks multiplied by \f$ B^2 \f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::nonZeros() const
+{
+   return columns_.size() * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return nonZeroBlocks( i/B ) * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void BlockCompressedMatrix<Type,B>::clear()
+{
+   BlockCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+//
+// \param sm The block compressed matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void BlockCompressedMatrix<Type,B>::swap( BlockCompressedMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   offset_.swap( sm.offset_ );
+   columns_.swap( sm.columns_ );
+   std::swap( values_, sm.values_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the non-zero
+// blocks of the sparse matrix. In case the element is found, the function returns an iterator
+// to the element. Otherwise an iterator just past the last element of row \a i (the end()
+// iterator) is returned.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( i ) );
+
+   if( pos != last && pos->index() == j )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index not less then the
+// given column index. In combination with the upperBound() function this function can be used
+// to create a pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t* const first( indices()+offset_[i/B] );
+   const size_t* const last ( indices()+offset_[i/B+1UL] );
+
+   if( j >= n_ )
+      return end( i );
+
+   const size_t* const pos( std::lower_bound( first, last, j/B ) );
+   const size_t column( ( pos != last && *pos == j/B )?( j%B ):( 0UL ) );
+
+   return ConstIterator( values_+( pos-indices() )*blockCapacity+column*blockSpacing+i%B, pos, column );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index greater then the
+// given column index. In combination with the lowerBound() function this function can be used
+// to create a pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::upperBound( size_t i, size_t j ) const
+{
+   return lowerBound( i, j+1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of block rows of the sparse matrix.
+//
+// \return The number of block rows.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::blockRows() const
+{
+   return m_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of block columns of the sparse matrix.
+//
+// \return The number of block columns.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::blockColumns() const
+{
+   return n_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero blocks of the sparse matrix.
+//
+// \return The number of non-zero blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::nonZeroBlocks() const
+{
+   return columns_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks of the specified block row.
+//
+// \param ib The index of the block row.
+// \return The number of non-zero blocks of block row \a ib.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::nonZeroBlocks( size_t ib ) const
+{
+   BLAZE_USER_ASSERT( ib < blockRows(), "Invalid block row access index" );
+   return offset_[ib+1UL] - offset_[ib];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks.
+//
+// In analogy to the blaze::SlicedEllpackMatrix, the rows of the matrix can be processed in
+// ranges of chunks via the multiply() functions. Each chunk consists of a single block row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::chunks() const
+{
+   return blockRows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the specified chunk.
+//
+// \param c The index of the chunk.
+// \return The number of stored elements of chunk \a c.
+//
+// This function returns the number of elements of chunk \a c that are processed in a
+// multiplication, which can be used to balance the work between several threads.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::chunkCapacity( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return nonZeroBlocks( c ) * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a range of block rows with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param begin The index of the first block row.
+// \param end The index one past the last block row.
+// \param op The assignment operation (Assign, AddAssign, SubAssign, or MultAssign).
+// \return void
+//
+// This function computes the rows of the block rows \f$[begin..end)\f$ of the sparse
+// matrix/dense vector multiplication and combines them with the according elements of the
+// target vector \a y via the given assignment operation. The target vector is expected to have
+// the same size as the matrix has rows. Disjoint ranges of block rows can be processed
+// concurrently. The \a B results of each block row are accumulated in registers. In case the
+// matrix is vectorizable and the dense vector \a x has the same element type, the block
+// columns are processed via aligned loads and fused multiply-add operations.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename VT1   // Type of the left-hand side target vector
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename OP >  // Type of the assignment operation
+inline void BlockCompressedMatrix<Type,B>::multiply( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x,
+                                                     size_t begin, size_t end, OP op ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == m_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == n_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= blockRows(), "Invalid range of block rows" );
+
+   multiply_backend( ~y, ~x, begin, end, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a range of block rows with a dense matrix (\f$ C=A*X \f$).
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param X The right-hand side row-major dense matrix operand.
+// \param begin The index of the first block row.
+// \param end The index one past the last block row.
+// \param op The assignment operation (Assign, AddAssign, or SubAssign).
+// \return void
+//
+// This function computes the rows of the block rows \f$[begin..end)\f$ of the sparse
+// matrix/dense matrix multiplication and combines them with the according rows of the
+// target matrix \a C via the given assignment operation. For each block row, the \a B rows
+// of the result are accumulated in registers, i.e. each row of \a X is loaded only once per
+// non-zero block. In case the matrix and both dense matrices are vectorizable and have the
+// same element type, the columns of \a X are processed in packs of intrinsic vector size.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the right-hand side matrix operand
+        , typename OP >  // Type of the assignment operation
+inline void BlockCompressedMatrix<Type,B>::multiply( DenseMatrix<MT1,false>& C, const DenseMatrix<MT2,false>& X,
+                                                     size_t begin, size_t end, OP op ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == m_            , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~X).rows()    == n_            , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~X).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= blockRows(), "Invalid range of block rows" );
+
+   multiplyMatrix_backend( ~C, ~X, begin, end, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default matrix/vector multiplication kernel for a range of block rows.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param begin The index of the first block row.
+// \param end The index one past the last block row.
+// \param op The assignment operation.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename VT1   // Type of the left-hand side target vector
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename OP >  // Type of the assignment operation
+inline typename DisableIf< typename BlockCompressedMatrix<Type,B>::template UseVectorizedVectorKernel<VT2> >::Type
+   BlockCompressedMatrix<Type,B>::multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP ) const
+{
+   typedef typename MultTrait<Type,typename VT2::ElementType>::Type  ET;
+
+   for( size_t ib=begin; ib<end; ++ib )
+   {
+      ET tmp[B];
+      for( size_t r=0UL; r<B; ++r )
+         tmp[r] = ET();
+
+      for( size_t k=offset_[ib]; k<offset_[ib+1UL]; ++k )
+      {
+         const Type* const v( values_ + k*blockCapacity );
+         const size_t j( columns_[k]*B );
+
+         for( size_t c=0UL; c<B; ++c ) {
+            for( size_t r=0UL; r<B; ++r ) {
+               tmp[r] += v[c*blockSpacing+r] * x[j+c];
+            }
+         }
+      }
+
+      for( size_t r=0UL; r<B; ++r ) {
+         OP::apply( y, ib*B+r, tmp[r] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized matrix/vector multiplication kernel for a range of block rows.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param begin The index of the first block row.
+// \param end The index one past the last block row.
+// \param op The assignment operation.
+// \return void
+//
+// This function implements the vectorized matrix/vector multiplication kernel. The padded
+// block columns are multiplied with the broadcast elements of \a x via aligned loads and fused
+// multiply-add operations. The results of each block row are accumulated in registers.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename VT1   // Type of the left-hand side target vector
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename OP >  // Type of the assignment operation
+inline typename EnableIf< typename BlockCompressedMatrix<Type,B>::template UseVectorizedVectorKernel<VT2> >::Type
+   BlockCompressedMatrix<Type,B>::multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP ) const
+{
+   const size_t lanes( blockSpacing / IT::size );
+
+   AlignedArray<Type,blockSpacing> sums;
+
+   for( size_t ib=begin; ib<end; ++ib )
+   {
+      IntrinsicType xmm[lanes];
+
+      for( size_t k=offset_[ib]; k<offset_[ib+1UL]; ++k )
+      {
+         const Type* const v( values_ + k*blockCapacity );
+         const size_t j( columns_[k]*B );
+
+         for( size_t c=0UL; c<B; ++c ) {
+            const IntrinsicType x1( set( x[j+c] ) );
+            for( size_t l=0UL; l<lanes; ++l ) {
+               xmm[l] = fmadd( load( v+c*blockSpacing+l*IT::size ), x1, xmm[l] );
+            }
+         }
+      }
+
+      for( size_t l=0UL; l<lanes; ++l ) {
+         store( sums.data()+l*IT::size, xmm[l] );
+      }
+
+      for( size_t r=0UL; r<B; ++r ) {
+         OP::apply( y, ib*B+r, sums[r] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default matrix/matrix multiplication kernel for a range of block rows.
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param X The right-hand side row-major dense matrix operand.
+// \param begin The index of the first block row.
+// \param end The index one past the last block row.
+// \param op The assignment operation.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the right-hand side matrix operand
+        , typename OP >  // Type of the assignment operation
+inline typename DisableIf< typename BlockCompressedMatrix<Type,B>::template UseVectorizedMatrixKernel<MT1,MT2> >::Type
+   BlockCompressedMatrix<Type,B>::multiplyMatrix_backend( MT1& C, const MT2& X, size_t begin, size_t end, OP ) const
+{
+   typedef typename MultTrait<Type,typename MT2::ElementType>::Type  ET;
+
+   const size_t columns( X.columns() );
+
+   for( size_t ib=begin; ib<end; ++ib ) {
+      for( size_t jj=0UL; jj<columns; ++jj )
+      {
+         ET tmp[B];
+         for( size_t r=0UL; r<B; ++r )
+            tmp[r] = ET();
+
+         for( size_t k=offset_[ib]; k<offset_[ib+1UL]; ++k )
+         {
+            const Type* const v( values_ + k*blockCapacity );
+            const size_t j( columns_[k]*B );
+
+            for( size_t c=0UL; c<B; ++c ) {
+               for( size_t r=0UL; r<B; ++r ) {
+                  tmp[r] += v[c*blockSpacing+r] * X(j+c,jj);
+               }
+            }
+         }
+
+         for( size_t r=0UL; r<B; ++r ) {
+            OP::apply( C, ib*B+r, jj, tmp[r] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized matrix/matrix multiplication kernel for a range of block rows.
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param X The right-hand side row-major dense matrix operand.
+// \param begin The index of the first block row.
+// \param end The index one past the last block row.
+// \param op The assignment operation.
+// \return void
+//
+// This function implements the vectorized matrix/matrix multiplication kernel. The columns
+// of \a X are processed in packs of intrinsic vector size. For each pack, the \a B rows of
+// the result are accumulated in registers, each loaded row of \a X is reused for all \a B
+// rows of a block, and the elements of the blocks are broadcast.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the right-hand side matrix operand
+        , typename OP >  // Type of the assignment operation
+inline typename EnableIf< typename BlockCompressedMatrix<Type,B>::template UseVectorizedMatrixKernel<MT1,MT2> >::Type
+   BlockCompressedMatrix<Type,B>::multiplyMatrix_backend( MT1& C, const MT2& X, size_t begin, size_t end, OP ) const
+{
+   const size_t columns( X.columns() );
+
+   for( size_t ib=begin; ib<end; ++ib ) {
+      for( size_t jj=0UL; jj<columns; jj+=IT::size )
+      {
+         IntrinsicType xmm[B];
+
+         for( size_t k=offset_[ib]; k<offset_[ib+1UL]; ++k )
+         {
+            const Type* const v( values_ + k*blockCapacity );
+            const size_t j( columns_[k]*B );
+
+            for( size_t c=0UL; c<B; ++c ) {
+               const IntrinsicType x1( X.load( j+c, jj ) );
+               for( size_t r=0UL; r<B; ++r ) {
+                  xmm[r] = fmadd( set( v[c*blockSpacing+r] ), x1, xmm[r] );
+               }
+            }
+         }
+
+         for( size_t r=0UL; r<B; ++r ) {
+            OP::store( C, ib*B+r, jj, xmm[r] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , size_t B >       // Number of rows and columns of the blocks
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , size_t B >       // Number of rows and columns of the blocks
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BUILD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Builds the block compressed representation of a row-major sparse matrix.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+// \exception std::invalid_argument Invalid matrix size for the block size.
+//
+// This function expects the matrix to be in default state. In a first pass, the non-zero
+// blocks of each block row are determined. In a second pass, the elements of the given matrix
+// are copied into the exactly allocated, zero-initialized blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT >  // Type of the row-major sparse matrix
+void BlockCompressedMatrix<Type,B>::build( const SparseMatrix<MT,false>& sm )
+{
+   typedef typename MT::CompositeType                          CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  SourceIterator;
+
+   BLAZE_INTERNAL_ASSERT( values_ == NULL && columns_.empty(), "Invalid matrix state" );
+
+   if( (~sm).rows() % B != 0UL || (~sm).columns() % B != 0UL ) {
+      throw std::invalid_argument( "Invalid matrix size for a block compressed matrix" );
+   }
+
+   CT A( serial( ~sm ) );  // Evaluation of the sparse matrix
+
+   const size_t m ( A.rows() );
+   const size_t n ( A.columns() );
+   const size_t mb( m / B );
+   const size_t nb( n / B );
+
+   std::vector<size_t> offset( mb+1UL, 0UL );
+   std::vector<size_t> columns;
+   std::vector<size_t> position( nb, size_t(-1) );
+
+   // Determining the non-zero blocks of each block row
+   for( size_t ib=0UL; ib<mb; ++ib )
+   {
+      for( size_t i=ib*B; i<(ib+1UL)*B; ++i ) {
+         const SourceIterator last( A.end(i) );
+         for( SourceIterator element=A.begin(i); element!=last; ++element ) {
+            const size_t jb( element->index() / B );
+            if( position[jb] != ib ) {
+               position[jb] = ib;
+               columns.push_back( jb );
+            }
+         }
+      }
+
+      std::sort( columns.begin()+offset[ib], columns.end() );
+      offset[ib+1UL] = columns.size();
+   }
+
+   // Copying the elements into the non-zero blocks
+   const size_t capacity( columns.size() * blockCapacity );
+
+   if( capacity != 0UL )
+   {
+      values_ = allocate<Type>( capacity );
+      std::fill( values_, values_+capacity, Type() );
+
+      for( size_t ib=0UL; ib<mb; ++ib )
+      {
+         for( size_t k=offset[ib]; k<offset[ib+1UL]; ++k )
+            position[columns[k]] = k;
+
+         for( size_t i=ib*B; i<(ib+1UL)*B; ++i ) {
+            const SourceIterator last( A.end(i) );
+            for( SourceIterator element=A.begin(i); element!=last; ++element ) {
+               const size_t j( element->index() );
+               values_[position[j/B]*blockCapacity + (j%B)*blockSpacing + i%B] = element->value();
+            }
+         }
+      }
+   }
+
+   m_ = m;
+   n_ = n;
+   offset_.swap( offset );
+   columns_.swap( columns );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Builds the block compressed representation of an arbitrary matrix.
+//
+// \param m The matrix to be converted.
+// \return void
+// \exception std::invalid_argument Invalid matrix size for the block size.
+//
+// This function converts the given matrix into a row-major compressed matrix, which is
+// subsequently converted into the block compressed representation.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the matrix
+        , bool SO >      // Storage order of the matrix
+void BlockCompressedMatrix<Type,B>::build( const Matrix<MT,SO>& m )
+{
+   const ResultType tmp( ~m );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t B >
+inline void clear( BlockCompressedMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline bool isDefault( const BlockCompressedMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline void swap( BlockCompressedMatrix<Type,B>& a, BlockCompressedMatrix<Type,B>& b ) /* throw() */;
+
+template< typename Type, size_t B >
+inline void move( BlockCompressedMatrix<Type,B>& dst, BlockCompressedMatrix<Type,B>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void clear( BlockCompressedMatrix<Type,B>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given block compressed matrix is in default state.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline bool isDefault( const BlockCompressedMatrix<Type,B>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void swap( BlockCompressedMatrix<Type,B>& a, BlockCompressedMatrix<Type,B>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one block compressed matrix to another.
+// \ingroup block_compressed_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void move( BlockCompressedMatrix<Type,B>& dst, BlockCompressedMatrix<Type,B>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B >
+struct SubmatrixTrait< BlockCompressedMatrix<T1,B> >
+{
+   typedef CompressedMatrix<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B >
+struct RowTrait< BlockCompressedMatrix<T1,B> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B >
+struct ColumnTrait< BlockCompressedMatrix<T1,B> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISBLOCKCOMPRESSEDMATRIX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t B >
+struct IsBlockCompressedMatrix< BlockCompressedMatrix<T,B> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -354,6 +354,7 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
                                      void              resize ( size_t m, size_t n, bool preserve=true );
                               inline void              reserve( size_t nonzeros );
                                      void              reserve( size_t i, size_t nonzeros );
+                                     void              reserve( const std::vector<size_t>& nonzeros );
                               inline void              trim   ();
                               inline void              trim   ( size_t i );
                               inline CompressedMatrix& transpose();
@@ -621,8 +622,6 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
 {
-   using blaze::assign;
-
    const size_t nonzeros( (~sm).nonZeros() );
 
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -630,7 +629,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
       begin_[i+1UL] = end_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 //*************************************************************************************************
 
@@ -946,8 +945,6 @@ template< typename MT    // Type of the right-hand side sparse matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -957,7 +954,7 @@ inline CompressedMatrix<Type,SO>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1679,6 +1676,71 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Setting the minimum capacities of all rows/columns of the sparse matrix.
+//
+// \param nonzeros The new minimum capacities of the rows/columns.
+// \return void
+//
+// This function increases the capacity of each row/column \a i of the sparse matrix to at least
+// \a nonzeros[i] elements. The current values of the sparse matrix are preserved. In contrast to
+// consecutive calls to the row/column-specific reserve() function, which each move all subsequent
+// rows/columns, all capacities are adapted in a single step. In case the storage order is set to
+// \a rowMajor, the number of given capacities has to match the number of rows, in case the
+// storage order is set to \a columnMajor, it has to match the number of columns.
+//
+// Since all rows/columns of an empty or reset matrix provide sufficient capacity after a call to
+// this function, they can be filled via the append() function in arbitrary order and without a
+// call to finalize(). In particular, different rows/columns can be filled concurrently by several
+// threads.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void CompressedMatrix<Type,SO>::reserve( const std::vector<size_t>& nonzeros )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == rows(), "Invalid number of row capacities" );
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   size_t total( 0UL );
+   bool sufficient( true );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      total += max( capacity(i), nonzeros[i] );
+      if( nonzeros[i] > capacity(i) )
+         sufficient = false;
+   }
+
+   if( sufficient ) return;
+
+   const size_t newCapacity( max( total, capacity() ) );
+
+   Iterator* newBegin( new Iterator[2UL*m_+2UL] );
+   Iterator* newEnd  ( newBegin+m_+1UL );
+
+   newBegin[0UL] = allocate<Element>( newCapacity );
+   newEnd  [m_ ] = newBegin[0UL]+newCapacity;
+
+   for( size_t k=0UL; k<m_; ++k ) {
+      newEnd  [k    ] = std::copy( begin_[k], end_[k], newBegin[k] );
+      newBegin[k+1UL] = newBegin[k] + max( capacity(k), nonzeros[k] );
+   }
+
+   BLAZE_INTERNAL_ASSERT( newBegin[m_] <= newEnd[m_], "Invalid pointer calculations" );
+
+   std::swap( newBegin, begin_ );
+   deallocate( newBegin[0UL] );
+   delete [] newBegin;
+   end_ = newEnd;
+   capacity_ = m_;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Removing all excessive capacity from all rows/columns.
 //
@@ -2588,6 +2650,7 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
                                      void              resize ( size_t m, size_t n, bool preserve=true );
                               inline void              reserve( size_t nonzeros );
                                      void              reserve( size_t j, size_t nonzeros );
+                                     void              reserve( const std::vector<size_t>& nonzeros );
                               inline void              trim   ();
                               inline void              trim   ( size_t j );
                               inline CompressedMatrix& transpose();
@@ -2862,8 +2925,6 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
 {
-   using blaze::assign;
-
    const size_t nonzeros( (~sm).nonZeros() );
 
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -2871,7 +2932,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
       begin_[j+1UL] = end_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3169,8 +3230,6 @@ template< typename MT      // Type of the right-hand side sparse matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -3180,7 +3239,7 @@ inline CompressedMatrix<Type,true>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3906,6 +3965,66 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the minimum capacities of all columns of the sparse matrix.
+//
+// \param nonzeros The new minimum capacities of the columns.
+// \return void
+//
+// This function increases the capacity of each column \a j of the sparse matrix to at least
+// \a nonzeros[j] elements. The current values of the sparse matrix are preserved. The number of
+// given capacities has to match the number of columns. Since all columns of an empty or reset
+// matrix provide sufficient capacity after a call to this function, they can be filled via the
+// append() function in arbitrary order and without a call to finalize().
+*/
+template< typename Type >  // Data type of the sparse matrix
+void CompressedMatrix<Type,true>::reserve( const std::vector<size_t>& nonzeros )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == columns(), "Invalid number of column capacities" );
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   size_t total( 0UL );
+   bool sufficient( true );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      total += max( capacity(j), nonzeros[j] );
+      if( nonzeros[j] > capacity(j) )
+         sufficient = false;
+   }
+
+   if( sufficient ) return;
+
+   const size_t newCapacity( max( total, capacity() ) );
+
+   Iterator* newBegin( new Iterator[2UL*n_+2UL] );
+   Iterator* newEnd  ( newBegin+n_+1UL );
+
+   newBegin[0UL] = allocate<Element>( newCapacity );
+   newEnd  [n_ ] = newBegin[0UL]+newCapacity;
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      newEnd  [k    ] = std::copy( begin_[k], end_[k], newBegin[k] );
+      newBegin[k+1UL] = newBegin[k] + max( capacity(k), nonzeros[k] );
+   }
+
+   BLAZE_INTERNAL_ASSERT( newBegin[n_] <= newEnd[n_], "Invalid pointer calculations" );
+
+   std::swap( newBegin, begin_ );
+   deallocate( newBegin[0UL] );
+   delete [] newBegin;
+   end_ = newEnd;
+   capacity_ = n_;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Removing all excessive capacity from all columns.
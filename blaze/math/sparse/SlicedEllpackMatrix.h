@@ -0,0 +1,1621 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SlicedEllpackMatrix.h
+//  \brief Implementation of a sliced ELLPACK MxN matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSlicedEllpackMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sliced_ellpack_matrix SlicedEllpackMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-optimized implementation of a \f$ M \times N \f$ sparse matrix in SELL-C-sigma format.
+// \ingroup sliced_ellpack_matrix
+//
+// The SlicedEllpackMatrix class template is the representation of an arbitrary sized, row-major
+// sparse matrix in the sliced ELLPACK (SELL-C-sigma) storage format. In contrast to the
+// blaze::CompressedMatrix, which stores the non-zero elements of each row as contiguous array of
+// value/index pairs, the SlicedEllpackMatrix groups the rows into chunks of \a C consecutive rows,
+// where \a C is the number of values per intrinsic vector of the element type. The non-zero
+// elements of the rows of a chunk are stored interleaved in separate value and index arrays, i.e.
+// the k-th non-zero elements of all \a C rows of a chunk are stored contiguously. Each chunk
+// is padded to the length of its longest row. In order to reduce the amount of padding, the
+// rows are sorted by their number of non-zero elements within windows of \a sigma consecutive
+// rows. This format enables the computation of \a C rows of a sparse matrix/dense vector
+// multiplication at once via aligned loads of the values and gathers of the according vector
+// elements, which considerably improves the performance of the multiplication in comparison to
+// the compressed format.
+//
+// The type of the elements can be specified via the single template parameter:
+
+   \code
+   template< typename Type >
+   class SlicedEllpackMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SlicedEllpackMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type. The vectorized
+//          multiplication kernels are used for single and double precision element types.
+//
+// A SlicedEllpackMatrix is read-only: It is created from (or assigned) any other dense or sparse
+// matrix and provides read access to all elements, but does not allow to modify single elements.
+// The column indices are stored as 32-bit integral values, i.e. the number of columns must not
+// exceed \f$ 2^{31} \f$. The following example demonstrates the use of SlicedEllpackMatrix:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SlicedEllpackMatrix;
+   using blaze::DynamicVector;
+   using blaze::columnVector;
+
+   CompressedMatrix<double> A( 1000UL, 1000UL );
+   // ... Initialization of A
+
+   SlicedEllpackMatrix<double> S( A );         // Conversion with the default sigma
+   SlicedEllpackMatrix<double> T( A, 256UL );  // Conversion with a window of 256 rows for the sorting
+
+   DynamicVector<double,columnVector> x( 1000UL, 1.0 ), y;
+
+   y  = S * x;        // Vectorized sparse matrix/dense vector multiplication
+   y += T * ( x+x );  // Vectorized addition assignment of a multiplication
+
+   const double d( S(2,3) );  // Read access to the element (2,3)
+
+   // Traversal of the non-zero elements of row 2
+   for( SlicedEllpackMatrix<double>::ConstIterator it=S.begin(2); it!=S.end(2); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+
+   CompressedMatrix<double> B( S * A );  // SlicedEllpackMatrix as operand of any operation
+   \endcode
+*/
+template< typename Type >  // Data type of the sparse matrix
+class SlicedEllpackMatrix : public SparseMatrix< SlicedEllpackMatrix<Type>, false >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;             //!< Intrinsic trait for the matrix element type.
+   typedef typename IT::Type     IntrinsicType;  //!< Intrinsic type of the matrix elements.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef SlicedEllpackMatrix<Type>     This;            //!< Type of this SlicedEllpackMatrix instance.
+   typedef CompressedMatrix<Type,false>  ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>   OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>   TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                          ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                   ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                   CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                   Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                   ConstReference;  //!< Reference to a constant sparse matrix value.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SlicedEllpackMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SlicedEllpackMatrix<ET>  Other;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of a single row of the sliced ELLPACK matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef ValueIndexPair<Type>  Element;  //!< Element type of the sliced ELLPACK matrix.
+
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying elements.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator()
+         : value_( NULL )  // Pointer to the value of the current element
+         , index_( NULL )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the value of the current element.
+      // \param index Pointer to the index of the current element.
+      */
+      inline ConstIterator( const Type* value, const uint32_t* index )
+         : value_( value )  // Pointer to the value of the current element
+         , index_( index )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         value_ += chunkSize;
+         index_ += chunkSize;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The element at the current iterator position.
+      */
+      inline const Element operator*() const {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline ReturnType value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return ( value_ - rhs.value_ ) / DifferenceType( chunkSize );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type*     value_;  //!< Pointer to the value of the current element.
+      const uint32_t* index_;  //!< Pointer to the index of the current element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef ConstIterator  Iterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+
+   //! The number of rows per chunk.
+   /*! The \a chunkSize compile time constant specifies the number of consecutive rows, whose
+       non-zero elements are stored interleaved. It corresponds to the number of values per
+       intrinsic vector of the element type. */
+   enum { chunkSize = IT::size };
+
+   //! The default size of the sorting windows.
+   enum { defaultSigma = 32UL*chunkSize };
+   //**********************************************************************************************
+
+   //**Assignment operations***********************************************************************
+   /*!\brief Plain assignment operation for the multiply() function.
+   */
+   struct Assign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] = value; }
+   };
+
+   /*!\brief Addition assignment operation for the multiply() function.
+   */
+   struct AddAssign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] += value; }
+   };
+
+   /*!\brief Subtraction assignment operation for the multiply() function.
+   */
+   struct SubAssign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] -= value; }
+   };
+
+   /*!\brief Multiplication assignment operation for the multiply() function.
+   */
+   struct MultAssign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] *= value; }
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SlicedEllpackMatrix();
+   explicit inline SlicedEllpackMatrix( size_t m, size_t n );
+            inline SlicedEllpackMatrix( const SlicedEllpackMatrix& sm );
+
+   template< typename MT, bool SO >
+   inline SlicedEllpackMatrix( const Matrix<MT,SO>& m, size_t sigma=defaultSigma );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SlicedEllpackMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                    inline SlicedEllpackMatrix& operator=( const SlicedEllpackMatrix& rhs );
+   template< typename MT, bool SO > inline SlicedEllpackMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t sigma() const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   clear();
+   inline void   swap( SlicedEllpackMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline size_t chunks() const;
+   inline size_t chunkCapacity( size_t c ) const;
+
+   template< typename VT1, typename VT2, typename OP >
+   inline void multiply( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x,
+                         size_t begin, size_t end, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the element type of the matrix and the given dense vector type are suited for the
+       vectorized, gather-based multiplication kernel, the nested \a value will be set to 1,
+       otherwise it will be 0. */
+   template< typename VT >
+   struct UseVectorizedKernel {
+      enum { value = ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame< VT, DynamicVector<Type,false> >::value &&
+                     IT::addition && IT::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class LengthGreater*****************************************************************
+   /*!\brief Comparison of two rows by their number of non-zero elements.
+   */
+   struct LengthGreater
+   {
+      explicit inline LengthGreater( const std::vector<size_t>& lengths ) : lengths_( &lengths ) {}
+
+      inline bool operator()( size_t i, size_t j ) const {
+         return (*lengths_)[i] > (*lengths_)[j];
+      }
+
+      const std::vector<size_t>* lengths_;  //!< The number of non-zero elements of each row.
+   };
+   //**********************************************************************************************
+
+   //**Build functions*****************************************************************************
+   /*!\name Build functions */
+   //@{
+   template< typename MT >           void build( const SparseMatrix<MT,false>& sm );
+   template< typename MT, bool SO >  void build( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Multiplication kernels**********************************************************************
+   /*!\name Multiplication kernels */
+   //@{
+   template< typename VT1, typename VT2, typename OP >
+   inline typename DisableIf< UseVectorizedKernel<VT2> >::Type
+      multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP op ) const;
+
+   template< typename VT1, typename VT2, typename OP >
+   inline typename EnableIf< UseVectorizedKernel<VT2> >::Type
+      multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                    //!< The current number of rows of the sparse matrix.
+   size_t n_;                    //!< The current number of columns of the sparse matrix.
+   size_t sigma_;                //!< The size of the windows for the sorting of the rows.
+   size_t nonZeros_;             //!< The total number of non-zero elements.
+   std::vector<size_t> perm_;    //!< The row stored in each slot.
+   std::vector<size_t> slot_;    //!< The slot of each row.
+   std::vector<size_t> length_;  //!< The number of non-zero elements of each slot.
+   std::vector<size_t> offset_;  //!< The offsets of the chunks within the value and index arrays.
+   std::vector<size_t> common_;  //!< The minimum number of non-zero elements of the rows of each chunk.
+   Type* values_;                //!< The values of the non-zero elements.
+   uint32_t* indices_;           //!< The column indices of the non-zero elements.
+
+   static const Type zero_;      //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type >  // Data type of the sparse matrix
+const Type SlicedEllpackMatrix<Type>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SlicedEllpackMatrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SlicedEllpackMatrix<Type>::SlicedEllpackMatrix()
+   : m_       ( 0UL )            // The current number of rows of the sparse matrix
+   , n_       ( 0UL )            // The current number of columns of the sparse matrix
+   , sigma_   ( defaultSigma )   // The size of the windows for the sorting of the rows
+   , nonZeros_( 0UL )            // The total number of non-zero elements
+   , perm_    ()                 // The row stored in each slot
+   , slot_    ()                 // The slot of each row
+   , length_  ()                 // The number of non-zero elements of each slot
+   , offset_  ( 1UL, 0UL )       // The offsets of the chunks
+   , common_  ()                 // The minimum number of non-zero elements per chunk
+   , values_  ( NULL )           // The values of the non-zero elements
+   , indices_ ( NULL )           // The column indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a sliced ELLPACK matrix of size \f$ m \times n \f$ without any non-zero
+//        elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid number of columns for a sliced ELLPACK matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SlicedEllpackMatrix<Type>::SlicedEllpackMatrix( size_t m, size_t n )
+   : m_       ( 0UL )            // The current number of rows of the sparse matrix
+   , n_       ( 0UL )            // The current number of columns of the sparse matrix
+   , sigma_   ( defaultSigma )   // The size of the windows for the sorting of the rows
+   , nonZeros_( 0UL )            // The total number of non-zero elements
+   , perm_    ()                 // The row stored in each slot
+   , slot_    ()                 // The slot of each row
+   , length_  ()                 // The number of non-zero elements of each slot
+   , offset_  ( 1UL, 0UL )       // The offsets of the chunks
+   , common_  ()                 // The minimum number of non-zero elements per chunk
+   , values_  ( NULL )           // The values of the non-zero elements
+   , indices_ ( NULL )           // The column indices of the non-zero elements
+{
+   build( CompressedMatrix<Type,false>( m, n ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SlicedEllpackMatrix.
+//
+// \param sm Sliced ELLPACK matrix to be copied.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SlicedEllpackMatrix<Type>::SlicedEllpackMatrix( const SlicedEllpackMatrix& sm )
+   : m_       ( sm.m_ )          // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )          // The current number of columns of the sparse matrix
+   , sigma_   ( sm.sigma_ )      // The size of the windows for the sorting of the rows
+   , nonZeros_( sm.nonZeros_ )   // The total number of non-zero elements
+   , perm_    ( sm.perm_ )       // The row stored in each slot
+   , slot_    ( sm.slot_ )       // The slot of each row
+   , length_  ( sm.length_ )     // The number of non-zero elements of each slot
+   , offset_  ( sm.offset_ )     // The offsets of the chunks
+   , common_  ( sm.common_ )     // The minimum number of non-zero elements per chunk
+   , values_  ( NULL )           // The values of the non-zero elements
+   , indices_ ( NULL )           // The column indices of the non-zero elements
+{
+   const size_t capacity( offset_.back() );
+
+   if( capacity != 0UL ) {
+      values_  = allocate<Type>( capacity );
+      indices_ = allocate<uint32_t>( capacity );
+      std::copy( sm.values_ , sm.values_ +capacity, values_  );
+      std::copy( sm.indices_, sm.indices_+capacity, indices_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted.
+// \param sigma The size of the windows for the sorting of the rows.
+// \exception std::invalid_argument Invalid number of columns for a sliced ELLPACK matrix.
+//
+// This constructor converts the given dense or sparse matrix into the sliced ELLPACK format. The
+// rows are sorted by their number of non-zero elements within windows of \a sigma consecutive
+// rows (rounded up to a multiple of the chunk size). A \a sigma smaller or equal to the chunk
+// size preserves the original order of the rows. In case the given matrix has more than
+// \f$ 2^{31} \f$ columns, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline SlicedEllpackMatrix<Type>::SlicedEllpackMatrix( const Matrix<MT,SO>& m, size_t sigma )
+   : m_       ( 0UL )            // The current number of rows of the sparse matrix
+   , n_       ( 0UL )            // The current number of columns of the sparse matrix
+   , sigma_   ( sigma )          // The size of the windows for the sorting of the rows
+   , nonZeros_( 0UL )            // The total number of non-zero elements
+   , perm_    ()                 // The row stored in each slot
+   , slot_    ()                 // The slot of each row
+   , length_  ()                 // The number of non-zero elements of each slot
+   , offset_  ( 1UL, 0UL )       // The offsets of the chunks
+   , common_  ()                 // The minimum number of non-zero elements per chunk
+   , values_  ( NULL )           // The values of the non-zero elements
+   , indices_ ( NULL )           // The column indices of the non-zero elements
+{
+   build( ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SlicedEllpackMatrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SlicedEllpackMatrix<Type>::~SlicedEllpackMatrix()
+{
+   deallocate( values_  );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstReference
+   SlicedEllpackMatrix<Type>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+
+   const size_t slot  ( slot_[i] );
+   const size_t offset( offset_[slot/chunkSize] + slot%chunkSize );
+
+   return ConstIterator( values_+offset, indices_+offset );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+
+   const size_t slot  ( slot_[i] );
+   const size_t offset( offset_[slot/chunkSize] + slot%chunkSize + length_[slot]*chunkSize );
+
+   return ConstIterator( values_+offset, indices_+offset );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SlicedEllpackMatrix.
+//
+// \param rhs Sliced ELLPACK matrix to be copied.
+// \return Reference to the assigned sliced ELLPACK matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SlicedEllpackMatrix<Type>&
+   SlicedEllpackMatrix<Type>::operator=( const SlicedEllpackMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SlicedEllpackMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be assigned.
+// \return Reference to the assigned sliced ELLPACK matrix.
+// \exception std::invalid_argument Invalid number of columns for a sliced ELLPACK matrix.
+//
+// The sliced ELLPACK matrix is rebuilt from the given matrix. The size of the sorting windows
+// of the matrix remains unchanged.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline SlicedEllpackMatrix<Type>&
+   SlicedEllpackMatrix<Type>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SlicedEllpackMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the windows for the sorting of the rows.
+//
+// \return The size of the sorting windows.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::sigma() const
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::nonZeros() const
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return length_[slot_[i]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void SlicedEllpackMatrix<Type>::clear()
+{
+   SlicedEllpackMatrix tmp;
+   tmp.sigma_ = sigma_;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+//
+// \param sm The sliced ELLPACK matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void SlicedEllpackMatrix<Type>::swap( SlicedEllpackMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( sigma_, sm.sigma_ );
+   std::swap( nonZeros_, sm.nonZeros_ );
+   perm_.swap( sm.perm_ );
+   slot_.swap( sm.slot_ );
+   length_.swap( sm.length_ );
+   offset_.swap( sm.offset_ );
+   common_.swap( sm.common_ );
+   std::swap( values_, sm.values_ );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an iterator to the element. Otherwise an
+// iterator just past the last non-zero element of row \a i (the end() iterator) is returned.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( i ) );
+
+   if( pos != last && pos->index() == j )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index not less then the
+// given column index. In combination with the upperBound() function this function can be used
+// to create a pair of iterators specifying a range of indices.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t slot  ( slot_[i] );
+   const size_t offset( offset_[slot/chunkSize] + slot%chunkSize );
+
+   size_t first( 0UL );
+   size_t last ( length_[slot] );
+
+   while( first < last ) {
+      const size_t mid( first + ( last - first ) / 2UL );
+      if( indices_[offset+mid*chunkSize] < j )
+         first = mid + 1UL;
+      else last = mid;
+   }
+
+   return ConstIterator( values_+offset+first*chunkSize, indices_+offset+first*chunkSize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index greater then the
+// given column index. In combination with the lowerBound() function this function can be used
+// to create a pair of iterators specifying a range of indices.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t slot  ( slot_[i] );
+   const size_t offset( offset_[slot/chunkSize] + slot%chunkSize );
+
+   size_t first( 0UL );
+   size_t last ( length_[slot] );
+
+   while( first < last ) {
+      const size_t mid( first + ( last - first ) / 2UL );
+      if( indices_[offset+mid*chunkSize] <= j )
+         first = mid + 1UL;
+      else last = mid;
+   }
+
+   return ConstIterator( values_+offset+first*chunkSize, indices_+offset+first*chunkSize );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks.
+//
+// Each chunk consists of \a chunkSize consecutive slots. The rows stored in chunk \a c can be
+// processed via the multiply() function.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::chunks() const
+{
+   return offset_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the specified chunk.
+//
+// \param c The index of the chunk.
+// \return The number of stored elements of chunk \a c (including the padding).
+//
+// This function returns the number of elements of chunk \a c that are processed in a
+// multiplication, which can be used to balance the work between several threads.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::chunkCapacity( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return offset_[c+1UL] - offset_[c];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a range of chunks with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param begin The index of the first chunk.
+// \param end The index one past the last chunk.
+// \param op The assignment operation (Assign, AddAssign, SubAssign, or MultAssign).
+// \return void
+//
+// This function computes the rows of the sparse matrix/dense vector multiplication that are
+// stored in the chunks \f$[begin..end)\f$ and combines them with the according elements of
+// the target vector \a y via the given assignment operation. The target vector is expected
+// to have the same size as the matrix has rows. Since each row is stored in exactly one
+// chunk, disjoint ranges of chunks can be processed concurrently. In case the dense vector
+// \a x is a blaze::DynamicVector with the same single or double precision element type, \a C
+// rows are computed at once via aligned loads of the values and gathers of the elements of
+// \a x.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename VT1     // Type of the left-hand side target vector
+        , typename VT2     // Type of the right-hand side vector operand
+        , typename OP >    // Type of the assignment operation
+inline void SlicedEllpackMatrix<Type>::multiply( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x,
+                                                 size_t begin, size_t end, OP op ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == m_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == n_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= chunks(), "Invalid range of chunks" );
+
+   multiply_backend( ~y, ~x, begin, end, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default multiplication kernel for a range of chunks.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param begin The index of the first chunk.
+// \param end The index one past the last chunk.
+// \param op The assignment operation.
+// \return void
+//
+// This function implements the default multiplication kernel for the rows stored in the
+// given range of chunks.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename VT1     // Type of the left-hand side target vector
+        , typename VT2     // Type of the right-hand side vector operand
+        , typename OP >    // Type of the assignment operation
+inline typename DisableIf< typename SlicedEllpackMatrix<Type>::template UseVectorizedKernel<VT2> >::Type
+   SlicedEllpackMatrix<Type>::multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP ) const
+{
+   typedef typename MultTrait<Type,typename VT2::ElementType>::Type  ET;
+
+   for( size_t c=begin; c<end; ++c )
+   {
+      const size_t first( c*chunkSize );
+      const size_t last ( min( first+chunkSize, m_ ) );
+
+      for( size_t s=first; s<last; ++s )
+      {
+         const Type*     v  ( values_  + offset_[c] + s - first );
+         const uint32_t* idx( indices_ + offset_[c] + s - first );
+
+         ET tmp = ET();
+         for( size_t k=0UL; k<length_[s]; ++k ) {
+            tmp += v[k*chunkSize] * x[idx[k*chunkSize]];
+         }
+
+         OP::apply( y, perm_[s], tmp );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized multiplication kernel for a range of chunks.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param begin The index of the first chunk.
+// \param end The index one past the last chunk.
+// \param op The assignment operation.
+// \return void
+//
+// This function implements the vectorized multiplication kernel for the rows stored in the
+// given range of chunks. The first elements of all rows of a chunk, up to the length of the
+// shortest row, are processed via aligned loads of the values and gathers of the according
+// elements of \a x. The remaining elements of the longer rows are processed row by row, i.e.
+// the padding of the chunk is never accessed.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename VT1     // Type of the left-hand side target vector
+        , typename VT2     // Type of the right-hand side vector operand
+        , typename OP >    // Type of the assignment operation
+inline typename EnableIf< typename SlicedEllpackMatrix<Type>::template UseVectorizedKernel<VT2> >::Type
+   SlicedEllpackMatrix<Type>::multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP ) const
+{
+   const Type* const px( x.data() );
+
+   AlignedArray<Type,chunkSize> sums;
+
+   for( size_t c=begin; c<end; ++c )
+   {
+      const size_t    first( c*chunkSize );
+      const size_t    lanes( min( size_t( chunkSize ), m_ - first ) );
+      const size_t    kend ( common_[c] );
+      const Type*     v    ( values_  + offset_[c] );
+      const uint32_t* idx  ( indices_ + offset_[c] );
+
+      IntrinsicType xmm1, xmm2;
+      size_t k( 0UL );
+
+      for( ; (k+2UL) <= kend; k+=2UL ) {
+         xmm1 = fmadd( load( v+k*chunkSize ), gather( px, idx+k*chunkSize ), xmm1 );
+         xmm2 = fmadd( load( v+(k+1UL)*chunkSize ), gather( px, idx+(k+1UL)*chunkSize ), xmm2 );
+      }
+      if( k < kend ) {
+         xmm1 = fmadd( load( v+k*chunkSize ), gather( px, idx+k*chunkSize ), xmm1 );
+      }
+
+      store( sums.data(), xmm1 + xmm2 );
+
+      for( size_t l=0UL; l<lanes; ++l )
+      {
+         Type tmp( sums[l] );
+         for( size_t k2=kend; k2<length_[first+l]; ++k2 ) {
+            tmp += v[k2*chunkSize+l] * px[idx[k2*chunkSize+l]];
+         }
+
+         OP::apply( y, perm_[first+l], tmp );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the sparse matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the sparse matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BUILD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Builds the sliced ELLPACK representation of a row-major sparse matrix.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+// \exception std::invalid_argument Invalid number of columns for a sliced ELLPACK matrix.
+//
+// This function expects the matrix to be in default state. The rows of the given matrix are
+// sorted by their number of non-zero elements within windows of \a sigma rows, grouped into
+// chunks of \a chunkSize rows, and stored interleaved into the value and index arrays.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT >    // Type of the row-major sparse matrix
+void SlicedEllpackMatrix<Type>::build( const SparseMatrix<MT,false>& sm )
+{
+   typedef typename MT::CompositeType                          CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  SourceIterator;
+
+   BLAZE_INTERNAL_ASSERT( values_ == NULL && indices_ == NULL, "Invalid matrix state" );
+
+   if( (~sm).columns() > 2147483648UL ) {
+      throw std::invalid_argument( "Invalid number of columns for a sliced ELLPACK matrix" );
+   }
+
+   CT A( serial( ~sm ) );  // Evaluation of the sparse matrix
+
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+   const size_t chunks( ( m + chunkSize - 1UL ) / chunkSize );
+
+   std::vector<size_t> lengths( m, 0UL );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const SourceIterator last( A.end(i) );
+      for( SourceIterator element=A.begin(i); element!=last; ++element )
+         ++lengths[i];
+      nonzeros += lengths[i];
+   }
+
+   // Sorting the rows by their number of non-zero elements within the windows
+   std::vector<size_t> perm( m ), slot( m );
+   for( size_t i=0UL; i<m; ++i )
+      perm[i] = i;
+
+   const size_t window( ( ( max( sigma_, size_t( chunkSize ) ) - 1UL ) / chunkSize + 1UL ) * chunkSize );
+
+   if( window > size_t( chunkSize ) ) {
+      for( size_t i=0UL; i<m; i+=window ) {
+         std::stable_sort( perm.begin()+i, perm.begin()+min( i+window, m ), LengthGreater( lengths ) );
+      }
+   }
+
+   // Computing the layout of the chunks
+   std::vector<size_t> length( chunks*chunkSize, 0UL ), offset( chunks+1UL, 0UL ), common( chunks, 0UL );
+
+   for( size_t s=0UL; s<m; ++s ) {
+      slot[perm[s]] = s;
+      length[s] = lengths[perm[s]];
+   }
+
+   for( size_t c=0UL; c<chunks; ++c )
+   {
+      const size_t first( c*chunkSize );
+      const size_t last ( min( first+chunkSize, m ) );
+
+      size_t width( length[first] );
+      common[c] = length[first];
+
+      for( size_t s=first+1UL; s<last; ++s ) {
+         width     = max( width, length[s] );
+         common[c] = min( common[c], length[s] );
+      }
+
+      offset[c+1UL] = offset[c] + width*chunkSize;
+   }
+
+   // Storing the non-zero elements
+   const size_t capacity( offset[chunks] );
+
+   if( capacity != 0UL )
+   {
+      values_  = allocate<Type>( capacity );
+      indices_ = allocate<uint32_t>( capacity );
+
+      std::fill( values_ , values_ +capacity, Type() );
+      std::fill( indices_, indices_+capacity, uint32_t( 0 ) );
+
+      for( size_t s=0UL; s<m; ++s )
+      {
+         size_t pos( offset[s/chunkSize] + s%chunkSize );
+
+         const SourceIterator last( A.end(perm[s]) );
+         for( SourceIterator element=A.begin(perm[s]); element!=last; ++element, pos+=chunkSize ) {
+            values_ [pos] = element->value();
+            indices_[pos] = static_cast<uint32_t>( element->index() );
+         }
+      }
+   }
+
+   m_        = m;
+   n_        = n;
+   nonZeros_ = nonzeros;
+   perm_.swap( perm );
+   slot_.swap( slot );
+   length_.swap( length );
+   offset_.swap( offset );
+   common_.swap( common );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Builds the sliced ELLPACK representation of an arbitrary matrix.
+//
+// \param m The matrix to be converted.
+// \return void
+// \exception std::invalid_argument Invalid number of columns for a sliced ELLPACK matrix.
+//
+// This function converts the given matrix into a row-major compressed matrix, which is
+// subsequently converted into the sliced ELLPACK format.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+void SlicedEllpackMatrix<Type>::build( const Matrix<MT,SO>& m )
+{
+   const ResultType tmp( ~m );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SLICEDELLPACKMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SlicedEllpackMatrix operators */
+//@{
+template< typename Type >
+inline void clear( SlicedEllpackMatrix<Type>& m );
+
+template< typename Type >
+inline bool isDefault( const SlicedEllpackMatrix<Type>& m );
+
+template< typename Type >
+inline void swap( SlicedEllpackMatrix<Type>& a, SlicedEllpackMatrix<Type>& b ) /* throw() */;
+
+template< typename Type >
+inline void move( SlicedEllpackMatrix<Type>& dst, SlicedEllpackMatrix<Type>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void clear( SlicedEllpackMatrix<Type>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given sliced ELLPACK matrix is in default state.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline bool isDefault( const SlicedEllpackMatrix<Type>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+// \ingroup sliced_ellpack_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void swap( SlicedEllpackMatrix<Type>& a, SlicedEllpackMatrix<Type>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one sliced ELLPACK matrix to another.
+// \ingroup sliced_ellpack_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void move( SlicedEllpackMatrix<Type>& dst, SlicedEllpackMatrix<Type>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct SubmatrixTrait< SlicedEllpackMatrix<T1> >
+{
+   typedef CompressedMatrix<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct RowTrait< SlicedEllpackMatrix<T1> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct ColumnTrait< SlicedEllpackMatrix<T1> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSLICEDELLPACKMATRIX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsSlicedEllpackMatrix< SlicedEllpackMatrix<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,499 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpGEMM.h
+//  \brief Header file for the row-wise sparse matrix/sparse matrix multiplication kernel
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPGEMM_H_
+#define _BLAZE_MATH_SPARSE_SPGEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row accumulator of the row-wise sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// The SpGEMMAccumulator class template accumulates the products contributing to a single row
+// of the result of a row-major sparse matrix/sparse matrix multiplication (Gustavson's algorithm).
+// Depending on the number of products of a row, the accumulator uses either a dense sparse
+// accumulator (SPA) of the size of a row or a hash table with linear probing. The SPA is used
+// for rows with many products in comparison to the number of columns, the hash table for rows
+// with few products, in which case it avoids touching a row-sized array and therefore keeps the
+// working set in cache. Both variants tag their entries with the sequence number of the current
+// row and therefore never have to be cleared.\n
+// Each thread participating in a parallel multiplication has to use its own accumulator.
+*/
+template< typename Type >  // Data type of the accumulated elements
+class SpGEMMAccumulator : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   explicit inline SpGEMMAccumulator( size_t n );
+   //**********************************************************************************************
+
+   //**Multiplication functions********************************************************************
+   template< typename MT1, typename MT2 >
+   inline size_t count( const MT1& A, const MT2& B, size_t i );
+
+   template< typename MT1, typename MT2, typename MT3 >
+   inline void compute( MT1& C, const MT2& A, const MT3& B, size_t i );
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   template< typename MT1, typename MT2 >
+   inline size_t flops( const MT1& A, const MT2& B, size_t i ) const;
+
+   inline bool   useHashTable( size_t flops ) const;
+   inline void   prepare     ( size_t flops );
+   inline size_t probe       ( size_t j ) const;
+   //**********************************************************************************************
+
+   //**Private class SlotLess**********************************************************************
+   /*!\brief Ordering of hash table slots by the column index stored in the slots.
+   */
+   struct SlotLess
+   {
+      explicit inline SlotLess( const size_t* columns ) : columns_( columns ) {}
+
+      inline bool operator()( size_t a, size_t b ) const { return columns_[a] < columns_[b]; }
+
+      const size_t* columns_;  //!< The column indices of the hash table slots.
+   };
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t n_;                     //!< The number of columns of the result.
+   size_t stamp_;                 //!< The sequence number of the current row.
+   size_t mask_;                  //!< The bit mask of the current hash table size.
+   std::vector<size_t> tags_;     //!< The sequence numbers of the SPA/hash table entries.
+   std::vector<size_t> columns_;  //!< The column indices of the hash table slots.
+   std::vector<Type>   values_;   //!< The accumulated values of the SPA/hash table entries.
+   std::vector<size_t> indices_;  //!< The column indices/slots touched in the current row.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The constructor for SpGEMMAccumulator.
+//
+// \param n The number of columns of the result.
+//
+// The SPA and the hash table are allocated lazily on their first use.
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline SpGEMMAccumulator<Type>::SpGEMMAccumulator( size_t n )
+   : n_      ( n   )  // The number of columns of the result
+   , stamp_  ( 0UL )  // The sequence number of the current row
+   , mask_   ( 0UL )  // The bit mask of the current hash table size
+   , tags_   ()       // The sequence numbers of the SPA/hash table entries
+   , columns_()       // The column indices of the hash table slots
+   , values_ ()       // The accumulated values of the SPA/hash table entries
+   , indices_()       // The column indices/slots touched in the current row
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Counts the number of non-zero elements of the specified row of the result (symbolic phase).
+//
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \param i The index of the row of the result.
+// \return The number of structurally non-zero elements of row \a i of \f$ A*B \f$.
+//
+// Note that the returned number is an upper bound for the number of elements appended by the
+// compute() function, since the latter skips elements that cancel out numerically.
+*/
+template< typename Type >  // Data type of the accumulated elements
+template< typename MT1     // Type of the left-hand side sparse matrix
+        , typename MT2 >   // Type of the right-hand side sparse matrix
+inline size_t SpGEMMAccumulator<Type>::count( const MT1& A, const MT2& B, size_t i )
+{
+   typedef typename MT1::ConstIterator  LeftIterator;
+   typedef typename MT2::ConstIterator  RightIterator;
+
+   const size_t products( flops( A, B, i ) );
+
+   if( products < 2UL )
+      return products;
+
+   prepare( products );
+
+   const bool hashed( useHashTable( products ) );
+   size_t nonzeros( 0UL );
+
+   const LeftIterator lend( A.end(i) );
+   for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem )
+   {
+      const RightIterator rend( B.end( lelem->index() ) );
+      for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+      {
+         const size_t pos( hashed ? probe( relem->index() ) : relem->index() );
+
+         if( tags_[pos] != stamp_ ) {
+            tags_[pos] = stamp_;
+            if( hashed ) columns_[pos] = relem->index();
+            ++nonzeros;
+         }
+      }
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the specified row of the result (numeric phase).
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \param i The index of the row of the result.
+// \return void
+//
+// This function accumulates row \a i of \f$ A*B \f$ and appends all non-default elements in
+// ascending order of their column indices to the (empty) row \a i of \a C. The row of \a C must
+// provide sufficient capacity for all elements (see the count() function). Since the function
+// does not finalize the row, the rows of \a C can be computed in arbitrary order.
+*/
+template< typename Type >  // Data type of the accumulated elements
+template< typename MT1     // Type of the target sparse matrix
+        , typename MT2     // Type of the left-hand side sparse matrix
+        , typename MT3 >   // Type of the right-hand side sparse matrix
+inline void SpGEMMAccumulator<Type>::compute( MT1& C, const MT2& A, const MT3& B, size_t i )
+{
+   typedef typename MT2::ConstIterator  LeftIterator;
+   typedef typename MT3::ConstIterator  RightIterator;
+
+   const size_t products( flops( A, B, i ) );
+
+   if( products == 0UL )
+      return;
+
+   prepare( products );
+
+   const bool hashed( useHashTable( products ) );
+   size_t minIndex( n_ ), maxIndex( 0UL );
+
+   indices_.clear();
+
+   const LeftIterator lend( A.end(i) );
+   for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem )
+   {
+      const RightIterator rend( B.end( lelem->index() ) );
+      for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+      {
+         const size_t pos( hashed ? probe( relem->index() ) : relem->index() );
+
+         if( tags_[pos] != stamp_ ) {
+            tags_  [pos] = stamp_;
+            values_[pos] = lelem->value() * relem->value();
+            indices_.push_back( pos );
+            if( hashed ) columns_[pos] = relem->index();
+            if( relem->index() < minIndex ) minIndex = relem->index();
+            if( relem->index() > maxIndex ) maxIndex = relem->index();
+         }
+         else {
+            values_[pos] += lelem->value() * relem->value();
+         }
+      }
+   }
+
+   const size_t nonzeros( indices_.size() );
+
+   if( hashed ) {
+      std::sort( indices_.begin(), indices_.end(), SlotLess( &columns_[0] ) );
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         const size_t pos( indices_[k] );
+         if( !isDefault( values_[pos] ) )
+            C.append( i, columns_[pos], values_[pos] );
+      }
+   }
+   else if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) ) {
+      std::sort( indices_.begin(), indices_.end() );
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         const size_t j( indices_[k] );
+         if( !isDefault( values_[j] ) )
+            C.append( i, j, values_[j] );
+      }
+   }
+   else {
+      for( size_t j=minIndex; j<=maxIndex; ++j ) {
+         if( tags_[j] == stamp_ && !isDefault( values_[j] ) )
+            C.append( i, j, values_[j] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of products contributing to the specified row of the result.
+//
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \param i The index of the row of the result.
+// \return The number of products contributing to row \a i of \f$ A*B \f$.
+*/
+template< typename Type >  // Data type of the accumulated elements
+template< typename MT1     // Type of the left-hand side sparse matrix
+        , typename MT2 >   // Type of the right-hand side sparse matrix
+inline size_t SpGEMMAccumulator<Type>::flops( const MT1& A, const MT2& B, size_t i ) const
+{
+   typedef typename MT1::ConstIterator  LeftIterator;
+
+   size_t products( 0UL );
+
+   const LeftIterator lend( A.end(i) );
+   for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+      products += B.nonZeros( lelem->index() );
+   }
+
+   return products;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a row with the given number of products is accumulated in the hash table.
+//
+// \param flops The number of products contributing to the row.
+// \return \a true in case the hash table is used, \a false if the SPA is used.
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline bool SpGEMMAccumulator<Type>::useHashTable( size_t flops ) const
+{
+   return ( 4UL * flops < n_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Prepares the accumulator for a new row with the given number of products.
+//
+// \param flops The number of products contributing to the row.
+// \return void
+//
+// This function starts a new row by incrementing the sequence number, which invalidates all
+// entries of the previous row, and enlarges the SPA or hash table if necessary. The size of the
+// hash table is the smallest power of two greater than or equal to twice the number of products.
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline void SpGEMMAccumulator<Type>::prepare( size_t flops )
+{
+   ++stamp_;
+
+   size_t size( n_ );
+
+   if( useHashTable( flops ) ) {
+      size = 16UL;
+      while( size < 2UL*flops ) size *= 2UL;
+      mask_ = size - 1UL;
+      if( columns_.size() < size ) columns_.resize( size );
+   }
+
+   if( tags_.size() < size ) {
+      tags_.resize( size, 0UL );
+      values_.resize( size );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the hash table slot of the given column index.
+//
+// \param j The column index.
+// \return The slot of the column index within the current hash table.
+//
+// This function returns either the slot already containing the given column index in the
+// current row or the first free slot of its probing sequence.
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline size_t SpGEMMAccumulator<Type>::probe( size_t j ) const
+{
+   size_t pos( ( j * 2654435761UL ) & mask_ );
+
+   while( tags_[pos] == stamp_ && columns_[pos] != j ) {
+      pos = ( pos + 1UL ) & mask_;
+   }
+
+   return pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic phase of the row-wise sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \param nonzeros The resulting numbers of non-zero elements of the rows.
+// \param acc The accumulator of the calling thread.
+// \return void
+//
+// This function determines the number of structurally non-zero elements of the rows
+// \f$[begin..end)\f$ of \f$ A*B \f$. Since it only writes the according entries of \a nonzeros,
+// disjoint row ranges can be processed concurrently by different threads.
+*/
+template< typename MT1     // Type of the left-hand side sparse matrix
+        , typename MT2     // Type of the right-hand side sparse matrix
+        , typename Type >  // Data type of the accumulated elements
+void spgemmSymbolic( const SparseMatrix<MT1,false>& A, const SparseMatrix<MT2,false>& B,
+                     size_t begin, size_t end, std::vector<size_t>& nonzeros,
+                     SpGEMMAccumulator<Type>& acc )
+{
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows(), "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( end <= nonzeros.size(), "Invalid row range" );
+
+   for( size_t i=begin; i<end; ++i ) {
+      nonzeros[i] = acc.count( ~A, ~B, i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric phase of the row-wise sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \param acc The accumulator of the calling thread.
+// \return void
+//
+// This function computes the rows \f$[begin..end)\f$ of \f$ A*B \f$ and appends them to the
+// according empty rows of \a C. The rows of \a C must provide sufficient capacity as determined
+// by the spgemmSymbolic() function. Since the rows are not finalized, disjoint row ranges can be
+// processed concurrently by different threads.
+*/
+template< typename MT1     // Type of the target sparse matrix
+        , typename MT2     // Type of the left-hand side sparse matrix
+        , typename MT3     // Type of the right-hand side sparse matrix
+        , typename Type >  // Data type of the accumulated elements
+void spgemmNumeric( SparseMatrix<MT1,false>& C, const SparseMatrix<MT2,false>& A,
+                    const SparseMatrix<MT3,false>& B, size_t begin, size_t end,
+                    SpGEMMAccumulator<Type>& acc )
+{
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+
+   for( size_t i=begin; i<end; ++i ) {
+      acc.compute( ~C, ~A, ~B, i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
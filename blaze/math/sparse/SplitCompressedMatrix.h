@@ -0,0 +1,1530 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SplitCompressedMatrix.h
+//  \brief Implementation of a MxN compressed matrix with separate value and index arrays
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SPLITCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SPLITCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSplitCompressedMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup split_compressed_matrix SplitCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-optimized implementation of a \f$ M \times N \f$ compressed sparse matrix with
+//        separate value and index arrays.
+// \ingroup split_compressed_matrix
+//
+// The SplitCompressedMatrix class template is the representation of an arbitrary sized,
+// row-major sparse matrix in the compressed row storage format. In contrast to the
+// blaze::CompressedMatrix, which stores the non-zero elements of each row as contiguous array
+// of value/index pairs, the SplitCompressedMatrix stores the values and the column indices of
+// all non-zero elements in two separate arrays (structure of arrays). Additionally, the type of
+// the column indices can be chosen. With the default 32-bit indices, the storage of a single
+// precision non-zero element requires 8 instead of 16 bytes, and the storage of a double
+// precision non-zero element requires 12 instead of 16 bytes. This considerably reduces the
+// memory traffic of sparse matrix/dense vector multiplications, which are bound by the memory
+// bandwidth for large matrices. The type of the elements and the type of the column indices
+// can be specified via the two template parameters:
+
+   \code
+   template< typename Type, typename IndexType >
+   class SplitCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SplitCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type. The vectorized
+//          multiplication kernels are used for single and double precision element types.
+//  - IndexType: specifies the unsigned integral type of the column indices. The default value
+//          is \c uint32_t, which limits the number of columns to \f$ 2^{32} \f$. The vectorized
+//          multiplication kernels are used for 32-bit indices.
+//
+// A SplitCompressedMatrix is read-only: It is created from (or assigned) any other dense or
+// sparse matrix and provides read access to all elements, but does not allow to modify single
+// elements. The following example demonstrates the use of SplitCompressedMatrix:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SplitCompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::columnVector;
+
+   CompressedMatrix<float> A( 1000UL, 1000UL );
+   // ... Initialization of A
+
+   SplitCompressedMatrix<float> S( A );               // Conversion with 32-bit column indices
+   SplitCompressedMatrix<float,uint16_t> T( A );      // Conversion with 16-bit column indices
+
+   DynamicVector<float,columnVector> x( 1000UL, 1.0F ), y;
+
+   y  = S * x;        // Vectorized sparse matrix/dense vector multiplication
+   y += T * ( x+x );  // Addition assignment of a multiplication
+
+   const float f( S(2,3) );  // Read access to the element (2,3)
+
+   // Traversal of the non-zero elements of row 2
+   for( SplitCompressedMatrix<float>::ConstIterator it=S.begin(2); it!=S.end(2); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+
+   CompressedMatrix<float> B( S * A );  // SplitCompressedMatrix as operand of any operation
+   \endcode
+*/
+template< typename Type                // Data type of the sparse matrix
+        , typename IndexType=uint32_t >  // Type of the column indices
+class SplitCompressedMatrix : public SparseMatrix< SplitCompressedMatrix<Type,IndexType>, false >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;             //!< Intrinsic trait for the matrix element type.
+   typedef typename IT::Type     IntrinsicType;  //!< Intrinsic type of the matrix elements.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef SplitCompressedMatrix<Type,IndexType>  This;            //!< Type of this SplitCompressedMatrix instance.
+   typedef CompressedMatrix<Type,false>           ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>            OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>            TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                   ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                            ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                            CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                            Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                            ConstReference;  //!< Reference to a constant sparse matrix value.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SplitCompressedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SplitCompressedMatrix<ET,IndexType>  Other;  //!< The type of the other SplitCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of a single row of the compressed matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef ValueIndexPair<Type>  Element;  //!< Element type of the compressed matrix.
+
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying elements.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator()
+         : value_( NULL )  // Pointer to the value of the current element
+         , index_( NULL )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the value of the current element.
+      // \param index Pointer to the index of the current element.
+      */
+      inline ConstIterator( const Type* value, const IndexType* index )
+         : value_( value )  // Pointer to the value of the current element
+         , index_( index )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         ++value_;
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The element at the current iterator position.
+      */
+      inline const Element operator*() const {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline ReturnType value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return value_ - rhs.value_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type*      value_;  //!< Pointer to the value of the current element.
+      const IndexType* index_;  //!< Pointer to the index of the current element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef ConstIterator  Iterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Assignment operations***********************************************************************
+   /*!\brief Plain assignment operation for the multiply() function.
+   */
+   struct Assign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] = value; }
+   };
+
+   /*!\brief Addition assignment operation for the multiply() function.
+   */
+   struct AddAssign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] += value; }
+   };
+
+   /*!\brief Subtraction assignment operation for the multiply() function.
+   */
+   struct SubAssign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] -= value; }
+   };
+
+   /*!\brief Multiplication assignment operation for the multiply() function.
+   */
+   struct MultAssign
+   {
+      template< typename VT, typename T >
+      static inline void apply( VT& y, size_t i, const T& value ) { y[i] *= value; }
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SplitCompressedMatrix();
+   explicit inline SplitCompressedMatrix( size_t m, size_t n );
+            inline SplitCompressedMatrix( const SplitCompressedMatrix& sm );
+
+   template< typename MT, bool SO >
+   inline SplitCompressedMatrix( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SplitCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                    inline SplitCompressedMatrix& operator=( const SplitCompressedMatrix& rhs );
+   template< typename MT, bool SO > inline SplitCompressedMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   clear();
+   inline void   swap( SplitCompressedMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline const Type*      values () const;
+   inline const IndexType* indices() const;
+   inline size_t           chunks () const;
+   inline size_t           chunkCapacity( size_t c ) const;
+
+   template< typename VT1, typename VT2, typename OP >
+   inline void multiply( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x,
+                         size_t begin, size_t end, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the element type of the matrix, the index type, and the given dense vector type
+       are suited for the vectorized, gather-based multiplication kernel, the nested \a value
+       will be set to 1, otherwise it will be 0. */
+   template< typename VT >
+   struct UseVectorizedKernel {
+      enum { value = ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame< IndexType, uint32_t >::value &&
+                     IsSame< VT, DynamicVector<Type,false> >::value &&
+                     IT::addition && IT::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Build functions*****************************************************************************
+   /*!\name Build functions */
+   //@{
+   template< typename MT >           void build( const SparseMatrix<MT,false>& sm );
+   template< typename MT, bool SO >  void build( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Multiplication kernels**********************************************************************
+   /*!\name Multiplication kernels */
+   //@{
+   template< typename VT1, typename VT2, typename OP >
+   inline typename DisableIf< UseVectorizedKernel<VT2> >::Type
+      multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP op ) const;
+
+   template< typename VT1, typename VT2, typename OP >
+   inline typename EnableIf< UseVectorizedKernel<VT2> >::Type
+      multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                    //!< The current number of rows of the sparse matrix.
+   size_t n_;                    //!< The current number of columns of the sparse matrix.
+   std::vector<size_t> offset_;  //!< The offsets of the rows within the value and index arrays.
+   Type* values_;                //!< The values of the non-zero elements.
+   IndexType* indices_;          //!< The column indices of the non-zero elements.
+
+   static const Type zero_;      //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IndexType );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IndexType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+const Type SplitCompressedMatrix<Type,IndexType>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SplitCompressedMatrix.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline SplitCompressedMatrix<Type,IndexType>::SplitCompressedMatrix()
+   : m_      ( 0UL )         // The current number of rows of the sparse matrix
+   , n_      ( 0UL )         // The current number of columns of the sparse matrix
+   , offset_ ( 1UL, 0UL )    // The offsets of the rows
+   , values_ ( NULL )        // The values of the non-zero elements
+   , indices_( NULL )        // The column indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a compressed matrix of size \f$ m \times n \f$ without any non-zero
+//        elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid number of columns for the index type.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline SplitCompressedMatrix<Type,IndexType>::SplitCompressedMatrix( size_t m, size_t n )
+   : m_      ( 0UL )         // The current number of rows of the sparse matrix
+   , n_      ( 0UL )         // The current number of columns of the sparse matrix
+   , offset_ ( 1UL, 0UL )    // The offsets of the rows
+   , values_ ( NULL )        // The values of the non-zero elements
+   , indices_( NULL )        // The column indices of the non-zero elements
+{
+   build( CompressedMatrix<Type,false>( m, n ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SplitCompressedMatrix.
+//
+// \param sm Compressed matrix to be copied.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline SplitCompressedMatrix<Type,IndexType>::SplitCompressedMatrix( const SplitCompressedMatrix& sm )
+   : m_      ( sm.m_ )       // The current number of rows of the sparse matrix
+   , n_      ( sm.n_ )       // The current number of columns of the sparse matrix
+   , offset_ ( sm.offset_ )  // The offsets of the rows
+   , values_ ( NULL )        // The values of the non-zero elements
+   , indices_( NULL )        // The column indices of the non-zero elements
+{
+   const size_t nonzeros( offset_.back() );
+
+   if( nonzeros != 0UL ) {
+      values_  = allocate<Type>( nonzeros );
+      indices_ = allocate<IndexType>( nonzeros );
+      std::copy( sm.values_ , sm.values_ +nonzeros, values_  );
+      std::copy( sm.indices_, sm.indices_+nonzeros, indices_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted.
+// \exception std::invalid_argument Invalid number of columns for the index type.
+//
+// This constructor converts the given dense or sparse matrix into the compressed format with
+// separate value and index arrays. In case the column indices of the given matrix cannot be
+// represented by the index type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+template< typename MT           // Type of the foreign matrix
+        , bool SO >             // Storage order of the foreign matrix
+inline SplitCompressedMatrix<Type,IndexType>::SplitCompressedMatrix( const Matrix<MT,SO>& m )
+   : m_      ( 0UL )         // The current number of rows of the sparse matrix
+   , n_      ( 0UL )         // The current number of columns of the sparse matrix
+   , offset_ ( 1UL, 0UL )    // The offsets of the rows
+   , values_ ( NULL )        // The values of the non-zero elements
+   , indices_( NULL )        // The column indices of the non-zero elements
+{
+   build( ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SplitCompressedMatrix.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline SplitCompressedMatrix<Type,IndexType>::~SplitCompressedMatrix()
+{
+   deallocate( values_  );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline typename SplitCompressedMatrix<Type,IndexType>::ConstReference
+   SplitCompressedMatrix<Type,IndexType>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline typename SplitCompressedMatrix<Type,IndexType>::ConstIterator
+   SplitCompressedMatrix<Type,IndexType>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return ConstIterator( values_+offset_[i], indices_+offset_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline typename SplitCompressedMatrix<Type,IndexType>::ConstIterator
+   SplitCompressedMatrix<Type,IndexType>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline typename SplitCompressedMatrix<Type,IndexType>::ConstIterator
+   SplitCompressedMatrix<Type,IndexType>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return ConstIterator( values_+offset_[i+1UL], indices_+offset_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline typename SplitCompressedMatrix<Type,IndexType>::ConstIterator
+   SplitCompressedMatrix<Type,IndexType>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SplitCompressedMatrix.
+//
+// \param rhs Compressed matrix to be copied.
+// \return Reference to the assigned compressed matrix.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline SplitCompressedMatrix<Type,IndexType>&
+   SplitCompressedMatrix<Type,IndexType>::operator=( const SplitCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SplitCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be assigned.
+// \return Reference to the assigned compressed matrix.
+// \exception std::invalid_argument Invalid number of columns for the index type.
+//
+// The compressed matrix is rebuilt from the given matrix.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+template< typename MT           // Type of the right-hand side matrix
+        , bool SO >             // Storage order of the right-hand side matrix
+inline SplitCompressedMatrix<Type,IndexType>&
+   SplitCompressedMatrix<Type,IndexType>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SplitCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline size_t SplitCompressedMatrix<Type,IndexType>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline size_t SplitCompressedMatrix<Type,IndexType>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline size_t SplitCompressedMatrix<Type,IndexType>::nonZeros() const
+{
+   return offset_.back();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline size_t SplitCompressedMatrix<Type,IndexType>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return offset_[i+1UL] - offset_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline void SplitCompressedMatrix<Type,IndexType>::clear()
+{
+   SplitCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed matrices.
+//
+// \param sm The compressed matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline void SplitCompressedMatrix<Type,IndexType>::swap( SplitCompressedMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   offset_.swap( sm.offset_ );
+   std::swap( values_, sm.values_ );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an iterator to the element. Otherwise an
+// iterator just past the last non-zero element of row \a i (the end() iterator) is returned.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline typename SplitCompressedMatrix<Type,IndexType>::ConstIterator
+   SplitCompressedMatrix<Type,IndexType>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( i ) );
+
+   if( pos != last && pos->index() == j )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index not less then the
+// given column index. In combination with the upperBound() function this function can be used
+// to create a pair of iterators specifying a range of indices.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline typename SplitCompressedMatrix<Type,IndexType>::ConstIterator
+   SplitCompressedMatrix<Type,IndexType>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const IndexType* const first( indices_+offset_[i] );
+   const IndexType* const last ( indices_+offset_[i+1UL] );
+
+   const IndexType* const pos( ( j < n_ )?( std::lower_bound( first, last, IndexType( j ) ) ):( last ) );
+
+   return ConstIterator( values_+( pos-indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index greater then the
+// given column index. In combination with the lowerBound() function this function can be used
+// to create a pair of iterators specifying a range of indices.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline typename SplitCompressedMatrix<Type,IndexType>::ConstIterator
+   SplitCompressedMatrix<Type,IndexType>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const IndexType* const first( indices_+offset_[i] );
+   const IndexType* const last ( indices_+offset_[i+1UL] );
+
+   const IndexType* const pos( ( j < n_ )?( std::upper_bound( first, last, IndexType( j ) ) ):( last ) );
+
+   return ConstIterator( values_+( pos-indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the values of the non-zero elements.
+//
+// \return Pointer to the values of the non-zero elements.
+//
+// The values of the non-zero elements of all rows are stored consecutively. The values of
+// row \a i start at the position \a begin(i) and end before the position \a end(i).
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline const Type* SplitCompressedMatrix<Type,IndexType>::values() const
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the column indices of the non-zero elements.
+//
+// \return Pointer to the column indices of the non-zero elements.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline const IndexType* SplitCompressedMatrix<Type,IndexType>::indices() const
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks.
+//
+// In analogy to the blaze::SlicedEllpackMatrix, the rows of the matrix can be processed in
+// ranges of chunks via the multiply() function. Each chunk consists of a single row.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline size_t SplitCompressedMatrix<Type,IndexType>::chunks() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the specified chunk.
+//
+// \param c The index of the chunk.
+// \return The number of stored elements of chunk \a c.
+//
+// This function returns the number of elements of chunk \a c that are processed in a
+// multiplication, which can be used to balance the work between several threads.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline size_t SplitCompressedMatrix<Type,IndexType>::chunkCapacity( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return offset_[c+1UL] - offset_[c];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a range of rows with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param begin The index of the first row.
+// \param end The index one past the last row.
+// \param op The assignment operation (Assign, AddAssign, SubAssign, or MultAssign).
+// \return void
+//
+// This function computes the rows \f$[begin..end)\f$ of the sparse matrix/dense vector
+// multiplication and combines them with the according elements of the target vector \a y via
+// the given assignment operation. The target vector is expected to have the same size as the
+// matrix has rows. Disjoint ranges of rows can be processed concurrently. In case the dense
+// vector \a x is a blaze::DynamicVector with the same single or double precision element type
+// and the column indices are 32-bit values, each row is computed via unaligned loads of the
+// values and gathers of the elements of \a x.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+template< typename VT1          // Type of the left-hand side target vector
+        , typename VT2          // Type of the right-hand side vector operand
+        , typename OP >         // Type of the assignment operation
+inline void SplitCompressedMatrix<Type,IndexType>::multiply( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x,
+                                                             size_t begin, size_t end, OP op ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == m_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == n_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= m_, "Invalid range of rows" );
+
+   multiply_backend( ~y, ~x, begin, end, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default multiplication kernel for a range of rows.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param begin The index of the first row.
+// \param end The index one past the last row.
+// \param op The assignment operation.
+// \return void
+//
+// This function implements the default multiplication kernel for the given range of rows.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+template< typename VT1          // Type of the left-hand side target vector
+        , typename VT2          // Type of the right-hand side vector operand
+        , typename OP >         // Type of the assignment operation
+inline typename DisableIf< typename SplitCompressedMatrix<Type,IndexType>::template UseVectorizedKernel<VT2> >::Type
+   SplitCompressedMatrix<Type,IndexType>::multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP ) const
+{
+   typedef typename MultTrait<Type,typename VT2::ElementType>::Type  ET;
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      const size_t kend( offset_[i+1UL] );
+
+      ET tmp = ET();
+      for( size_t k=offset_[i]; k<kend; ++k ) {
+         tmp += values_[k] * x[indices_[k]];
+      }
+
+      OP::apply( y, i, tmp );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized multiplication kernel for a range of rows.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param begin The index of the first row.
+// \param end The index one past the last row.
+// \param op The assignment operation.
+// \return void
+//
+// This function implements the vectorized multiplication kernel for the given range of rows.
+// The non-zero elements of each row are processed in packs of intrinsic vector size via
+// unaligned loads of the values and gathers of the according elements of \a x. The remaining
+// elements are processed one by one.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+template< typename VT1          // Type of the left-hand side target vector
+        , typename VT2          // Type of the right-hand side vector operand
+        , typename OP >         // Type of the assignment operation
+inline typename EnableIf< typename SplitCompressedMatrix<Type,IndexType>::template UseVectorizedKernel<VT2> >::Type
+   SplitCompressedMatrix<Type,IndexType>::multiply_backend( VT1& y, const VT2& x, size_t begin, size_t end, OP ) const
+{
+   const size_t size( IT::size );
+
+   const Type* const px( x.data() );
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      const size_t first( offset_[i] );
+      const size_t last ( offset_[i+1UL] );
+      const size_t kend ( last - ( last - first ) % size );
+
+      IntrinsicType xmm1, xmm2;
+      size_t k( first );
+
+      for( ; (k+2UL*size) <= kend; k+=2UL*size ) {
+         xmm1 = fmadd( loadu( values_+k ), gather( px, indices_+k ), xmm1 );
+         xmm2 = fmadd( loadu( values_+k+size ), gather( px, indices_+k+size ), xmm2 );
+      }
+      if( k < kend ) {
+         xmm1 = fmadd( loadu( values_+k ), gather( px, indices_+k ), xmm1 );
+         k += size;
+      }
+
+      Type tmp( sum( xmm1 + xmm2 ) );
+
+      for( ; k<last; ++k ) {
+         tmp += values_[k] * px[indices_[k]];
+      }
+
+      OP::apply( y, i, tmp );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+template< typename Other >      // Data type of the foreign expression
+inline bool SplitCompressedMatrix<Type,IndexType>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+template< typename Other >      // Data type of the foreign expression
+inline bool SplitCompressedMatrix<Type,IndexType>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BUILD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Builds the compressed representation of a row-major sparse matrix.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+// \exception std::invalid_argument Invalid number of columns for the index type.
+//
+// This function expects the matrix to be in default state. The non-zero elements of the given
+// matrix are counted row by row and subsequently copied into the exactly allocated value and
+// index arrays.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+template< typename MT >         // Type of the row-major sparse matrix
+void SplitCompressedMatrix<Type,IndexType>::build( const SparseMatrix<MT,false>& sm )
+{
+   typedef typename MT::CompositeType                          CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  SourceIterator;
+
+   BLAZE_INTERNAL_ASSERT( values_ == NULL && indices_ == NULL, "Invalid matrix state" );
+
+   if( (~sm).columns() != 0UL &&
+       (~sm).columns() - 1UL > size_t( std::numeric_limits<IndexType>::max() ) ) {
+      throw std::invalid_argument( "Invalid number of columns for the index type" );
+   }
+
+   CT A( serial( ~sm ) );  // Evaluation of the sparse matrix
+
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+
+   std::vector<size_t> offset( m+1UL, 0UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      size_t nonzeros( 0UL );
+      const SourceIterator last( A.end(i) );
+      for( SourceIterator element=A.begin(i); element!=last; ++element )
+         ++nonzeros;
+      offset[i+1UL] = offset[i] + nonzeros;
+   }
+
+   const size_t nonzeros( offset[m] );
+
+   if( nonzeros != 0UL )
+   {
+      values_  = allocate<Type>( nonzeros );
+      indices_ = allocate<IndexType>( nonzeros );
+
+      for( size_t i=0UL; i<m; ++i )
+      {
+         size_t pos( offset[i] );
+
+         const SourceIterator last( A.end(i) );
+         for( SourceIterator element=A.begin(i); element!=last; ++element, ++pos ) {
+            values_ [pos] = element->value();
+            indices_[pos] = static_cast<IndexType>( element->index() );
+         }
+      }
+   }
+
+   m_ = m;
+   n_ = n;
+   offset_.swap( offset );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Builds the compressed representation of an arbitrary matrix.
+//
+// \param m The matrix to be converted.
+// \return void
+// \exception std::invalid_argument Invalid number of columns for the index type.
+//
+// This function converts the given matrix into a row-major compressed matrix, which is
+// subsequently converted into the representation with separate value and index arrays.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+template< typename MT           // Type of the matrix
+        , bool SO >             // Storage order of the matrix
+void SplitCompressedMatrix<Type,IndexType>::build( const Matrix<MT,SO>& m )
+{
+   const ResultType tmp( ~m );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPLITCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SplitCompressedMatrix operators */
+//@{
+template< typename Type, typename IndexType >
+inline void clear( SplitCompressedMatrix<Type,IndexType>& m );
+
+template< typename Type, typename IndexType >
+inline bool isDefault( const SplitCompressedMatrix<Type,IndexType>& m );
+
+template< typename Type, typename IndexType >
+inline void swap( SplitCompressedMatrix<Type,IndexType>& a, SplitCompressedMatrix<Type,IndexType>& b ) /* throw() */;
+
+template< typename Type, typename IndexType >
+inline void move( SplitCompressedMatrix<Type,IndexType>& dst, SplitCompressedMatrix<Type,IndexType>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compressed matrix.
+// \ingroup split_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline void clear( SplitCompressedMatrix<Type,IndexType>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed matrix is in default state.
+// \ingroup split_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline bool isDefault( const SplitCompressedMatrix<Type,IndexType>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed matrices.
+// \ingroup split_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline void swap( SplitCompressedMatrix<Type,IndexType>& a, SplitCompressedMatrix<Type,IndexType>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one compressed matrix to another.
+// \ingroup split_compressed_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type         // Data type of the sparse matrix
+        , typename IndexType >  // Type of the column indices
+inline void move( SplitCompressedMatrix<Type,IndexType>& dst, SplitCompressedMatrix<Type,IndexType>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT >
+struct SubmatrixTrait< SplitCompressedMatrix<T1,IT> >
+{
+   typedef CompressedMatrix<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT >
+struct RowTrait< SplitCompressedMatrix<T1,IT> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT >
+struct ColumnTrait< SplitCompressedMatrix<T1,IT> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSPLITCOMPRESSEDMATRIX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename IT >
+struct IsSplitCompressedMatrix< SplitCompressedMatrix<T,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
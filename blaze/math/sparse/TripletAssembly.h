@@ -0,0 +1,580 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/TripletAssembly.h
+//  \brief Header file for the assembly of sparse matrices from (row,column,value) triplets
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_TRIPLETASSEMBLY_H_
+#define _BLAZE_MATH_SPARSE_TRIPLETASSEMBLY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assembly of a sparse matrix from unsorted (row,column,value) triplets.
+// \ingroup sparse_matrix
+//
+// The TripletAssembler class template converts a coordinate (COO) representation of a sparse
+// matrix, i.e. an unsorted sequence of (row,column,value) triplets that may contain duplicates,
+// into the compressed row (in case of a row-major matrix) or compressed column (in case of a
+// column-major matrix) format. In the following, the rows of a row-major and the columns of a
+// column-major matrix are referred to as the \a keys of the assembly. The conversion consists
+// of five phases:
+//
+//  -# count(): Each part of the triplet sequence counts the number of triplets per key.
+//  -# prefix(): The counts are transformed into the positions of the parts within the keys.
+//  -# scatter(): Each part stably scatters its triplets into the segments of their keys.
+//  -# compress(): The segment of each key is sorted and duplicate entries are summed up.
+//  -# append(): The resulting elements of each key are appended to the target matrix.
+//
+// The count() and scatter() phases work on disjoint parts of the triplet sequence, the compress()
+// and append() phases on disjoint ranges of keys. Therefore all phases except for prefix() can
+// be executed concurrently by several threads. Since the scatter is stable and the segments are
+// sorted stably, duplicate entries are always summed in the order of the triplet sequence, i.e.
+// the result does not depend on the number of parts or threads. The numbers of elements per
+// key determined by compress() enable the target matrix to allocate exactly the required
+// capacity in a single step before the append() phase.\n
+// The type of the row and column indices of the triplets is also used within the internal sort
+// buffer. Therefore 32-bit indices reduce the memory footprint and traffic of the assembly.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+class TripletAssembler : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   explicit inline TripletAssembler( size_t m, size_t n, const IT* rows, const IT* columns,
+                                     const Type* values, size_t size, size_t parts );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline size_t                     parts   () const;
+   inline const std::vector<size_t>& nonZeros() const;
+   //**********************************************************************************************
+
+   //**Assembly functions**************************************************************************
+   inline void count   ( size_t part );
+   inline void prefix  ();
+   inline void scatter ( size_t part );
+   inline void compress( size_t begin, size_t end );
+
+   template< typename MT >
+   inline void append( MT& A, size_t begin, size_t end ) const;
+   //**********************************************************************************************
+
+ private:
+   //**Private class Element***********************************************************************
+   /*!\brief Minor index/value pair of the sort buffer.
+   */
+   struct Element
+   {
+      inline Element() {}
+
+      inline bool operator<( const Element& rhs ) const { return index_ < rhs.index_; }
+
+      IT   index_;  //!< The column (row-major) or row (column-major) index of the element.
+      Type value_;  //!< The value of the element.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline const IT* keyIndices  () const;
+   inline const IT* minorIndices() const;
+
+   static inline void sort( Element* first, Element* last );
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t m_;                      //!< The number of rows of the target matrix.
+   size_t n_;                      //!< The number of columns of the target matrix.
+   size_t keys_;                   //!< The number of keys (rows/columns) of the target matrix.
+   const IT*   rows_;              //!< The row indices of the triplets.
+   const IT*   columns_;           //!< The column indices of the triplets.
+   const Type* values_;            //!< The values of the triplets.
+   size_t size_;                   //!< The total number of triplets.
+   size_t parts_;                  //!< The number of parts of the triplet sequence.
+   std::vector<size_t> counts_;    //!< The per-part counts/positions of the keys.
+   std::vector<size_t> offsets_;   //!< The offsets of the segments of the keys.
+   std::vector<size_t> nonzeros_;  //!< The number of triplets/elements per key.
+   std::vector<Element> buffer_;   //!< The sort buffer.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The constructor for TripletAssembler.
+//
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param size The total number of triplets.
+// \param parts The requested number of parts of the triplet sequence.
+//
+// Since every part requires a counter per key, the number of parts is limited such that the
+// counters never require more memory than the triplets themselves.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+inline TripletAssembler<Type,IT,SO>::TripletAssembler( size_t m, size_t n, const IT* rows,
+                                                       const IT* columns, const Type* values,
+                                                       size_t size, size_t parts )
+   : m_       ( m )                 // The number of rows of the target matrix
+   , n_       ( n )                 // The number of columns of the target matrix
+   , keys_    ( SO ? n : m )        // The number of keys (rows/columns) of the target matrix
+   , rows_    ( rows )              // The row indices of the triplets
+   , columns_ ( columns )           // The column indices of the triplets
+   , values_  ( values )            // The values of the triplets
+   , size_    ( size )              // The total number of triplets
+   , parts_   ( parts )             // The number of parts of the triplet sequence
+   , counts_  ()                    // The per-part counts/positions of the keys
+   , offsets_ ( keys_+1UL, 0UL )    // The offsets of the segments of the keys
+   , nonzeros_( keys_, 0UL )        // The number of triplets/elements per key
+   , buffer_  ( size )              // The sort buffer
+{
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( IT );
+
+   const size_t maxParts( ( keys_ > 0UL )?( std::max( size_ / keys_, 1UL ) ):( 1UL ) );
+
+   if( parts_ > maxParts ) parts_ = maxParts;
+   if( parts_ == 0UL     ) parts_ = 1UL;
+
+   counts_.resize( parts_*keys_, 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of parts of the triplet sequence.
+//
+// \return The number of parts of the triplet sequence.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+inline size_t TripletAssembler<Type,IT,SO>::parts() const
+{
+   return parts_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of triplets/elements per key.
+//
+// \return The number of triplets (after prefix()) or elements (after compress()) per key.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+inline const std::vector<size_t>& TripletAssembler<Type,IT,SO>::nonZeros() const
+{
+   return nonzeros_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the key indices of the triplets (row indices in case of a row-major matrix).
+//
+// \return The key indices of the triplets.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+inline const IT* TripletAssembler<Type,IT,SO>::keyIndices() const
+{
+   return ( SO )?( columns_ ):( rows_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the minor indices of the triplets (column indices in case of a row-major matrix).
+//
+// \return The minor indices of the triplets.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+inline const IT* TripletAssembler<Type,IT,SO>::minorIndices() const
+{
+   return ( SO )?( rows_ ):( columns_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stable sort of a segment of the sort buffer by the minor indices.
+//
+// \param first Pointer to the first element of the segment.
+// \param last Pointer one past the last element of the segment.
+// \return void
+//
+// Short segments, which are the common case for the rows/columns of a sparse matrix, are sorted
+// by insertion sort to avoid the temporary buffer of std::stable_sort().
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+inline void TripletAssembler<Type,IT,SO>::sort( Element* first, Element* last )
+{
+   if( last - first > 32 ) {
+      std::stable_sort( first, last );
+      return;
+   }
+
+   for( Element* pos=first+1; pos<last; ++pos )
+   {
+      if( !( *pos < *(pos-1) ) ) continue;
+
+      const Element tmp( *pos );
+      Element* dst( pos );
+
+      do {
+         *dst = *(dst-1);
+         --dst;
+      }
+      while( dst != first && tmp < *(dst-1) );
+
+      *dst = tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSEMBLY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Counts the triplets per key within the given part of the triplet sequence.
+//
+// \param part The index of the part of the triplet sequence.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+inline void TripletAssembler<Type,IT,SO>::count( size_t part )
+{
+   BLAZE_INTERNAL_ASSERT( part < parts_, "Invalid part index" );
+
+   const IT* const keys( keyIndices() );
+
+   const size_t begin( ( part     * size_ ) / parts_ );
+   const size_t end  ( ( (part+1) * size_ ) / parts_ );
+
+   size_t* const counts( &counts_[0] + part*keys_ );
+
+   for( size_t k=begin; k<end; ++k )
+   {
+      BLAZE_USER_ASSERT( static_cast<size_t>( rows_   [k] ) < m_, "Invalid row access index"    );
+      BLAZE_USER_ASSERT( static_cast<size_t>( columns_[k] ) < n_, "Invalid column access index" );
+
+      ++counts[ keys[k] ];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the positions of all parts within the segments of the keys.
+//
+// \return void
+//
+// This function transforms the per-part counts into the positions at which the parts scatter
+// their triplets and determines the number of triplets per key. It has to be called by a single
+// thread after all parts have been counted.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+inline void TripletAssembler<Type,IT,SO>::prefix()
+{
+   size_t pos( 0UL );
+
+   for( size_t i=0UL; i<keys_; ++i )
+   {
+      offsets_[i] = pos;
+
+      for( size_t part=0UL; part<parts_; ++part ) {
+         const size_t count( counts_[part*keys_+i] );
+         counts_[part*keys_+i] = pos;
+         pos += count;
+      }
+
+      nonzeros_[i] = pos - offsets_[i];
+   }
+
+   offsets_[keys_] = pos;
+
+   BLAZE_INTERNAL_ASSERT( pos == size_, "Invalid number of triplets detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scatters the triplets of the given part into the segments of their keys.
+//
+// \param part The index of the part of the triplet sequence.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+inline void TripletAssembler<Type,IT,SO>::scatter( size_t part )
+{
+   BLAZE_INTERNAL_ASSERT( part < parts_, "Invalid part index" );
+
+   const IT* const keys  ( keyIndices() );
+   const IT* const minors( minorIndices() );
+
+   const size_t begin( ( part     * size_ ) / parts_ );
+   const size_t end  ( ( (part+1) * size_ ) / parts_ );
+
+   size_t* const positions( &counts_[0] + part*keys_ );
+
+   for( size_t k=begin; k<end; ++k ) {
+      Element& element( buffer_[ positions[ keys[k] ]++ ] );
+      element.index_ = minors[k];
+      element.value_ = values_[k];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sorts the segments of the given range of keys and sums up duplicate entries.
+//
+// \param begin The index of the first key of the range.
+// \param end The index one past the last key of the range.
+// \return void
+//
+// Duplicate entries are summed up in the order of the triplet sequence. Sums that result in
+// zero are nevertheless kept as explicit elements.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+inline void TripletAssembler<Type,IT,SO>::compress( size_t begin, size_t end )
+{
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= keys_, "Invalid key range" );
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      if( nonzeros_[i] == 0UL ) continue;
+
+      Element* const first( &buffer_[0] + offsets_[i] );
+      Element* const last ( first + nonzeros_[i] );
+
+      sort( first, last );
+
+      Element* dst( first );
+
+      for( Element* src=first+1; src!=last; ++src ) {
+         if( src->index_ == dst->index_ )
+            dst->value_ += src->value_;
+         else
+            *(++dst) = *src;
+      }
+
+      nonzeros_[i] = static_cast<size_t>( dst - first ) + 1UL;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appends the elements of the given range of keys to the target matrix.
+//
+// \param A The target sparse matrix.
+// \param begin The index of the first key of the range.
+// \param end The index one past the last key of the range.
+// \return void
+//
+// The according rows/columns of the target matrix must be empty and provide sufficient capacity
+// for the elements determined by compress(). Since this function does not finalize the
+// rows/columns, disjoint ranges of keys can be appended concurrently in case the capacities
+// of all rows/columns have been reserved in advance.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT    // Type of the row and column indices
+        , bool SO >      // Storage order of the target matrix
+template< typename MT >  // Type of the target sparse matrix
+inline void TripletAssembler<Type,IT,SO>::append( MT& A, size_t begin, size_t end ) const
+{
+   BLAZE_INTERNAL_ASSERT( A.rows() == m_ && A.columns() == n_, "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= keys_, "Invalid key range" );
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      const Element* element( ( nonzeros_[i] > 0UL )?( &buffer_[0] + offsets_[i] ):( NULL ) );
+
+      for( size_t k=0UL; k<nonzeros_[i]; ++k, ++element ) {
+         if( SO )
+            A.append( element->index_, i, element->value_ );
+         else
+            A.append( i, element->index_, element->value_ );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial assembly of a sparse matrix from (row,column,value) triplets.
+// \ingroup sparse_matrix
+//
+// \param A The target sparse matrix.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param size The total number of triplets.
+// \return void
+//
+// This function assembles the given triplets into the empty target matrix by means of a single
+// TripletAssembler part. The target matrix reserves the exact number of non-zero elements before
+// the rows/columns are appended and finalized in order.
+*/
+template< typename MT      // Type of the target sparse matrix
+        , bool SO          // Storage order of the target sparse matrix
+        , typename IT      // Type of the row and column indices
+        , typename Type >  // Data type of the triplet values
+void tripletAssembly( SparseMatrix<MT,SO>& A, const IT* rows, const IT* columns,
+                      const Type* values, size_t size )
+{
+   BLAZE_INTERNAL_ASSERT( (~A).nonZeros() == 0UL, "Non-empty target matrix detected" );
+
+   const size_t keys( SO ? (~A).columns() : (~A).rows() );
+
+   TripletAssembler<Type,IT,SO> assembler( (~A).rows(), (~A).columns(), rows, columns, values, size, 1UL );
+
+   assembler.count( 0UL );
+   assembler.prefix();
+   assembler.scatter( 0UL );
+   assembler.compress( 0UL, keys );
+
+   const std::vector<size_t>& nonzeros( assembler.nonZeros() );
+
+   size_t total( 0UL );
+   for( size_t i=0UL; i<keys; ++i )
+      total += nonzeros[i];
+
+   (~A).reserve( total );
+
+   for( size_t i=0UL; i<keys; ++i ) {
+      assembler.append( ~A, i, i+1UL );
+      (~A).finalize( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,173 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/IsSIMDEnabled.h
+//  \brief Header file for the IsSIMDEnabled type trait class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_ISSIMDENABLED_H_
+#define _BLAZE_MATH_TYPETRAITS_ISSIMDENABLED_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/FalseType.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/TrueType.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the IsSIMDEnabled type trait.
+// \ingroup math_type_traits
+//
+// This auxiliary helper determines whether the given operation type \a OP provides a nested
+// \a SIMDEnabled class template that can be instantiated for the element type \a T.
+*/
+template< typename OP, typename T >
+struct HasSIMDEnabledHelper
+{
+ private:
+   //**********************************************************************************************
+   typedef char  Yes[1];
+   typedef char  No [2];
+
+   template< typename U >
+   static Yes& test( typename U::BLAZE_TEMPLATE SIMDEnabled<T>* );
+
+   template< typename U >
+   static No& test( ... );
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   enum { value = sizeof( test<OP>( 0 ) ) == sizeof( Yes ) };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the IsSIMDEnabled type trait.
+// \ingroup math_type_traits
+*/
+template< typename OP, typename T, bool HasSIMDEnabled >
+struct IsSIMDEnabledHelper
+{
+   //**********************************************************************************************
+   enum { value = 0 };
+   typedef FalseType  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsSIMDEnabledHelper class template for operations with a nested
+//        \a SIMDEnabled class template.
+// \ingroup math_type_traits
+*/
+template< typename OP, typename T >
+struct IsSIMDEnabledHelper<OP,T,true>
+{
+   //**********************************************************************************************
+   enum { value = OP::BLAZE_TEMPLATE SIMDEnabled<T>::value };
+   typedef typename SelectType<value,TrueType,FalseType>::Type  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compile time check whether the given operation provides a SIMD implementation.
+// \ingroup math_type_traits
+//
+// This type trait tests whether or not the given operation type \a OP can be evaluated by means
+// of intrinsic operations for elements of type \a T. In order to qualify as SIMD enabled, the
+// operation has to provide a nested class template \a SIMDEnabled, whose \a value member
+// enumeration evaluates to 1 for the given element type, and a corresponding \a load() member
+// function accepting intrinsic operands:
+
+   \code
+   struct Square
+   {
+      template< typename T >
+      struct SIMDEnabled { enum { value = IntrinsicTrait<T>::multiplication }; };
+
+      template< typename T >
+      T operator()( const T& a ) const { return a * a; }
+
+      template< typename T >
+      T load( const T& a ) const { return a * a; }
+   };
+
+   blaze::IsSIMDEnabled< Square, double >::value  // Evaluates to 1 (in case of SSE2 support)
+   blaze::IsSIMDEnabled< Square, int >::Type      // Results in TrueType (in case of SSE2 support)
+   blaze::IsSIMDEnabled< Square, bool >           // Is derived from FalseType
+   \endcode
+
+// Operations without a nested \a SIMDEnabled class template (as for instance plain function
+// objects or lambdas) are never considered to be SIMD enabled. In case the given operation is
+// SIMD enabled, the \a value member enumeration is set to 1, the nested type definition \a Type
+// is \a TrueType, and the class derives from \a TrueType. Otherwise \a value is set to 0, \a Type
+// is \a FalseType, and the class derives from \a FalseType.
+*/
+template< typename OP, typename T >
+struct IsSIMDEnabled : public IsSIMDEnabledHelper<OP,T,HasSIMDEnabledHelper<OP,T>::value>::Type
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   enum { value = IsSIMDEnabledHelper<OP,T,HasSIMDEnabledHelper<OP,T>::value>::value };
+   typedef typename IsSIMDEnabledHelper<OP,T,HasSIMDEnabledHelper<OP,T>::value>::Type  Type;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,7 +45,9 @@
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsMatAbsExpr.h>
 #include <blaze/math/typetraits/IsMatEvalExpr.h>
+#include <blaze/math/typetraits/IsMatMapExpr.h>
 #include <blaze/math/typetraits/IsMatMatAddExpr.h>
+#include <blaze/math/typetraits/IsMatMatMapExpr.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsMatMatSubExpr.h>
 #include <blaze/math/typetraits/IsMatScalarDivExpr.h>
@@ -335,6 +337,60 @@ inline typename EnableIf< IsMatAbsExpr<MT>, typename ColumnExprTrait<MT>::Type >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific column of the given matrix map operation.
+// \ingroup views
+//
+// \param matrix The constant matrix map operation.
+// \param index The index of the column.
+// \return View on the specified column of the map operation.
+//
+// This function returns an expression representing the specified column of the given matrix map
+// operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline typename EnableIf< IsMatMapExpr<MT>, typename ColumnExprTrait<MT>::Type >::Type
+   column( const Matrix<MT,SO>& matrix, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename ColumnExprTrait<MT>::Type  ReturnType;
+   return ReturnType( column( (~matrix).operand(), index ), (~matrix).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific column of the given matrix/matrix map operation.
+// \ingroup views
+//
+// \param matrix The constant matrix/matrix map operation.
+// \param index The index of the column.
+// \return View on the specified column of the map operation.
+//
+// This function returns an expression representing the specified column of the given
+// matrix/matrix map operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline typename EnableIf< IsMatMatMapExpr<MT>, typename ColumnExprTrait<MT>::Type >::Type
+   column( const Matrix<MT,SO>& matrix, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename ColumnExprTrait<MT>::Type  ReturnType;
+   return ReturnType( column( (~matrix).leftOperand() , index )
+                    , column( (~matrix).rightOperand(), index )
+                    , (~matrix).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Creating a view on a specific column of the given matrix evaluation operation.
@@ -81,7 +81,6 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
-#include <blaze/util/AlignedArray.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Pointer.h>
 #include <blaze/util/constraints/Reference.h>
@@ -691,12 +690,7 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
             return iterator_.loadu();
          }
          else {
-            AlignedArray<ElementType,IT::size> array;
-            for( size_t j=0UL; j<rest_; ++j )
-               array[j] = *(iterator_+j);
-            for( size_t j=rest_; j<IT::size; ++j )
-               array[j] = ElementType();
-            return blaze::load( array.data() );
+            return maskload( &*iterator_, rest_ );
          }
       }
       //*******************************************************************************************
@@ -2964,8 +2958,6 @@ template< typename MT  // Type of the dense matrix
 inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
    DenseSubmatrix<MT,AF,SO>::loadu( size_t i, size_t j ) const
 {
-   using blaze::load;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -2979,12 +2971,7 @@ inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
       return matrix_.loadu( row_+i, column_+j );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      for( size_t k=0UL; k<rest_; ++k )
-         array[k] = matrix_(row_+i,column_+j+k);
-      for( size_t k=rest_; k<IT::size; ++k )
-         array[k] = ElementType();
-      return load( array.data() );
+      return maskload( data()+i*spacing()+j, rest_ );
    }
 }
 //*************************************************************************************************
@@ -3037,8 +3024,6 @@ template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
 inline void DenseSubmatrix<MT,AF,SO>::storeu( size_t i, size_t j, const IntrinsicType& value )
 {
-   using blaze::store;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -3052,10 +3037,7 @@ inline void DenseSubmatrix<MT,AF,SO>::storeu( size_t i, size_t j, const Intrinsi
       matrix_.storeu( row_+i, column_+j, value );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      store( array.data(), value );
-      for( size_t k=0UL; k<rest_; ++k )
-         matrix_(row_+i,column_+j+k) = array[k];
+      maskstore( data()+i*spacing()+j, rest_, value );
    }
 }
 //*************************************************************************************************
@@ -3892,12 +3874,7 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
             return iterator_.loadu();
          }
          else {
-            AlignedArray<ElementType,IT::size> array;
-            for( size_t i=0UL; i<rest_; ++i )
-               array[i] = *(iterator_+i);
-            for( size_t i=rest_; i<IT::size; ++i )
-               array[i] = ElementType();
-            return blaze::load( array.data() );
+            return maskload( &*iterator_, rest_ );
          }
       }
       //*******************************************************************************************
@@ -6113,8 +6090,6 @@ template< typename MT >  // Type of the dense matrix
 inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
    DenseSubmatrix<MT,unaligned,true>::loadu( size_t i, size_t j ) const
 {
-   using blaze::load;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -6128,12 +6103,7 @@ inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
       return matrix_.loadu( row_+i, column_+j );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      for( size_t k=0UL; k<rest_; ++k )
-         array[k] = matrix_(row_+i+k,column_+j);
-      for( size_t k=rest_; k<IT::size; ++k )
-         array[k] = ElementType();
-      return load( array.data() );
+      return maskload( data()+i+j*spacing(), rest_ );
    }
 }
 /*! \endcond */
@@ -6185,8 +6155,6 @@ inline void DenseSubmatrix<MT,unaligned,true>::store( size_t i, size_t j, const
 template< typename MT >  // Type of the dense matrix
 inline void DenseSubmatrix<MT,unaligned,true>::storeu( size_t i, size_t j, const IntrinsicType& value )
 {
-   using blaze::store;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -6200,10 +6168,7 @@ inline void DenseSubmatrix<MT,unaligned,true>::storeu( size_t i, size_t j, const
       matrix_.storeu( row_+i, column_+j, value );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      store( array.data(), value );
-      for( size_t k=0UL; k<rest_; ++k )
-         matrix_(row_+i+k,column_+j) = array[k];
+      maskstore( data()+i+j*spacing(), rest_, value );
    }
 }
 /*! \endcond */
@@ -69,7 +69,6 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
-#include <blaze/util/AlignedArray.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Vectorizable.h>
 #include <blaze/util/DisableIf.h>
@@ -605,12 +604,7 @@ class DenseSubvector : public DenseVector< DenseSubvector<VT,AF,TF>, TF >
             return iterator_.loadu();
          }
          else {
-            AlignedArray<ElementType,IT::size> array;
-            for( size_t i=0UL; i<rest_; ++i )
-               array[i] = *(iterator_+i);
-            for( size_t i=rest_; i<IT::size; ++i )
-               array[i] = ElementType();
-            return blaze::load( array.data() );
+            return maskload( &*iterator_, rest_ );
          }
       }
       //*******************************************************************************************
@@ -1791,8 +1785,6 @@ template< typename VT  // Type of the dense vector
 inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
    DenseSubvector<VT,AF,TF>::loadu( size_t index ) const
 {
-   using blaze::load;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( index < size()         , "Invalid subvector access index" );
@@ -1805,12 +1797,7 @@ inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
       return vector_.loadu( offset_+index );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      for( size_t i=0UL; i<rest_; ++i )
-         array[i] = vector_[offset_+index+i];
-      for( size_t i=rest_; i<IT::size; ++i )
-         array[i] = ElementType();
-      return load( array.data() );
+      return maskload( data()+index, rest_ );
    }
 }
 //*************************************************************************************************
@@ -1859,8 +1846,6 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 inline void DenseSubvector<VT,AF,TF>::storeu( size_t index, const IntrinsicType& value )
 {
-   using blaze::store;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( index < size()         , "Invalid subvector access index" );
@@ -1873,10 +1858,7 @@ inline void DenseSubvector<VT,AF,TF>::storeu( size_t index, const IntrinsicType&
       vector_.storeu( offset_+index, value );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      store( array.data(), value );
-      for( size_t i=0UL; i<rest_; ++i )
-         vector_[offset_+index+i] = array[i];
+      maskstore( data()+index, rest_, value );
    }
 }
 //*************************************************************************************************
@@ -45,7 +45,9 @@
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsMatAbsExpr.h>
 #include <blaze/math/typetraits/IsMatEvalExpr.h>
+#include <blaze/math/typetraits/IsMatMapExpr.h>
 #include <blaze/math/typetraits/IsMatMatAddExpr.h>
+#include <blaze/math/typetraits/IsMatMatMapExpr.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsMatMatSubExpr.h>
 #include <blaze/math/typetraits/IsMatScalarDivExpr.h>
@@ -334,6 +336,60 @@ inline typename EnableIf< IsMatAbsExpr<MT>, typename RowExprTrait<MT>::Type >::T
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific row of the given matrix map operation.
+// \ingroup views
+//
+// \param matrix The constant matrix map operation.
+// \param index The index of the row.
+// \return View on the specified row of the map operation.
+//
+// This function returns an expression representing the specified row of the given matrix map
+// operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline typename EnableIf< IsMatMapExpr<MT>, typename RowExprTrait<MT>::Type >::Type
+   row( const Matrix<MT,SO>& matrix, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename RowExprTrait<MT>::Type  ReturnType;
+   return ReturnType( row( (~matrix).operand(), index ), (~matrix).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific row of the given matrix/matrix map operation.
+// \ingroup views
+//
+// \param matrix The constant matrix/matrix map operation.
+// \param index The index of the row.
+// \return View on the specified row of the map operation.
+//
+// This function returns an expression representing the specified row of the given
+// matrix/matrix map operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline typename EnableIf< IsMatMatMapExpr<MT>, typename RowExprTrait<MT>::Type >::Type
+   row( const Matrix<MT,SO>& matrix, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename RowExprTrait<MT>::Type  ReturnType;
+   return ReturnType( row( (~matrix).leftOperand() , index )
+                    , row( (~matrix).rightOperand(), index )
+                    , (~matrix).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Creating a view on a specific row of the given matrix evaluation operation.
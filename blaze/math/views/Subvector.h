@@ -46,17 +46,20 @@
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsCrossExpr.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMatReduceExpr.h>
 #include <blaze/math/typetraits/IsMatVecMultExpr.h>
 #include <blaze/math/typetraits/IsTransExpr.h>
 #include <blaze/math/typetraits/IsTVecMatMultExpr.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/IsVecAbsExpr.h>
 #include <blaze/math/typetraits/IsVecEvalExpr.h>
+#include <blaze/math/typetraits/IsVecMapExpr.h>
 #include <blaze/math/typetraits/IsVecScalarDivExpr.h>
 #include <blaze/math/typetraits/IsVecScalarMultExpr.h>
 #include <blaze/math/typetraits/IsVecSerialExpr.h>
 #include <blaze/math/typetraits/IsVecTransExpr.h>
 #include <blaze/math/typetraits/IsVecVecAddExpr.h>
+#include <blaze/math/typetraits/IsVecVecMapExpr.h>
 #include <blaze/math/typetraits/IsVecVecMultExpr.h>
 #include <blaze/math/typetraits/IsVecVecSubExpr.h>
 #include <blaze/math/views/AlignmentFlag.h>
@@ -665,6 +668,121 @@ inline typename EnableIf< IsVecAbsExpr<VT>, typename SubvectorExprTrait<VT,AF>::
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given vector map operation.
+// \ingroup views
+//
+// \param vector The constant vector map operation.
+// \param index The index of the first element of the subvector.
+// \param size The size of the subvector.
+// \return View on the specified subvector of the map operation.
+//
+// This function returns an expression representing the specified subvector of the given vector
+// map operation.
+*/
+template< bool AF      // Alignment flag
+        , typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+inline typename EnableIf< IsVecMapExpr<VT>, typename SubvectorExprTrait<VT,AF>::Type >::Type
+   subvector( const Vector<VT,TF>& vector, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename SubvectorExprTrait<VT,AF>::Type  ReturnType;
+   return ReturnType( subvector<AF>( (~vector).operand(), index, size ), (~vector).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given vector/vector map operation.
+// \ingroup views
+//
+// \param vector The constant vector/vector map operation.
+// \param index The index of the first element of the subvector.
+// \param size The size of the subvector.
+// \return View on the specified subvector of the map operation.
+//
+// This function returns an expression representing the specified subvector of the given
+// vector/vector map operation.
+*/
+template< bool AF      // Alignment flag
+        , typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+inline typename EnableIf< IsVecVecMapExpr<VT>, typename SubvectorExprTrait<VT,AF>::Type >::Type
+   subvector( const Vector<VT,TF>& vector, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename SubvectorExprTrait<VT,AF>::Type  ReturnType;
+   return ReturnType( subvector<AF>( (~vector).leftOperand() , index, size )
+                    , subvector<AF>( (~vector).rightOperand(), index, size )
+                    , (~vector).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given row-wise matrix reduction.
+// \ingroup views
+//
+// \param vector The constant row-wise matrix reduction.
+// \param index The index of the first element of the subvector.
+// \param size The size of the subvector.
+// \return View on the specified subvector of the reduction operation.
+//
+// This function returns an expression representing the specified subvector of the given
+// row-wise matrix reduction, i.e. the reduction of the according rows of the matrix operand.
+*/
+template< bool AF        // Alignment flag
+        , typename VT >  // Type of the vector
+inline typename EnableIf< IsMatReduceExpr<VT>, typename SubvectorExprTrait<VT,AF>::Type >::Type
+   subvector( const Vector<VT,false>& vector, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename SubvectorExprTrait<VT,AF>::Type  ReturnType;
+   return ReturnType( submatrix<unaligned>( (~vector).operand(), index, 0UL, size, (~vector).operand().columns() )
+                    , (~vector).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given column-wise matrix reduction.
+// \ingroup views
+//
+// \param vector The constant column-wise matrix reduction.
+// \param index The index of the first element of the subvector.
+// \param size The size of the subvector.
+// \return View on the specified subvector of the reduction operation.
+//
+// This function returns an expression representing the specified subvector of the given
+// column-wise matrix reduction, i.e. the reduction of the according columns of the matrix
+// operand.
+*/
+template< bool AF        // Alignment flag
+        , typename VT >  // Type of the vector
+inline typename EnableIf< IsMatReduceExpr<VT>, typename SubvectorExprTrait<VT,AF>::Type >::Type
+   subvector( const Vector<VT,true>& vector, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename SubvectorExprTrait<VT,AF>::Type  ReturnType;
+   return ReturnType( submatrix<unaligned>( (~vector).operand(), 0UL, index, (~vector).operand().rows(), size )
+                    , (~vector).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Creating a view on a specific subvector of the given vector evaluation operation.
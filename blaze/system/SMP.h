@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 #include <blaze/config/SMP.h>
 
 
@@ -123,4 +125,101 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  NUMA MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the NUMA-aware shared-memory parallelization.
+// \ingroup system
+//
+// This compilation switch enables/disables the NUMA-aware mode of the shared-memory
+// parallelization. In case the \c BLAZE_USE_NUMA command line argument is specified during
+// compilation and one of the parallelizations is active, the Blaze library arranges the
+// parallel execution such that each thread works on memory that is local to its NUMA node:
+//
+//  - The tasks of a parallel operation are assigned statically to the threads, i.e. each thread
+//    always works on the same part of a vector or matrix of a given size.
+//  - Dense vectors and matrices of built-in data type are initialized in parallel with the
+//    same partitioning (first-touch initialization), such that the memory pages are placed on
+//    the NUMA node of the thread that works on them in subsequent operations.
+//
+// The static assignment only pays off in case the threads are pinned to fixed cores. For the
+// OpenMP-based parallelization this is achieved via the \c OMP_PROC_BIND and \c OMP_PLACES
+// environment variables, for the C++11 and Boost thread-based parallelizations via the
+// \c BLAZE_THREAD_AFFINITY environment variable or the setThreadAffinity() function.
+*/
+#if ( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE ) && \
+    defined(BLAZE_USE_NUMA)
+#define BLAZE_NUMA_MODE 1
+#else
+#define BLAZE_NUMA_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loop schedule of the OpenMP-based parallelization.
+// \ingroup system
+//
+// By default, the parts of a parallel operation are distributed dynamically among the OpenMP
+// threads. In NUMA mode, each thread is statically assigned the same part of every operation.
+*/
+#if BLAZE_NUMA_MODE
+#define BLAZE_OPENMP_SCHEDULE static
+#else
+#define BLAZE_OPENMP_SCHEDULE dynamic,1
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Storage class specifier for the per-thread state of the shared-memory parallelization.
+// \ingroup system
+//
+// In case of the C++11 and Boost thread-based parallelizations several threads can issue
+// parallel operations at the same time (see asyncAssign()). Therefore the activity flags of the
+// parallel and serial sections are stored per thread. For the OpenMP-based parallelization and
+// in case no parallelization is active, the flags are shared by all threads.
+*/
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#define BLAZE_SMP_THREAD_LOCAL thread_local
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE && defined(_MSC_VER)
+#define BLAZE_SMP_THREAD_LOCAL __declspec(thread)
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#define BLAZE_SMP_THREAD_LOCAL __thread
+#else
+#define BLAZE_SMP_THREAD_LOCAL
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::SMP_TASKS_PER_THREAD > 0UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
 #endif
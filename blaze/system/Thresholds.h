@@ -40,7 +40,37 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstdlib>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime-adjustable thresholds.
+// \ingroup system
+//
+// This compilation switch selects between the compile time and the runtime thresholds. By
+// default all thresholds are compile time constants as defined in the configuration file
+// <em>./blaze/config/Thresholds.h</em>. In case the \c BLAZE_USE_RUNTIME_THRESHOLDS command
+// line argument is specified during compilation, all thresholds are turned into modifiable
+// values, which are initialized with the values of the configuration file and which can be
+// adapted either programmatically or via environment variables (see RuntimeThresholds). Note
+// that all translation units of a program have to be compiled with the same setting.
+*/
+#if defined(BLAZE_USE_RUNTIME_THRESHOLDS)
+#define BLAZE_RUNTIME_THRESHOLDS_MODE 1
+#else
+#define BLAZE_RUNTIME_THRESHOLDS_MODE 0
+#endif
+//*************************************************************************************************
 
 
 
@@ -51,7 +81,377 @@
 //
 //=================================================================================================
 
+#if BLAZE_RUNTIME_THRESHOLDS_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The default values of all thresholds as given in the configuration file.
+// \ingroup system
+*/
+namespace blaze { namespace defaults {
 #include <blaze/config/Thresholds.h>
+} }
+/*! \endcond */
+//*************************************************************************************************
+
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!\brief Table of the runtime-adjustable thresholds.
+// \ingroup system
+//
+// The RuntimeThresholds class holds the thresholds of the Blaze library in case the runtime
+// thresholds are activated via the \c BLAZE_USE_RUNTIME_THRESHOLDS command line argument. All
+// thresholds are initialized with the values from the configuration file
+// <em>./blaze/config/Thresholds.h</em>. At program start each threshold can be overridden by
+// an environment variable of the same name with a \c BLAZE_ prefix:
+
+   \code
+   export BLAZE_SMP_DVECASSIGN_THRESHOLD=50000
+   export BLAZE_DMATDMATMULT_THRESHOLD=6400
+   \endcode
+
+// Values that cannot be interpreted as non-negative integral numbers are ignored, as is a value
+// of 0 for any of the BLAS thresholds. Additionally, all thresholds can be adapted at runtime
+// by assigning a new value to the according variable:
+
+   \code
+   blaze::SMP_DVECASSIGN_THRESHOLD = 50000UL;
+   \endcode
+
+// Note that the thresholds must not be changed while a computation is in progress.
+*/
+template< typename T = void >
+struct RuntimeThresholds
+{
+   //**Thresholds**********************************************************************************
+   static size_t DMATDVECMULT_THRESHOLD;
+   static size_t TDMATDVECMULT_THRESHOLD;
+   static size_t TDVECDMATMULT_THRESHOLD;
+   static size_t TDVECTDMATMULT_THRESHOLD;
+   static size_t DMATDMATMULT_THRESHOLD;
+   static size_t DMATTDMATMULT_THRESHOLD;
+   static size_t TDMATDMATMULT_THRESHOLD;
+   static size_t TDMATTDMATMULT_THRESHOLD;
+   static size_t SMP_DVECASSIGN_THRESHOLD;
+   static size_t SMP_DVECDVECADD_THRESHOLD;
+   static size_t SMP_DVECDVECSUB_THRESHOLD;
+   static size_t SMP_DVECDVECMULT_THRESHOLD;
+   static size_t SMP_DVECSCALARMULT_THRESHOLD;
+   static size_t SMP_DVECREDUCE_THRESHOLD;
+   static size_t SMP_DMATDVECMULT_THRESHOLD;
+   static size_t SMP_TDMATDVECMULT_THRESHOLD;
+   static size_t SMP_TDVECDMATMULT_THRESHOLD;
+   static size_t SMP_TDVECTDMATMULT_THRESHOLD;
+   static size_t SMP_DMATSVECMULT_THRESHOLD;
+   static size_t SMP_TDMATSVECMULT_THRESHOLD;
+   static size_t SMP_TSVECDMATMULT_THRESHOLD;
+   static size_t SMP_TSVECTDMATMULT_THRESHOLD;
+   static size_t SMP_SMATDVECMULT_THRESHOLD;
+   static size_t SMP_TSMATDVECMULT_THRESHOLD;
+   static size_t SMP_TDVECSMATMULT_THRESHOLD;
+   static size_t SMP_TDVECTSMATMULT_THRESHOLD;
+   static size_t SMP_SMATSVECMULT_THRESHOLD;
+   static size_t SMP_TSMATSVECMULT_THRESHOLD;
+   static size_t SMP_TSVECSMATMULT_THRESHOLD;
+   static size_t SMP_TSVECTSMATMULT_THRESHOLD;
+   static size_t SMP_DMATASSIGN_THRESHOLD;
+   static size_t SMP_DMATDMATADD_THRESHOLD;
+   static size_t SMP_DMATTDMATADD_THRESHOLD;
+   static size_t SMP_DMATDMATSUB_THRESHOLD;
+   static size_t SMP_DMATTDMATSUB_THRESHOLD;
+   static size_t SMP_DMATSCALARMULT_THRESHOLD;
+   static size_t SMP_DMATREDUCE_THRESHOLD;
+   static size_t SMP_DMATDMATMULT_THRESHOLD;
+   static size_t SMP_DMATTDMATMULT_THRESHOLD;
+   static size_t SMP_TDMATDMATMULT_THRESHOLD;
+   static size_t SMP_TDMATTDMATMULT_THRESHOLD;
+   static size_t SMP_DMATSMATMULT_THRESHOLD;
+   static size_t SMP_DMATTSMATMULT_THRESHOLD;
+   static size_t SMP_TDMATSMATMULT_THRESHOLD;
+   static size_t SMP_TDMATTSMATMULT_THRESHOLD;
+   static size_t SMP_SMATDMATMULT_THRESHOLD;
+   static size_t SMP_SMATTDMATMULT_THRESHOLD;
+   static size_t SMP_TSMATDMATMULT_THRESHOLD;
+   static size_t SMP_TSMATTDMATMULT_THRESHOLD;
+   static size_t SMP_SMATSMATMULT_THRESHOLD;
+   static size_t SMP_SMATTSMATMULT_THRESHOLD;
+   static size_t SMP_TSMATSMATMULT_THRESHOLD;
+   static size_t SMP_TSMATTSMATMULT_THRESHOLD;
+   static size_t SMP_DVECTDVECMULT_THRESHOLD;
+   static size_t SMP_TRIPLETASSEMBLY_THRESHOLD;
+   static size_t SMP_PGS_THRESHOLD;
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   static bool load();
+   static void load( const char* name, size_t& threshold, size_t minimum );
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T > size_t RuntimeThresholds<T>::DMATDVECMULT_THRESHOLD       = defaults::blaze::DMATDVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::TDMATDVECMULT_THRESHOLD      = defaults::blaze::TDMATDVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::TDVECDMATMULT_THRESHOLD      = defaults::blaze::TDVECDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::TDVECTDMATMULT_THRESHOLD     = defaults::blaze::TDVECTDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::DMATDMATMULT_THRESHOLD       = defaults::blaze::DMATDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::DMATTDMATMULT_THRESHOLD      = defaults::blaze::DMATTDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::TDMATDMATMULT_THRESHOLD      = defaults::blaze::TDMATDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::TDMATTDMATMULT_THRESHOLD     = defaults::blaze::TDMATTDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DVECASSIGN_THRESHOLD     = defaults::blaze::SMP_DVECASSIGN_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DVECDVECADD_THRESHOLD    = defaults::blaze::SMP_DVECDVECADD_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DVECDVECSUB_THRESHOLD    = defaults::blaze::SMP_DVECDVECSUB_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DVECDVECMULT_THRESHOLD   = defaults::blaze::SMP_DVECDVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DVECSCALARMULT_THRESHOLD = defaults::blaze::SMP_DVECSCALARMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DVECREDUCE_THRESHOLD     = defaults::blaze::SMP_DVECREDUCE_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATDVECMULT_THRESHOLD   = defaults::blaze::SMP_DMATDVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TDMATDVECMULT_THRESHOLD  = defaults::blaze::SMP_TDMATDVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TDVECDMATMULT_THRESHOLD  = defaults::blaze::SMP_TDVECDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TDVECTDMATMULT_THRESHOLD = defaults::blaze::SMP_TDVECTDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATSVECMULT_THRESHOLD   = defaults::blaze::SMP_DMATSVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TDMATSVECMULT_THRESHOLD  = defaults::blaze::SMP_TDMATSVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TSVECDMATMULT_THRESHOLD  = defaults::blaze::SMP_TSVECDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TSVECTDMATMULT_THRESHOLD = defaults::blaze::SMP_TSVECTDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_SMATDVECMULT_THRESHOLD   = defaults::blaze::SMP_SMATDVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TSMATDVECMULT_THRESHOLD  = defaults::blaze::SMP_TSMATDVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TDVECSMATMULT_THRESHOLD  = defaults::blaze::SMP_TDVECSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TDVECTSMATMULT_THRESHOLD = defaults::blaze::SMP_TDVECTSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_SMATSVECMULT_THRESHOLD   = defaults::blaze::SMP_SMATSVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TSMATSVECMULT_THRESHOLD  = defaults::blaze::SMP_TSMATSVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TSVECSMATMULT_THRESHOLD  = defaults::blaze::SMP_TSVECSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TSVECTSMATMULT_THRESHOLD = defaults::blaze::SMP_TSVECTSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATASSIGN_THRESHOLD     = defaults::blaze::SMP_DMATASSIGN_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATDMATADD_THRESHOLD    = defaults::blaze::SMP_DMATDMATADD_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATTDMATADD_THRESHOLD   = defaults::blaze::SMP_DMATTDMATADD_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATDMATSUB_THRESHOLD    = defaults::blaze::SMP_DMATDMATSUB_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATTDMATSUB_THRESHOLD   = defaults::blaze::SMP_DMATTDMATSUB_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATSCALARMULT_THRESHOLD = defaults::blaze::SMP_DMATSCALARMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATREDUCE_THRESHOLD     = defaults::blaze::SMP_DMATREDUCE_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATDMATMULT_THRESHOLD   = defaults::blaze::SMP_DMATDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATTDMATMULT_THRESHOLD  = defaults::blaze::SMP_DMATTDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TDMATDMATMULT_THRESHOLD  = defaults::blaze::SMP_TDMATDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TDMATTDMATMULT_THRESHOLD = defaults::blaze::SMP_TDMATTDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATSMATMULT_THRESHOLD   = defaults::blaze::SMP_DMATSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DMATTSMATMULT_THRESHOLD  = defaults::blaze::SMP_DMATTSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TDMATSMATMULT_THRESHOLD  = defaults::blaze::SMP_TDMATSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TDMATTSMATMULT_THRESHOLD = defaults::blaze::SMP_TDMATTSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_SMATDMATMULT_THRESHOLD   = defaults::blaze::SMP_SMATDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_SMATTDMATMULT_THRESHOLD  = defaults::blaze::SMP_SMATTDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TSMATDMATMULT_THRESHOLD  = defaults::blaze::SMP_TSMATDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TSMATTDMATMULT_THRESHOLD = defaults::blaze::SMP_TSMATTDMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_SMATSMATMULT_THRESHOLD   = defaults::blaze::SMP_SMATSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_SMATTSMATMULT_THRESHOLD  = defaults::blaze::SMP_SMATTSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TSMATSMATMULT_THRESHOLD  = defaults::blaze::SMP_TSMATSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TSMATTSMATMULT_THRESHOLD = defaults::blaze::SMP_TSMATTSMATMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_DVECTDVECMULT_THRESHOLD  = defaults::blaze::SMP_DVECTDVECMULT_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_TRIPLETASSEMBLY_THRESHOLD = defaults::blaze::SMP_TRIPLETASSEMBLY_THRESHOLD;
+template< typename T > size_t RuntimeThresholds<T>::SMP_PGS_THRESHOLD             = defaults::blaze::SMP_PGS_THRESHOLD;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Overrides the thresholds by the values of the according environment variables.
+//
+// \return \a true after the environment has been evaluated.
+//
+// This function is called once during the static initialization of the program. Each threshold
+// is overridden by the value of the according environment variable (for instance the variable
+// \c BLAZE_SMP_DVECASSIGN_THRESHOLD for the \a SMP_DVECASSIGN_THRESHOLD), if it is set.
+*/
+template< typename T >
+bool RuntimeThresholds<T>::load()
+{
+   static bool loaded( false );
+
+   if( loaded )
+      return true;
+
+   load( "BLAZE_DMATDVECMULT_THRESHOLD",       DMATDVECMULT_THRESHOLD      , 1UL );
+   load( "BLAZE_TDMATDVECMULT_THRESHOLD",      TDMATDVECMULT_THRESHOLD     , 1UL );
+   load( "BLAZE_TDVECDMATMULT_THRESHOLD",      TDVECDMATMULT_THRESHOLD     , 1UL );
+   load( "BLAZE_TDVECTDMATMULT_THRESHOLD",     TDVECTDMATMULT_THRESHOLD    , 1UL );
+   load( "BLAZE_DMATDMATMULT_THRESHOLD",       DMATDMATMULT_THRESHOLD      , 1UL );
+   load( "BLAZE_DMATTDMATMULT_THRESHOLD",      DMATTDMATMULT_THRESHOLD     , 1UL );
+   load( "BLAZE_TDMATDMATMULT_THRESHOLD",      TDMATDMATMULT_THRESHOLD     , 1UL );
+   load( "BLAZE_TDMATTDMATMULT_THRESHOLD",     TDMATTDMATMULT_THRESHOLD    , 1UL );
+   load( "BLAZE_SMP_DVECASSIGN_THRESHOLD",     SMP_DVECASSIGN_THRESHOLD    , 0UL );
+   load( "BLAZE_SMP_DVECDVECADD_THRESHOLD",    SMP_DVECDVECADD_THRESHOLD   , 0UL );
+   load( "BLAZE_SMP_DVECDVECSUB_THRESHOLD",    SMP_DVECDVECSUB_THRESHOLD   , 0UL );
+   load( "BLAZE_SMP_DVECDVECMULT_THRESHOLD",   SMP_DVECDVECMULT_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_DVECSCALARMULT_THRESHOLD", SMP_DVECSCALARMULT_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_DVECREDUCE_THRESHOLD",     SMP_DVECREDUCE_THRESHOLD    , 0UL );
+   load( "BLAZE_SMP_DMATDVECMULT_THRESHOLD",   SMP_DMATDVECMULT_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_TDMATDVECMULT_THRESHOLD",  SMP_TDMATDVECMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TDVECDMATMULT_THRESHOLD",  SMP_TDVECDMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TDVECTDMATMULT_THRESHOLD", SMP_TDVECTDMATMULT_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_DMATSVECMULT_THRESHOLD",   SMP_DMATSVECMULT_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_TDMATSVECMULT_THRESHOLD",  SMP_TDMATSVECMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TSVECDMATMULT_THRESHOLD",  SMP_TSVECDMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TSVECTDMATMULT_THRESHOLD", SMP_TSVECTDMATMULT_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_SMATDVECMULT_THRESHOLD",   SMP_SMATDVECMULT_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_TSMATDVECMULT_THRESHOLD",  SMP_TSMATDVECMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TDVECSMATMULT_THRESHOLD",  SMP_TDVECSMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TDVECTSMATMULT_THRESHOLD", SMP_TDVECTSMATMULT_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_SMATSVECMULT_THRESHOLD",   SMP_SMATSVECMULT_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_TSMATSVECMULT_THRESHOLD",  SMP_TSMATSVECMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TSVECSMATMULT_THRESHOLD",  SMP_TSVECSMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TSVECTSMATMULT_THRESHOLD", SMP_TSVECTSMATMULT_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_DMATASSIGN_THRESHOLD",     SMP_DMATASSIGN_THRESHOLD    , 0UL );
+   load( "BLAZE_SMP_DMATDMATADD_THRESHOLD",    SMP_DMATDMATADD_THRESHOLD   , 0UL );
+   load( "BLAZE_SMP_DMATTDMATADD_THRESHOLD",   SMP_DMATTDMATADD_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_DMATDMATSUB_THRESHOLD",    SMP_DMATDMATSUB_THRESHOLD   , 0UL );
+   load( "BLAZE_SMP_DMATTDMATSUB_THRESHOLD",   SMP_DMATTDMATSUB_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_DMATSCALARMULT_THRESHOLD", SMP_DMATSCALARMULT_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_DMATREDUCE_THRESHOLD",     SMP_DMATREDUCE_THRESHOLD    , 0UL );
+   load( "BLAZE_SMP_DMATDMATMULT_THRESHOLD",   SMP_DMATDMATMULT_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_DMATTDMATMULT_THRESHOLD",  SMP_DMATTDMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TDMATDMATMULT_THRESHOLD",  SMP_TDMATDMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TDMATTDMATMULT_THRESHOLD", SMP_TDMATTDMATMULT_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_DMATSMATMULT_THRESHOLD",   SMP_DMATSMATMULT_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_DMATTSMATMULT_THRESHOLD",  SMP_DMATTSMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TDMATSMATMULT_THRESHOLD",  SMP_TDMATSMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TDMATTSMATMULT_THRESHOLD", SMP_TDMATTSMATMULT_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_SMATDMATMULT_THRESHOLD",   SMP_SMATDMATMULT_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_SMATTDMATMULT_THRESHOLD",  SMP_SMATTDMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TSMATDMATMULT_THRESHOLD",  SMP_TSMATDMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TSMATTDMATMULT_THRESHOLD", SMP_TSMATTDMATMULT_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_SMATSMATMULT_THRESHOLD",   SMP_SMATSMATMULT_THRESHOLD  , 0UL );
+   load( "BLAZE_SMP_SMATTSMATMULT_THRESHOLD",  SMP_SMATTSMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TSMATSMATMULT_THRESHOLD",  SMP_TSMATSMATMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TSMATTSMATMULT_THRESHOLD", SMP_TSMATTSMATMULT_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_DVECTDVECMULT_THRESHOLD",  SMP_DVECTDVECMULT_THRESHOLD , 0UL );
+   load( "BLAZE_SMP_TRIPLETASSEMBLY_THRESHOLD", SMP_TRIPLETASSEMBLY_THRESHOLD, 0UL );
+   load( "BLAZE_SMP_PGS_THRESHOLD", SMP_PGS_THRESHOLD, 0UL );
+
+   loaded = true;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Overrides a single threshold by the value of the given environment variable.
+//
+// \param name The name of the environment variable.
+// \param threshold The threshold to be overridden.
+// \param minimum The minimum valid value of the threshold.
+// \return void
+//
+// In case the environment variable is not set, does not represent an integral number, or the
+// given value is smaller than \a minimum, the threshold remains unchanged.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename T >
+void RuntimeThresholds<T>::load( const char* name, size_t& threshold, size_t minimum )
+{
+   const char* env = std::getenv( name );
+
+   if( env == NULL || *env < '0' || *env > '9' )
+      return;
+
+   char* end( NULL );
+   const unsigned long value( std::strtoul( env, &end, 10 ) );
+
+   if( *end == '\0' && value >= minimum )
+      threshold = static_cast<size_t>( value );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLD VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+size_t& DMATDVECMULT_THRESHOLD       = RuntimeThresholds<>::DMATDVECMULT_THRESHOLD;
+size_t& TDMATDVECMULT_THRESHOLD      = RuntimeThresholds<>::TDMATDVECMULT_THRESHOLD;
+size_t& TDVECDMATMULT_THRESHOLD      = RuntimeThresholds<>::TDVECDMATMULT_THRESHOLD;
+size_t& TDVECTDMATMULT_THRESHOLD     = RuntimeThresholds<>::TDVECTDMATMULT_THRESHOLD;
+size_t& DMATDMATMULT_THRESHOLD       = RuntimeThresholds<>::DMATDMATMULT_THRESHOLD;
+size_t& DMATTDMATMULT_THRESHOLD      = RuntimeThresholds<>::DMATTDMATMULT_THRESHOLD;
+size_t& TDMATDMATMULT_THRESHOLD      = RuntimeThresholds<>::TDMATDMATMULT_THRESHOLD;
+size_t& TDMATTDMATMULT_THRESHOLD     = RuntimeThresholds<>::TDMATTDMATMULT_THRESHOLD;
+size_t& SMP_DVECASSIGN_THRESHOLD     = RuntimeThresholds<>::SMP_DVECASSIGN_THRESHOLD;
+size_t& SMP_DVECDVECADD_THRESHOLD    = RuntimeThresholds<>::SMP_DVECDVECADD_THRESHOLD;
+size_t& SMP_DVECDVECSUB_THRESHOLD    = RuntimeThresholds<>::SMP_DVECDVECSUB_THRESHOLD;
+size_t& SMP_DVECDVECMULT_THRESHOLD   = RuntimeThresholds<>::SMP_DVECDVECMULT_THRESHOLD;
+size_t& SMP_DVECSCALARMULT_THRESHOLD = RuntimeThresholds<>::SMP_DVECSCALARMULT_THRESHOLD;
+size_t& SMP_DVECREDUCE_THRESHOLD     = RuntimeThresholds<>::SMP_DVECREDUCE_THRESHOLD;
+size_t& SMP_DMATDVECMULT_THRESHOLD   = RuntimeThresholds<>::SMP_DMATDVECMULT_THRESHOLD;
+size_t& SMP_TDMATDVECMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TDMATDVECMULT_THRESHOLD;
+size_t& SMP_TDVECDMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TDVECDMATMULT_THRESHOLD;
+size_t& SMP_TDVECTDMATMULT_THRESHOLD = RuntimeThresholds<>::SMP_TDVECTDMATMULT_THRESHOLD;
+size_t& SMP_DMATSVECMULT_THRESHOLD   = RuntimeThresholds<>::SMP_DMATSVECMULT_THRESHOLD;
+size_t& SMP_TDMATSVECMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TDMATSVECMULT_THRESHOLD;
+size_t& SMP_TSVECDMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TSVECDMATMULT_THRESHOLD;
+size_t& SMP_TSVECTDMATMULT_THRESHOLD = RuntimeThresholds<>::SMP_TSVECTDMATMULT_THRESHOLD;
+size_t& SMP_SMATDVECMULT_THRESHOLD   = RuntimeThresholds<>::SMP_SMATDVECMULT_THRESHOLD;
+size_t& SMP_TSMATDVECMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TSMATDVECMULT_THRESHOLD;
+size_t& SMP_TDVECSMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TDVECSMATMULT_THRESHOLD;
+size_t& SMP_TDVECTSMATMULT_THRESHOLD = RuntimeThresholds<>::SMP_TDVECTSMATMULT_THRESHOLD;
+size_t& SMP_SMATSVECMULT_THRESHOLD   = RuntimeThresholds<>::SMP_SMATSVECMULT_THRESHOLD;
+size_t& SMP_TSMATSVECMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TSMATSVECMULT_THRESHOLD;
+size_t& SMP_TSVECSMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TSVECSMATMULT_THRESHOLD;
+size_t& SMP_TSVECTSMATMULT_THRESHOLD = RuntimeThresholds<>::SMP_TSVECTSMATMULT_THRESHOLD;
+size_t& SMP_DMATASSIGN_THRESHOLD     = RuntimeThresholds<>::SMP_DMATASSIGN_THRESHOLD;
+size_t& SMP_DMATDMATADD_THRESHOLD    = RuntimeThresholds<>::SMP_DMATDMATADD_THRESHOLD;
+size_t& SMP_DMATTDMATADD_THRESHOLD   = RuntimeThresholds<>::SMP_DMATTDMATADD_THRESHOLD;
+size_t& SMP_DMATDMATSUB_THRESHOLD    = RuntimeThresholds<>::SMP_DMATDMATSUB_THRESHOLD;
+size_t& SMP_DMATTDMATSUB_THRESHOLD   = RuntimeThresholds<>::SMP_DMATTDMATSUB_THRESHOLD;
+size_t& SMP_DMATSCALARMULT_THRESHOLD = RuntimeThresholds<>::SMP_DMATSCALARMULT_THRESHOLD;
+size_t& SMP_DMATREDUCE_THRESHOLD     = RuntimeThresholds<>::SMP_DMATREDUCE_THRESHOLD;
+size_t& SMP_DMATDMATMULT_THRESHOLD   = RuntimeThresholds<>::SMP_DMATDMATMULT_THRESHOLD;
+size_t& SMP_DMATTDMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_DMATTDMATMULT_THRESHOLD;
+size_t& SMP_TDMATDMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TDMATDMATMULT_THRESHOLD;
+size_t& SMP_TDMATTDMATMULT_THRESHOLD = RuntimeThresholds<>::SMP_TDMATTDMATMULT_THRESHOLD;
+size_t& SMP_DMATSMATMULT_THRESHOLD   = RuntimeThresholds<>::SMP_DMATSMATMULT_THRESHOLD;
+size_t& SMP_DMATTSMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_DMATTSMATMULT_THRESHOLD;
+size_t& SMP_TDMATSMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TDMATSMATMULT_THRESHOLD;
+size_t& SMP_TDMATTSMATMULT_THRESHOLD = RuntimeThresholds<>::SMP_TDMATTSMATMULT_THRESHOLD;
+size_t& SMP_SMATDMATMULT_THRESHOLD   = RuntimeThresholds<>::SMP_SMATDMATMULT_THRESHOLD;
+size_t& SMP_SMATTDMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_SMATTDMATMULT_THRESHOLD;
+size_t& SMP_TSMATDMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TSMATDMATMULT_THRESHOLD;
+size_t& SMP_TSMATTDMATMULT_THRESHOLD = RuntimeThresholds<>::SMP_TSMATTDMATMULT_THRESHOLD;
+size_t& SMP_SMATSMATMULT_THRESHOLD   = RuntimeThresholds<>::SMP_SMATSMATMULT_THRESHOLD;
+size_t& SMP_SMATTSMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_SMATTSMATMULT_THRESHOLD;
+size_t& SMP_TSMATSMATMULT_THRESHOLD  = RuntimeThresholds<>::SMP_TSMATSMATMULT_THRESHOLD;
+size_t& SMP_TSMATTSMATMULT_THRESHOLD = RuntimeThresholds<>::SMP_TSMATTSMATMULT_THRESHOLD;
+size_t& SMP_DVECTDVECMULT_THRESHOLD  = RuntimeThresholds<>::SMP_DVECTDVECMULT_THRESHOLD;
+size_t& SMP_TRIPLETASSEMBLY_THRESHOLD = RuntimeThresholds<>::SMP_TRIPLETASSEMBLY_THRESHOLD;
+size_t& SMP_PGS_THRESHOLD             = RuntimeThresholds<>::SMP_PGS_THRESHOLD;
+
+const bool thresholdsLoaded = RuntimeThresholds<>::load();
+
+} // namespace
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#else
+
+#include <blaze/config/Thresholds.h>
+
+#endif
 
 
 
@@ -64,63 +464,74 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_RUNTIME_THRESHOLDS_MODE
+#define BLAZE_THRESHOLD_DEFAULT( NAME ) blaze::defaults::blaze::NAME
+#else
+#define BLAZE_THRESHOLD_DEFAULT( NAME ) blaze::NAME
+#endif
+
 namespace {
 
-BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_THRESHOLD > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
-
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( DMATDVECMULT_THRESHOLD       ) > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( TDMATDVECMULT_THRESHOLD      ) > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( TDVECDMATMULT_THRESHOLD      ) > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( TDVECTDMATMULT_THRESHOLD     ) > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( DMATDMATMULT_THRESHOLD       ) > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( DMATTDMATMULT_THRESHOLD      ) > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( TDMATDMATMULT_THRESHOLD      ) > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( TDMATTDMATMULT_THRESHOLD     ) > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DVECASSIGN_THRESHOLD     ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DVECDVECADD_THRESHOLD    ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DVECDVECSUB_THRESHOLD    ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DVECDVECMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DVECSCALARMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DVECREDUCE_THRESHOLD     ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATDVECMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TDMATDVECMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TDVECDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TDVECTDMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATSVECMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TDMATSVECMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TSVECDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TSVECTDMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_SMATDVECMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TSMATDVECMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TDVECSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TDVECTSMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_SMATSVECMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TSMATSVECMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TSVECSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TSVECTSMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATASSIGN_THRESHOLD     ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATDMATADD_THRESHOLD    ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATTDMATADD_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATDMATSUB_THRESHOLD    ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATTDMATSUB_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATSCALARMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATREDUCE_THRESHOLD     ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATDMATMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATTDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TDMATDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TDMATTDMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATSMATMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DMATTSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TDMATSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TDMATTSMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_SMATDMATMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_SMATTDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TSMATDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TSMATTDMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_SMATSMATMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_SMATTSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TSMATSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TSMATTSMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_DVECTDVECMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_TRIPLETASSEMBLY_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_THRESHOLD_DEFAULT( SMP_PGS_THRESHOLD ) >= 0UL );
 
 }
+
+#undef BLAZE_THRESHOLD_DEFAULT
 /*! \endcond */
 //*************************************************************************************************
 
@@ -110,7 +110,7 @@
 
 //=================================================================================================
 //
-//  SSE/AVX/MIC MODE CONFIGURATION
+//  SSE/AVX/FMA/AVX-512/MIC MODE CONFIGURATION
 //
 //=================================================================================================
 
@@ -233,6 +233,60 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the FMA mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the FMA mode. In case the FMA mode is enabled
+// (i.e. in case FMA3 functionality is available) the Blaze library attempts to fuse the
+// multiplications and additions of the vectorized kernels (as for instance the kernels of
+// the dense matrix multiplications) into fused multiply-add operations. In case the FMA mode
+// is disabled, separate multiplication and addition operations are used.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__FMA__)
+#  define BLAZE_FMA_MODE 1
+#else
+#  define BLAZE_FMA_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512F mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512F mode. In case the AVX-512F mode is
+// enabled (i.e. in case AVX-512 foundation functionality is available) the Blaze library
+// attempts to vectorize the linear algebra operations on 32-bit and 64-bit data types by
+// 512-bit AVX-512 intrinsics. In case the AVX-512F mode is disabled, the Blaze library
+// chooses the AVX/AVX2 functionality for these operations.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512F__)
+#  define BLAZE_AVX512F_MODE 1
+#else
+#  define BLAZE_AVX512F_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512BW mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512BW mode. In case the AVX-512BW mode is
+// enabled (i.e. in case AVX-512 byte and word functionality is available) the Blaze library
+// attempts to vectorize the linear algebra operations on 8-bit and 16-bit integral data types
+// by 512-bit AVX-512 intrinsics. In case the AVX-512BW mode is disabled, the Blaze library
+// chooses the AVX2 functionality for these operations.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512BW__)
+#  define BLAZE_AVX512BW_MODE 1
+#else
+#  define BLAZE_AVX512BW_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -262,12 +316,15 @@
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( !BLAZE_SSE2_MODE  || BLAZE_SSE_MODE   );
-BLAZE_STATIC_ASSERT( !BLAZE_SSE3_MODE  || BLAZE_SSE2_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE || BLAZE_SSE3_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE  || BLAZE_SSSE3_MODE );
-BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE   || BLAZE_SSE4_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE2_MODE     || BLAZE_SSE_MODE     );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE3_MODE     || BLAZE_SSE2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE    || BLAZE_SSE3_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE     || BLAZE_SSSE3_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE      || BLAZE_SSE4_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE     || BLAZE_AVX_MODE     );
+BLAZE_STATIC_ASSERT( !BLAZE_FMA_MODE      || BLAZE_AVX_MODE     );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512F_MODE  || BLAZE_AVX2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512BW_MODE || BLAZE_AVX512F_MODE );
 
 }
 /*! \endcond */
@@ -282,7 +339,7 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 //
 //=================================================================================================
 
-#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE || BLAZE_FMA_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
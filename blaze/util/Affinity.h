@@ -0,0 +1,174 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Affinity.h
+//  \brief Header file for the thread affinity functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_AFFINITY_H_
+#define _BLAZE_UTIL_AFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#elif defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THREAD AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Thread affinity functions */
+//@{
+inline std::vector<size_t> parseCpuList( const std::string& list );
+inline bool pinThread( size_t cpu );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parsing a list of CPU numbers.
+// \ingroup util
+//
+// \param list The list of CPUs in the form "0-3,8,10-11".
+// \return The CPU numbers in the order of the list.
+// \exception std::invalid_argument Invalid CPU list.
+//
+// This function parses a comma-separated list of CPU numbers and CPU ranges, as it is used by
+// the Linux kernel (for instance in <em>/sys/devices/system/node/node0/cpulist</em>) and by the
+// \c BLAZE_THREAD_AFFINITY environment variable. Whitespace around the entries is ignored. In
+// case the list is malformed, a \a std::invalid_argument exception is thrown.
+
+   \code
+   std::vector<size_t> cpus( blaze::parseCpuList( "0-3,8" ) );  // Results in 0, 1, 2, 3, 8
+   \endcode
+*/
+inline std::vector<size_t> parseCpuList( const std::string& list )
+{
+   std::vector<size_t> cpus;
+
+   const char* pos( list.c_str() );
+
+   for( ;; )
+   {
+      while( std::isspace( *pos ) ) ++pos;
+
+      if( !std::isdigit( *pos ) )
+         throw std::invalid_argument( "Invalid CPU list" );
+
+      char* end( NULL );
+      const size_t first( std::strtoul( pos, &end, 10 ) );
+      size_t last( first );
+      pos = end;
+
+      if( *pos == '-' ) {
+         ++pos;
+         if( !std::isdigit( *pos ) )
+            throw std::invalid_argument( "Invalid CPU list" );
+         last = std::strtoul( pos, &end, 10 );
+         pos = end;
+         if( last < first )
+            throw std::invalid_argument( "Invalid CPU range" );
+      }
+
+      for( size_t cpu=first; cpu<=last; ++cpu )
+         cpus.push_back( cpu );
+
+      while( std::isspace( *pos ) ) ++pos;
+
+      if( *pos == '\0' )
+         break;
+      else if( *pos != ',' )
+         throw std::invalid_argument( "Invalid CPU list" );
+
+      ++pos;
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pinning the calling thread to the given CPU.
+// \ingroup util
+//
+// \param cpu The number of the CPU.
+// \return \a true if the thread has been pinned, \a false if not.
+//
+// This function restricts the execution of the calling thread to the given CPU. It is supported
+// on Linux and Windows systems. On all other systems, and in case the given CPU is not available,
+// the function has no effect and returns \a false.
+*/
+inline bool pinThread( size_t cpu )
+{
+#if defined(_MSC_VER)
+   if( cpu >= sizeof(DWORD_PTR)*8UL )
+      return false;
+   return SetThreadAffinityMask( GetCurrentThread(), DWORD_PTR(1) << cpu ) != 0;
+#elif defined(__linux__)
+   if( cpu >= CPU_SETSIZE )
+      return false;
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   CPU_SET( cpu, &set );
+   return pthread_setaffinity_np( pthread_self(), sizeof(cpu_set_t), &set ) == 0;
+#else
+   UNUSED_PARAMETER( cpu );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -138,12 +138,14 @@ inline void deallocate_backend( const void* address )
 // The allocate() function provides the functionality to allocate memory based on the alignment
 // restrictions of the given built-in data type. For instance, in case SSE vectorization is
 // possible, the returned memory is guaranteed to be at least 16-byte aligned. In case AVX is
-// active, the memory is even guaranteed to be at least 32-byte aligned.
+// active, the memory is even guaranteed to be at least 32-byte aligned, in case AVX-512 is
+// active at least 64-byte aligned.
 //
 // Examples:
 
    \code
-   // Guaranteed to be 16-byte aligned (32-byte aligned in case AVX is used)
+   // Guaranteed to be 16-byte aligned (32-byte aligned in case AVX is used,
+   // 64-byte aligned in case AVX-512 is used)
    double* dp = allocate<double>( 10UL );
    \endcode
 */
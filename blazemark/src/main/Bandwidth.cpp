@@ -0,0 +1,287 @@
+//=================================================================================================
+/*!
+//  \file src/main/Bandwidth.cpp
+//  \brief Source file for the NUMA memory bandwidth benchmark
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#ifndef BLAZE_USE_NUMA
+#  define BLAZE_USE_NUMA
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Affinity.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blazemark::element_t;
+using blaze::columnVector;
+using blaze::DynamicVector;
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Description of a single NUMA node.
+*/
+struct Node
+{
+   std::string         name;  //!< The name of the NUMA node.
+   std::vector<size_t> cpus;  //!< The CPUs of the NUMA node.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Detection of the NUMA nodes of the system.
+//
+// \return The list of NUMA nodes.
+//
+// The NUMA nodes are detected via the \c /sys/devices/system/node file system of the Linux
+// kernel. In case no NUMA information is available, a single node is assumed that comprises
+// the CPUs of the currently active threads.
+*/
+std::vector<Node> detectNodes()
+{
+   std::vector<Node> nodes;
+
+   for( size_t i=0UL; ; ++i )
+   {
+      std::ostringstream oss;
+      oss << "/sys/devices/system/node/node" << i << "/cpulist";
+
+      std::ifstream ifs( oss.str().c_str() );
+      std::string list;
+
+      if( !ifs || !std::getline( ifs, list ) )
+         break;
+
+      Node node;
+      std::ostringstream name;
+      name << "Node " << i;
+      node.name = name.str();
+
+      try {
+         node.cpus = blaze::parseCpuList( list );
+      }
+      catch( std::invalid_argument& ) {
+         continue;
+      }
+
+      if( !node.cpus.empty() )
+         nodes.push_back( node );
+   }
+
+   if( nodes.empty() ) {
+      Node node;
+      node.name = "Node 0";
+      for( size_t i=0UL; i<blaze::getNumThreads(); ++i )
+         node.cpus.push_back( i );
+      nodes.push_back( node );
+   }
+
+   return nodes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the memory bandwidth of the given CPUs.
+//
+// \param cpus The CPUs used for the measurement.
+// \param N The number of elements of each vector.
+// \return The memory bandwidth [GB/s].
+//
+// The threads of the shared-memory parallelization are pinned to the given CPUs. The vectors
+// are allocated and initialized afterwards, such that in NUMA mode their memory pages are
+// placed on the NUMA nodes of the given CPUs (first-touch initialization). The bandwidth is
+// determined by means of the STREAM triad \f$ \vec{a} = \vec{b} + s \cdot \vec{c} \f$, which
+// reads two and writes one vector.
+*/
+double measure( const std::vector<size_t>& cpus, size_t N )
+{
+   blaze::setNumThreads( cpus.size() );
+   blaze::setThreadAffinity( cpus );
+
+   DynamicVector<element_t,columnVector> a( N, element_t(0) ), b( N, element_t(1) ), c( N, element_t(2) );
+   const element_t s( 3 );
+   blaze::timing::WcTimer timer;
+
+   a = b + s * c;
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      a = b + s * c;
+      timer.end();
+   }
+
+   if( a[N-1UL] != element_t(7) ) {
+      std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+   }
+
+   return 3.0 * N * sizeof( element_t ) / timer.min() / 1E9;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prints the given list of CPUs.
+//
+// \param cpus The list of CPUs.
+// \return The list of CPUs in the form of a string.
+*/
+std::string print( const std::vector<size_t>& cpus )
+{
+   std::ostringstream oss;
+
+   for( size_t i=0UL; i<cpus.size(); ++i ) {
+      size_t j( i );
+      while( j+1UL < cpus.size() && cpus[j+1UL] == cpus[j]+1UL ) ++j;
+      if( i != 0UL ) oss << ",";
+      oss << cpus[i];
+      if( j != i ) oss << "-" << cpus[j];
+      i = j;
+   }
+
+   return oss.str();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the NUMA memory bandwidth benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The benchmark measures the memory bandwidth of each NUMA node of the system individually and
+// of all NUMA nodes in combination. In combination with the NUMA mode of the Blaze library (see
+// the \c BLAZE_USE_NUMA compilation switch) the combined bandwidth is expected to scale with
+// the number of NUMA nodes. The optional command line argument specifies the number of elements
+// of each vector, which should be chosen such that the vectors considerably exceed the size of
+// the last level cache.
+*/
+int main( int argc, char** argv )
+{
+   if( argc > 2 ) {
+      std::cerr << " Invalid use of program 'Bandwidth'!\n"
+                << "   Use: ./bandwidth [<number_of_elements>]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const size_t N( ( argc > 1 )?( std::strtoul( argv[1], NULL, 10 ) ):( 20000000UL ) );
+
+   if( N == 0UL ) {
+      std::cerr << " Invalid number of elements!\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   if( !BLAZE_NUMA_MODE ) {
+      std::cout << "\n No shared memory parallelization active: measuring a single thread\n";
+   }
+
+   const std::vector<Node> nodes( detectNodes() );
+   std::vector<size_t> all;
+
+   std::cout << "\n Memory bandwidth of the STREAM triad (N = " << N << "):\n";
+
+   for( size_t i=0UL; i<nodes.size(); ++i )
+   {
+      const double bandwidth( measure( nodes[i].cpus, N ) );
+
+      std::cout << "   " << std::left << std::setw( 10 ) << nodes[i].name
+                << std::setw( 20 ) << ( "(CPUs " + print( nodes[i].cpus ) + ")" )
+                << std::right << std::fixed << std::setprecision( 2 ) << std::setw( 10 )
+                << bandwidth << " GB/s\n";
+
+      all.insert( all.end(), nodes[i].cpus.begin(), nodes[i].cpus.end() );
+   }
+
+   if( nodes.size() > 1UL )
+   {
+      const double bandwidth( measure( all, N ) );
+
+      std::cout << "   " << std::left << std::setw( 30 ) << "All nodes"
+                << std::right << std::fixed << std::setprecision( 2 ) << std::setw( 10 )
+                << bandwidth << " GB/s\n";
+   }
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,315 @@
+//=================================================================================================
+/*!
+//  \file src/main/PCG.cpp
+//  \brief Source file for the preconditioned conjugate gradient benchmark
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/solvers/CG.h>
+#include <blaze/math/solvers/ICPreconditioner.h>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
+#include <blaze/math/solvers/SSORPreconditioner.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/system/Config.h>
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blaze::CG;
+using blaze::CMatMxN;
+using blaze::ICPreconditioner;
+using blaze::JacobiPreconditioner;
+using blaze::real;
+using blaze::SSORPreconditioner;
+using blaze::VecN;
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Result of a single solver run.
+*/
+struct Result
+{
+   size_t iterations;  //!< The number of CG iterations.
+   double setup;       //!< The minimum setup time of the preconditioner [s].
+   double solve;       //!< The minimum time of the solution process [s].
+   bool   converged;   //!< Convergence flag.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setup of the system matrix of the benchmark.
+//
+// \param N The number of rows and columns of the 2D discretized grid.
+// \return The system matrix.
+//
+// This function sets up the five-point stencil of the 2D Poisson problem on a \f$ N \times N \f$
+// grid. In order to create an ill-conditioned system, the rows and columns of the matrix are
+// symmetrically scaled by random factors in the range \f$ [1..100] \f$.
+*/
+CMatMxN setupMatrix( size_t N )
+{
+   const size_t NN( N*N );
+
+   std::vector<real> scale( NN );
+   for( size_t i=0UL; i<NN; ++i ) {
+      scale[i] = blaze::rand<real>( real(1), real(100) );
+   }
+
+   CMatMxN A( NN, NN, 5UL*NN );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         const size_t k( i*N+j );
+         if( i > 0UL   ) A.append( k, k-N  , -scale[k]*scale[k-N]   );  // Top neighbor
+         if( j > 0UL   ) A.append( k, k-1UL, -scale[k]*scale[k-1UL] );  // Left neighbor
+         A.append( k, k, 4.0*scale[k]*scale[k] );
+         if( j < N-1UL ) A.append( k, k+1UL, -scale[k]*scale[k+1UL] );  // Right neighbor
+         if( i < N-1UL ) A.append( k, k+N  , -scale[k]*scale[k+N]   );  // Bottom neighbor
+         A.finalize( k );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runs the preconditioned conjugate gradient method with the given preconditioner.
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param pc The preconditioner.
+// \return The result of the solver run.
+//
+// The setup of the preconditioner and the solution process are timed separately. Both are
+// repeated \a blazemark::reps times and the minimum runtimes are reported.
+*/
+template< typename PC >  // Type of the preconditioner
+Result run( const CMatMxN& A, const VecN& b, PC& pc )
+{
+   CG solver;
+   solver.setMaxIterations( 100000UL );
+   solver.setThreshold( 1E-8 );
+
+   VecN x;
+   blaze::timing::WcTimer setupTimer, solveTimer;
+   Result result;
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep )
+   {
+      setupTimer.start();
+      pc.setup( A );
+      setupTimer.end();
+
+      solveTimer.start();
+      result.converged = solver.solve( A, b, x, pc );
+      solveTimer.end();
+   }
+
+   result.iterations = solver.getLastIterations();
+   result.setup      = setupTimer.min();
+   result.solve      = solveTimer.min();
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runs the unpreconditioned conjugate gradient method.
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \return The result of the solver run.
+*/
+Result run( const CMatMxN& A, const VecN& b )
+{
+   CG solver;
+   solver.setMaxIterations( 100000UL );
+   solver.setThreshold( 1E-8 );
+
+   VecN x;
+   blaze::timing::WcTimer solveTimer;
+   Result result;
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep )
+   {
+      solveTimer.start();
+      result.converged = solver.solve( A, b, x );
+      solveTimer.end();
+   }
+
+   result.iterations = solver.getLastIterations();
+   result.setup      = 0.0;
+   result.solve      = solveTimer.min();
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prints the result of a single solver run.
+//
+// \param name The name of the preconditioner.
+// \param result The result of the solver run.
+// \return void
+*/
+void print( const std::string& name, const Result& result )
+{
+   std::cout << "     " << std::left << std::setw( 10 ) << name
+             << std::right << std::setw( 12 ) << result.iterations
+             << std::fixed << std::setprecision( 6 )
+             << std::setw( 14 ) << result.setup
+             << std::setw( 14 ) << result.solve
+             << std::setw( 14 ) << result.setup + result.solve;
+   if( !result.converged )
+      std::cout << "   (not converged)";
+   std::cout << "\n";
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the preconditioned conjugate gradient benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The benchmark compares the number of iterations and the time-to-solution of the conjugate
+// gradient solver of the Blaze library without preconditioning and with the Jacobi, the SSOR
+// and the incomplete Cholesky (IC(0)) preconditioner. The optional command line arguments
+// specify the sizes of the 2D discretized grids.
+*/
+int main( int argc, char** argv )
+{
+   std::vector<size_t> sizes;
+
+   for( int i=1; i<argc; ++i ) {
+      const size_t N( std::strtoul( argv[i], NULL, 10 ) );
+      if( N == 0UL ) {
+         std::cerr << " Invalid use of program 'PCG'!\n"
+                   << "   Use: ./pcg [<size> ...]\n" << std::endl;
+         return EXIT_FAILURE;
+      }
+      sizes.push_back( N );
+   }
+
+   if( sizes.empty() ) {
+      sizes.push_back(  50UL );
+      sizes.push_back( 100UL );
+      sizes.push_back( 200UL );
+   }
+
+   std::cout << "\n Preconditioned Conjugate Gradient Method:\n";
+
+   try {
+      for( size_t i=0UL; i<sizes.size(); ++i )
+      {
+         const size_t N( sizes[i] );
+
+         blaze::setSeed( blazemark::seed );
+
+         const CMatMxN A( setupMatrix( N ) );
+         VecN b( N*N );
+         for( size_t j=0UL; j<N*N; ++j ) {
+            b[j] = blaze::rand<real>( real(-1), real(1) );
+         }
+
+         std::cout << "   N = " << N << " (" << N*N << " unknowns):\n"
+                   << "     " << std::left << std::setw( 10 ) << "Precond."
+                   << std::right << std::setw( 12 ) << "Iterations"
+                   << std::setw( 14 ) << "Setup [s]"
+                   << std::setw( 14 ) << "Solve [s]"
+                   << std::setw( 14 ) << "Total [s]" << "\n";
+
+         JacobiPreconditioner jacobi;
+         SSORPreconditioner   ssor( real(1.5) );
+         ICPreconditioner     ic;
+
+         print( "None"  , run( A, b ) );
+         print( "Jacobi", run( A, b, jacobi ) );
+         print( "SSOR"  , run( A, b, ssor ) );
+         print( "IC(0)" , run( A, b, ic ) );
+      }
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during benchmark execution: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
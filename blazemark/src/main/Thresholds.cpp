@@ -0,0 +1,710 @@
+//=================================================================================================
+/*!
+//  \file src/main/Thresholds.cpp
+//  \brief Source file for the Blaze threshold autotuner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#  define BLAZE_USE_RUNTIME_THRESHOLDS
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/CompressedMatrix.h>
+#include <blazemark/blaze/init/CompressedVector.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blazemark::element_t;
+using blazemark::blaze::init;
+using blaze::rowMajor;
+using blaze::columnMajor;
+using blaze::rowVector;
+using blaze::columnVector;
+using blaze::CompressedMatrix;
+using blaze::CompressedVector;
+using blaze::DynamicMatrix;
+using blaze::DynamicVector;
+
+
+
+
+//=================================================================================================
+//
+//  TUNING CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+const double minTime   ( 0.01 );  //!< Minimum runtime of a single timing measurement [s]
+const double tolerance ( 0.02 );  //!< Relative speedup required to accept a crossover
+const double growth    ( 1.25 );  //!< Growth factor of the operand sizes between two measurements
+const size_t fill      ( 10UL );  //!< Percentage of non-zero elements in sparse operands
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base class for all operations measured by the threshold autotuner.
+//
+// Each kernel represents a single operation that is selected by one of the Blaze thresholds.
+// The resize() function prepares the operands for a given size \a N, the run() function
+// executes the operation once.
+*/
+class Kernel
+{
+ public:
+   virtual ~Kernel() {}
+   virtual void resize( size_t N ) = 0;
+   virtual void run() = 0;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements per row/column of a sparse operand.
+*/
+inline size_t nonZeros( size_t N )
+{
+   return std::max<size_t>( 1UL, N * fill / 100UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of a dense operand of size \a N.
+*/
+template< typename Type, bool TF >
+void setup( DynamicVector<Type,TF>& v, size_t N )
+{
+   v.resize( N, false );
+   init( v );
+}
+
+template< typename Type, bool SO >
+void setup( DynamicMatrix<Type,SO>& m, size_t N )
+{
+   m.resize( N, N, false );
+   init( m );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of a sparse operand of size \a N.
+*/
+template< typename Type, bool TF >
+void setup( CompressedVector<Type,TF>& v, size_t N )
+{
+   v.reset();
+   v.resize( N, false );
+   init( v, nonZeros( N ) );
+}
+
+template< typename Type, bool SO >
+void setup( CompressedMatrix<Type,SO>& m, size_t N )
+{
+   m.reset();
+   m.resize( N, N, false );
+   init( m, nonZeros( N ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense vector assignment (\f$ \vec{b} = \vec{a} \f$).
+*/
+class DVecAssign : public Kernel
+{
+ public:
+   void resize( size_t N ) { setup( a_, N ); b_.resize( N, false ); }
+   void run() { b_ = a_; }
+
+ private:
+   DynamicVector<element_t,columnVector> a_, b_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense vector addition, subtraction, and multiplication (\f$ \vec{c} = \vec{a} + \vec{b} \f$).
+*/
+template< char OP >
+class DVecDVecOp : public Kernel
+{
+ public:
+   void resize( size_t N ) { setup( a_, N ); setup( b_, N ); c_.resize( N, false ); }
+   void run() {
+      if     ( OP == '+' ) c_ = a_ + b_;
+      else if( OP == '-' ) c_ = a_ - b_;
+      else                 c_ = a_ * b_;
+   }
+
+ private:
+   DynamicVector<element_t,columnVector> a_, b_, c_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense vector/scalar multiplication (\f$ \vec{b} = \vec{a} \cdot s \f$).
+*/
+class DVecScalarMult : public Kernel
+{
+ public:
+   void resize( size_t N ) { setup( a_, N ); b_.resize( N, false ); }
+   void run() { b_ = a_ * element_t(2.2); }
+
+ private:
+   DynamicVector<element_t,columnVector> a_, b_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense vector reduction (\f$ s = \sum_i a_i \f$).
+*/
+class DVecReduce : public Kernel
+{
+ public:
+   DVecReduce() : s_() {}
+   void resize( size_t N ) { setup( a_, N ); }
+   void run() { s_ += sum( a_ ); }
+
+ private:
+   DynamicVector<element_t,columnVector> a_;
+   element_t s_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Outer product (\f$ C = \vec{a} \cdot \vec{b}^T \f$).
+*/
+class DVecTDVecMult : public Kernel
+{
+ public:
+   void resize( size_t N ) { setup( a_, N ); setup( b_, N ); C_.resize( N, N, false ); }
+   void run() { C_ = a_ * b_; }
+
+ private:
+   DynamicVector<element_t,columnVector> a_;
+   DynamicVector<element_t,rowVector> b_;
+   DynamicMatrix<element_t,rowMajor> C_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/vector multiplication (\f$ \vec{c} = A \cdot \vec{b} \f$).
+*/
+template< typename MT, typename VT >
+class MatVecMult : public Kernel
+{
+ public:
+   void resize( size_t N ) { setup( A_, N ); setup( b_, N ); c_.resize( N, false ); }
+   void run() { c_ = A_ * b_; }
+
+ private:
+   MT A_;
+   VT b_;
+   DynamicVector<element_t,columnVector> c_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vector/matrix multiplication (\f$ \vec{c}^T = \vec{b}^T \cdot A \f$).
+*/
+template< typename VT, typename MT >
+class VecMatMult : public Kernel
+{
+ public:
+   void resize( size_t N ) { setup( b_, N ); setup( A_, N ); c_.resize( N, false ); }
+   void run() { c_ = b_ * A_; }
+
+ private:
+   VT b_;
+   MT A_;
+   DynamicVector<element_t,rowVector> c_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix assignment (\f$ B = A \f$).
+*/
+class DMatAssign : public Kernel
+{
+ public:
+   void resize( size_t N ) { setup( A_, N ); B_.resize( N, N, false ); }
+   void run() { B_ = A_; }
+
+ private:
+   DynamicMatrix<element_t,rowMajor> A_, B_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix addition and subtraction (\f$ C = A + B \f$).
+*/
+template< typename MT1, typename MT2, char OP >
+class DMatDMatOp : public Kernel
+{
+ public:
+   void resize( size_t N ) { setup( A_, N ); setup( B_, N ); C_.resize( N, N, false ); }
+   void run() {
+      if( OP == '+' ) C_ = A_ + B_;
+      else            C_ = A_ - B_;
+   }
+
+ private:
+   MT1 A_;
+   MT2 B_;
+   DynamicMatrix<element_t,rowMajor> C_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix/scalar multiplication (\f$ B = A \cdot s \f$).
+*/
+class DMatScalarMult : public Kernel
+{
+ public:
+   void resize( size_t N ) { setup( A_, N ); B_.resize( N, N, false ); }
+   void run() { B_ = A_ * element_t(2.2); }
+
+ private:
+   DynamicMatrix<element_t,rowMajor> A_, B_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix reduction (\f$ s = \sum_{ij} a_{ij} \f$).
+*/
+class DMatReduce : public Kernel
+{
+ public:
+   DMatReduce() : s_() {}
+   void resize( size_t N ) { setup( A_, N ); }
+   void run() { s_ += sum( A_ ); }
+
+ private:
+   DynamicMatrix<element_t,rowMajor> A_;
+   element_t s_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/matrix multiplication (\f$ C = A \cdot B \f$).
+*/
+template< typename MT1, typename MT2 >
+class MatMatMult : public Kernel
+{
+ public:
+   void resize( size_t N ) { setup( A_, N ); setup( B_, N ); C_.resize( N, N, false ); }
+   void run() { C_ = A_ * B_; }
+
+ private:
+   MT1 A_;
+   MT2 B_;
+   DynamicMatrix<element_t,rowMajor> C_;
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TUNING FUNCTIONALITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Description of a single threshold to be tuned.
+*/
+struct Threshold
+{
+   const char* name;    //!< The name of the threshold.
+   size_t*     value;   //!< Pointer to the runtime value of the threshold.
+   Kernel*     kernel;  //!< The operation selected by the threshold.
+   size_t      first;   //!< The smallest measured operand size.
+   size_t      last;    //!< The largest measured operand size.
+   bool        blas;    //!< \a true for BLAS thresholds, \a false for SMP thresholds.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds a threshold to the given list of thresholds to be tuned.
+//
+// \param list The list of thresholds.
+// \param name The name of the threshold.
+// \param value The runtime value of the threshold.
+// \param kernel The operation selected by the threshold.
+// \param first The smallest measured operand size.
+// \param last The largest measured operand size.
+// \param blas \a true for BLAS thresholds, \a false for SMP thresholds.
+// \return void
+*/
+void add( std::vector<Threshold>& list, const char* name, size_t& value, Kernel* kernel,
+          size_t first, size_t last, bool blas = false )
+{
+   const Threshold t = { name, &value, kernel, first, last, blas };
+   list.push_back( t );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the minimum runtime of a single execution of the given kernel.
+//
+// \param kernel The kernel to be measured.
+// \return Minimum runtime of a single execution [s].
+*/
+double measure( Kernel& kernel )
+{
+   size_t steps( 1UL );
+   blaze::timing::WcTimer timer;
+
+   kernel.run();
+
+   for( ;; ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step )
+         kernel.run();
+      timer.end();
+      if( timer.last() >= minTime ) break;
+      steps *= 2UL;
+   }
+
+   for( size_t rep=1UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step )
+         kernel.run();
+      timer.end();
+   }
+
+   return timer.min() / steps;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the crossover point of the given threshold.
+//
+// \param t The threshold to be tuned.
+// \return The tuned value of the threshold.
+//
+// The operation is measured for geometrically growing operand sizes, once with the threshold
+// disabling the alternative code path (serial execution or Blaze kernels, respectively) and once
+// with the threshold enabling it (parallel execution or BLAS kernels, respectively). The
+// crossover is the first size for which the alternative is faster for two consecutive sizes.
+// The threshold is set to this size (BLAS thresholds) or to the preceding size (SMP thresholds).
+*/
+size_t tune( const Threshold& t )
+{
+   const size_t off( std::numeric_limits<size_t>::max() );
+   const size_t on ( 0UL );
+
+   size_t prev( 0UL ), candidate( 0UL );
+   bool found( false );
+
+   std::cout << "   " << std::left << std::setw( 30 ) << t.name << std::flush;
+
+   for( size_t N=t.first; N<=t.last; N=std::max( N+1UL, static_cast<size_t>( N*growth ) ) )
+   {
+      t.kernel->resize( N );
+
+      *t.value = off;
+      const double base( measure( *t.kernel ) );
+      *t.value = on;
+      const double alt( measure( *t.kernel ) );
+
+      const size_t metric( ( t.blas )?( N*N ):( N ) );
+
+      if( alt * ( 1.0 + tolerance ) < base ) {
+         if( found ) break;
+         candidate = ( t.blas )?( metric ):( prev );
+         found = true;
+      }
+      else found = false;
+
+      prev = metric;
+   }
+
+   const size_t value( ( found )?( candidate ):( prev ) );
+
+   std::cout << std::right << std::setw( 12 ) << value << ( found ? "" : "  (no crossover)" ) << "\n";
+
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the tuned thresholds by rewriting the given thresholds configuration file.
+//
+// \param in The name of the configuration file used as template.
+// \param out The name of the generated header file.
+// \param thresholds The tuned thresholds.
+// \return \a true in case the header was written successfully, \a false if not.
+*/
+bool write( const std::string& in, const std::string& out, const std::vector<Threshold>& thresholds )
+{
+   std::ifstream ifs( in.c_str() );
+   if( !ifs ) {
+      std::cerr << " Unable to open the thresholds template '" << in << "'!\n";
+      return false;
+   }
+
+   std::ofstream ofs( out.c_str() );
+   if( !ofs ) {
+      std::cerr << " Unable to create the thresholds header '" << out << "'!\n";
+      return false;
+   }
+
+   const std::string prefix( "const size_t " );
+   std::string line;
+
+   while( std::getline( ifs, line ) )
+   {
+      if( line.compare( 0UL, prefix.size(), prefix ) == 0 ) {
+         const std::string::size_type end( line.find( ' ', prefix.size() ) );
+         const std::string name( line.substr( prefix.size(), end-prefix.size() ) );
+         for( size_t i=0UL; i<thresholds.size(); ++i ) {
+            if( name == thresholds[i].name ) {
+               std::ostringstream oss;
+               oss << prefix << name << " = " << *thresholds[i].value << "UL;";
+               line = oss.str();
+            }
+         }
+      }
+      ofs << line << "\n";
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze threshold autotuner.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The autotuner measures the crossover points of all SMP thresholds (provided a shared memory
+// parallelization is active) and of all BLAS thresholds (provided the BLAS mode is active) on
+// the current machine and writes a thresholds header, which can replace the configuration file
+// <em>./blaze/config/Thresholds.h</em>. Additionally, the tuned values are printed in the form
+// of environment variables, which can be used in combination with the runtime thresholds (see
+// the \c BLAZE_USE_RUNTIME_THRESHOLDS compilation switch).
+*/
+int main( int argc, char** argv )
+{
+   if( argc > 3 ) {
+      std::cerr << " Invalid use of program 'Thresholds'!\n"
+                << "   Use: ./thresholds [<output_header> [<thresholds_template>]]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::string out( ( argc > 1 )?( argv[1] ):( "Thresholds.h" ) );
+   const std::string in ( ( argc > 2 )?( argv[2] ):( INSTALL_PATH "/../blaze/config/Thresholds.h" ) );
+
+   typedef DynamicVector<element_t,columnVector>     DV;
+   typedef DynamicVector<element_t,rowVector>        TDV;
+   typedef CompressedVector<element_t,columnVector>  SV;
+   typedef CompressedVector<element_t,rowVector>     TSV;
+   typedef DynamicMatrix<element_t,rowMajor>         DM;
+   typedef DynamicMatrix<element_t,columnMajor>      TDM;
+   typedef CompressedMatrix<element_t,rowMajor>      SM;
+   typedef CompressedMatrix<element_t,columnMajor>   TSM;
+
+   std::vector<Threshold> smp, blas;
+
+   add( smp, "SMP_DVECASSIGN_THRESHOLD"    , blaze::SMP_DVECASSIGN_THRESHOLD    , new DVecAssign()           , 1000UL, 4000000UL );
+   add( smp, "SMP_DVECDVECADD_THRESHOLD"   , blaze::SMP_DVECDVECADD_THRESHOLD   , new DVecDVecOp<'+'>()      , 1000UL, 4000000UL );
+   add( smp, "SMP_DVECDVECSUB_THRESHOLD"   , blaze::SMP_DVECDVECSUB_THRESHOLD   , new DVecDVecOp<'-'>()      , 1000UL, 4000000UL );
+   add( smp, "SMP_DVECDVECMULT_THRESHOLD"  , blaze::SMP_DVECDVECMULT_THRESHOLD  , new DVecDVecOp<'*'>()      , 1000UL, 4000000UL );
+   add( smp, "SMP_DVECSCALARMULT_THRESHOLD", blaze::SMP_DVECSCALARMULT_THRESHOLD, new DVecScalarMult()       , 1000UL, 4000000UL );
+   add( smp, "SMP_DVECREDUCE_THRESHOLD"    , blaze::SMP_DVECREDUCE_THRESHOLD    , new DVecReduce()           , 1000UL, 4000000UL );
+   add( smp, "SMP_DMATDVECMULT_THRESHOLD"  , blaze::SMP_DMATDVECMULT_THRESHOLD  , new MatVecMult<DM,DV>()    ,   20UL,    4000UL );
+   add( smp, "SMP_TDMATDVECMULT_THRESHOLD" , blaze::SMP_TDMATDVECMULT_THRESHOLD , new MatVecMult<TDM,DV>()   ,   20UL,    4000UL );
+   add( smp, "SMP_TDVECDMATMULT_THRESHOLD" , blaze::SMP_TDVECDMATMULT_THRESHOLD , new VecMatMult<TDV,DM>()   ,   20UL,    4000UL );
+   add( smp, "SMP_TDVECTDMATMULT_THRESHOLD", blaze::SMP_TDVECTDMATMULT_THRESHOLD, new VecMatMult<TDV,TDM>()  ,   20UL,    4000UL );
+   add( smp, "SMP_DMATSVECMULT_THRESHOLD"  , blaze::SMP_DMATSVECMULT_THRESHOLD  , new MatVecMult<DM,SV>()    ,   20UL,    4000UL );
+   add( smp, "SMP_TDMATSVECMULT_THRESHOLD" , blaze::SMP_TDMATSVECMULT_THRESHOLD , new MatVecMult<TDM,SV>()   ,   20UL,    4000UL );
+   add( smp, "SMP_TSVECDMATMULT_THRESHOLD" , blaze::SMP_TSVECDMATMULT_THRESHOLD , new VecMatMult<TSV,DM>()   ,   20UL,    4000UL );
+   add( smp, "SMP_TSVECTDMATMULT_THRESHOLD", blaze::SMP_TSVECTDMATMULT_THRESHOLD, new VecMatMult<TSV,TDM>()  ,   20UL,    4000UL );
+   add( smp, "SMP_SMATDVECMULT_THRESHOLD"  , blaze::SMP_SMATDVECMULT_THRESHOLD  , new MatVecMult<SM,DV>()    ,   20UL,    8000UL );
+   add( smp, "SMP_TSMATDVECMULT_THRESHOLD" , blaze::SMP_TSMATDVECMULT_THRESHOLD , new MatVecMult<TSM,DV>()   ,   20UL,    8000UL );
+   add( smp, "SMP_TDVECSMATMULT_THRESHOLD" , blaze::SMP_TDVECSMATMULT_THRESHOLD , new VecMatMult<TDV,SM>()   ,   20UL,    8000UL );
+   add( smp, "SMP_TDVECTSMATMULT_THRESHOLD", blaze::SMP_TDVECTSMATMULT_THRESHOLD, new VecMatMult<TDV,TSM>()  ,   20UL,    8000UL );
+   add( smp, "SMP_SMATSVECMULT_THRESHOLD"  , blaze::SMP_SMATSVECMULT_THRESHOLD  , new MatVecMult<SM,SV>()    ,   20UL,    8000UL );
+   add( smp, "SMP_TSMATSVECMULT_THRESHOLD" , blaze::SMP_TSMATSVECMULT_THRESHOLD , new MatVecMult<TSM,SV>()   ,   20UL,    8000UL );
+   add( smp, "SMP_TSVECSMATMULT_THRESHOLD" , blaze::SMP_TSVECSMATMULT_THRESHOLD , new VecMatMult<TSV,SM>()   ,   20UL,    8000UL );
+   add( smp, "SMP_TSVECTSMATMULT_THRESHOLD", blaze::SMP_TSVECTSMATMULT_THRESHOLD, new VecMatMult<TSV,TSM>()  ,   20UL,    8000UL );
+   add( smp, "SMP_DMATASSIGN_THRESHOLD"    , blaze::SMP_DMATASSIGN_THRESHOLD    , new DMatAssign()           ,   20UL,    4000UL );
+   add( smp, "SMP_DMATDMATADD_THRESHOLD"   , blaze::SMP_DMATDMATADD_THRESHOLD   , new DMatDMatOp<DM,DM,'+'>() ,  20UL,    4000UL );
+   add( smp, "SMP_DMATTDMATADD_THRESHOLD"  , blaze::SMP_DMATTDMATADD_THRESHOLD  , new DMatDMatOp<DM,TDM,'+'>(),  20UL,    4000UL );
+   add( smp, "SMP_DMATDMATSUB_THRESHOLD"   , blaze::SMP_DMATDMATSUB_THRESHOLD   , new DMatDMatOp<DM,DM,'-'>() ,  20UL,    4000UL );
+   add( smp, "SMP_DMATTDMATSUB_THRESHOLD"  , blaze::SMP_DMATTDMATSUB_THRESHOLD  , new DMatDMatOp<DM,TDM,'-'>(),  20UL,    4000UL );
+   add( smp, "SMP_DMATSCALARMULT_THRESHOLD", blaze::SMP_DMATSCALARMULT_THRESHOLD, new DMatScalarMult()       ,   20UL,    4000UL );
+   add( smp, "SMP_DMATREDUCE_THRESHOLD"    , blaze::SMP_DMATREDUCE_THRESHOLD    , new DMatReduce()           ,   20UL,    4000UL );
+   add( smp, "SMP_DMATDMATMULT_THRESHOLD"  , blaze::SMP_DMATDMATMULT_THRESHOLD  , new MatMatMult<DM,DM>()    ,   10UL,    1000UL );
+   add( smp, "SMP_DMATTDMATMULT_THRESHOLD" , blaze::SMP_DMATTDMATMULT_THRESHOLD , new MatMatMult<DM,TDM>()   ,   10UL,    1000UL );
+   add( smp, "SMP_TDMATDMATMULT_THRESHOLD" , blaze::SMP_TDMATDMATMULT_THRESHOLD , new MatMatMult<TDM,DM>()   ,   10UL,    1000UL );
+   add( smp, "SMP_TDMATTDMATMULT_THRESHOLD", blaze::SMP_TDMATTDMATMULT_THRESHOLD, new MatMatMult<TDM,TDM>()  ,   10UL,    1000UL );
+   add( smp, "SMP_DMATSMATMULT_THRESHOLD"  , blaze::SMP_DMATSMATMULT_THRESHOLD  , new MatMatMult<DM,SM>()    ,   10UL,    1000UL );
+   add( smp, "SMP_DMATTSMATMULT_THRESHOLD" , blaze::SMP_DMATTSMATMULT_THRESHOLD , new MatMatMult<DM,TSM>()   ,   10UL,    1000UL );
+   add( smp, "SMP_TDMATSMATMULT_THRESHOLD" , blaze::SMP_TDMATSMATMULT_THRESHOLD , new MatMatMult<TDM,SM>()   ,   10UL,    1000UL );
+   add( smp, "SMP_TDMATTSMATMULT_THRESHOLD", blaze::SMP_TDMATTSMATMULT_THRESHOLD, new MatMatMult<TDM,TSM>()  ,   10UL,    1000UL );
+   add( smp, "SMP_SMATDMATMULT_THRESHOLD"  , blaze::SMP_SMATDMATMULT_THRESHOLD  , new MatMatMult<SM,DM>()    ,   10UL,    1000UL );
+   add( smp, "SMP_SMATTDMATMULT_THRESHOLD" , blaze::SMP_SMATTDMATMULT_THRESHOLD , new MatMatMult<SM,TDM>()   ,   10UL,    1000UL );
+   add( smp, "SMP_TSMATDMATMULT_THRESHOLD" , blaze::SMP_TSMATDMATMULT_THRESHOLD , new MatMatMult<TSM,DM>()   ,   10UL,    1000UL );
+   add( smp, "SMP_TSMATTDMATMULT_THRESHOLD", blaze::SMP_TSMATTDMATMULT_THRESHOLD, new MatMatMult<TSM,TDM>()  ,   10UL,    1000UL );
+   add( smp, "SMP_SMATSMATMULT_THRESHOLD"  , blaze::SMP_SMATSMATMULT_THRESHOLD  , new MatMatMult<SM,SM>()    ,   20UL,    2000UL );
+   add( smp, "SMP_SMATTSMATMULT_THRESHOLD" , blaze::SMP_SMATTSMATMULT_THRESHOLD , new MatMatMult<SM,TSM>()   ,   20UL,    2000UL );
+   add( smp, "SMP_TSMATSMATMULT_THRESHOLD" , blaze::SMP_TSMATSMATMULT_THRESHOLD , new MatMatMult<TSM,SM>()   ,   20UL,    2000UL );
+   add( smp, "SMP_TSMATTSMATMULT_THRESHOLD", blaze::SMP_TSMATTSMATMULT_THRESHOLD, new MatMatMult<TSM,TSM>()  ,   20UL,    2000UL );
+   add( smp, "SMP_DVECTDVECMULT_THRESHOLD" , blaze::SMP_DVECTDVECMULT_THRESHOLD , new DVecTDVecMult()        ,   20UL,    4000UL );
+
+   add( blas, "DMATDVECMULT_THRESHOLD"  , blaze::DMATDVECMULT_THRESHOLD  , new MatVecMult<DM,DV>()  , 10UL, 4000UL, true );
+   add( blas, "TDMATDVECMULT_THRESHOLD" , blaze::TDMATDVECMULT_THRESHOLD , new MatVecMult<TDM,DV>() , 10UL, 4000UL, true );
+   add( blas, "TDVECDMATMULT_THRESHOLD" , blaze::TDVECDMATMULT_THRESHOLD , new VecMatMult<TDV,DM>() , 10UL, 4000UL, true );
+   add( blas, "TDVECTDMATMULT_THRESHOLD", blaze::TDVECTDMATMULT_THRESHOLD, new VecMatMult<TDV,TDM>(), 10UL, 4000UL, true );
+   add( blas, "DMATDMATMULT_THRESHOLD"  , blaze::DMATDMATMULT_THRESHOLD  , new MatMatMult<DM,DM>()  , 10UL, 1000UL, true );
+   add( blas, "DMATTDMATMULT_THRESHOLD" , blaze::DMATTDMATMULT_THRESHOLD , new MatMatMult<DM,TDM>() , 10UL, 1000UL, true );
+   add( blas, "TDMATDMATMULT_THRESHOLD" , blaze::TDMATDMATMULT_THRESHOLD , new MatMatMult<TDM,DM>() , 10UL, 1000UL, true );
+   add( blas, "TDMATTDMATMULT_THRESHOLD", blaze::TDMATTDMATMULT_THRESHOLD, new MatMatMult<TDM,TDM>(), 10UL, 1000UL, true );
+
+   blaze::setSeed( blazemark::seed );
+
+   // Tuning the SMP thresholds based on the Blaze kernels
+   if( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+   {
+      std::vector<size_t> defaults( blas.size() );
+      for( size_t i=0UL; i<blas.size(); ++i ) {
+         defaults[i] = *blas[i].value;
+         *blas[i].value = std::numeric_limits<size_t>::max();
+      }
+
+      std::cout << "\n Tuning the SMP thresholds...\n";
+      for( size_t i=0UL; i<smp.size(); ++i )
+         *smp[i].value = tune( smp[i] );
+
+      for( size_t i=0UL; i<blas.size(); ++i )
+         *blas[i].value = defaults[i];
+   }
+   else {
+      std::cout << "\n No shared memory parallelization active: skipping the SMP thresholds\n";
+   }
+
+   // Tuning the BLAS thresholds based on the tuned SMP thresholds
+   if( BLAZE_BLAS_MODE )
+   {
+      std::cout << "\n Tuning the BLAS thresholds...\n";
+      for( size_t i=0UL; i<blas.size(); ++i )
+         *blas[i].value = tune( blas[i] );
+   }
+   else {
+      std::cout << "\n BLAS mode not active: skipping the BLAS thresholds\n";
+   }
+
+   std::vector<Threshold> all( blas );
+   all.insert( all.end(), smp.begin(), smp.end() );
+
+   const bool success( write( in, out, all ) );
+
+   if( success ) {
+      std::cout << "\n Generated thresholds header '" << out << "'\n"
+                << "\n Runtime threshold settings (see BLAZE_USE_RUNTIME_THRESHOLDS):\n";
+      for( size_t i=0UL; i<all.size(); ++i )
+         std::cout << "   export BLAZE_" << all[i].name << "=" << *all[i].value << "\n";
+      std::cout << std::endl;
+   }
+
+   for( size_t i=0UL; i<all.size(); ++i )
+      delete all[i].kernel;
+
+   return ( success )?( EXIT_SUCCESS ):( EXIT_FAILURE );
+}
+//*************************************************************************************************
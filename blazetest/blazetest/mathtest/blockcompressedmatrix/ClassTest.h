@@ -0,0 +1,498 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/blockcompressedmatrix/ClassTest.h
+//  \brief Header file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BlockCompressedMatrix class template.
+//
+// This class represents a test suite for the blaze::BlockCompressedMatrix class template. It
+// performs a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors        ();
+   void testAssignment          ();
+   void testFunctionCall        ();
+   void testIterator            ();
+   void testNonZeros            ();
+   void testClear               ();
+   void testSwap                ();
+   void testFind                ();
+   void testLowerBound          ();
+   void testUpperBound          ();
+   void testIsDefault           ();
+   void testMultiplication      ();
+   void testMatrixMultiplication();
+
+   template< typename Type, size_t B >
+   void testVectorKernel( size_t m, size_t n );
+
+   template< typename Type, size_t B >
+   void testMatrixKernel( size_t m, size_t n, size_t p );
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& matrix, const MT2& expected ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& vector, const VT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::BlockCompressedMatrix<int,3UL>     MT;   //!< Type of the block compressed matrix.
+   typedef MT::ResultType                            RT;   //!< Result type of the block compressed matrix.
+   typedef MT::OppositeType                          OMT;  //!< Opposite type of the block compressed matrix.
+   typedef MT::TransposeType                         TMT;  //!< Transpose type of the block compressed matrix.
+   typedef MT::Rebind<double>::Other                 RMT;  //!< Rebound block compressed matrix type.
+   typedef blaze::BlockCompressedMatrix<double,3UL>  DMT;  //!< Double precision block compressed matrix type.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT  );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( RT  );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( OMT );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( TMT );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( RMT );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT  );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( RT  );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( RMT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType, RT::ElementType  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType, OMT::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType, TMT::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT::ElementType, double );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT, DMT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given matrix. In case the actual number of
+// rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( rows( matrix ) != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << rows( matrix ) << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given matrix. In case the actual number of
+// columns does not correspond to the given expected number of columns, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( columns( matrix ) != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << columns( matrix ) << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given matrix. In case the
+// actual number of non-zero elements does not correspond to the given expected number,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const
+{
+   if( nonZeros( matrix ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( matrix ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements in a specific row of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param index The row to be checked.
+// \param expectedNonZeros The expected number of non-zero elements in the specified row.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements in the specified row of the given
+// matrix. In case the actual number of non-zero elements does not correspond to the given
+// expected number, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const
+{
+   if( nonZeros( matrix, index ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements in row " << index << "\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( matrix, index ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expected The matrix containing the expected elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given matrix elementwise to the expected matrix. In case any
+// element differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the matrix to be checked
+        , typename MT2 >  // Type of the expected matrix
+void ClassTest::checkMatrix( const MT1& matrix, const MT2& expected ) const
+{
+   if( matrix != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix elements detected\n"
+          << " Details:\n"
+          << "   Result:\n" << matrix << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given vector.
+//
+// \param vector The vector to be checked.
+// \param expected The vector containing the expected elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given vector elementwise to the expected vector. In case any
+// element differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the vector to be checked
+        , typename VT2 >  // Type of the expected vector
+void ClassTest::checkVector( const VT1& vector, const VT2& expected ) const
+{
+   if( vector != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector elements detected\n"
+          << " Details:\n"
+          << "   Result:\n" << vector << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block compressed matrix/dense vector multiplication kernels.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of a randomly generated \f$ m \times n \f$ block
+// compressed matrix with a dense vector for the given element type and block size. The results
+// of all four assignment operations are compared to the according computation with a
+// blaze::CompressedMatrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t B >     // Block size of the block compressed matrix
+void ClassTest::testVectorKernel( size_t m, size_t n )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> cmat( m, n );
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t k=0UL; k<( i*5UL )%13UL; ++k ) {
+         cmat( i, ( i*3UL+k*7UL ) % n ) = Type( int( ( i+k ) % 9UL ) - 4 );
+      }
+   }
+
+   blaze::DynamicVector<Type,blaze::columnVector> vec( n );
+   for( size_t j=0UL; j<n; ++j ) {
+      vec[j] = Type( int( j % 7UL ) - 3 );
+   }
+
+   const blaze::BlockCompressedMatrix<Type,B> mat( cmat );
+
+   checkMatrix( mat, cmat );
+
+   blaze::DynamicVector<Type,blaze::columnVector> res, ref;
+
+   res  = mat * vec;
+   ref  = cmat * vec;
+   checkVector( res, ref );
+
+   res += mat * ( vec + vec );
+   ref += cmat * ( vec + vec );
+   checkVector( res, ref );
+
+   res -= mat * vec;
+   ref -= cmat * vec;
+   checkVector( res, ref );
+
+   res *= mat * vec;
+   ref *= cmat * vec;
+   checkVector( res, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block compressed matrix/dense matrix multiplication kernels.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param p The number of columns of the dense matrix operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of a randomly generated \f$ m \times n \f$ block
+// compressed matrix with a row-major \f$ n \times p \f$ dense matrix for the given element type
+// and block size. The results of the assignment, addition assignment, and subtraction assignment
+// are compared to the according computation with a blaze::CompressedMatrix. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t B >     // Block size of the block compressed matrix
+void ClassTest::testMatrixKernel( size_t m, size_t n, size_t p )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> cmat( m, n );
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t k=0UL; k<( i*7UL )%11UL; ++k ) {
+         cmat( i, ( i*5UL+k*3UL ) % n ) = Type( int( ( i+k ) % 7UL ) - 3 );
+      }
+   }
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> dmat( n, p );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<p; ++j ) {
+         dmat(i,j) = Type( int( ( i+2UL*j ) % 5UL ) - 2 );
+      }
+   }
+
+   const blaze::BlockCompressedMatrix<Type,B> mat( cmat );
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> res, ref;
+
+   res  = mat * dmat;
+   ref  = cmat * dmat;
+   checkMatrix( res, ref );
+
+   res += mat * dmat;
+   ref += cmat * dmat;
+   checkMatrix( res, ref );
+
+   res -= mat * ( dmat + dmat );
+   ref -= cmat * ( dmat + dmat );
+   checkMatrix( res, ref );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BlockCompressedMatrix class test.
+*/
+#define RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::blockcompressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -111,6 +111,7 @@ class ClassTest
    void testLowerBound  ();
    void testUpperBound  ();
    void testIsDefault   ();
+   void testAssemble    ();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -40,9 +40,17 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <cstdlib>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/util/Random.h>
 
 
 namespace blazetest {
@@ -65,6 +73,54 @@ namespace densematrix {
 */
 class OperationTest
 {
+ private:
+   //**Custom operations***************************************************************************
+   /*!\brief Vectorizable custom unary operation for the map() tests.
+   */
+   struct Cube
+   {
+      template< typename T >
+      struct SIMDEnabled { enum { value = blaze::IntrinsicTrait<T>::multiplication }; };
+
+      template< typename T >
+      T operator()( const T& a ) const { return a * a * a; }
+
+      template< typename T >
+      T load( const T& a ) const { return a * a * a; }
+   };
+
+   /*!\brief Non-vectorizable custom unary operation for the map() tests.
+   */
+   struct Shift
+   {
+      template< typename T >
+      T operator()( const T& a ) const { return a + T(1); }
+   };
+
+   /*!\brief Vectorizable custom binary operation for the map() tests.
+   */
+   struct Axpy
+   {
+      template< typename T >
+      struct SIMDEnabled { enum { value = blaze::IntrinsicTrait<T>::addition &&
+                                          blaze::IntrinsicTrait<T>::multiplication }; };
+
+      template< typename T >
+      T operator()( const T& a, const T& b ) const { return a * b + a; }
+
+      template< typename T >
+      T load( const T& a, const T& b ) const { return a * b + a; }
+   };
+
+   /*!\brief Non-vectorizable custom binary operation for the map() tests.
+   */
+   struct Blend
+   {
+      template< typename T >
+      T operator()( const T& a, const T& b ) const { return T(2) * a - b; }
+   };
+   //**********************************************************************************************
+
  public:
    //**Constructors********************************************************************************
    /*!\name Constructors */
@@ -90,6 +146,20 @@ class OperationTest
    void testIsUpper();
    void testMinimum();
    void testMaximum();
+   void testReduction();
+   void testMap();
+
+   template< bool SO, typename T >
+   void testReduction();
+
+   template< typename MT1, typename MT2 >
+   void testReduction( const MT1& a, const MT2& b );
+
+   template< bool SO, typename OP >
+   void testMap( size_t m, size_t n, OP op );
+
+   template< bool SO, typename OP >
+   void testBinaryMap( size_t m, size_t n, OP op );
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -105,6 +175,16 @@ class OperationTest
 
    template< typename Type >
    void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& expected, const std::string& operation ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkValue( const Type1& result, const Type2& expected,
+                    const std::string& function, size_t m, size_t n ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkReduction( const Type1& result, const Type2& expected, const std::string& function ) const;
    //@}
    //**********************************************************************************************
 
@@ -126,6 +206,385 @@ class OperationTest
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Test of the reduction functions for dense matrices of the given element type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the total, row-wise, and column-wise reduction functions for dense
+// matrices with element type \a T and storage order \a SO. The matrix sizes include empty
+// matrices, sizes below and above a single SIMD vector, and sizes beyond the SMP reduction
+// threshold in both dimensions. All tests are repeated for unaligned submatrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO        // Storage order of the dense matrices
+        , typename T >   // Element type of the dense matrices
+void OperationTest::testReduction()
+{
+   using blaze::submatrix;
+
+   const size_t simd ( blaze::IntrinsicTrait<T>::size );
+   const size_t large( blaze::SMP_DMATREDUCE_THRESHOLD + 3UL );
+
+   const size_t rows   [] = { 0UL, 0UL, 3UL, 1UL, simd+1UL    , 33UL, large, 9UL   };
+   const size_t columns[] = { 0UL, 3UL, 0UL, 1UL, 2UL*simd+3UL, 17UL, 9UL  , large };
+
+   for( size_t k=0UL; k<sizeof(rows)/sizeof(size_t); ++k )
+   {
+      const size_t m( rows[k]    );
+      const size_t n( columns[k] );
+
+      // Random values for the additive, minimum and maximum reductions and values with a
+      // small product for the multiplicative reductions
+      blaze::DynamicMatrix<T,SO> a( m, n ), b( m, n );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            a(i,j) = T( blaze::rand<int>( -9, 9 ) );
+            b(i,j) = ( ( i + j ) % 3UL == 1UL )?( T(-1) ):( T(1) );
+         }
+      }
+      for( size_t i=0UL; i<m && i<n; i+=m/4UL+1UL ) {
+         b(i,i) = T(2);
+      }
+
+      testReduction( a, b );
+
+      if( m > 1UL && n > 1UL ) {
+         testReduction( submatrix( a, 1UL, 1UL, m-1UL, n-1UL ), submatrix( b, 1UL, 1UL, m-1UL, n-1UL ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reduction functions for the given pair of dense matrices.
+//
+// \param a The dense matrix for the additive, minimum, maximum, and norm reductions.
+// \param b The dense matrix for the multiplicative reductions.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the total reduce(), sum(), prod(), min(), max(),
+// l1Norm(), l2Norm(), and linfNorm() functions and of the row-wise and column-wise reduce(),
+// sum(), prod(), min(), and max() functions to the according scalar computations. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the first dense matrix
+        , typename MT2 >  // Type of the second dense matrix
+void OperationTest::testReduction( const MT1& a, const MT2& b )
+{
+   using std::abs;
+   using blaze::rowwise;
+   using blaze::columnwise;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   typedef typename MT1::ElementType  ET;
+
+   const size_t m( a.rows()    );
+   const size_t n( a.columns() );
+
+
+   //=====================================================================================
+   // Total reductions
+   //=====================================================================================
+
+   {
+      ET refSum( 0 ), refProd( 1 ), refMin( 0 ), refMax( 0 ), refL1( 0 ), refLinf( 0 ), refSqr( 0 );
+
+      if( m > 0UL && n > 0UL ) {
+         refMin = a(0UL,0UL);
+         refMax = a(0UL,0UL);
+      }
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            refSum  += a(i,j);
+            refProd *= b(i,j);
+            refL1   += abs( a(i,j) );
+            refSqr  += a(i,j) * a(i,j);
+            if( abs( a(i,j) ) > refLinf ) refLinf = abs( a(i,j) );
+            if( a(i,j) < refMin ) refMin = a(i,j);
+            if( a(i,j) > refMax ) refMax = a(i,j);
+         }
+      }
+
+      checkValue( reduce( a, blaze::Add() ), refSum , "reduce()"  , m, n );
+      checkValue( sum( a )                 , refSum , "sum()"     , m, n );
+      checkValue( prod( b )                , refProd, "prod()"    , m, n );
+      checkValue( min( a )                 , refMin , "min()"     , m, n );
+      checkValue( max( a )                 , refMax , "max()"     , m, n );
+      checkValue( l1Norm( a )              , refL1  , "l1Norm()"  , m, n );
+      checkValue( l2Norm( a )              , std::sqrt( double( refSqr ) ), "l2Norm()", m, n );
+      checkValue( linfNorm( a )            , refLinf, "linfNorm()", m, n );
+   }
+
+
+   //=====================================================================================
+   // Row-wise reductions
+   //=====================================================================================
+
+   {
+      blaze::DynamicVector<ET,columnVector> refSum( m, ET(0) ), refProd( m, ET(1) ),
+                                            refMin( m, ET(0) ), refMax ( m, ET(0) );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         if( n > 0UL ) {
+            refMin[i] = a(i,0UL);
+            refMax[i] = a(i,0UL);
+         }
+         for( size_t j=0UL; j<n; ++j ) {
+            refSum[i]  += a(i,j);
+            refProd[i] *= b(i,j);
+            if( a(i,j) < refMin[i] ) refMin[i] = a(i,j);
+            if( a(i,j) > refMax[i] ) refMax[i] = a(i,j);
+         }
+      }
+
+      blaze::DynamicVector<ET,columnVector> res;
+
+      checkReduction( blaze::reduce<rowwise>( a, blaze::Add() ), refSum, "reduce<rowwise>() (element access)" );
+
+      res = blaze::reduce<rowwise>( a, blaze::Add() );
+      checkReduction( res, refSum, "reduce<rowwise>()" );
+
+      res = blaze::sum<rowwise>( a );
+      checkReduction( res, refSum, "sum<rowwise>()" );
+
+      res = blaze::prod<rowwise>( b );
+      checkReduction( res, refProd, "prod<rowwise>()" );
+
+      res = blaze::min<rowwise>( a );
+      checkReduction( res, refMin, "min<rowwise>()" );
+
+      res = blaze::max<rowwise>( a );
+      checkReduction( res, refMax, "max<rowwise>()" );
+   }
+
+
+   //=====================================================================================
+   // Column-wise reductions
+   //=====================================================================================
+
+   {
+      blaze::DynamicVector<ET,rowVector> refSum( n, ET(0) ), refProd( n, ET(1) ),
+                                         refMin( n, ET(0) ), refMax ( n, ET(0) );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         if( m > 0UL ) {
+            refMin[j] = a(0UL,j);
+            refMax[j] = a(0UL,j);
+         }
+         for( size_t i=0UL; i<m; ++i ) {
+            refSum[j]  += a(i,j);
+            refProd[j] *= b(i,j);
+            if( a(i,j) < refMin[j] ) refMin[j] = a(i,j);
+            if( a(i,j) > refMax[j] ) refMax[j] = a(i,j);
+         }
+      }
+
+      blaze::DynamicVector<ET,rowVector> res;
+
+      checkReduction( blaze::reduce<columnwise>( a, blaze::Add() ), refSum, "reduce<columnwise>() (element access)" );
+
+      res = blaze::reduce<columnwise>( a, blaze::Add() );
+      checkReduction( res, refSum, "reduce<columnwise>()" );
+
+      res = blaze::sum<columnwise>( a );
+      checkReduction( res, refSum, "sum<columnwise>()" );
+
+      res = blaze::prod<columnwise>( b );
+      checkReduction( res, refProd, "prod<columnwise>()" );
+
+      res = blaze::min<columnwise>( a );
+      checkReduction( res, refMin, "min<columnwise>()" );
+
+      res = blaze::max<columnwise>( a );
+      checkReduction( res, refMax, "max<columnwise>()" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the unary \c map() function for a single matrix size.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \param op The custom unary operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of the
+// unary map() expression for \a m by \a n dense matrices with storage order \a SO. Additionally,
+// the map() expression is evaluated on and assigned to unaligned submatrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO        // Storage order of the matrices
+        , typename OP >  // Type of the custom operation
+void OperationTest::testMap( size_t m, size_t n, OP op )
+{
+   using blaze::randomize;
+   using blaze::submatrix;
+
+   blaze::DynamicMatrix<double,SO> a( m, n ), b( m, n ), c( m, n ), ref( m, n );
+   randomize( a, -9.0, 9.0 );
+   randomize( b, -9.0, 9.0 );
+
+   // Assignment
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = op( a(i,j) );
+
+   c = map( a, op );
+   checkResult( c, ref, "Assignment" );
+
+   // Addition assignment
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = b(i,j) + op( a(i,j) );
+
+   c = b;
+   c += map( a, op );
+   checkResult( c, ref, "Addition assignment" );
+
+   // Subtraction assignment
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = b(i,j) - op( a(i,j) );
+
+   c = b;
+   c -= map( a, op );
+   checkResult( c, ref, "Subtraction assignment" );
+
+   // Submatrix assignment
+   if( m > 2UL && n > 2UL )
+   {
+      const size_t k( m - 2UL );
+      const size_t l( n - 2UL );
+
+      ref = b;
+      for( size_t i=0UL; i<k; ++i )
+         for( size_t j=0UL; j<l; ++j )
+            ref(i+1UL,j+1UL) = op( a(i+2UL,j+2UL) );
+
+      c = b;
+      submatrix( c, 1UL, 1UL, k, l ) = map( submatrix( a, 2UL, 2UL, k, l ), op );
+      checkResult( c, ref, "Submatrix assignment" );
+
+      for( size_t i=0UL; i<k; ++i )
+         for( size_t j=0UL; j<l; ++j )
+            ref(i+1UL,j+1UL) = b(i+1UL,j+1UL) + op( a(i+2UL,j+2UL) );
+
+      c = b;
+      submatrix( c, 1UL, 1UL, k, l ) += map( submatrix( a, 2UL, 2UL, k, l ), op );
+      checkResult( c, ref, "Submatrix addition assignment" );
+
+      for( size_t i=0UL; i<k; ++i )
+         for( size_t j=0UL; j<l; ++j )
+            ref(i+1UL,j+1UL) = b(i+1UL,j+1UL) - op( a(i+2UL,j+2UL) );
+
+      c = b;
+      submatrix( c, 1UL, 1UL, k, l ) -= map( submatrix( a, 2UL, 2UL, k, l ), op );
+      checkResult( c, ref, "Submatrix subtraction assignment" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the binary \c map() function for a single matrix size.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \param op The custom binary operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of the
+// binary map() expression for \a m by \a n dense matrices with storage order \a SO. Additionally,
+// the map() expression is evaluated on and assigned to unaligned submatrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO        // Storage order of the matrices
+        , typename OP >  // Type of the custom operation
+void OperationTest::testBinaryMap( size_t m, size_t n, OP op )
+{
+   using blaze::randomize;
+   using blaze::submatrix;
+
+   blaze::DynamicMatrix<double,SO> a( m, n ), b( m, n ), c( m, n ), d( m, n ), ref( m, n );
+   randomize( a, -9.0, 9.0 );
+   randomize( b, -9.0, 9.0 );
+   randomize( d, -9.0, 9.0 );
+
+   // Assignment
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = op( a(i,j), b(i,j) );
+
+   c = map( a, b, op );
+   checkResult( c, ref, "Assignment" );
+
+   // Addition assignment
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = d(i,j) + op( a(i,j), b(i,j) );
+
+   c = d;
+   c += map( a, b, op );
+   checkResult( c, ref, "Addition assignment" );
+
+   // Subtraction assignment
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = d(i,j) - op( a(i,j), b(i,j) );
+
+   c = d;
+   c -= map( a, b, op );
+   checkResult( c, ref, "Subtraction assignment" );
+
+   // Submatrix assignment
+   if( m > 2UL && n > 2UL )
+   {
+      const size_t k( m - 2UL );
+      const size_t l( n - 2UL );
+
+      ref = d;
+      for( size_t i=0UL; i<k; ++i )
+         for( size_t j=0UL; j<l; ++j )
+            ref(i+1UL,j+1UL) = op( a(i+2UL,j+2UL), b(i,j) );
+
+      c = d;
+      submatrix( c, 1UL, 1UL, k, l ) =
+         map( submatrix( a, 2UL, 2UL, k, l ), submatrix( b, 0UL, 0UL, k, l ), op );
+      checkResult( c, ref, "Submatrix assignment" );
+
+      for( size_t i=0UL; i<k; ++i )
+         for( size_t j=0UL; j<l; ++j )
+            ref(i+1UL,j+1UL) = d(i+1UL,j+1UL) + op( a(i+2UL,j+2UL), b(i,j) );
+
+      c = d;
+      submatrix( c, 1UL, 1UL, k, l ) +=
+         map( submatrix( a, 2UL, 2UL, k, l ), submatrix( b, 0UL, 0UL, k, l ), op );
+      checkResult( c, ref, "Submatrix addition assignment" );
+
+      for( size_t i=0UL; i<k; ++i )
+         for( size_t j=0UL; j<l; ++j )
+            ref(i+1UL,j+1UL) = d(i+1UL,j+1UL) - op( a(i+2UL,j+2UL), b(i,j) );
+
+      c = d;
+      submatrix( c, 1UL, 1UL, k, l ) -=
+         map( submatrix( a, 2UL, 2UL, k, l ), submatrix( b, 0UL, 0UL, k, l ), op );
+      checkResult( c, ref, "Submatrix subtraction assignment" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Checking the number of rows of the given dense matrix.
 //
@@ -289,6 +748,122 @@ void OperationTest::checkNonZeros( const Type& matrix, size_t index, size_t expe
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the result of a matrix operation.
+//
+// \param result The computed dense matrix.
+// \param expected The expected dense matrix.
+// \param operation The name of the checked operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the computed matrix to the expected matrix. In case the dimensions of
+// the two matrices differ or any element does not match, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type1    // Type of the computed dense matrix
+        , typename Type2 >  // Type of the expected dense matrix
+void OperationTest::checkResult( const Type1& result, const Type2& expected,
+                                 const std::string& operation ) const
+{
+   checkRows   ( result, expected.rows()    );
+   checkColumns( result, expected.columns() );
+
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         if( !blaze::equal( result(i,j), expected(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: " << operation << " failed\n"
+                << " Details:\n"
+                << "   Dimensions     : " << result.rows() << "x" << result.columns() << "\n"
+                << "   Element        : (" << i << "," << j << ")\n"
+                << "   Result         : " << result(i,j) << "\n"
+                << "   Expected result: " << expected(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a total matrix reduction.
+//
+// \param result The computed value.
+// \param expected The expected value.
+// \param function The name of the checked function.
+// \param m The number of rows of the reduced matrix.
+// \param n The number of columns of the reduced matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the computed value to the expected value. In case the two values
+// differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the computed value
+        , typename Type2 >  // Type of the expected value
+void OperationTest::checkValue( const Type1& result, const Type2& expected,
+                                const std::string& function, size_t m, size_t n ) const
+{
+   if( !blaze::equal( result, expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << function << " failed\n"
+          << " Details:\n"
+          << "   Dimensions     : " << m << "x" << n << "\n"
+          << "   Result         : " << result << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a row-wise or column-wise matrix reduction.
+//
+// \param result The computed dense vector.
+// \param expected The expected dense vector.
+// \param function The name of the checked function.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the computed vector to the expected vector. In case the sizes of the
+// two vectors differ or any element does not match, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the computed dense vector
+        , typename Type2 >  // Type of the expected dense vector
+void OperationTest::checkReduction( const Type1& result, const Type2& expected,
+                                    const std::string& function ) const
+{
+   if( result.size() != expected.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << function << " failed\n"
+          << " Details:\n"
+          << "   Size         : " << result.size() << "\n"
+          << "   Expected size: " << expected.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      if( !blaze::equal( result[i], expected[i] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << function << " failed\n"
+             << " Details:\n"
+             << "   Size           : " << result.size() << "\n"
+             << "   Element        : " << i << "\n"
+             << "   Result         : " << result[i] << "\n"
+             << "   Expected result: " << expected[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 
 
 //=================================================================================================
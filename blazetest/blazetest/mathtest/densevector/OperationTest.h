@@ -40,9 +40,16 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <cstdlib>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/util/Random.h>
 
 
 namespace blazetest {
@@ -65,6 +72,54 @@ namespace densevector {
 */
 class OperationTest
 {
+ private:
+   //**Custom operations***************************************************************************
+   /*!\brief Vectorizable custom unary operation for the map() tests.
+   */
+   struct Cube
+   {
+      template< typename T >
+      struct SIMDEnabled { enum { value = blaze::IntrinsicTrait<T>::multiplication }; };
+
+      template< typename T >
+      T operator()( const T& a ) const { return a * a * a; }
+
+      template< typename T >
+      T load( const T& a ) const { return a * a * a; }
+   };
+
+   /*!\brief Non-vectorizable custom unary operation for the map() tests.
+   */
+   struct Shift
+   {
+      template< typename T >
+      T operator()( const T& a ) const { return a + T(1); }
+   };
+
+   /*!\brief Vectorizable custom binary operation for the map() tests.
+   */
+   struct Axpy
+   {
+      template< typename T >
+      struct SIMDEnabled { enum { value = blaze::IntrinsicTrait<T>::addition &&
+                                          blaze::IntrinsicTrait<T>::multiplication }; };
+
+      template< typename T >
+      T operator()( const T& a, const T& b ) const { return a * b + a; }
+
+      template< typename T >
+      T load( const T& a, const T& b ) const { return a * b + a; }
+   };
+
+   /*!\brief Non-vectorizable custom binary operation for the map() tests.
+   */
+   struct Blend
+   {
+      template< typename T >
+      T operator()( const T& a, const T& b ) const { return T(2) * a - b; }
+   };
+   //**********************************************************************************************
+
  public:
    //**Constructors********************************************************************************
    /*!\name Constructors */
@@ -87,6 +142,20 @@ class OperationTest
    void testNormalize();
    void testMinimum();
    void testMaximum();
+   void testReduction();
+   void testMap();
+
+   template< typename T >
+   void testReduction();
+
+   template< typename VT1, typename VT2 >
+   void testReduction( const VT1& a, const VT2& b );
+
+   template< typename OP >
+   void testMap( size_t n, OP op );
+
+   template< typename OP >
+   void testBinaryMap( size_t n, OP op );
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
@@ -96,6 +165,13 @@ class OperationTest
 
    template< typename Type >
    void checkNonZeros( const Type& vector, size_t nonzeros ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& expected, const std::string& operation ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkValue( const Type1& result, const Type2& expected,
+                    const std::string& function, size_t size ) const;
    //@}
    //**********************************************************************************************
 
@@ -117,6 +193,265 @@ class OperationTest
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Test of the reduction functions for dense vectors of the given element type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reduction functions for dense vectors with element type \a T. The
+// vector sizes include 0 and 1, sizes below and above a single SIMD vector, and a size beyond
+// the SMP reduction threshold. All tests are repeated for unaligned subvectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the dense vectors
+void OperationTest::testReduction()
+{
+   using blaze::subvector;
+
+   const size_t simd( blaze::IntrinsicTrait<T>::size );
+
+   const size_t sizes[] = { 0UL, 1UL, simd-1UL, simd+1UL, 4UL*simd+3UL, 127UL,
+                            blaze::SMP_DVECREDUCE_THRESHOLD + 5UL };
+
+   for( size_t k=0UL; k<sizeof(sizes)/sizeof(size_t); ++k )
+   {
+      const size_t n( sizes[k] );
+
+      // Random values for the additive, minimum and maximum reductions and values with a
+      // small product for the multiplicative reductions
+      blaze::DynamicVector<T,blaze::rowVector> a( n ), b( n );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         a[i] = T( blaze::rand<int>( -9, 9 ) );
+         b[i] = ( i % 3UL == 1UL )?( T(-1) ):( T(1) );
+      }
+      for( size_t i=0UL; i<n; i+=n/4UL+1UL ) {
+         b[i] = T(2);
+      }
+
+      testReduction( a, b );
+
+      if( n > 1UL ) {
+         testReduction( subvector( a, 1UL, n-1UL ), subvector( b, 1UL, n-1UL ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reduction functions for the given pair of dense vectors.
+//
+// \param a The dense vector for the additive, minimum, maximum, and norm reductions.
+// \param b The dense vector for the multiplicative reductions.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the reduce(), sum(), prod(), min(), max(), argmin(),
+// argmax(), l1Norm(), l2Norm(), linfNorm(), and length() functions to the according scalar
+// computations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the first dense vector
+        , typename VT2 >  // Type of the second dense vector
+void OperationTest::testReduction( const VT1& a, const VT2& b )
+{
+   using std::abs;
+
+   typedef typename VT1::ElementType  ET;
+
+   const size_t n( a.size() );
+
+   ET refSum( 0 ), refProd( 1 ), refMin( 0 ), refMax( 0 ), refL1( 0 ), refLinf( 0 ), refSqr( 0 );
+   size_t refArgmin( 0UL ), refArgmax( 0UL );
+
+   if( n > 0UL ) {
+      refMin = a[0UL];
+      refMax = a[0UL];
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      refSum  += a[i];
+      refProd *= b[i];
+      refL1   += abs( a[i] );
+      refSqr  += a[i] * a[i];
+      if( abs( a[i] ) > refLinf ) refLinf = abs( a[i] );
+      if( a[i] < refMin ) { refMin = a[i]; refArgmin = i; }
+      if( a[i] > refMax ) { refMax = a[i]; refArgmax = i; }
+   }
+
+   const double refL2( std::sqrt( double( refSqr ) ) );
+
+   checkValue( reduce( a, blaze::Add() ), refSum , "reduce()"  , n );
+   checkValue( sum( a )                 , refSum , "sum()"     , n );
+   checkValue( prod( b )                , refProd, "prod()"    , n );
+   checkValue( min( a )                 , refMin , "min()"     , n );
+   checkValue( max( a )                 , refMax , "max()"     , n );
+   checkValue( argmin( a )              , refArgmin, "argmin()", n );
+   checkValue( argmax( a )              , refArgmax, "argmax()", n );
+   checkValue( l1Norm( a )              , refL1  , "l1Norm()"  , n );
+   checkValue( l2Norm( a )              , refL2  , "l2Norm()"  , n );
+   checkValue( linfNorm( a )            , refLinf, "linfNorm()", n );
+   checkValue( length( a )              , refL2  , "length()"  , n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the unary \c map() function for a single vector size.
+//
+// \param n The size of the vectors.
+// \param op The custom unary operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of the
+// unary map() expression for dense vectors of size \a n. Additionally, the map() expression is
+// evaluated on and assigned to unaligned subvectors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename OP >  // Type of the custom operation
+void OperationTest::testMap( size_t n, OP op )
+{
+   using blaze::randomize;
+   using blaze::subvector;
+
+   blaze::DynamicVector<double,blaze::rowVector> a( n ), b( n ), c( n ), ref( n );
+   randomize( a, -9.0, 9.0 );
+   randomize( b, -9.0, 9.0 );
+
+   // Assignment
+   for( size_t i=0UL; i<n; ++i )
+      ref[i] = op( a[i] );
+
+   c = map( a, op );
+   checkResult( c, ref, "Assignment" );
+
+   // Addition assignment
+   for( size_t i=0UL; i<n; ++i )
+      ref[i] = b[i] + op( a[i] );
+
+   c = b;
+   c += map( a, op );
+   checkResult( c, ref, "Addition assignment" );
+
+   // Subtraction assignment
+   for( size_t i=0UL; i<n; ++i )
+      ref[i] = b[i] - op( a[i] );
+
+   c = b;
+   c -= map( a, op );
+   checkResult( c, ref, "Subtraction assignment" );
+
+   // Subvector assignment
+   if( n > 2UL )
+   {
+      const size_t m( n - 2UL );
+
+      ref = b;
+      for( size_t i=0UL; i<m; ++i )
+         ref[i+1UL] = op( a[i+2UL] );
+
+      c = b;
+      subvector( c, 1UL, m ) = map( subvector( a, 2UL, m ), op );
+      checkResult( c, ref, "Subvector assignment" );
+
+      for( size_t i=0UL; i<m; ++i )
+         ref[i+1UL] = b[i+1UL] + op( a[i+2UL] );
+
+      c = b;
+      subvector( c, 1UL, m ) += map( subvector( a, 2UL, m ), op );
+      checkResult( c, ref, "Subvector addition assignment" );
+
+      for( size_t i=0UL; i<m; ++i )
+         ref[i+1UL] = b[i+1UL] - op( a[i+2UL] );
+
+      c = b;
+      subvector( c, 1UL, m ) -= map( subvector( a, 2UL, m ), op );
+      checkResult( c, ref, "Subvector subtraction assignment" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the binary \c map() function for a single vector size.
+//
+// \param n The size of the vectors.
+// \param op The custom binary operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of the
+// binary map() expression for dense vectors of size \a n. Additionally, the map() expression
+// is evaluated on and assigned to unaligned subvectors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename OP >  // Type of the custom operation
+void OperationTest::testBinaryMap( size_t n, OP op )
+{
+   using blaze::randomize;
+   using blaze::subvector;
+
+   blaze::DynamicVector<double,blaze::rowVector> a( n ), b( n ), c( n ), d( n ), ref( n );
+   randomize( a, -9.0, 9.0 );
+   randomize( b, -9.0, 9.0 );
+   randomize( d, -9.0, 9.0 );
+
+   // Assignment
+   for( size_t i=0UL; i<n; ++i )
+      ref[i] = op( a[i], b[i] );
+
+   c = map( a, b, op );
+   checkResult( c, ref, "Assignment" );
+
+   // Addition assignment
+   for( size_t i=0UL; i<n; ++i )
+      ref[i] = d[i] + op( a[i], b[i] );
+
+   c = d;
+   c += map( a, b, op );
+   checkResult( c, ref, "Addition assignment" );
+
+   // Subtraction assignment
+   for( size_t i=0UL; i<n; ++i )
+      ref[i] = d[i] - op( a[i], b[i] );
+
+   c = d;
+   c -= map( a, b, op );
+   checkResult( c, ref, "Subtraction assignment" );
+
+   // Subvector assignment
+   if( n > 2UL )
+   {
+      const size_t m( n - 2UL );
+
+      ref = d;
+      for( size_t i=0UL; i<m; ++i )
+         ref[i+1UL] = op( a[i+2UL], b[i] );
+
+      c = d;
+      subvector( c, 1UL, m ) = map( subvector( a, 2UL, m ), subvector( b, 0UL, m ), op );
+      checkResult( c, ref, "Subvector assignment" );
+
+      for( size_t i=0UL; i<m; ++i )
+         ref[i+1UL] = d[i+1UL] + op( a[i+2UL], b[i] );
+
+      c = d;
+      subvector( c, 1UL, m ) += map( subvector( a, 2UL, m ), subvector( b, 0UL, m ), op );
+      checkResult( c, ref, "Subvector addition assignment" );
+
+      for( size_t i=0UL; i<m; ++i )
+         ref[i+1UL] = d[i+1UL] - op( a[i+2UL], b[i] );
+
+      c = d;
+      subvector( c, 1UL, m ) -= map( subvector( a, 2UL, m ), subvector( b, 0UL, m ), op );
+      checkResult( c, ref, "Subvector subtraction assignment" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Checking the size of the given dense vector.
 //
@@ -201,6 +536,74 @@ void OperationTest::checkNonZeros( const Type& vector, size_t expectedNonZeros )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the result of a vector operation.
+//
+// \param result The computed dense vector.
+// \param expected The expected dense vector.
+// \param operation The name of the checked operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the computed vector to the expected vector. In case the size of the
+// two vectors differs or any element does not match, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type1    // Type of the computed dense vector
+        , typename Type2 >  // Type of the expected dense vector
+void OperationTest::checkResult( const Type1& result, const Type2& expected,
+                                 const std::string& operation ) const
+{
+   checkSize( result, expected.size() );
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      if( !blaze::equal( result[i], expected[i] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << operation << " failed\n"
+             << " Details:\n"
+             << "   Size           : " << result.size() << "\n"
+             << "   Index          : " << i << "\n"
+             << "   Result         : " << result[i] << "\n"
+             << "   Expected result: " << expected[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a vector reduction.
+//
+// \param result The computed value.
+// \param expected The expected value.
+// \param function The name of the checked function.
+// \param size The size of the reduced vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the computed value to the expected value. In case the two values
+// differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the computed value
+        , typename Type2 >  // Type of the expected value
+void OperationTest::checkValue( const Type1& result, const Type2& expected,
+                                const std::string& function, size_t size ) const
+{
+   if( !blaze::equal( result, expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << function << " failed\n"
+          << " Details:\n"
+          << "   Size           : " << size << "\n"
+          << "   Result         : " << result << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
 
 
 //=================================================================================================
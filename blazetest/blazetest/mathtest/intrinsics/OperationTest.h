@@ -44,13 +44,17 @@
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#include <blaze/math/Functors.h>
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/FalseType.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/policies/Deallocate.h>
 #include <blaze/util/Random.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/TrueType.h>
 #include <blaze/util/UniqueArray.h>
 
 
@@ -104,7 +108,16 @@ class OperationTest : private blaze::NonCopyable
    void testStore    ();
    void testStream   ();
    void testStoreu   ( size_t offset );
+   void testMaskload ( size_t offset );
+   void testMaskstore( size_t offset );
    void testReduction();
+   void testFmadd    ( blaze::TrueType  );
+   void testFmadd    ( blaze::FalseType );
+   void testMathFunctions( blaze::TrueType  );
+   void testMathFunctions( blaze::FalseType );
+
+   template< typename OP >
+   void testMathFunction( const std::string& name, OP op, T min, T max );
    //@}
    //**********************************************************************************************
 
@@ -165,9 +178,17 @@ OperationTest<T>::OperationTest()
 
    for( size_t offset=0UL; offset<IT::size; ++offset ) {
       testStoreu( offset );
+      testMaskload( offset );
+      testMaskstore( offset );
    }
 
    testReduction();
+   testFmadd( typename blaze::SelectType< IT::multiplication
+                                        , blaze::TrueType
+                                        , blaze::FalseType >::Type() );
+   testMathFunctions( typename blaze::SelectType< IT::mathFunctions
+                                                , blaze::TrueType
+                                                , blaze::FalseType >::Type() );
 }
 //*************************************************************************************************
 
@@ -265,6 +286,113 @@ void OperationTest<T>::testStoreu( size_t offset )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the masked load operation.
+//
+// \param offset The offset of the first loaded value from an aligned address.
+// \return void
+// \exception std::runtime_error Masked load error detected.
+//
+// This function tests the masked load operation for all numbers of values \f$ [0..size] \f$.
+// The loaded lanes are compared to the source values, all remaining lanes are required to be
+// zero. In order to detect values that are read although they are masked out, all values past
+// the last loaded value are set to a non-zero marker. In case any error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testMaskload( size_t offset )
+{
+   using blaze::maskload;
+   using blaze::store;
+
+   test_ = "maskload() operation";
+
+   for( size_t n=0UL; n<=IT::size; ++n )
+   {
+      initialize();
+
+      for( size_t i=n; i<IT::size; ++i ) {
+         a_[offset+i] = T( 1 );
+      }
+
+      store( b_, maskload( a_+offset, n ) );
+
+      for( size_t i=0UL; i<IT::size; ++i )
+      {
+         const T ref( ( i < n )?( a_[offset+i] ):( T() ) );
+
+         if( b_[i] != ref ) {
+            std::ostringstream oss;
+            oss.precision( 20 );
+            oss << " Test : " << test_ << "\n"
+                << " Error: Value mismatch detected at lane " << i << "\n"
+                << " Details:\n"
+                << "   Offset           = " << offset << "\n"
+                << "   Number of values = " << n << "\n"
+                << "   Expected value   = " << ref << "\n"
+                << "   Loaded value     = " << b_[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the masked store operation.
+//
+// \param offset The offset of the first stored value from an aligned address.
+// \return void
+// \exception std::runtime_error Masked store error detected.
+//
+// This function tests the masked store operation for all numbers of values \f$ [0..size] \f$.
+// The stored values are compared to the source vector, all values before and after the stored
+// range are required to be unchanged. In case any error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testMaskstore( size_t offset )
+{
+   using blaze::load;
+   using blaze::maskstore;
+
+   test_ = "maskstore() operation";
+
+   Ptr c( blaze::allocate<T>( NN ) );
+
+   for( size_t n=0UL; n<=IT::size; ++n )
+   {
+      initialize();
+
+      for( size_t i=0UL; i<NN; ++i ) {
+         c[i] = b_[i];
+      }
+
+      maskstore( b_+offset, n, load( a_ ) );
+
+      for( size_t i=0UL; i<NN; ++i )
+      {
+         const T ref( ( i >= offset && i < offset+n )?( a_[i-offset] ):( c[i] ) );
+
+         if( b_[i] != ref ) {
+            std::ostringstream oss;
+            oss.precision( 20 );
+            oss << " Test : " << test_ << "\n"
+                << " Error: Value mismatch detected at index " << i << "\n"
+                << " Details:\n"
+                << "   Offset           = " << offset << "\n"
+                << "   Number of values = " << n << "\n"
+                << "   Expected value   = " << ref << "\n"
+                << "   Stored value     = " << b_[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the reduction operation.
 //
@@ -312,6 +440,180 @@ void OperationTest<T>::testReduction()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the fused multiply-add operations.
+//
+// \return void
+// \exception std::runtime_error Fused multiply-add error detected.
+//
+// This function tests the fused multiply-add operations (fmadd(), fmsub(), and fnmadd()) by
+// comparing their results to the according scalar operations. In case any error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testFmadd( blaze::TrueType )
+{
+   using blaze::fmadd;
+   using blaze::fmsub;
+   using blaze::fnmadd;
+   using blaze::load;
+   using blaze::randomize;
+   using blaze::store;
+
+   Ptr c( blaze::allocate<T>( NN ) );
+   Ptr d( blaze::allocate<T>( NN ) );
+
+   for( size_t op=0UL; op<3UL; ++op )
+   {
+      test_ = ( op == 0UL )?( "fmadd() operation" ):
+              ( op == 1UL )?( "fmsub() operation" ):( "fnmadd() operation" );
+
+      for( size_t i=0UL; i<NN; ++i ) {
+         randomize( a_[i], 0, 9 );
+         randomize( b_[i], 0, 9 );
+      }
+
+      for( size_t i=0UL; i<NN; ++i ) {
+         randomize( c[i], 0, 9 );
+      }
+
+      for( size_t i=0UL; i<N; i+=IT::size )
+      {
+         const IntrinsicType a( load( a_+i ) );
+         const IntrinsicType b( load( b_+i ) );
+         const IntrinsicType x( load( c.get()+i ) );
+
+         if( op == 0UL )
+            store( d.get()+i, fmadd( a, b, x ) );
+         else if( op == 1UL )
+            store( d.get()+i, fmsub( a, b, x ) );
+         else
+            store( d.get()+i, fnmadd( a, b, x ) );
+      }
+
+      for( size_t i=0UL; i<N; ++i )
+      {
+         const T ref( ( op == 0UL )?( T( a_[i] * b_[i] + c[i] ) ):
+                      ( op == 1UL )?( T( a_[i] * b_[i] - c[i] ) ):( T( c[i] - a_[i] * b_[i] ) ) );
+
+         if( !blaze::equal( ref, d[i] ) ) {
+            std::ostringstream oss;
+            oss.precision( 20 );
+            oss << " Test : " << test_ << "\n"
+                << " Error: Value mismatch detected at index " << i << "\n"
+                << " Details:\n"
+                << "   a                 = " << a_[i] << "\n"
+                << "   b                 = " << b_[i] << "\n"
+                << "   c                 = " << c[i] << "\n"
+                << "   Scalar result     = " << ref << "\n"
+                << "   Vectorized result = " << d[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the fused multiply-add tests for data types without vectorized multiplication.
+//
+// \return void
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testFmadd( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*!\brief Testing the elementwise math functions.
+//
+// \return void
+// \exception std::runtime_error Math function error detected.
+//
+// This function tests the vectorized math functions (sqrt(), invsqrt(), exp(), log(), pow(),
+// sin(), cos(), and tanh()) by comparing their results to the according scalar functions. In
+// case any error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testMathFunctions( blaze::TrueType )
+{
+   testMathFunction( "sqrt()"   , blaze::Sqrt()          , T(  0), T(1000) );
+   testMathFunction( "invsqrt()", blaze::InvSqrt()       , T(0.1), T(1000) );
+   testMathFunction( "exp()"    , blaze::Exp()           , T(-80), T(  80) );
+   testMathFunction( "log()"    , blaze::Log()           , T(0.1), T(1000) );
+   testMathFunction( "pow()"    , blaze::Pow<T>( T(1.5) ), T(0.1), T(  10) );
+   testMathFunction( "sin()"    , blaze::Sin()           , T(-10), T(  10) );
+   testMathFunction( "cos()"    , blaze::Cos()           , T(-10), T(  10) );
+   testMathFunction( "tanh()"   , blaze::Tanh()          , T( -5), T(   5) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the math function tests for data types without vectorized math functions.
+//
+// \return void
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testMathFunctions( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing a single elementwise math function.
+//
+// \param name The name of the math function.
+// \param op The functor representing the math function.
+// \param min The lower limit of the random input values.
+// \param max The upper limit of the random input values.
+// \return void
+// \exception std::runtime_error Math function error detected.
+//
+// This function tests the given math function by comparing the result of the vectorized
+// evaluation for random input values in the range \f$ [min..max) \f$ to the result of the
+// scalar evaluation. In case any error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+template< typename OP >  // Type of the math function
+void OperationTest<T>::testMathFunction( const std::string& name, OP op, T min, T max )
+{
+   using blaze::load;
+   using blaze::randomize;
+   using blaze::store;
+
+   test_ = name + " operation";
+
+   for( size_t i=0UL; i<NN; ++i ) {
+      randomize( a_[i], min, max );
+   }
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      store( b_+i, op.load( load( a_+i ) ) );
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      if( !blaze::equal( op( a_[i] ), b_[i] ) ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test : " << test_ << "\n"
+             << " Error: Value mismatch detected at index " << i << "\n"
+             << " Details:\n"
+             << "   Input            = " << a_[i] << "\n"
+             << "   Scalar result    = " << op( a_[i] ) << "\n"
+             << "   Vectorized result = " << b_[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
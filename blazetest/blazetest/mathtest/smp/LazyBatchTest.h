@@ -0,0 +1,263 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/LazyBatchTest.h
+//  \brief Header file for the LazyBatch class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_LAZYBATCHTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_LAZYBATCHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the LazyBatch class.
+//
+// This class represents a test suite for the LazyBatch class contained in the
+// <em><blaze/math/smp/LazyBatch.h></em> header file. The tests are performed for all
+// parallelization modes. In case of the C++11 and Boost thread parallelizations, the
+// independent assignments below the SMP thresholds are executed concurrently, otherwise
+// all assignments are executed one after another.
+*/
+class LazyBatchTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicVector<int,blaze::columnVector>  VT;   //!< Type of the dense vectors.
+   typedef blaze::DynamicMatrix<int,blaze::rowMajor>      MT;   //!< Type of the row-major matrices.
+   typedef blaze::DynamicMatrix<int,blaze::columnMajor>   TMT;  //!< Type of the column-major matrices.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit LazyBatchTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testLevels();
+   void testResults();
+   void testBarriers();
+   void testException();
+   void testClear();
+
+   template< typename Type1, typename Type2 >
+   void checkVector( const Type1& result, const Type2& expected ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkMatrix( const Type1& result, const Type2& expected ) const;
+
+   void checkSize  ( const blaze::LazyBatch& batch, size_t expectedSize   ) const;
+   void checkLevels( const blaze::LazyBatch& batch, size_t expectedLevels ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a batched vector assignment.
+//
+// \param result The computed dense vector.
+// \param expected The expected dense vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the computed vector to the expected vector. In case the sizes of the
+// two vectors differ or any element does not match, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the computed dense vector
+        , typename Type2 >  // Type of the expected dense vector
+void LazyBatchTest::checkVector( const Type1& result, const Type2& expected ) const
+{
+   if( result.size() != expected.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size detected\n"
+          << " Details:\n"
+          << "   Size         : " << result.size() << "\n"
+          << "   Expected size: " << expected.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      if( result[i] != expected[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Size           : " << result.size() << "\n"
+             << "   Element        : " << i << "\n"
+             << "   Result         : " << result[i] << "\n"
+             << "   Expected result: " << expected[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a batched matrix assignment.
+//
+// \param result The computed dense matrix.
+// \param expected The expected dense matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the computed matrix to the expected matrix. In case the dimensions of
+// the two matrices differ or any element does not match, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type1    // Type of the computed dense matrix
+        , typename Type2 >  // Type of the expected dense matrix
+void LazyBatchTest::checkMatrix( const Type1& result, const Type2& expected ) const
+{
+   if( result.rows() != expected.rows() || result.columns() != expected.columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid dimensions detected\n"
+          << " Details:\n"
+          << "   Dimensions         : " << result.rows() << "x" << result.columns() << "\n"
+          << "   Expected dimensions: " << expected.rows() << "x" << expected.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         if( result(i,j) != expected(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment failed\n"
+                << " Details:\n"
+                << "   Dimensions     : " << result.rows() << "x" << result.columns() << "\n"
+                << "   Element        : (" << i << "," << j << ")\n"
+                << "   Result         : " << result(i,j) << "\n"
+                << "   Expected result: " << expected(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the LazyBatch class.
+//
+// \return void
+*/
+void runTest()
+{
+   LazyBatchTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the LazyBatch class test.
+*/
+#define RUN_SMP_LAZYBATCH_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
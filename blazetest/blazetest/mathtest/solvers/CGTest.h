@@ -0,0 +1,255 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/CGTest.h
+//  \brief Header file for the CG solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_CGTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_CGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/solvers/CG.h>
+#include <blaze/math/solvers/GaussianElimination.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the CG solver.
+//
+// This class represents a test suite for the CG solver contained in the
+// <em><blaze/math/solvers/CG.h></em> header file and for the Jacobi, SSOR, and IC(0)
+// preconditioners. The preconditioners are compared to the solution of a linear system with
+// the according dense preconditioner matrix, the plain and the preconditioned CG method are
+// applied to linear systems with known solution. In case shared memory parallelization is
+// enabled, the CG kernels are additionally checked for reproducible results.
+*/
+class CGTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit CGTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testCG();
+   void testJacobi();
+   void testSSOR();
+   void testIC();
+   void testPCG();
+   void testDeterminism();
+
+   template< typename PC >
+   void testPCG( const PC& pc, const blaze::CMatMxN& A, const blaze::VecN& expected );
+
+   template< typename PC >
+   void checkApply( const PC& pc, const blaze::CMatMxN& M ) const;
+
+   void setupBand     ( blaze::CMatMxN& A, size_t n ) const;
+   void setupLaplacian( blaze::CMatMxN& A, size_t m ) const;
+   void setupSolution ( blaze::VecN& x, size_t n ) const;
+   void checkSolution ( const blaze::CG& cg, bool converged,
+                        const blaze::VecN& x, const blaze::VecN& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the preconditioned CG method with the given preconditioner.
+//
+// \param pc The preconditioner for the system matrix.
+// \param A The system matrix.
+// \param expected The known solution of the linear system.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves the linear system \f$ A \cdot x + b = 0 \f$ with the right-hand side
+// \f$ b = -A \cdot expected \f$ by means of the preconditioned CG method. In case the solver
+// does not converge or the solution differs from the known solution, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename PC >  // Type of the preconditioner
+void CGTest::testPCG( const PC& pc, const blaze::CMatMxN& A, const blaze::VecN& expected )
+{
+   const blaze::VecN b( -( A * expected ) );
+
+   blaze::CG cg;
+   cg.setMaxIterations( 1000UL );
+   cg.setThreshold( 1E-12 );
+
+   blaze::VecN x;
+   const bool converged( cg.solve( A, b, x, pc ) );
+
+   checkSolution( cg, converged, x, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the application of a preconditioner.
+//
+// \param pc The preconditioner to be checked.
+// \param M The dense preconditioner matrix represented by the preconditioner.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function applies the given preconditioner to several residual vectors and compares the
+// result to the solution of the linear system \f$ M \cdot z = r \f$ computed by Gaussian
+// elimination. In case any element differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename PC >  // Type of the preconditioner
+void CGTest::checkApply( const PC& pc, const blaze::CMatMxN& M ) const
+{
+   const size_t n( M.rows() );
+
+   blaze::GaussianElimination solver;
+
+   for( size_t k=0UL; k<3UL; ++k )
+   {
+      blaze::VecN r( n ), z, expected;
+
+      for( size_t i=0UL; i<n; ++i ) {
+         r[i] = std::sin( blaze::real( ( k+1UL )*i+k ) );
+      }
+
+      const blaze::VecN b( -r );
+
+      pc.apply( r, z );
+      solver.solve( M, b, expected );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         if( std::fabs( z[i] - expected[i] ) > 1E-10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Application of the preconditioner failed\n"
+                << " Details:\n"
+                << "   Size           : " << n << "\n"
+                << "   Index          : " << i << "\n"
+                << "   Result         : " << z[i] << "\n"
+                << "   Expected result: " << expected[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the CG solver.
+//
+// \return void
+*/
+void runTest()
+{
+   CGTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CG solver test.
+*/
+#define RUN_SOLVERS_CG_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -43,6 +43,12 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/math/SparseSubmatrix.h>
 
 
 namespace blazetest {
@@ -65,6 +71,31 @@ namespace sparsematrix {
 */
 class OperationTest
 {
+ private:
+   //**Custom operations***************************************************************************
+   /*!\brief Vectorizable custom unary operation for the map() tests.
+   */
+   struct Cube
+   {
+      template< typename T >
+      struct SIMDEnabled { enum { value = blaze::IntrinsicTrait<T>::multiplication }; };
+
+      template< typename T >
+      T operator()( const T& a ) const { return a * a * a; }
+
+      template< typename T >
+      T load( const T& a ) const { return a * a * a; }
+   };
+
+   /*!\brief Non-vectorizable custom unary operation for the map() tests.
+   */
+   struct Twice
+   {
+      template< typename T >
+      T operator()( const T& a ) const { return a + a; }
+   };
+   //**********************************************************************************************
+
  public:
    //**Constructors********************************************************************************
    /*!\name Constructors */
@@ -90,6 +121,10 @@ class OperationTest
    void testIsUpper();
    void testMinimum();
    void testMaximum();
+   void testMap();
+
+   template< bool SO, typename OP >
+   void testMap( size_t m, size_t n, OP op );
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -105,6 +140,9 @@ class OperationTest
 
    template< typename Type >
    void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& expected, const std::string& operation ) const;
    //@}
    //**********************************************************************************************
 
@@ -126,6 +164,106 @@ class OperationTest
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Test of the \c map() function for a single matrix size.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \param op The custom operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment of the map() expression for \a m by \a n sparse matrices
+// with storage order \a SO to a sparse and a dense matrix and the addition assignment and
+// subtraction assignment to a dense matrix. Additionally, the map() expression is evaluated
+// on a sparse submatrix and assigned to an unaligned dense submatrix. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO        // Storage order of the matrices
+        , typename OP >  // Type of the custom operation
+void OperationTest::testMap( size_t m, size_t n, OP op )
+{
+   using blaze::randomize;
+   using blaze::submatrix;
+
+   blaze::CompressedMatrix<double,SO> a( m, n ), c( m, n );
+   blaze::DynamicMatrix<double,SO> b( m, n ), d( m, n ), ref( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=i%3UL; j<n; j+=3UL ) {
+         a(i,j) = blaze::rand<double>( 1.0, 9.0 );
+      }
+   }
+   randomize( b, -9.0, 9.0 );
+
+   const blaze::DynamicMatrix<double,SO> x( a );
+
+   // Sparse matrix assignment
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = op( x(i,j) );
+
+   c = map( a, op );
+   checkResult( c, ref, "Sparse matrix assignment" );
+   checkNonZeros( c, a.nonZeros() );
+
+   // Dense matrix assignment
+   d = map( a, op );
+   checkResult( d, ref, "Dense matrix assignment" );
+
+   // Dense matrix addition assignment
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = b(i,j) + op( x(i,j) );
+
+   d = b;
+   d += map( a, op );
+   checkResult( d, ref, "Dense matrix addition assignment" );
+
+   // Dense matrix subtraction assignment
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = b(i,j) - op( x(i,j) );
+
+   d = b;
+   d -= map( a, op );
+   checkResult( d, ref, "Dense matrix subtraction assignment" );
+
+   // Submatrix assignment
+   if( m > 2UL && n > 2UL )
+   {
+      const size_t k( m - 2UL );
+      const size_t l( n - 2UL );
+
+      ref = b;
+      for( size_t i=0UL; i<k; ++i )
+         for( size_t j=0UL; j<l; ++j )
+            ref(i+1UL,j+1UL) = op( x(i+2UL,j+2UL) );
+
+      d = b;
+      submatrix( d, 1UL, 1UL, k, l ) = map( submatrix( a, 2UL, 2UL, k, l ), op );
+      checkResult( d, ref, "Submatrix assignment" );
+
+      for( size_t i=0UL; i<k; ++i )
+         for( size_t j=0UL; j<l; ++j )
+            ref(i+1UL,j+1UL) = b(i+1UL,j+1UL) + op( x(i+2UL,j+2UL) );
+
+      d = b;
+      submatrix( d, 1UL, 1UL, k, l ) += map( submatrix( a, 2UL, 2UL, k, l ), op );
+      checkResult( d, ref, "Submatrix addition assignment" );
+
+      for( size_t i=0UL; i<k; ++i )
+         for( size_t j=0UL; j<l; ++j )
+            ref(i+1UL,j+1UL) = b(i+1UL,j+1UL) - op( x(i+2UL,j+2UL) );
+
+      d = b;
+      submatrix( d, 1UL, 1UL, k, l ) -= map( submatrix( a, 2UL, 2UL, k, l ), op );
+      checkResult( d, ref, "Submatrix subtraction assignment" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Checking the number of rows of the given sparse matrix.
 //
@@ -289,6 +427,45 @@ void OperationTest::checkNonZeros( const Type& matrix, size_t index, size_t expe
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the result of a matrix operation.
+//
+// \param result The computed matrix.
+// \param expected The expected dense matrix.
+// \param operation The name of the checked operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the computed matrix to the expected matrix. In case the dimensions of
+// the two matrices differ or any element does not match, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type1    // Type of the computed matrix
+        , typename Type2 >  // Type of the expected dense matrix
+void OperationTest::checkResult( const Type1& result, const Type2& expected,
+                                 const std::string& operation ) const
+{
+   checkRows   ( result, expected.rows()    );
+   checkColumns( result, expected.columns() );
+
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         if( !blaze::equal( result(i,j), expected(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: " << operation << " failed\n"
+                << " Details:\n"
+                << "   Dimensions     : " << result.rows() << "x" << result.columns() << "\n"
+                << "   Element        : (" << i << "," << j << ")\n"
+                << "   Result         : " << result(i,j) << "\n"
+                << "   Expected result: " << expected(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 
 
 //=================================================================================================
@@ -43,6 +43,12 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/math/SparseSubvector.h>
 
 
 namespace blazetest {
@@ -65,6 +71,31 @@ namespace sparsevector {
 */
 class OperationTest
 {
+ private:
+   //**Custom operations***************************************************************************
+   /*!\brief Vectorizable custom unary operation for the map() tests.
+   */
+   struct Cube
+   {
+      template< typename T >
+      struct SIMDEnabled { enum { value = blaze::IntrinsicTrait<T>::multiplication }; };
+
+      template< typename T >
+      T operator()( const T& a ) const { return a * a * a; }
+
+      template< typename T >
+      T load( const T& a ) const { return a * a * a; }
+   };
+
+   /*!\brief Non-vectorizable custom unary operation for the map() tests.
+   */
+   struct Twice
+   {
+      template< typename T >
+      T operator()( const T& a ) const { return a + a; }
+   };
+   //**********************************************************************************************
+
  public:
    //**Constructors********************************************************************************
    /*!\name Constructors */
@@ -87,6 +118,10 @@ class OperationTest
    void testNormalize();
    void testMinimum();
    void testMaximum();
+   void testMap();
+
+   template< typename OP >
+   void testMap( size_t n, OP op );
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
@@ -96,6 +131,9 @@ class OperationTest
 
    template< typename Type >
    void checkNonZeros( const Type& vector, size_t nonzeros ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& expected, const std::string& operation ) const;
    //@}
    //**********************************************************************************************
 
@@ -117,6 +155,95 @@ class OperationTest
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Test of the \c map() function for a single vector size.
+//
+// \param n The size of the vectors.
+// \param op The custom operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment of the map() expression for sparse vectors of size \a n
+// to a sparse and a dense vector and the addition assignment and subtraction assignment to a
+// dense vector. Additionally, the map() expression is evaluated on a sparse subvector and
+// assigned to an unaligned dense subvector. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename OP >  // Type of the custom operation
+void OperationTest::testMap( size_t n, OP op )
+{
+   using blaze::randomize;
+   using blaze::subvector;
+
+   blaze::CompressedVector<double,blaze::rowVector> a( n ), c( n );
+   blaze::DynamicVector<double,blaze::rowVector> b( n ), d( n ), ref( n, 0.0 );
+
+   for( size_t i=0UL; i<n; i+=3UL ) {
+      a[i] = blaze::rand<double>( 1.0, 9.0 );
+   }
+   randomize( b, -9.0, 9.0 );
+
+   const blaze::DynamicVector<double,blaze::rowVector> x( a );
+
+   // Sparse vector assignment
+   for( size_t i=0UL; i<n; ++i )
+      ref[i] = op( x[i] );
+
+   c = map( a, op );
+   checkResult( c, ref, "Sparse vector assignment" );
+   checkNonZeros( c, a.nonZeros() );
+
+   // Dense vector assignment
+   d = map( a, op );
+   checkResult( d, ref, "Dense vector assignment" );
+
+   // Dense vector addition assignment
+   for( size_t i=0UL; i<n; ++i )
+      ref[i] = b[i] + op( x[i] );
+
+   d = b;
+   d += map( a, op );
+   checkResult( d, ref, "Dense vector addition assignment" );
+
+   // Dense vector subtraction assignment
+   for( size_t i=0UL; i<n; ++i )
+      ref[i] = b[i] - op( x[i] );
+
+   d = b;
+   d -= map( a, op );
+   checkResult( d, ref, "Dense vector subtraction assignment" );
+
+   // Subvector assignment
+   if( n > 2UL )
+   {
+      const size_t m( n - 2UL );
+
+      ref = b;
+      for( size_t i=0UL; i<m; ++i )
+         ref[i+1UL] = op( x[i+2UL] );
+
+      d = b;
+      subvector( d, 1UL, m ) = map( subvector( a, 2UL, m ), op );
+      checkResult( d, ref, "Subvector assignment" );
+
+      for( size_t i=0UL; i<m; ++i )
+         ref[i+1UL] = b[i+1UL] + op( x[i+2UL] );
+
+      d = b;
+      subvector( d, 1UL, m ) += map( subvector( a, 2UL, m ), op );
+      checkResult( d, ref, "Subvector addition assignment" );
+
+      for( size_t i=0UL; i<m; ++i )
+         ref[i+1UL] = b[i+1UL] - op( x[i+2UL] );
+
+      d = b;
+      subvector( d, 1UL, m ) -= map( subvector( a, 2UL, m ), op );
+      checkResult( d, ref, "Subvector subtraction assignment" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Checking the size of the given sparse vector.
 //
@@ -201,6 +328,42 @@ void OperationTest::checkNonZeros( const Type& vector, size_t expectedNonZeros )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the result of a vector operation.
+//
+// \param result The computed vector.
+// \param expected The expected dense vector.
+// \param operation The name of the checked operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the computed vector to the expected vector. In case the size of the
+// two vectors differs or any element does not match, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type1    // Type of the computed vector
+        , typename Type2 >  // Type of the expected dense vector
+void OperationTest::checkResult( const Type1& result, const Type2& expected,
+                                 const std::string& operation ) const
+{
+   checkSize( result, expected.size() );
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      if( !blaze::equal( result[i], expected[i] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << operation << " failed\n"
+             << " Details:\n"
+             << "   Size           : " << result.size() << "\n"
+             << "   Index          : " << i << "\n"
+             << "   Result         : " << result[i] << "\n"
+             << "   Expected result: " << expected[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 
 
 //=================================================================================================
@@ -0,0 +1,1050 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/blockcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/blockcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testClear();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testMultiplication();
+   testMatrixMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BlockCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (0x0)";
+
+      MT mat( 0UL, 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (6x9)";
+
+      MT mat( 6UL, 9UL );
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 9UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 3UL, 0UL );
+      checkNonZeros( mat, 5UL, 0UL );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (invalid size)";
+
+      try {
+         MT mat( 4UL, 6UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 6UL, 9UL );
+      cmat(0,1) = 1;
+      cmat(2,0) = 2;
+      cmat(3,4) = 3;
+      cmat(5,5) = 4;
+      cmat(5,8) = 5;
+
+      MT mat( cmat );
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 9UL );
+      checkNonZeros( mat, 27UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 2UL, 3UL );
+      checkNonZeros( mat, 3UL, 6UL );
+      checkNonZeros( mat, 5UL, 6UL );
+      checkMatrix  ( mat, cmat );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (invalid size)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 5UL, 6UL );
+      cmat(4,5) = 1;
+
+      try {
+         MT mat( cmat );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion of a matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> cmat( 3UL, 6UL );
+      cmat(0,5) = 1;
+      cmat(1,0) = 2;
+      cmat(1,1) = 3;
+
+      MT mat( cmat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 6UL );
+      checkNonZeros( mat, 18UL );
+      checkMatrix  ( mat, cmat );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (DynamicMatrix)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> dmat( 3UL, 6UL, 0 );
+      dmat(0,0) = 1;
+      dmat(1,4) = 2;
+      dmat(2,5) = 3;
+
+      MT mat( dmat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 6UL );
+      checkNonZeros( mat, 18UL );
+      checkNonZeros( mat, 0UL, 6UL );
+      checkMatrix  ( mat, dmat );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix copy constructor";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 6UL, 6UL );
+      cmat(0,0) = 1;
+      cmat(1,4) = 2;
+      cmat(5,1) = 3;
+
+      MT mat1( cmat );
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 6UL );
+      checkColumns ( mat2, 6UL );
+      checkNonZeros( mat2, 27UL );
+      checkMatrix  ( mat2, cmat );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix copy assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 6UL, 3UL );
+      cmat(0,1) = 1;
+      cmat(4,0) = 2;
+
+      MT mat1( cmat );
+      MT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 6UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 18UL );
+      checkMatrix  ( mat2, cmat );
+   }
+
+
+   //=====================================================================================
+   // Sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 9UL, 6UL );
+      cmat(0,1) = 1;
+      cmat(7,0) = 2;
+      cmat(8,5) = 3;
+
+      MT mat( 3UL, 3UL );
+      mat = cmat;
+
+      checkRows    ( mat, 9UL );
+      checkColumns ( mat, 6UL );
+      checkNonZeros( mat, 27UL );
+      checkMatrix  ( mat, cmat );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix assignment (expression)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 6UL, 6UL );
+      cmat(0,4) = 1;
+      cmat(3,2) = 2;
+      cmat(5,0) = 3;
+
+      MT mat;
+      mat = cmat * cmat;
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref( cmat * cmat );
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 6UL );
+      checkNonZeros( mat, 9UL );
+      checkMatrix  ( mat, ref );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix assignment (invalid size)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 4UL );
+      cmat(0,3) = 1;
+
+      MT mat( 3UL, 3UL );
+
+      try {
+         mat = cmat;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> dmat( 3UL, 6UL, 0 );
+      dmat(0,2) = 1;
+      dmat(1,0) = 2;
+
+      MT mat;
+      mat = dmat;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 6UL );
+      checkNonZeros( mat, 9UL );
+      checkMatrix  ( mat, dmat );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "BlockCompressedMatrix::operator()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 18UL, 12UL );
+   for( size_t i=0UL; i<18UL; ++i ) {
+      for( size_t k=0UL; k<i%5UL; ++k ) {
+         cmat( i, ( i+5UL*k ) % 12UL ) = int( i+k+1UL );
+      }
+   }
+
+   const MT mat( cmat );
+
+   for( size_t i=0UL; i<18UL; ++i ) {
+      for( size_t j=0UL; j<12UL; ++j ) {
+         if( mat(i,j) != cmat(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Function call operator failed\n"
+                << " Details:\n"
+                << "   Position       = (" << i << "," << j << ")\n"
+                << "   Result         = " << mat(i,j) << "\n"
+                << "   Expected value = " << cmat(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 6UL, 9UL );
+   cmat(0,8) = 1;
+   cmat(4,0) = 2;
+   cmat(5,2) = 3;
+   cmat(4,4) = 4;
+
+   const MT mat( cmat );
+
+   // Counting the number of elements in row 1 (zero row of a non-zero block)
+   {
+      test_ = "BlockCompressedMatrix iterator subtraction (zero row)";
+
+      const size_t number( mat.end(1) - mat.begin(1) );
+
+      if( number != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements in row 4
+   {
+      test_ = "BlockCompressedMatrix iterator subtraction";
+
+      const size_t number( mat.end(4) - mat.begin(4) );
+
+      if( number != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing the traversal of row 4
+   {
+      test_ = "BlockCompressedMatrix iterator traversal";
+
+      const size_t indices[6] = { 0UL, 1UL, 2UL, 3UL, 4UL, 5UL };
+      const int    values [6] = { 2, 0, 0, 0, 4, 0 };
+
+      size_t k( 0UL );
+      for( ConstIterator it=mat.cbegin(4); it!=mat.cend(4); ++it, ++k )
+      {
+         if( k >= 6UL || it->index() != indices[k] || it->value() != values[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element detected\n"
+                << " Details:\n"
+                << "   Position       : " << k << "\n"
+                << "   Index          : " << it->index() << "\n"
+                << "   Value          : " << it->value() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( k != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of traversed elements\n"
+             << " Details:\n"
+             << "   Number of elements         : " << k << "\n"
+             << "   Expected number of elements: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "BlockCompressedMatrix::nonZeros()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 36UL, 39UL );
+
+   for( size_t i=0UL; i<36UL; ++i ) {
+      for( size_t k=0UL; k<( i*7UL )%11UL; ++k ) {
+         cmat( i, ( i+k*5UL ) % 39UL ) = 1;
+      }
+   }
+
+   const MT mat( cmat );
+
+   checkRows    ( mat, 36UL );
+   checkColumns ( mat, 39UL );
+
+   size_t total( 0UL );
+
+   for( size_t ib=0UL; ib<12UL; ++ib )
+   {
+      size_t blocks( 0UL );
+
+      for( size_t jb=0UL; jb<13UL; ++jb ) {
+         bool nonzero( false );
+         for( size_t i=ib*3UL; i<ib*3UL+3UL; ++i ) {
+            for( size_t j=jb*3UL; j<jb*3UL+3UL; ++j ) {
+               if( cmat(i,j) != 0 ) nonzero = true;
+            }
+         }
+         if( nonzero ) ++blocks;
+      }
+
+      for( size_t i=ib*3UL; i<ib*3UL+3UL; ++i ) {
+         checkNonZeros( mat, i, blocks*3UL );
+      }
+
+      total += blocks*9UL;
+   }
+
+   checkNonZeros( mat, total );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "BlockCompressedMatrix::clear()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 6UL );
+   cmat(0,1) = 1;
+   cmat(2,3) = 2;
+
+   MT mat( cmat );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 6UL );
+   checkNonZeros( mat, 18UL );
+
+   mat.clear();
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+
+   mat = cmat;
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "BlockCompressedMatrix swap";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat1( 6UL, 6UL );
+   cmat1(0,0) = 1;
+   cmat1(4,4) = 2;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat2( 9UL, 3UL );
+   cmat2(8,0) = 3;
+
+   MT mat1( cmat1 );
+   MT mat2( cmat2 );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 9UL );
+   checkColumns ( mat1, 3UL );
+   checkNonZeros( mat1, 9UL );
+   checkMatrix  ( mat1, cmat2 );
+
+   checkRows    ( mat2, 6UL );
+   checkColumns ( mat2, 6UL );
+   checkNonZeros( mat2, 18UL );
+   checkMatrix  ( mat2, cmat1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "BlockCompressedMatrix::find()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 9UL, 6UL );
+   cmat(1,2) = 1;
+   cmat(6,1) = 3;
+   cmat(6,5) = 4;
+
+   const MT mat( cmat );
+
+   // Searching for the element (6,5)
+   {
+      const ConstIterator pos( mat.find( 6UL, 5UL ) );
+
+      if( pos == mat.end( 6UL ) || pos->index() != 5UL || pos->value() != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element (6,5) could not be found\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Searching for the zero element (6,2) within a non-zero block
+   {
+      const ConstIterator pos( mat.find( 6UL, 2UL ) );
+
+      if( pos == mat.end( 6UL ) || pos->index() != 2UL || pos->value() != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element (6,2) could not be found\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Searching for the non-existing element (1,4)
+   {
+      const ConstIterator pos( mat.find( 1UL, 4UL ) );
+
+      if( pos != mat.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-existing element could be found\n"
+             << " Details:\n"
+             << "   Required index = 4\n"
+             << "   Found index    = " << pos->index() << "\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Searching in the empty row 3
+   {
+      const ConstIterator pos( mat.find( 3UL, 0UL ) );
+
+      if( pos != mat.end( 3UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element in empty row could be found\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "BlockCompressedMatrix::lowerBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 9UL );
+   cmat(1,4) = 2;
+
+   const MT mat( cmat );
+
+   const size_t expected[9] = { 3UL, 3UL, 3UL, 3UL, 4UL, 5UL, 9UL, 9UL, 9UL };
+
+   for( size_t j=0UL; j<9UL; ++j )
+   {
+      const ConstIterator pos( mat.lowerBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 9UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower bound detected\n"
+             << " Details:\n"
+             << "   Required index = " << j << "\n"
+             << "   Found index    = " << index << "\n"
+             << "   Expected index = " << expected[j] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "BlockCompressedMatrix::upperBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 9UL );
+   cmat(1,4) = 2;
+
+   const MT mat( cmat );
+
+   const size_t expected[9] = { 3UL, 3UL, 3UL, 4UL, 5UL, 9UL, 9UL, 9UL, 9UL };
+
+   for( size_t j=0UL; j<9UL; ++j )
+   {
+      const ConstIterator pos( mat.upperBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 9UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid upper bound detected\n"
+             << " Details:\n"
+             << "   Required index = " << j << "\n"
+             << "   Found index    = " << index << "\n"
+             << "   Expected index = " << expected[j] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with 0x0 matrix
+   {
+      MT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with 3x6 matrix
+   {
+      MT mat( 3UL, 6UL );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a BlockCompressedMatrix with a dense vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the sparse matrix/dense vector multiplication with a
+// BlockCompressedMatrix for integral, single precision and double precision element types and
+// several block sizes. The results are compared to the according computation with a
+// blaze::CompressedMatrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   //=====================================================================================
+   // Integral element type
+   //=====================================================================================
+
+   test_ = "BlockCompressedMatrix/dense vector multiplication (int, 2x2 blocks)";
+   testVectorKernel<int,2UL>( 120UL, 84UL );
+
+   test_ = "BlockCompressedMatrix/dense vector multiplication (int, 3x3 blocks)";
+   testVectorKernel<int,3UL>( 120UL, 84UL );
+
+
+   //=====================================================================================
+   // Single precision element type
+   //=====================================================================================
+
+   test_ = "BlockCompressedMatrix/dense vector multiplication (float, 2x2 blocks)";
+   testVectorKernel<float,2UL>( 120UL, 84UL );
+
+   test_ = "BlockCompressedMatrix/dense vector multiplication (float, 3x3 blocks)";
+   testVectorKernel<float,3UL>( 120UL, 84UL );
+
+   test_ = "BlockCompressedMatrix/dense vector multiplication (float, 4x4 blocks)";
+   testVectorKernel<float,4UL>( 120UL, 84UL );
+
+
+   //=====================================================================================
+   // Double precision element type
+   //=====================================================================================
+
+   test_ = "BlockCompressedMatrix/dense vector multiplication (double, 2x2 blocks)";
+   testVectorKernel<double,2UL>( 120UL, 84UL );
+
+   test_ = "BlockCompressedMatrix/dense vector multiplication (double, 3x3 blocks)";
+   testVectorKernel<double,3UL>( 120UL, 84UL );
+
+   test_ = "BlockCompressedMatrix/dense vector multiplication (double, 4x4 blocks)";
+   testVectorKernel<double,4UL>( 120UL, 84UL );
+
+
+   //=====================================================================================
+   // Sparse matrix/sparse matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix/sparse matrix multiplication";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 24UL, 18UL );
+      for( size_t i=0UL; i<24UL; ++i ) {
+         for( size_t k=0UL; k<( i*5UL )%7UL; ++k ) {
+            cmat( i, ( i*3UL+k*5UL ) % 18UL ) = int( ( i+k ) % 9UL ) - 4;
+         }
+      }
+
+      const MT mat( cmat );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> tmat( trans( cmat ) );
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> res( mat * tmat );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref( cmat * tmat );
+
+      checkMatrix( res, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a BlockCompressedMatrix with a dense matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the sparse matrix/dense matrix multiplication with a
+// BlockCompressedMatrix for integral, single precision and double precision element types and
+// several block sizes. The results are compared to the according computation with a
+// blaze::CompressedMatrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testMatrixMultiplication()
+{
+   //=====================================================================================
+   // Integral element type
+   //=====================================================================================
+
+   test_ = "BlockCompressedMatrix/dense matrix multiplication (int, 3x3 blocks)";
+   testMatrixKernel<int,3UL>( 60UL, 48UL, 13UL );
+
+
+   //=====================================================================================
+   // Single precision element type
+   //=====================================================================================
+
+   test_ = "BlockCompressedMatrix/dense matrix multiplication (float, 2x2 blocks)";
+   testMatrixKernel<float,2UL>( 60UL, 48UL, 13UL );
+
+   test_ = "BlockCompressedMatrix/dense matrix multiplication (float, 3x3 blocks)";
+   testMatrixKernel<float,3UL>( 60UL, 48UL, 13UL );
+
+   test_ = "BlockCompressedMatrix/dense matrix multiplication (float, 4x4 blocks)";
+   testMatrixKernel<float,4UL>( 60UL, 48UL, 13UL );
+
+
+   //=====================================================================================
+   // Double precision element type
+   //=====================================================================================
+
+   test_ = "BlockCompressedMatrix/dense matrix multiplication (double, 2x2 blocks)";
+   testMatrixKernel<double,2UL>( 60UL, 48UL, 13UL );
+
+   test_ = "BlockCompressedMatrix/dense matrix multiplication (double, 3x3 blocks)";
+   testMatrixKernel<double,3UL>( 60UL, 48UL, 13UL );
+
+   test_ = "BlockCompressedMatrix/dense matrix multiplication (double, 4x4 blocks)";
+   testMatrixKernel<double,4UL>( 60UL, 48UL, 13UL );
+
+
+   //=====================================================================================
+   // Column-major target matrix
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix/dense matrix multiplication (column-major result)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> cmat( 12UL, 9UL );
+      for( size_t i=0UL; i<12UL; ++i ) {
+         cmat( i, ( i*4UL ) % 9UL ) = double( i+1UL );
+      }
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> dmat( 9UL, 5UL );
+      for( size_t i=0UL; i<9UL; ++i ) {
+         for( size_t j=0UL; j<5UL; ++j ) {
+            dmat(i,j) = double( i*5UL+j );
+         }
+      }
+
+      const RMT mat( cmat );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> res, ref;
+
+      res  = mat * dmat;
+      ref  = cmat * dmat;
+      checkMatrix( res, ref );
+
+      res += mat * dmat;
+      ref += cmat * dmat;
+      checkMatrix( res, ref );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/util/Complex.h>
@@ -91,6 +92,7 @@ ClassTest::ClassTest()
    testLowerBound();
    testUpperBound();
    testIsDefault();
+   testAssemble();
 }
 //*************************************************************************************************
 
@@ -6807,6 +6809,86 @@ void ClassTest::testReserve()
       checkCapacity( mat,  2UL, 10UL );
    }
 
+   {
+      test_ = "Row-major CompressedMatrix::reserve( const std::vector<size_t>& )";
+
+      // Initialization check
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(1,0) = 1;
+      mat(1,2) = 2;
+      mat(2,1) = 3;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+
+      // Increasing the capacity of the 0th and 2nd row
+      std::vector<size_t> nonzeros( 3UL );
+      nonzeros[0] = 4UL;
+      nonzeros[1] = 0UL;
+      nonzeros[2] = 2UL;
+
+      mat.reserve( nonzeros );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 8UL );
+      checkCapacity( mat, 0UL, 4UL );
+      checkCapacity( mat, 1UL, 2UL );
+      checkCapacity( mat, 2UL, 2UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(1,0) != 1 || mat(1,2) != 2 || mat(2,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving capacity failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 1 0 2 0 )\n( 0 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Requesting less than the current capacity
+      nonzeros[0] = 1UL;
+      nonzeros[1] = 1UL;
+      nonzeros[2] = 1UL;
+
+      mat.reserve( nonzeros );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 8UL );
+      checkCapacity( mat, 0UL, 4UL );
+      checkCapacity( mat, 1UL, 2UL );
+      checkCapacity( mat, 2UL, 2UL );
+      checkNonZeros( mat, 3UL );
+
+      // Filling the reserved capacity via append()
+      mat.append( 0UL, 1UL, 4 );
+      mat.append( 0UL, 3UL, 5 );
+      mat.append( 2UL, 3UL, 6 );
+
+      checkCapacity( mat, 8UL );
+      checkNonZeros( mat, 6UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(1,0) != 1 || mat(1,2) != 2 || mat(2,1) != 3 ||
+          mat(0,1) != 4 || mat(0,3) != 5 || mat(2,3) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Appending elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 4 0 5 )\n( 1 0 2 0 )\n( 0 3 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
 
    //=====================================================================================
    // Column-major matrix tests
@@ -6879,6 +6961,86 @@ void ClassTest::testReserve()
       checkCapacity( mat,  1UL, 15UL );
       checkCapacity( mat,  2UL, 10UL );
    }
+
+   {
+      test_ = "Column-major CompressedMatrix::reserve( const std::vector<size_t>& )";
+
+      // Initialization check
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 4UL, 3UL );
+      mat(0,1) = 1;
+      mat(2,1) = 2;
+      mat(1,2) = 3;
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      // Increasing the capacity of the 0th and 2nd column
+      std::vector<size_t> nonzeros( 3UL );
+      nonzeros[0] = 4UL;
+      nonzeros[1] = 0UL;
+      nonzeros[2] = 2UL;
+
+      mat.reserve( nonzeros );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 8UL );
+      checkCapacity( mat, 0UL, 4UL );
+      checkCapacity( mat, 1UL, 2UL );
+      checkCapacity( mat, 2UL, 2UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,1) != 1 || mat(2,1) != 2 || mat(1,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving capacity failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 )\n( 0 0 3 )\n( 0 2 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Requesting less than the current capacity
+      nonzeros[0] = 1UL;
+      nonzeros[1] = 1UL;
+      nonzeros[2] = 1UL;
+
+      mat.reserve( nonzeros );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 8UL );
+      checkCapacity( mat, 0UL, 4UL );
+      checkCapacity( mat, 1UL, 2UL );
+      checkCapacity( mat, 2UL, 2UL );
+      checkNonZeros( mat, 3UL );
+
+      // Filling the reserved capacity via append()
+      mat.append( 1UL, 0UL, 4 );
+      mat.append( 3UL, 0UL, 5 );
+      mat.append( 3UL, 2UL, 6 );
+
+      checkCapacity( mat, 8UL );
+      checkNonZeros( mat, 6UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,1) != 1 || mat(2,1) != 2 || mat(1,2) != 3 ||
+          mat(1,0) != 4 || mat(3,0) != 5 || mat(3,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Appending elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 )\n( 4 0 3 )\n( 0 2 0 )\n( 5 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -8540,6 +8702,153 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c assemble() function for the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c assemble() function for the CompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssemble()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major assemble()";
+
+      // Assembling unsorted triplets with duplicates
+      {
+         const unsigned int rows   [] = { 2U, 0U, 3U, 0U, 2U, 3U, 0U, 3U };
+         const unsigned int columns[] = { 1U, 3U, 2U, 0U, 1U, 1U, 3U, 2U };
+         const int          values [] = {  1,  2,  3,  4,  5,  6,  7, -3 };
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 4UL, 5UL, 3UL );
+         mat(1,1) = 9;
+
+         assemble( mat, rows, columns, values, 8UL );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 5UL );
+         checkCapacity( mat, 5UL );
+         checkNonZeros( mat, 5UL );
+         checkNonZeros( mat, 0UL, 2UL );
+         checkNonZeros( mat, 1UL, 0UL );
+         checkNonZeros( mat, 2UL, 1UL );
+         checkNonZeros( mat, 3UL, 2UL );
+
+         if( mat.capacity() != 5UL ||
+             mat(0,0) != 4 || mat(0,3) != 9 || mat(2,1) != 6 || mat(3,1) != 6 || mat(3,2) != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly failed\n"
+                << " Details:\n"
+                << "   Capacity: " << mat.capacity() << "\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 4 0 0 9 0 )\n( 0 0 0 0 0 )\n( 0 6 0 0 0 )\n( 0 6 0 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         blaze::CompressedMatrix<int,blaze::rowMajor>::ConstIterator it( mat.begin( 0UL ) );
+
+         if( it->index() != 0UL || (++it)->index() != 3UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Unsorted row detected\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembling an empty sequence of triplets
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 2UL, 2UL );
+         mat(0,1) = 1;
+         mat(2,0) = 2;
+
+         assemble( mat, static_cast<const size_t*>( NULL ), static_cast<const size_t*>( NULL ),
+                   static_cast<const int*>( NULL ), 0UL );
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 2UL );
+         checkNonZeros( mat, 0UL );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major assemble()";
+
+      // Assembling unsorted triplets with duplicates
+      {
+         const int rows   [] = { 1, 3, 2, 0, 1, 1, 3, 2 };
+         const int columns[] = { 2, 0, 3, 0, 2, 3, 0, 3 };
+         const int values [] = { 1, 2, 3, 4, 5, 6, 7, -3 };
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 5UL, 4UL, 3UL );
+         mat(1,1) = 9;
+
+         assemble( mat, rows, columns, values, 8UL );
+
+         checkRows    ( mat, 5UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 5UL );
+         checkNonZeros( mat, 5UL );
+         checkNonZeros( mat, 0UL, 2UL );
+         checkNonZeros( mat, 1UL, 0UL );
+         checkNonZeros( mat, 2UL, 1UL );
+         checkNonZeros( mat, 3UL, 2UL );
+
+         if( mat.capacity() != 5UL ||
+             mat(0,0) != 4 || mat(3,0) != 9 || mat(1,2) != 6 || mat(1,3) != 6 || mat(2,3) != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly failed\n"
+                << " Details:\n"
+                << "   Capacity: " << mat.capacity() << "\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 4 0 0 0 )\n( 0 0 6 6 )\n( 0 0 0 0 )\n( 9 0 0 0 )\n( 0 0 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         blaze::CompressedMatrix<int,blaze::columnMajor>::ConstIterator it( mat.begin( 0UL ) );
+
+         if( it->index() != 0UL || (++it)->index() != 3UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Unsorted column detected\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembling an empty sequence of triplets
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 2UL, 3UL, 2UL );
+         mat(1,0) = 1;
+         mat(0,2) = 2;
+
+         assemble( mat, static_cast<const size_t*>( NULL ), static_cast<const size_t*>( NULL ),
+                   static_cast<const int*>( NULL ), 0UL );
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 0UL );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace compressedmatrix
 
 } // namespace mathtest
@@ -74,6 +74,8 @@ OperationTest::OperationTest()
    testIsUpper();
    testMinimum();
    testMaximum();
+   testReduction();
+   testMap();
 }
 //*************************************************************************************************
 
@@ -3506,6 +3508,83 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the reduction functions for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the total, row-wise, and column-wise \c reduce(), \c sum(),
+// \c prod(), \c min(), and \c max() functions and of the \c l1Norm(), \c l2Norm(), and
+// \c linfNorm() functions for row-major and column-major dense matrices of integral and floating
+// point element type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testReduction()
+{
+   test_ = "reduction functions (row-major, int)";
+   testReduction<blaze::rowMajor,int>();
+
+   test_ = "reduction functions (row-major, double)";
+   testReduction<blaze::rowMajor,double>();
+
+   test_ = "reduction functions (column-major, int)";
+   testReduction<blaze::columnMajor,int>();
+
+   test_ = "reduction functions (column-major, double)";
+   testReduction<blaze::columnMajor,double>();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c map() functions for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the unary and binary \c map() functions for row-major and
+// column-major dense matrices. The tests are run with vectorizable and non-vectorizable custom
+// operations for matrix sizes smaller and larger than a single SIMD vector, for odd sizes, and
+// for a size beyond the SMP assignment threshold. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testMap()
+{
+   const size_t large( blaze::SMP_DMATASSIGN_THRESHOLD + 3UL );
+
+   const size_t rows   [] = { 0UL, 1UL, 2UL, 7UL, 33UL, large };
+   const size_t columns[] = { 0UL, 1UL, 3UL, 5UL, 17UL, large };
+
+   for( size_t i=0UL; i<sizeof(rows)/sizeof(size_t); ++i )
+   {
+      test_ = "map() function (row-major, vectorizable operation)";
+      testMap<blaze::rowMajor>( rows[i], columns[i], Cube() );
+
+      test_ = "map() function (row-major, non-vectorizable operation)";
+      testMap<blaze::rowMajor>( rows[i], columns[i], Shift() );
+
+      test_ = "map() function (column-major, vectorizable operation)";
+      testMap<blaze::columnMajor>( rows[i], columns[i], Cube() );
+
+      test_ = "map() function (column-major, non-vectorizable operation)";
+      testMap<blaze::columnMajor>( rows[i], columns[i], Shift() );
+
+      test_ = "binary map() function (row-major, vectorizable operation)";
+      testBinaryMap<blaze::rowMajor>( rows[i], columns[i], Axpy() );
+
+      test_ = "binary map() function (row-major, non-vectorizable operation)";
+      testBinaryMap<blaze::rowMajor>( rows[i], columns[i], Blend() );
+
+      test_ = "binary map() function (column-major, vectorizable operation)";
+      testBinaryMap<blaze::columnMajor>( rows[i], columns[i], Axpy() );
+
+      test_ = "binary map() function (column-major, non-vectorizable operation)";
+      testBinaryMap<blaze::columnMajor>( rows[i], columns[i], Blend() );
+   }
+}
+//*************************************************************************************************
+
 } // namespace densematrix
 
 } // namespace mathtest
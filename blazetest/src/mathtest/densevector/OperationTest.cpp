@@ -68,6 +68,8 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testReduction();
+   testMap();
 }
 //*************************************************************************************************
 
@@ -490,6 +492,62 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the reduction functions for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reduce(), \c sum(), \c prod(), \c min(), \c max(),
+// \c argmin(), \c argmax(), \c l1Norm(), \c l2Norm(), \c linfNorm(), and \c length() functions
+// for dense vectors of integral and floating point element type. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testReduction()
+{
+   test_ = "reduction functions (int)";
+   testReduction<int>();
+
+   test_ = "reduction functions (double)";
+   testReduction<double>();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c map() functions for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the unary and binary \c map() functions for dense vectors.
+// The tests are run with vectorizable and non-vectorizable custom operations for vector sizes
+// smaller and larger than a single SIMD vector, for odd sizes, and for a size beyond the SMP
+// assignment threshold. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testMap()
+{
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 7UL, 33UL, blaze::SMP_DVECASSIGN_THRESHOLD + 3UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i )
+   {
+      test_ = "map() function (vectorizable operation)";
+      testMap( sizes[i], Cube() );
+
+      test_ = "map() function (non-vectorizable operation)";
+      testMap( sizes[i], Shift() );
+
+      test_ = "binary map() function (vectorizable operation)";
+      testBinaryMap( sizes[i], Axpy() );
+
+      test_ = "binary map() function (non-vectorizable operation)";
+      testBinaryMap( sizes[i], Blend() );
+   }
+}
+//*************************************************************************************************
+
 } // namespace densevector
 
 } // namespace mathtest
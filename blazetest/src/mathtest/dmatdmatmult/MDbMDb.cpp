@@ -86,6 +86,7 @@ int main()
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 32UL, 32UL ), CMDb(  32UL, 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 64UL, 32UL ), CMDb(  32UL, 16UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 64UL, 32UL ), CMDb(  32UL, 64UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 127UL, 67UL ), CMDb(  67UL, 131UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during dense matrix/dense matrix multiplication:\n"
@@ -97,6 +97,11 @@ int main()
       RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 32UL,  32UL,  8UL ), CMCb(  32UL, 32UL,  8UL ) );
       RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 64UL,  32UL, 16UL ), CMCb(  32UL, 16UL,  8UL ) );
       RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 64UL,  32UL, 16UL ), CMCb(  32UL, 64UL, 16UL ) );
+
+      // Running tests with large matrices beyond the SMP threshold (mixing rows accumulated in
+      // the dense accumulator and in the hash table of the parallel multiplication)
+      RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 157UL, 40UL,  320UL ), CMCb( 40UL, 800UL, 4800UL ) );
+      RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 220UL, 64UL, 1100UL ), CMCb( 64UL, 256UL,  640UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during sparse matrix/sparse matrix multiplication:\n"
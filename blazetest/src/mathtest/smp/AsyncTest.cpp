@@ -0,0 +1,433 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/AsyncTest.cpp
+//  \brief Source file for the asynchronous assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <blaze/math/StaticVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/smp/AsyncTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AsyncTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+AsyncTest::AsyncTest()
+{
+   testFuture();
+   testVectorAssign();
+   testMatrixAssign();
+   testOrder();
+   testSerialSection();
+   testException();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the default constructed Future.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a default constructed Future represents a completed assignment.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testFuture()
+{
+   test_ = "Default constructed Future";
+
+   const blaze::Future future;
+
+   checkReady( future );
+   future.wait();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of vector expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment of matrix/vector multiplications and vector
+// additions beyond the according SMP thresholds. Two independent assignments are launched at
+// once, an assignment that uses the result of a previous assignment is only launched after the
+// previous assignment has been waited for. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void AsyncTest::testVectorAssign()
+{
+   const size_t n( blaze::SMP_DMATDVECMULT_THRESHOLD + 7UL );
+
+   MT A( n, n ), B( n, n );
+   VT x( n );
+
+   blaze::randomize( A, -3, 3 );
+   blaze::randomize( B, -3, 3 );
+   blaze::randomize( x, -3, 3 );
+
+   VT refY( n, 0 ), refZ( n, 0 ), refW( n, 0 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         refY[i] += A(i,j) * x[j];
+         refZ[i] += B(i,j) * x[j];
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         refW[i] += B(i,j) * refY[j];
+      }
+   }
+
+   {
+      test_ = "Independent asynchronous matrix/vector multiplications";
+
+      VT y( n ), z( n );
+
+      const blaze::Future f1( blaze::asyncAssign( y, A * x ) );
+      const blaze::Future f2( blaze::asyncAssign( z, B * x ) );
+
+      f1.wait();
+      f2.wait();
+
+      checkReady( f1 );
+      checkReady( f2 );
+      checkVector( y, refY );
+      checkVector( z, refZ );
+   }
+
+   {
+      test_ = "Dependent asynchronous matrix/vector multiplications";
+
+      VT y( n ), w( n );
+
+      const blaze::Future f1( blaze::asyncAssign( y, A * x ) );
+      f1.wait();
+
+      const blaze::Future f2( blaze::asyncAssign( w, B * y ) );
+      f2.wait();
+
+      checkVector( y, refY );
+      checkVector( w, refW );
+   }
+
+   {
+      test_ = "Asynchronous vector addition";
+
+      const size_t m( blaze::SMP_DVECDVECADD_THRESHOLD + 3UL );
+
+      VT a( m ), b( m ), c( m ), ref( m );
+
+      blaze::randomize( a, -3, 3 );
+      blaze::randomize( b, -3, 3 );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         ref[i] = a[i] + b[i];
+      }
+
+      blaze::asyncAssign( c, a + b ).wait();
+
+      checkVector( c, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of matrix expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment of a matrix/matrix multiplication beyond the
+// according SMP threshold to a row-major and a column-major matrix. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testMatrixAssign()
+{
+   test_ = "Asynchronous matrix/matrix multiplication";
+
+   const size_t n( blaze::SMP_DMATDMATMULT_THRESHOLD + 5UL );
+
+   MT A( n, n ), B( n, n ), C( n, n ), ref( n, n, 0 );
+   TMT D( n, n );
+
+   blaze::randomize( A, -3, 3 );
+   blaze::randomize( B, -3, 3 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t k=0UL; k<n; ++k ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            ref(i,j) += A(i,k) * B(k,j);
+         }
+      }
+   }
+
+   const blaze::Future f1( blaze::asyncAssign( C, A * B ) );
+   const blaze::Future f2( blaze::asyncAssign( D, A * B ) );
+
+   f1.wait();
+   f2.wait();
+
+   checkMatrix( C, ref );
+   checkMatrix( D, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the execution order of asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the asynchronous assignments are completed in the order of their
+// launch, i.e. that all previously launched assignments have been completed as soon as the
+// last launched assignment has been completed. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testOrder()
+{
+   test_ = "Execution order of asynchronous assignments";
+
+   const size_t n( blaze::SMP_DMATDVECMULT_THRESHOLD + 7UL );
+
+   MT A( n, n );
+   VT x( n ), y[4];
+
+   blaze::randomize( A, -3, 3 );
+   blaze::randomize( x, -3, 3 );
+
+   blaze::Future futures[4];
+
+   for( size_t i=0UL; i<4UL; ++i ) {
+      futures[i] = blaze::asyncAssign( y[i], A * x );
+   }
+
+   futures[3].wait();
+
+   for( size_t i=0UL; i<4UL; ++i ) {
+      checkReady( futures[i] );
+   }
+
+   for( size_t i=1UL; i<4UL; ++i ) {
+      checkVector( y[i], y[0] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of asynchronous assignments launched within a serial section.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests an asynchronous assignment launched within a serial section. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testSerialSection()
+{
+   test_ = "Asynchronous assignment within a serial section";
+
+   const size_t n( blaze::SMP_DMATDVECMULT_THRESHOLD + 7UL );
+
+   MT A( n, n );
+   VT x( n ), y( n ), ref( n, 0 );
+
+   blaze::randomize( A, -3, 3 );
+   blaze::randomize( x, -3, 3 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         ref[i] += A(i,j) * x[j];
+      }
+   }
+
+   BLAZE_SERIAL_SECTION
+   {
+      blaze::asyncAssign( y, A * x ).wait();
+   }
+
+   if( blaze::isSerialSectionActive() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serial section still active\n"
+          << " Details:\n"
+          << "   The serial section is active after its end\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkVector( y, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions thrown by an asynchronous assignment.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown by an asynchronous assignment is rethrown by
+// Future::wait() and that subsequent asynchronous assignments are not affected. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testException()
+{
+   test_ = "Exception thrown by an asynchronous assignment";
+
+   blaze::StaticVector<int,3UL,blaze::columnVector> a;
+   VT b( 5UL, 1 );
+
+   const blaze::Future f1( blaze::asyncAssign( a, b ) );
+
+   try {
+      f1.wait();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid assignment succeeded\n"
+          << " Details:\n"
+          << "   No exception has been rethrown by wait()\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkReady( f1 );
+
+   VT c( 5UL, 2 ), d( 5UL );
+
+   blaze::asyncAssign( d, b + c ).wait();
+
+   checkVector( d, VT( 5UL, 3 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking whether the given Future represents a completed assignment.
+//
+// \param future The Future to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given Future does not represent a completed assignment, a \a std::runtime_error
+// exception is thrown.
+*/
+void AsyncTest::checkReady( const blaze::Future& future ) const
+{
+   if( !future.ready() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incomplete assignment detected\n"
+          << " Details:\n"
+          << "   The assignment has not been completed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running asynchronous assignment test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_ASYNC_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during asynchronous assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
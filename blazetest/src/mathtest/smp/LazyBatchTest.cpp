@@ -0,0 +1,620 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/LazyBatchTest.cpp
+//  \brief Source file for the LazyBatch class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/smp/LazyBatchTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the LazyBatchTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+LazyBatchTest::LazyBatchTest()
+{
+   testLevels();
+   testResults();
+   testBarriers();
+   testException();
+   testClear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the dependency analysis of the LazyBatch class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the number of levels of the dependency graph for independent assignments
+// and for read-after-write, write-after-write, and write-after-read dependencies. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void LazyBatchTest::testLevels()
+{
+   const size_t n( 20UL );
+
+   MT A( n, n ), B( n, n ), C( n, n );
+   VT x( n, 1 ), x2( n, 2 ), y1( n ), y2( n ), y3( n, 0 ), z( n );
+
+   {
+      test_ = "Empty LazyBatch";
+
+      blaze::LazyBatch batch;
+
+      checkSize  ( batch, 0UL );
+      checkLevels( batch, 0UL );
+   }
+
+   {
+      test_ = "LazyBatch with independent assignments";
+
+      blaze::LazyBatch batch;
+
+      batch.assign   ( y1, A * x );
+      batch.assign   ( y2, B * x );
+      batch.addAssign( y3, C * x );
+      batch.assign   ( z , x + x2 );
+
+      checkSize  ( batch, 4UL );
+      checkLevels( batch, 1UL );
+   }
+
+   {
+      test_ = "LazyBatch with read-after-write dependency";
+
+      blaze::LazyBatch batch;
+
+      batch.assign( y1, A * x );
+      batch.assign( y2, B * x );
+      batch.assign( z , y1 + y2 );
+
+      checkSize  ( batch, 3UL );
+      checkLevels( batch, 2UL );
+   }
+
+   {
+      test_ = "LazyBatch with write-after-write dependency";
+
+      blaze::LazyBatch batch;
+
+      batch.assign   ( y1, A * x );
+      batch.addAssign( y1, B * x );
+
+      checkSize  ( batch, 2UL );
+      checkLevels( batch, 2UL );
+   }
+
+   {
+      test_ = "LazyBatch with write-after-read dependency";
+
+      blaze::LazyBatch batch;
+
+      batch.assign   ( z , A * y1 );
+      batch.subAssign( y1, x );
+
+      checkSize  ( batch, 2UL );
+      checkLevels( batch, 2UL );
+   }
+
+   {
+      test_ = "LazyBatch with chain of dependencies";
+
+      blaze::LazyBatch batch;
+
+      batch.assign   ( y1, A * x );
+      batch.assign   ( y2, B * x );
+      batch.addAssign( y3, C * x );
+      batch.assign   ( z , y1 + y2 );
+      batch.subAssign( y1, x );
+
+      checkSize  ( batch, 5UL );
+      checkLevels( batch, 3UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the results of the LazyBatch class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the results of a batch of dependent and independent vector and matrix
+// assignments, including an assignment beyond the SMP threshold, an operand that is modified
+// between the recording and the execution of the batch, and the execution within a serial
+// section. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void LazyBatchTest::testResults()
+{
+   const size_t n( 20UL );
+   const size_t N( blaze::SMP_DMATDVECMULT_THRESHOLD + 7UL );
+
+   MT A( n, n ), B( n, n ), C( n, n ), L( N, N );
+   VT x( n ), x2( n ), xL( N );
+
+   blaze::randomize( A , -3, 3 );
+   blaze::randomize( B , -3, 3 );
+   blaze::randomize( C , -3, 3 );
+   blaze::randomize( L , -3, 3 );
+   blaze::randomize( x , -3, 3 );
+   blaze::randomize( x2, -3, 3 );
+   blaze::randomize( xL, -3, 3 );
+
+   {
+      test_ = "LazyBatch with dependent and independent vector assignments";
+
+      VT y1( n ), y2( n ), y3( n, 1 ), z( n ), w( n ), yL( N );
+      VT refY1( n, 0 ), refY2( n, 0 ), refY3( n, 1 ), refZ( n ), refW( n ), refYL( N, 0 );
+
+      blaze::LazyBatch batch;
+
+      batch.assign   ( y1, A * x );    // Level 0
+      batch.assign   ( y2, B * x );    // Level 0
+      batch.addAssign( y3, C * x );    // Level 0
+      batch.assign   ( yL, L * xL );   // Level 0, executed in parallel
+      batch.assign   ( w , x + x2 );   // Level 0
+      batch.assign   ( z , y1 + y2 );  // Level 1
+      batch.subAssign( y1, x );        // Level 2
+
+      // Modifying an operand between the recording and the execution
+      x2[0] = 10;
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            refY1[i] += A(i,j) * x[j];
+            refY2[i] += B(i,j) * x[j];
+            refY3[i] += C(i,j) * x[j];
+         }
+         refZ[i]   = refY1[i] + refY2[i];
+         refW[i]   = x[i] + x2[i];
+         refY1[i] -= x[i];
+      }
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            refYL[i] += L(i,j) * xL[j];
+         }
+      }
+
+      checkLevels( batch, 3UL );
+
+      batch.execute();
+
+      checkSize  ( batch, 0UL );
+      checkLevels( batch, 0UL );
+      checkVector( y1, refY1 );
+      checkVector( y2, refY2 );
+      checkVector( y3, refY3 );
+      checkVector( yL, refYL );
+      checkVector( z , refZ  );
+      checkVector( w , refW  );
+   }
+
+   {
+      test_ = "LazyBatch with dependent and independent matrix assignments";
+
+      MT D( n, n ), E( n, n ), F( n, n, 0 );
+      TMT G( n, n );
+      MT refD( n, n, 0 ), refE( n, n ), refF( n, n );
+
+      blaze::LazyBatch batch;
+
+      batch.assign   ( D, A * B );  // Level 0
+      batch.assign   ( E, A + C );  // Level 0
+      batch.assign   ( G, B - C );  // Level 0
+      batch.addAssign( F, D + E );  // Level 1
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t k=0UL; k<n; ++k ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               refD(i,j) += A(i,k) * B(k,j);
+            }
+         }
+      }
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            refE(i,j) = A(i,j) + C(i,j);
+            refF(i,j) = refD(i,j) + refE(i,j);
+         }
+      }
+
+      checkLevels( batch, 2UL );
+
+      batch.execute();
+
+      checkMatrix( D, refD );
+      checkMatrix( E, refE );
+      checkMatrix( G, B - C );
+      checkMatrix( F, refF );
+   }
+
+   {
+      test_ = "LazyBatch execution within a serial section";
+
+      VT y1( n ), y2( n ), z( n ), refZ( n, 0 );
+
+      blaze::LazyBatch batch;
+
+      batch.assign( y1, A * x );
+      batch.assign( y2, B * x );
+      batch.assign( z , y1 - y2 );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            refZ[i] += ( A(i,j) - B(i,j) ) * x[j];
+         }
+      }
+
+      BLAZE_SERIAL_SECTION
+      {
+         batch.execute();
+      }
+
+      checkVector( z, refZ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of assignments to views and adaptors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that assignments to views and adaptors are treated as dependent on all
+// previously and subsequently recorded assignments and that they are executed correctly. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void LazyBatchTest::testBarriers()
+{
+   using blaze::subvector;
+   using blaze::trans;
+
+   const size_t n( 20UL );
+
+   {
+      test_ = "LazyBatch with an assignment to a view";
+
+      MT A( n, n );
+      VT x( n ), a( n ), b( n ), c( n, 0 ), d( n ), refA( n, 0 ), refC( n, 0 );
+
+      blaze::randomize( A, -3, 3 );
+      blaze::randomize( x, -3, 3 );
+
+      blaze::DenseSubvector<VT> sv( subvector( c, 2UL, n-4UL ) );
+
+      blaze::LazyBatch batch;
+
+      batch.assign( a , A * x );                         // Level 0
+      batch.assign( b , x + x );                         // Level 0
+      batch.assign( sv, subvector( x, 0UL, n-4UL ) );    // Level 1, since sv is a view
+      batch.assign( d , x );                             // Level 2, since sv is a view
+
+      checkSize  ( batch, 4UL );
+      checkLevels( batch, 3UL );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            refA[i] += A(i,j) * x[j];
+         }
+      }
+
+      for( size_t i=2UL; i<n-2UL; ++i ) {
+         refC[i] = x[i-2UL];
+      }
+
+      batch.execute();
+
+      checkVector( a, refA );
+      checkVector( b, x + x );
+      checkVector( c, refC );
+      checkVector( d, x );
+   }
+
+   {
+      test_ = "LazyBatch with an assignment to an adaptor";
+
+      MT A( n, n ), B( n, n ), C( n, n ), D( n, n ), refC( n, n, 0 ), refS( n, n );
+      blaze::SymmetricMatrix<MT> S( n );
+
+      blaze::randomize( A, -3, 3 );
+      blaze::randomize( B, -3, 3 );
+
+      blaze::LazyBatch batch;
+
+      batch.assign( C, A * B );         // Level 0
+      batch.assign( S, A + trans(A) );  // Level 1, since S is an adaptor
+      batch.assign( D, B );             // Level 2, since S is an adaptor
+
+      checkSize  ( batch, 3UL );
+      checkLevels( batch, 3UL );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t k=0UL; k<n; ++k ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               refC(i,j) += A(i,k) * B(k,j);
+            }
+         }
+      }
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            refS(i,j) = A(i,j) + A(j,i);
+         }
+      }
+
+      batch.execute();
+
+      checkMatrix( C, refC );
+      checkMatrix( S, refS );
+      checkMatrix( D, B );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions thrown by a batched assignment.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown by one of several concurrently executed
+// assignments is rethrown by execute(), that the remaining assignments of the same level are
+// executed, that all assignments of subsequent levels are discarded, and that the batch can be
+// reused afterwards. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void LazyBatchTest::testException()
+{
+   test_ = "Exception thrown by a batched assignment";
+
+   const size_t n( 20UL );
+
+   MT A( n, n ), B( n, n );
+   VT x( n ), y1( n ), y2( n ), z( n, 0 ), refY1( n, 0 ), refY2( n, 0 ), refZ( n, 0 );
+   VT b( 5UL, 1 );
+   blaze::StaticVector<int,3UL,blaze::columnVector> s;
+
+   blaze::randomize( A, -3, 3 );
+   blaze::randomize( B, -3, 3 );
+   blaze::randomize( x, -3, 3 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         refY1[i] += A(i,j) * x[j];
+         refY2[i] += B(i,j) * x[j];
+      }
+   }
+
+   blaze::LazyBatch batch;
+
+   batch.assign( y1, A * x );    // Level 0
+   batch.assign( s , b );        // Level 0, throws an exception
+   batch.assign( y2, B * x );    // Level 0
+   batch.assign( z , y1 + y2 );  // Level 1, discarded
+
+   checkLevels( batch, 2UL );
+
+   try {
+      batch.execute();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid assignment succeeded\n"
+          << " Details:\n"
+          << "   No exception has been rethrown by execute()\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkSize  ( batch, 0UL );
+   checkLevels( batch, 0UL );
+   checkVector( y1, refY1 );
+   checkVector( y2, refY2 );
+   checkVector( z , refZ  );
+
+   batch.assign( z, y1 + y2 );
+   batch.execute();
+
+   checkVector( z, refY1 + refY2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the LazyBatch class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the clear() function discards all recorded assignments. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void LazyBatchTest::testClear()
+{
+   test_ = "LazyBatch::clear()";
+
+   const size_t n( 20UL );
+
+   VT x( n, 1 ), y( n, 0 ), z( n, 0 );
+
+   blaze::LazyBatch batch;
+
+   batch.assign( y, x );
+   batch.assign( z, y + x );
+
+   checkSize  ( batch, 2UL );
+   checkLevels( batch, 2UL );
+
+   batch.clear();
+
+   checkSize  ( batch, 0UL );
+   checkLevels( batch, 0UL );
+
+   batch.execute();
+
+   checkVector( y, VT( n, 0 ) );
+   checkVector( z, VT( n, 0 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of recorded assignments.
+//
+// \param batch The batch to be checked.
+// \param expectedSize The expected number of recorded assignments.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the number of recorded assignments does not correspond to the given expected number,
+// a \a std::runtime_error exception is thrown.
+*/
+void LazyBatchTest::checkSize( const blaze::LazyBatch& batch, size_t expectedSize ) const
+{
+   if( batch.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of assignments detected\n"
+          << " Details:\n"
+          << "   Number of assignments         : " << batch.size() << "\n"
+          << "   Expected number of assignments: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of levels of the dependency graph.
+//
+// \param batch The batch to be checked.
+// \param expectedLevels The expected number of levels.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the number of levels does not correspond to the given expected number, a
+// \a std::runtime_error exception is thrown.
+*/
+void LazyBatchTest::checkLevels( const blaze::LazyBatch& batch, size_t expectedLevels ) const
+{
+   if( batch.levels() != expectedLevels ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of levels detected\n"
+          << " Details:\n"
+          << "   Number of levels         : " << batch.levels() << "\n"
+          << "   Expected number of levels: " << expectedLevels << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running LazyBatch class test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_LAZYBATCH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during LazyBatch class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,489 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/CGTest.cpp
+//  \brief Source file for the CG solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blazetest/mathtest/solvers/CGTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CGTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+CGTest::CGTest()
+{
+   testCG();
+   testJacobi();
+   testSSOR();
+   testIC();
+   testPCG();
+   testDeterminism();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CG method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a linear system with the discrete 2D Laplace operator and a known
+// solution by means of the CG method. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void CGTest::testCG()
+{
+   test_ = "CG method";
+
+   blaze::CMatMxN A;
+   setupLaplacian( A, 12UL );
+
+   blaze::VecN expected;
+   setupSolution( expected, A.rows() );
+
+   const blaze::VecN b( -( A * expected ) );
+
+   blaze::CG cg;
+   cg.setMaxIterations( 1000UL );
+   cg.setThreshold( 1E-12 );
+
+   blaze::VecN x;
+   const bool converged( cg.solve( A, b, x ) );
+
+   checkSolution( cg, converged, x, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Jacobi preconditioner.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the application of the Jacobi preconditioner to the solution of a
+// linear system with the diagonal of the system matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void CGTest::testJacobi()
+{
+   test_ = "Jacobi preconditioner";
+
+   blaze::CMatMxN A;
+   setupBand( A, 20UL );
+
+   const blaze::DynamicMatrix<blaze::real> D( A );
+
+   blaze::CMatMxN M( D.rows(), D.columns() );
+   for( size_t i=0UL; i<D.rows(); ++i ) {
+      M(i,i) = D(i,i);
+   }
+
+   checkApply( blaze::JacobiPreconditioner( A ), M );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SSOR preconditioner.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the application of the SSOR preconditioner for several relaxation
+// parameters to the solution of a linear system with the dense SSOR matrix
+
+      \f[ M = \frac{1}{\omega(2-\omega)} (D + \omega L) D^{-1} (D + \omega L^T). \f]
+
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void CGTest::testSSOR()
+{
+   test_ = "SSOR preconditioner";
+
+   blaze::CMatMxN A;
+   setupBand( A, 20UL );
+
+   const blaze::DynamicMatrix<blaze::real> D( A );
+   const size_t n( D.rows() );
+
+   const blaze::real omegas[3] = { 1.0, 0.7, 1.3 };
+
+   for( size_t k=0UL; k<3UL; ++k )
+   {
+      const blaze::real omega( omegas[k] );
+
+      blaze::DynamicMatrix<blaze::real> lower( n, n, blaze::real(0) );
+      blaze::DynamicMatrix<blaze::real> upper( n, n, blaze::real(0) );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( j < i ) {
+               lower(i,j) = omega * D(i,j);
+            }
+            else if( j > i ) {
+               upper(i,j) = omega * D(i,j) / D(i,i);
+            }
+            else {
+               lower(i,j) = D(i,i);
+               upper(i,j) = blaze::real(1);
+            }
+         }
+      }
+
+      const blaze::DynamicMatrix<blaze::real> M( ( lower * upper ) / ( omega*( blaze::real(2) - omega ) ) );
+
+      checkApply( blaze::SSORPreconditioner( A, omega ), blaze::CMatMxN( M ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the IC(0) preconditioner.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the application of the IC(0) preconditioner to the solution of a
+// linear system with the system matrix. Since the Cholesky factor of a banded matrix does not
+// contain any fill-in, the incomplete factorization of the system matrix is exact. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void CGTest::testIC()
+{
+   test_ = "IC(0) preconditioner";
+
+   blaze::CMatMxN A;
+   setupBand( A, 20UL );
+
+   checkApply( blaze::ICPreconditioner( A ), A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the preconditioned CG method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a linear system with the discrete 2D Laplace operator and a known
+// solution by means of the preconditioned CG method with the Jacobi, the SSOR, and the IC(0)
+// preconditioner. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void CGTest::testPCG()
+{
+   blaze::CMatMxN A;
+   setupLaplacian( A, 12UL );
+
+   blaze::VecN expected;
+   setupSolution( expected, A.rows() );
+
+   test_ = "Preconditioned CG method with Jacobi preconditioner";
+   testPCG( blaze::JacobiPreconditioner( A ), A, expected );
+
+   test_ = "Preconditioned CG method with SSOR preconditioner";
+   testPCG( blaze::SSORPreconditioner( A ), A, expected );
+
+   test_ = "Preconditioned CG method with SSOR preconditioner (omega=1.5)";
+   testPCG( blaze::SSORPreconditioner( A, 1.5 ), A, expected );
+
+   test_ = "Preconditioned CG method with IC(0) preconditioner";
+   testPCG( blaze::ICPreconditioner( A ), A, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reproducibility of the CG method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a linear system that is large enough for the parallel execution of the
+// CG kernels twice by means of the plain CG method and by means of the preconditioned CG method.
+// Since the partial results of the threads are combined in a fixed order, the two solutions
+// have to be identical. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void CGTest::testDeterminism()
+{
+   const size_t m( 200UL );
+
+   blaze::CMatMxN A;
+   setupLaplacian( A, m );
+
+   blaze::VecN expected;
+   setupSolution( expected, A.rows() );
+
+   const blaze::VecN b( -( A * expected ) );
+
+   const blaze::JacobiPreconditioner pc( A );
+
+   for( size_t k=0UL; k<2UL; ++k )
+   {
+      test_ = ( k == 0UL )?( "Reproducibility of the CG method" )
+                          :( "Reproducibility of the preconditioned CG method" );
+
+      blaze::CG cg;
+      cg.setMaxIterations( 10000UL );
+      cg.setThreshold( 1E-8 );
+
+      blaze::VecN x1, x2;
+
+      const bool converged1( ( k == 0UL )?( cg.solve( A, b, x1 ) ):( cg.solve( A, b, x1, pc ) ) );
+      const size_t iterations1( cg.getLastIterations() );
+
+      const bool converged2( ( k == 0UL )?( cg.solve( A, b, x2 ) ):( cg.solve( A, b, x2, pc ) ) );
+      const size_t iterations2( cg.getLastIterations() );
+
+      // Comparing the two solutions bitwise (the comparison operators apply a tolerance)
+      bool identical( x1.size() == x2.size() );
+
+      for( size_t i=0UL; identical && i<x1.size(); ++i ) {
+         identical = ( x1[i] == x2[i] );
+      }
+
+      if( !converged1 || !converged2 || iterations1 != iterations2 || !identical ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Different results of identical solves\n"
+             << " Details:\n"
+             << "   Size                      : " << A.rows() << "\n"
+             << "   Converged (first solve)   : " << converged1 << "\n"
+             << "   Converged (second solve)  : " << converged2 << "\n"
+             << "   Iterations (first solve)  : " << iterations1 << "\n"
+             << "   Iterations (second solve) : " << iterations2 << "\n"
+             << "   Maximum difference        : " << blaze::max( blaze::abs( x1 - x2 ) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of a symmetric positive definite band matrix.
+//
+// \param A The matrix to be set up.
+// \param n The number of rows and columns of the matrix.
+// \return void
+//
+// This function sets up a diagonally dominant, symmetric pentadiagonal matrix without zero
+// elements within the band.
+*/
+void CGTest::setupBand( blaze::CMatMxN& A, size_t n ) const
+{
+   A.resize( n, n, false );
+   A.reset();
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i > 1UL )
+         A.append( i, i-2UL, blaze::real(-0.5) );
+      if( i > 0UL )
+         A.append( i, i-1UL, blaze::real(-1) );
+
+      A.append( i, i, blaze::real(4) + blaze::real(0.1)*std::sin( blaze::real(i) ) );
+
+      if( i+1UL < n )
+         A.append( i, i+1UL, blaze::real(-1) );
+      if( i+2UL < n )
+         A.append( i, i+2UL, blaze::real(-0.5) );
+
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the discrete 2D Laplace operator.
+//
+// \param A The matrix to be set up.
+// \param m The number of grid points in each dimension.
+// \return void
+//
+// This function sets up the five-point stencil of the 2D Laplace operator with Dirichlet
+// boundary conditions on a grid with \a m x \a m points.
+*/
+void CGTest::setupLaplacian( blaze::CMatMxN& A, size_t m ) const
+{
+   const size_t n( m*m );
+
+   A.resize( n, n, false );
+   A.reset();
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i >= m )
+         A.append( i, i-m, blaze::real(-1) );
+      if( i%m != 0UL )
+         A.append( i, i-1UL, blaze::real(-1) );
+
+      A.append( i, i, blaze::real(4) );
+
+      if( ( i+1UL )%m != 0UL )
+         A.append( i, i+1UL, blaze::real(-1) );
+      if( i+m < n )
+         A.append( i, i+m, blaze::real(-1) );
+
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the known solution of a linear system.
+//
+// \param x The solution vector to be set up.
+// \param n The size of the solution vector.
+// \return void
+*/
+void CGTest::setupSolution( blaze::VecN& x, size_t n ) const
+{
+   x.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] = std::cos( blaze::real( 3UL*i+1UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a linear system.
+//
+// \param cg The solver used to solve the linear system.
+// \param converged The result of the solution process.
+// \param x The computed solution.
+// \param expected The known solution.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver converged and that the computed solution matches the
+// known solution. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void CGTest::checkSolution( const blaze::CG& cg, bool converged,
+                            const blaze::VecN& x, const blaze::VecN& expected ) const
+{
+   blaze::real error( 0 );
+
+   for( size_t i=0UL; i<x.size() && i<expected.size(); ++i ) {
+      error = blaze::max( error, std::fabs( x[i] - expected[i] ) );
+   }
+
+   if( !converged || x.size() != expected.size() || error > 1E-8 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution of the linear system\n"
+          << " Details:\n"
+          << "   Size      : " << x.size() << "\n"
+          << "   Converged : " << converged << "\n"
+          << "   Iterations: " << cg.getLastIterations() << "\n"
+          << "   Precision : " << cg.getLastPrecision() << "\n"
+          << "   Error     : " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CG solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_CG_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CG solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
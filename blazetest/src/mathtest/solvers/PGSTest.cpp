@@ -0,0 +1,342 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/PGSTest.cpp
+//  \brief Source file for the PGS solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/solvers/PGSTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PGSTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+PGSTest::PGSTest()
+{
+   testSerialSweep();
+   testColoredSweep();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the serial block Gauss-Seidel sweep of the PGS solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves contact LCPs of different sizes by means of the serial block Gauss-Seidel
+// sweep and checks the residual of the converged solutions. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void PGSTest::testSerialSweep()
+{
+   test_ = "Serial block Gauss-Seidel sweep";
+
+   for( size_t contacts=1UL; contacts<=60UL; contacts+=7UL )
+   {
+      blaze::ContactLCP cp;
+      setupContacts( cp, contacts );
+
+      blaze::PGS pgs;
+      pgs.setMaxIterations( 100000UL );
+      pgs.setThreshold( 1E-10 );
+
+      bool converged( false );
+
+      BLAZE_SERIAL_SECTION
+      {
+         converged = pgs.solve( cp );
+      }
+
+      checkSolution( pgs, converged, cp );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the colored parallel sweep of the PGS solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves contact LCPs with at least SMP_PGS_THRESHOLD contacts, which are solved
+// by means of the colored parallel sweep in case shared memory parallelization is enabled, and
+// checks the residual of the converged solutions. Besides the contact LCPs of chains of rigid
+// bodies, the function solves contact LCPs whose block rows refer to contacts that do not refer
+// back to them. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PGSTest::testColoredSweep()
+{
+   const size_t threshold( blaze::max( blaze::SMP_PGS_THRESHOLD, 1UL ) );
+
+   test_ = "Colored parallel sweep";
+
+   for( size_t contacts=threshold; contacts<threshold+16UL; contacts+=5UL )
+   {
+      blaze::ContactLCP cp;
+      setupContacts( cp, contacts );
+
+      blaze::PGS pgs;
+      pgs.setMaxIterations( 100000UL );
+      pgs.setThreshold( 1E-10 );
+
+      const bool converged( pgs.solve( cp ) );
+
+      checkSolution( pgs, converged, cp );
+   }
+
+   test_ = "Colored parallel sweep with a structurally unsymmetric system matrix";
+
+   for( size_t contacts=threshold; contacts<threshold+16UL; contacts+=5UL )
+   {
+      blaze::ContactLCP cp;
+      setupAsymmetricContacts( cp, contacts );
+
+      blaze::PGS pgs;
+      pgs.setMaxIterations( 100000UL );
+      pgs.setThreshold( 1E-10 );
+
+      const bool converged( pgs.solve( cp ) );
+
+      checkSolution( pgs, converged, cp );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of a contact LCP for chains of rigid bodies.
+//
+// \param cp The contact LCP to be set up.
+// \param contacts The total number of contacts.
+// \return void
+//
+// This function sets up the contact LCP \f$ A = J M^{-1} J^T \f$ for chains of rigid bodies
+// with up to eight contacts each. The first body of each chain is fixed, each contact couples
+// two consecutive bodies of a chain. All movable bodies have unit masses and inertias.
+// The normal right-hand side entries push the bodies against each other, the tangential entries
+// and the lever arms of the contacts vary from contact to contact.
+*/
+void PGSTest::setupContacts( blaze::ContactLCP& cp, size_t contacts ) const
+{
+   const size_t n( 3UL*contacts );
+
+   // Setting up the Jacobian of the contacts with respect to the velocities of the movable bodies
+   blaze::CMatMxN J( n, 6UL*contacts );
+
+   for( size_t c=0UL; c<contacts; ++c ) {
+      for( size_t k=0UL; k<3UL; ++k ) {
+         const size_t row( 3UL*c+k );
+         if( c%8UL != 0UL )
+            J(row,6UL*(c-1UL)+k) = blaze::real(-1);
+         J(row,6UL*c+k) = blaze::real(1);
+         for( size_t d=3UL; d<6UL; ++d ) {
+            const blaze::real arm( blaze::real(0.5)*std::sin( blaze::real( 7UL*row+3UL*d+1UL ) ) );
+            if( c%8UL != 0UL )
+               J(row,6UL*(c-1UL)+d) = arm;
+            J(row,6UL*c+d) = -blaze::real(0.7)*arm;
+         }
+      }
+   }
+
+   // Computing the system matrix for unit masses and inertias of the movable bodies
+   const blaze::CMatMxN JT( trans( J ) );
+
+   cp.A_ = J * JT;
+   cp.b_.resize( n, false );
+   cp.x_.resize( n, false );
+   cp.cof_.resize( contacts, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      cp.b_[i] = ( i%3UL == 0UL )?( blaze::real(-1) )
+                                 :( blaze::real(0.15)*std::sin( blaze::real( 5UL*i+2UL ) ) );
+      cp.x_[i] = blaze::real(0);
+   }
+
+   for( size_t c=0UL; c<contacts; ++c ) {
+      cp.cof_[c] = blaze::real(0.5);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of a contact LCP with a structurally unsymmetric system matrix.
+//
+// \param cp The contact LCP to be set up.
+// \param contacts The number of contacts.
+// \return void
+//
+// This function sets up a contact LCP with diagonally dominant 3x3 diagonal blocks, whose block
+// rows additionally refer to a single other contact each. Since the referenced contacts do not
+// refer back, the sparsity pattern of the system matrix is not symmetric.
+*/
+void PGSTest::setupAsymmetricContacts( blaze::ContactLCP& cp, size_t contacts ) const
+{
+   const size_t n( 3UL*contacts );
+
+   blaze::CMatMxN A( n, n );
+
+   for( size_t c=0UL; c<contacts; ++c )
+   {
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t l=0UL; l<3UL; ++l ) {
+            A(3UL*c+k,3UL*c+l) = ( k == l )?( blaze::real(2) ):( blaze::real(0.3) );
+         }
+      }
+
+      // Coupling the contact to a single contact with a larger index
+      const size_t neighbor( ( 3UL*c+1UL ) % contacts );
+
+      if( neighbor > c ) {
+         for( size_t k=0UL; k<3UL; ++k ) {
+            A(3UL*c+k,3UL*neighbor+k) = blaze::real(0.4);
+         }
+      }
+   }
+
+   cp.A_ = A;
+   cp.b_.resize( n, false );
+   cp.x_.resize( n, false );
+   cp.cof_.resize( contacts, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      cp.b_[i] = ( i%3UL == 0UL )?( blaze::real(-1) )
+                                 :( blaze::real(0.5)*std::sin( blaze::real( 3UL*i+1UL ) ) );
+      cp.x_[i] = blaze::real(0);
+   }
+
+   for( size_t c=0UL; c<contacts; ++c ) {
+      cp.cof_[c] = blaze::real(0.5);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a contact LCP.
+//
+// \param pgs The solver used to solve the contact LCP.
+// \param converged The result of the solution process.
+// \param cp The solved contact LCP.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver converged and that the residual of the solution is
+// sufficiently small. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PGSTest::checkSolution( const blaze::PGS& pgs, bool converged, const blaze::ContactLCP& cp ) const
+{
+   if( !converged || cp.residual() > 1E-8 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution of the contact LCP\n"
+          << " Details:\n"
+          << "   Contacts  : " << cp.size()/3UL << "\n"
+          << "   Converged : " << converged << "\n"
+          << "   Iterations: " << pgs.getLastIterations() << "\n"
+          << "   Precision : " << pgs.getLastPrecision() << "\n"
+          << "   Residual  : " << cp.residual() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PGS solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_PGS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PGS solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,483 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/WarmStartTest.cpp
+//  \brief Source file for the WarmStart class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/problems/LCP.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/solvers/PGS.h>
+#include <blazetest/mathtest/solvers/WarmStartTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WarmStartTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+WarmStartTest::WarmStartTest()
+{
+   testStoreLoad();
+   testIterations();
+   testMismatch();
+   testClear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the store() and load() functions of the WarmStart class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function stores the unknowns of a contact LCP and loads them into a contact LCP with
+// partially matching contact IDs in a different order. In case the number of hits and misses
+// or any loaded unknown is not as expected, a \a std::runtime_error exception is thrown.
+*/
+void WarmStartTest::testStoreLoad()
+{
+   test_ = "Storing and loading the unknowns of contact LCPs";
+
+   blaze::ContactLCP cp1;
+   cp1.x_.resize( 12UL, false );
+   cp1.cof_.resize( 4UL, false );
+
+   for( size_t i=0UL; i<12UL; ++i ) {
+      cp1.x_[i] = blaze::real( i+1UL );
+   }
+
+   std::vector<size_t> ids1( 4UL );
+   ids1[0] = 17UL;
+   ids1[1] =  3UL;
+   ids1[2] = 42UL;
+   ids1[3] =  8UL;
+
+   blaze::WarmStart cache;
+   cache.store( cp1, ids1 );
+
+   checkSize( cache, 4UL );
+
+   blaze::ContactLCP cp2;
+   cp2.x_.resize( 9UL, false );
+   cp2.cof_.resize( 3UL, false );
+
+   for( size_t i=0UL; i<9UL; ++i ) {
+      cp2.x_[i] = blaze::real(-1);
+   }
+
+   std::vector<size_t> ids2( 3UL );
+   ids2[0] = 42UL;
+   ids2[1] =  5UL;
+   ids2[2] = 17UL;
+
+   cache.load( cp2, ids2 );
+
+   checkHits( cache, 2UL, 1UL );
+
+   const blaze::real expected[9] = { 7, 8, 9, 0, 0, 0, 1, 2, 3 };
+
+   for( size_t i=0UL; i<9UL; ++i ) {
+      if( cp2.x_[i] != expected[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading the unknowns failed\n"
+             << " Details:\n"
+             << "   Index          : " << i << "\n"
+             << "   Result         : " << cp2.x_[i] << "\n"
+             << "   Expected result: " << expected[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the warm start of the PGS solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a contact LCP, stores its solution, and solves a slightly modified
+// contact LCP both from a cold start and from the stored solution. In case the warm start
+// doesn't require fewer iterations than the cold start, a \a std::runtime_error exception is
+// thrown.
+*/
+void WarmStartTest::testIterations()
+{
+   test_ = "Warm start of the PGS solver";
+
+   const size_t contacts( 40UL );
+
+   std::vector<size_t> ids( contacts );
+   for( size_t c=0UL; c<contacts; ++c ) {
+      ids[c] = 1000UL + 3UL*c;
+   }
+
+   blaze::PGS pgs;
+   pgs.setMaxIterations( 100000UL );
+   pgs.setThreshold( 1E-10 );
+
+   blaze::WarmStart cache;
+
+   // Solving the initial contact LCP
+   blaze::ContactLCP cp1;
+   setupContacts( cp1, contacts, blaze::real(1) );
+
+   BLAZE_SERIAL_SECTION
+   {
+      pgs.solve( cp1 );
+   }
+
+   cache.store( cp1, ids );
+
+   // Solving the modified contact LCP from a cold start
+   blaze::ContactLCP cp2;
+   setupContacts( cp2, contacts, blaze::real(1.01) );
+
+   bool converged( false );
+
+   BLAZE_SERIAL_SECTION
+   {
+      converged = pgs.solve( cp2 );
+   }
+
+   const size_t cold( pgs.getLastIterations() );
+
+   // Solving the modified contact LCP from a warm start
+   blaze::ContactLCP cp3;
+   setupContacts( cp3, contacts, blaze::real(1.01) );
+
+   cache.load( cp3, ids );
+
+   checkHits( cache, contacts, 0UL );
+
+   BLAZE_SERIAL_SECTION
+   {
+      converged = pgs.solve( cp3 ) && converged;
+   }
+
+   const size_t warm( pgs.getLastIterations() );
+
+   if( !converged || warm >= cold ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: No savings by the warm start\n"
+          << " Details:\n"
+          << "   Converged             : " << converged << "\n"
+          << "   Cold start iterations : " << cold << "\n"
+          << "   Warm start iterations : " << warm << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of loading the unknowns into a problem with a different number of unknowns per contact.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function stores the unknowns of a contact LCP and tries to load them into an LCP. In
+// case no \a std::invalid_argument exception is thrown, a \a std::runtime_error exception is
+// thrown.
+*/
+void WarmStartTest::testMismatch()
+{
+   test_ = "Loading the unknowns of a contact LCP into an LCP";
+
+   blaze::ContactLCP cp;
+   cp.x_.resize( 6UL, false );
+   cp.x_.reset();
+   cp.cof_.resize( 2UL, false );
+
+   std::vector<size_t> ids( 2UL );
+   ids[0] = 1UL;
+   ids[1] = 2UL;
+
+   blaze::WarmStart cache;
+   cache.store( cp, ids );
+
+   blaze::LCP lcp;
+   lcp.x_.resize( 2UL, false );
+
+   try {
+      cache.load( lcp, ids );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading the unknowns succeeded\n"
+          << " Details:\n"
+          << "   Cached contacts: " << cache.size() << "\n"
+          << "   LCP size       : " << lcp.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() function of the WarmStart class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function clears a cache and loads it into a problem with a different number of unknowns
+// per contact. In case the cache is not empty after the clear() call or any contact is not reset
+// by the subsequent load, a \a std::runtime_error exception is thrown.
+*/
+void WarmStartTest::testClear()
+{
+   test_ = "Clearing the cache";
+
+   blaze::ContactLCP cp;
+   cp.x_.resize( 6UL, false );
+   cp.cof_.resize( 2UL, false );
+
+   for( size_t i=0UL; i<6UL; ++i ) {
+      cp.x_[i] = blaze::real(1);
+   }
+
+   std::vector<size_t> ids( 2UL );
+   ids[0] = 1UL;
+   ids[1] = 2UL;
+
+   blaze::WarmStart cache;
+   cache.store( cp, ids );
+
+   checkSize( cache, 2UL );
+
+   cache.clear();
+
+   checkSize( cache, 0UL );
+
+   blaze::LCP lcp;
+   lcp.x_.resize( 2UL, false );
+   lcp.x_[0] = blaze::real(1);
+   lcp.x_[1] = blaze::real(1);
+
+   cache.load( lcp, ids );
+
+   checkHits( cache, 0UL, 2UL );
+
+   if( lcp.x_[0] != blaze::real(0) || lcp.x_[1] != blaze::real(0) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resetting the unknowns failed\n"
+          << " Details:\n"
+          << "   Result         : ( " << lcp.x_[0] << " " << lcp.x_[1] << " )\n"
+          << "   Expected result: ( 0 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of a contact LCP for chains of rigid bodies.
+//
+// \param cp The contact LCP to be set up.
+// \param contacts The total number of contacts.
+// \param scaling The scaling factor for the tangential right-hand side entries.
+// \return void
+//
+// This function sets up the contact LCP \f$ A = J M^{-1} J^T \f$ for chains of rigid bodies
+// with up to eight contacts each. The first body of each chain is fixed, each contact couples
+// two consecutive bodies of a chain. All movable bodies have unit masses and inertias.
+// The normal right-hand side entries push the bodies against each other, the tangential entries
+// are scaled by the given factor. The lever arms of the contacts vary from contact to contact.
+*/
+void WarmStartTest::setupContacts( blaze::ContactLCP& cp, size_t contacts, blaze::real scaling ) const
+{
+   const size_t n( 3UL*contacts );
+
+   // Setting up the Jacobian of the contacts with respect to the velocities of the movable bodies
+   blaze::CMatMxN J( n, 6UL*contacts );
+
+   for( size_t c=0UL; c<contacts; ++c ) {
+      for( size_t k=0UL; k<3UL; ++k ) {
+         const size_t row( 3UL*c+k );
+         if( c%8UL != 0UL )
+            J(row,6UL*(c-1UL)+k) = blaze::real(-1);
+         J(row,6UL*c+k) = blaze::real(1);
+         for( size_t d=3UL; d<6UL; ++d ) {
+            const blaze::real arm( blaze::real(0.5)*std::sin( blaze::real( 7UL*row+3UL*d+1UL ) ) );
+            if( c%8UL != 0UL )
+               J(row,6UL*(c-1UL)+d) = arm;
+            J(row,6UL*c+d) = -blaze::real(0.7)*arm;
+         }
+      }
+   }
+
+   // Computing the system matrix for unit masses and inertias of the movable bodies
+   const blaze::CMatMxN JT( trans( J ) );
+
+   cp.A_ = J * JT;
+   cp.b_.resize( n, false );
+   cp.x_.resize( n, false );
+   cp.cof_.resize( contacts, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      cp.b_[i] = ( i%3UL == 0UL )?( blaze::real(-1) )
+                                 :( scaling*blaze::real(0.15)*std::sin( blaze::real( 5UL*i+2UL ) ) );
+      cp.x_[i] = blaze::real(0);
+   }
+
+   for( size_t c=0UL; c<contacts; ++c ) {
+      cp.cof_[c] = blaze::real(0.5);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of contacts in the cache.
+//
+// \param cache The cache to be checked.
+// \param expectedSize The expected number of contacts in the cache.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of contacts in the given cache. In case the actual number
+// of contacts does not correspond to the given expected number, a \a std::runtime_error
+// exception is thrown.
+*/
+void WarmStartTest::checkSize( const blaze::WarmStart& cache, size_t expectedSize ) const
+{
+   if( cache.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size detected\n"
+          << " Details:\n"
+          << "   Size         : " << cache.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the statistics of the last load.
+//
+// \param cache The cache to be checked.
+// \param expectedHits The expected number of hits of the last load.
+// \param expectedMisses The expected number of misses of the last load.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of hits and misses of the last call to the load() function.
+// In case the actual numbers don't correspond to the given expected numbers, a
+// \a std::runtime_error exception is thrown.
+*/
+void WarmStartTest::checkHits( const blaze::WarmStart& cache, size_t expectedHits, size_t expectedMisses ) const
+{
+   if( cache.getLastHits() != expectedHits || cache.getLastMisses() != expectedMisses ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of hits or misses detected\n"
+          << " Details:\n"
+          << "   Hits           : " << cache.getLastHits() << "\n"
+          << "   Expected hits  : " << expectedHits << "\n"
+          << "   Misses         : " << cache.getLastMisses() << "\n"
+          << "   Expected misses: " << expectedMisses << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running WarmStart class test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_WARMSTART_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during WarmStart class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
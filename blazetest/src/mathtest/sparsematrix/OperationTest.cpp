@@ -74,6 +74,7 @@ OperationTest::OperationTest()
    testIsUpper();
    testMinimum();
    testMaximum();
+   testMap();
 }
 //*************************************************************************************************
 
@@ -3472,6 +3473,42 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c map() function for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c map() function for row-major and column-major sparse
+// matrices. The tests are run with a custom operation providing a vectorized evaluation and a
+// plain custom operation for small and odd matrix sizes and for a size beyond the SMP assignment
+// threshold. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testMap()
+{
+   const size_t large( blaze::SMP_DMATASSIGN_THRESHOLD + 3UL );
+
+   const size_t rows   [] = { 0UL, 1UL, 2UL, 7UL, 33UL, large };
+   const size_t columns[] = { 0UL, 1UL, 3UL, 5UL, 17UL, large };
+
+   for( size_t i=0UL; i<sizeof(rows)/sizeof(size_t); ++i )
+   {
+      test_ = "map() function (row-major, vectorizable operation)";
+      testMap<blaze::rowMajor>( rows[i], columns[i], Cube() );
+
+      test_ = "map() function (row-major, non-vectorizable operation)";
+      testMap<blaze::rowMajor>( rows[i], columns[i], Twice() );
+
+      test_ = "map() function (column-major, vectorizable operation)";
+      testMap<blaze::columnMajor>( rows[i], columns[i], Cube() );
+
+      test_ = "map() function (column-major, non-vectorizable operation)";
+      testMap<blaze::columnMajor>( rows[i], columns[i], Twice() );
+   }
+}
+//*************************************************************************************************
+
 } // namespace sparsematrix
 
 } // namespace mathtest
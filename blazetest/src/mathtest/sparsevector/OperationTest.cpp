@@ -68,6 +68,7 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testMap();
 }
 //*************************************************************************************************
 
@@ -461,6 +462,33 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c map() function for sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c map() function for sparse vectors. The tests are
+// run with a custom operation providing a vectorized evaluation and a plain custom operation
+// for small and odd vector sizes and for a size beyond the SMP assignment threshold. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testMap()
+{
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 7UL, 33UL, blaze::SMP_DVECASSIGN_THRESHOLD + 3UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i )
+   {
+      test_ = "map() function (vectorizable operation)";
+      testMap( sizes[i], Cube() );
+
+      test_ = "map() function (non-vectorizable operation)";
+      testMap( sizes[i], Twice() );
+   }
+}
+//*************************************************************************************************
+
 } // namespace sparsevector
 
 } // namespace mathtest
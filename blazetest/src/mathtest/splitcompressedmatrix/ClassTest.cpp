@@ -0,0 +1,1015 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/splitcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the SplitCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/splitcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace splitcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SplitCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testClear();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SplitCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix size constructor (0x0)";
+
+      MT mat( 0UL, 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "SplitCompressedMatrix size constructor (3x4)";
+
+      MT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix conversion constructor (CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 5UL, 4UL );
+      cmat(0,1) = 1;
+      cmat(2,0) = 2;
+      cmat(2,2) = 3;
+      cmat(2,3) = 4;
+      cmat(4,3) = 5;
+
+      MT mat( cmat );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 3UL );
+      checkNonZeros( mat, 3UL, 0UL );
+      checkNonZeros( mat, 4UL, 1UL );
+      checkMatrix  ( mat, cmat );
+   }
+
+   {
+      test_ = "SplitCompressedMatrix conversion constructor (CompressedMatrix, 16-bit indices)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 5UL, 4UL );
+      cmat(0,1) = 1;
+      cmat(2,0) = 2;
+      cmat(2,2) = 3;
+      cmat(2,3) = 4;
+      cmat(4,3) = 5;
+
+      blaze::SplitCompressedMatrix<int,uint16_t> mat( cmat );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 2UL, 3UL );
+      checkMatrix  ( mat, cmat );
+   }
+
+   {
+      test_ = "SplitCompressedMatrix conversion constructor (too many columns for the index type)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 2UL, 257UL );
+      cmat(1,256) = 1;
+
+      try {
+         blaze::SplitCompressedMatrix<int,uint8_t> mat( cmat );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion of a matrix with too many columns succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "SplitCompressedMatrix conversion constructor (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> cmat( 3UL, 4UL );
+      cmat(0,3) = 1;
+      cmat(1,0) = 2;
+      cmat(1,1) = 3;
+
+      MT mat( cmat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+      checkMatrix  ( mat, cmat );
+   }
+
+   {
+      test_ = "SplitCompressedMatrix conversion constructor (DynamicMatrix)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> dmat( 2UL, 3UL, 0 );
+      dmat(0,0) = 1;
+      dmat(1,1) = 2;
+      dmat(1,2) = 3;
+
+      MT mat( dmat );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkMatrix  ( mat, dmat );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix copy constructor";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 3UL );
+      cmat(0,0) = 1;
+      cmat(1,2) = 2;
+      cmat(2,1) = 3;
+
+      MT mat1( cmat );
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkMatrix  ( mat2, cmat );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SplitCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix copy assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 2UL );
+      cmat(0,1) = 1;
+      cmat(2,0) = 2;
+
+      MT mat1( cmat );
+      MT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 2UL );
+      checkNonZeros( mat2, 2UL );
+      checkMatrix  ( mat2, cmat );
+   }
+
+
+   //=====================================================================================
+   // Sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 4UL, 3UL );
+      cmat(0,1) = 1;
+      cmat(3,0) = 2;
+      cmat(3,2) = 3;
+
+      MT mat( 2UL, 2UL );
+      mat = cmat;
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkMatrix  ( mat, cmat );
+   }
+
+   {
+      test_ = "SplitCompressedMatrix sparse matrix assignment (expression)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 3UL );
+      cmat(0,1) = 1;
+      cmat(1,2) = 2;
+      cmat(2,0) = 3;
+
+      MT mat;
+      mat = cmat * cmat;
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref( cmat * cmat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkMatrix  ( mat, ref );
+   }
+
+
+   //=====================================================================================
+   // Dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> dmat( 2UL, 3UL, 0 );
+      dmat(0,2) = 1;
+      dmat(1,0) = 2;
+
+      MT mat;
+      mat = dmat;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 2UL );
+      checkMatrix  ( mat, dmat );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// SplitCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "SplitCompressedMatrix::operator()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 19UL, 7UL );
+   for( size_t i=0UL; i<19UL; ++i ) {
+      for( size_t k=0UL; k<i%5UL; ++k ) {
+         cmat( i, ( i+3UL*k ) % 7UL ) = int( i+k+1UL );
+      }
+   }
+
+   const MT mat( cmat );
+
+   for( size_t i=0UL; i<19UL; ++i ) {
+      for( size_t j=0UL; j<7UL; ++j ) {
+         if( mat(i,j) != cmat(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Function call operator failed\n"
+                << " Details:\n"
+                << "   Position       = (" << i << "," << j << ")\n"
+                << "   Result         = " << mat(i,j) << "\n"
+                << "   Expected value = " << cmat(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 5UL );
+   cmat(0,4) = 1;
+   cmat(2,0) = 2;
+   cmat(2,2) = 3;
+   cmat(2,3) = 4;
+
+   const MT mat( cmat );
+
+   // Counting the number of elements in row 1
+   {
+      test_ = "SplitCompressedMatrix iterator subtraction (empty row)";
+
+      const size_t number( mat.end(1) - mat.begin(1) );
+
+      if( number != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements in row 2
+   {
+      test_ = "SplitCompressedMatrix iterator subtraction";
+
+      const size_t number( mat.end(2) - mat.begin(2) );
+
+      if( number != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing the traversal of row 2
+   {
+      test_ = "SplitCompressedMatrix iterator traversal";
+
+      const size_t indices[3] = { 0UL, 2UL, 3UL };
+      const int    values [3] = { 2, 3, 4 };
+
+      size_t k( 0UL );
+      for( ConstIterator it=mat.cbegin(2); it!=mat.cend(2); ++it, ++k )
+      {
+         if( k >= 3UL || it->index() != indices[k] || it->value() != values[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element detected\n"
+                << " Details:\n"
+                << "   Position       : " << k << "\n"
+                << "   Index          : " << it->index() << "\n"
+                << "   Value          : " << it->value() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( k != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of traversed elements\n"
+             << " Details:\n"
+             << "   Number of elements         : " << k << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "SplitCompressedMatrix::nonZeros()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 37UL, 40UL );
+   size_t total( 0UL );
+
+   for( size_t i=0UL; i<37UL; ++i ) {
+      for( size_t k=0UL; k<( i*7UL )%11UL; ++k ) {
+         cmat( i, ( i+k*3UL ) % 40UL ) = 1;
+      }
+      total += ( i*7UL )%11UL;
+   }
+
+   const MT mat( cmat );
+
+   checkRows    ( mat, 37UL );
+   checkColumns ( mat, 40UL );
+   checkNonZeros( mat, total );
+
+   for( size_t i=0UL; i<37UL; ++i ) {
+      checkNonZeros( mat, i, cmat.nonZeros( i ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "SplitCompressedMatrix::clear()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 4UL );
+   cmat(0,1) = 1;
+   cmat(2,3) = 2;
+
+   MT mat( cmat );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 2UL );
+
+   mat.clear();
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+
+   mat = cmat;
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SplitCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SplitCompressedMatrix swap";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat1( 2UL, 2UL );
+   cmat1(0,0) = 1;
+   cmat1(1,1) = 2;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat2( 3UL, 1UL );
+   cmat2(2,0) = 3;
+
+   MT mat1( cmat1 );
+   MT mat2( cmat2 );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkColumns ( mat1, 1UL );
+   checkNonZeros( mat1, 1UL );
+   checkMatrix  ( mat1, cmat2 );
+
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 2UL );
+   checkNonZeros( mat2, 2UL );
+   checkMatrix  ( mat2, cmat1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "SplitCompressedMatrix::find()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 8UL, 6UL );
+   cmat(1,2) = 1;
+   cmat(2,3) = 2;
+   cmat(6,1) = 3;
+   cmat(6,5) = 4;
+
+   const MT mat( cmat );
+
+   // Searching for the element (6,5)
+   {
+      const ConstIterator pos( mat.find( 6UL, 5UL ) );
+
+      if( pos == mat.end( 6UL ) || pos->index() != 5UL || pos->value() != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element (6,5) could not be found\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Searching for the non-existing element (6,2)
+   {
+      const ConstIterator pos( mat.find( 6UL, 2UL ) );
+
+      if( pos != mat.end( 6UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-existing element could be found\n"
+             << " Details:\n"
+             << "   Required index = 2\n"
+             << "   Found index    = " << pos->index() << "\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Searching in the empty row 0
+   {
+      const ConstIterator pos( mat.find( 0UL, 0UL ) );
+
+      if( pos != mat.end( 0UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element in empty row could be found\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "SplitCompressedMatrix::lowerBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 6UL );
+   cmat(1,1) = 1;
+   cmat(1,4) = 2;
+
+   const MT mat( cmat );
+
+   const size_t expected[6] = { 1UL, 1UL, 4UL, 4UL, 4UL, 6UL };
+
+   for( size_t j=0UL; j<6UL; ++j )
+   {
+      const ConstIterator pos( mat.lowerBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 6UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower bound detected\n"
+             << " Details:\n"
+             << "   Required index = " << j << "\n"
+             << "   Found index    = " << index << "\n"
+             << "   Expected index = " << expected[j] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "SplitCompressedMatrix::upperBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( 3UL, 6UL );
+   cmat(1,1) = 1;
+   cmat(1,4) = 2;
+
+   const MT mat( cmat );
+
+   const size_t expected[6] = { 1UL, 4UL, 4UL, 4UL, 6UL, 6UL };
+
+   for( size_t j=0UL; j<6UL; ++j )
+   {
+      const ConstIterator pos( mat.upperBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 6UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid upper bound detected\n"
+             << " Details:\n"
+             << "   Required index = " << j << "\n"
+             << "   Found index    = " << index << "\n"
+             << "   Expected index = " << expected[j] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with 0x0 matrix
+   {
+      MT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with 2x3 matrix
+   {
+      MT mat( 2UL, 3UL );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a SplitCompressedMatrix with a dense vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the sparse matrix/dense vector multiplication with a
+// SplitCompressedMatrix for integral, single precision and double precision element types and
+// several index types. The results are compared to the according computation with a
+// blaze::CompressedMatrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const size_t m( 133UL );
+   const size_t n( 71UL );
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> cmat( m, n );
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t k=0UL; k<( i*5UL )%29UL; ++k ) {
+         cmat( i, ( i*3UL+k*7UL ) % n ) = int( ( i+k ) % 9UL ) - 4;
+      }
+   }
+
+   blaze::DynamicVector<int,blaze::columnVector> vec( n );
+   for( size_t j=0UL; j<n; ++j ) {
+      vec[j] = int( j % 7UL ) - 3;
+   }
+
+
+   //=====================================================================================
+   // Integral element type
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix/dense vector multiplication (int)";
+
+      const MT mat( cmat );
+
+      blaze::DynamicVector<int,blaze::columnVector> res, ref;
+
+      res  = mat * vec;
+      ref  = cmat * vec;
+      checkVector( res, ref );
+
+      res += mat * ( vec + vec );
+      ref += cmat * ( vec + vec );
+      checkVector( res, ref );
+
+      res -= mat * vec;
+      ref -= cmat * vec;
+      checkVector( res, ref );
+
+      res *= mat * vec;
+      ref *= cmat * vec;
+      checkVector( res, ref );
+   }
+
+
+   //=====================================================================================
+   // Single precision element type
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix/dense vector multiplication (float)";
+
+      const blaze::CompressedMatrix<float,blaze::rowMajor> fcmat( cmat );
+      const blaze::SplitCompressedMatrix<float> mat( fcmat );
+      const blaze::DynamicVector<float,blaze::columnVector> fvec( vec );
+
+      blaze::DynamicVector<float,blaze::columnVector> res, ref;
+
+      res  = mat * fvec;
+      ref  = fcmat * fvec;
+      checkVector( res, ref );
+
+      res += mat * fvec;
+      ref += fcmat * fvec;
+      checkVector( res, ref );
+
+      res -= mat * ( fvec + fvec );
+      ref -= fcmat * ( fvec + fvec );
+      checkVector( res, ref );
+   }
+
+   {
+      test_ = "SplitCompressedMatrix/dense vector multiplication (float, 16-bit indices)";
+
+      const blaze::CompressedMatrix<float,blaze::rowMajor> fcmat( cmat );
+      const blaze::SplitCompressedMatrix<float,uint16_t> mat( fcmat );
+      const blaze::DynamicVector<float,blaze::columnVector> fvec( vec );
+
+      blaze::DynamicVector<float,blaze::columnVector> res, ref;
+
+      res  = mat * fvec;
+      ref  = fcmat * fvec;
+      checkVector( res, ref );
+
+      res -= mat * fvec;
+      ref -= fcmat * fvec;
+      checkVector( res, ref );
+   }
+
+
+   //=====================================================================================
+   // Double precision element type
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix/dense vector multiplication (double)";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> dcmat( cmat );
+      const RMT mat( dcmat );
+      const blaze::DynamicVector<double,blaze::columnVector> dvec( vec );
+
+      blaze::DynamicVector<double,blaze::columnVector> res, ref;
+
+      res  = mat * dvec;
+      ref  = dcmat * dvec;
+      checkVector( res, ref );
+
+      res += mat * dvec;
+      ref += dcmat * dvec;
+      checkVector( res, ref );
+
+      res -= mat * dvec;
+      ref -= dcmat * dvec;
+      checkVector( res, ref );
+
+      res *= mat * dvec;
+      ref *= dcmat * dvec;
+      checkVector( res, ref );
+   }
+
+   {
+      test_ = "SplitCompressedMatrix/dense vector multiplication (double, 64-bit indices)";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> dcmat( cmat );
+      const blaze::SplitCompressedMatrix<double,size_t> mat( dcmat );
+      const blaze::DynamicVector<double,blaze::columnVector> dvec( vec );
+
+      blaze::DynamicVector<double,blaze::columnVector> res, ref;
+
+      res  = mat * dvec;
+      ref  = dcmat * dvec;
+      checkVector( res, ref );
+
+      res += mat * ( dvec + dvec );
+      ref += dcmat * ( dvec + dvec );
+      checkVector( res, ref );
+   }
+
+
+   //=====================================================================================
+   // Sparse matrix/sparse matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedMatrix/sparse matrix multiplication";
+
+      const MT mat( cmat );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> tmat( trans( cmat ) );
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> res( mat * tmat );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref( cmat * tmat );
+
+      checkMatrix( res, ref );
+   }
+}
+//*************************************************************************************************
+
+} // namespace splitcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SplitCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SPLITCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SplitCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -40,15 +40,87 @@
 #include <cmath>
 #include <stdexcept>
 #include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/solvers/CG.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/logging/DebugSection.h>
 #include <blaze/util/Types.h>
 
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
 
 namespace blaze {
 
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary functor for the threaded execution of the CG kernels on a range of elements.
+*/
+struct CG::KernelTask
+{
+   //**Type definitions****************************************************************************
+   enum Kernel { multiplyKernel, updateKernel };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   explicit inline KernelTask( Kernel kernel, const CMatMxN* A, real alpha, const VecN& d, VecN& h,
+                               VecN* x, VecN& r, size_t begin, size_t end, bool dot, real* partial )
+      : kernel_ ( kernel  )  // The kernel to execute
+      , A_      ( A       )  // The system matrix
+      , alpha_  ( alpha   )  // The step size
+      , d_      ( &d      )  // The search direction
+      , h_      ( &h      )  // The product of the system matrix and the search direction
+      , x_      ( x       )  // The vector of unknowns
+      , r_      ( &r      )  // The residual
+      , begin_  ( begin   )  // The first element of the range
+      , end_    ( end     )  // One past the last element of the range
+      , dot_    ( dot     )  // Flag for the computation of the dot product of the residual
+      , partial_( partial )  // The partial results of the range
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   inline void operator()() {
+      if( kernel_ == multiplyKernel )
+         partial_[0] = CG::multiply( *A_, *d_, *h_, begin_, end_ );
+      else
+         partial_[0] = CG::update( alpha_, *d_, *h_, *x_, *r_, begin_, end_, dot_, partial_[1] );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Kernel         kernel_;   //!< The kernel to execute.
+   const CMatMxN* A_;        //!< The system matrix.
+   real           alpha_;    //!< The step size.
+   const VecN*    d_;        //!< The search direction.
+   VecN*          h_;        //!< The product of the system matrix and the search direction.
+   VecN*          x_;        //!< The vector of unknowns.
+   VecN*          r_;        //!< The residual.
+   size_t         begin_;    //!< The first element of the range.
+   size_t         end_;      //!< One past the last element of the range.
+   bool           dot_;      //!< Flag for the computation of the dot product of the residual.
+   real*          partial_;  //!< The partial dot product and the partial maximum norm of the range.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+#endif
+
+
+
+
 //=================================================================================================
 //
 //  CONSTRUCTOR
@@ -62,6 +134,8 @@ CG::CG()
    : r_()  // TODO
    , d_()  // TODO
    , h_()  // TODO
+   , z_()  // The preconditioned residual of the preconditioned conjugate gradient method
+   , partials_()  // The partial results of the parallel CG kernels
 {}
 //*************************************************************************************************
 
@@ -87,6 +161,13 @@ CG::CG()
 //
 // TODO: description
 // TODO: Problem formulation: \f$ A \cdot x + b = 0 \f$ !!
+//
+// Each iteration is performed by means of two fused kernels: The first one computes the product
+// of the system matrix and the search direction along with the dot product of the search
+// direction and the product (see multiply()), the second one updates the unknowns and the
+// residual along with the dot product and the maximum norm of the new residual (see update()).
+// Compared to the evaluation of separate vector expressions this avoids four passes over the
+// vectors per iteration.
 */
 bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
 {
@@ -133,25 +214,15 @@ bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
 
    for( ; !converged && it<maxIterations_; ++it )
    {
-      h_ = A * d_;
-
-      alpha = delta / ( trans(d_) * h_ );
-
-      x  += alpha * d_;
-      r_ += alpha * h_;
+      alpha = delta / multiply( A );
 
-      lastPrecision_ = 0;
-      for( size_t i=0; i<n; ++i ) {
-         lastPrecision_ = max( lastPrecision_, std::fabs( r_[i] ) );
-      }
+      beta = update( alpha, x, true );
 
       if( lastPrecision_ < threshold_ ) {
          converged = true;
          break;
       }
 
-      beta = trans(r_) * r_;
-
       d_ = ( beta / delta ) * d_ - r_;
 
       delta = beta;
@@ -170,4 +241,252 @@ bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the product of the system matrix and the search direction.
+//
+// \param A The system matrix.
+// \return The dot product of the search direction and the computed product.
+//
+// This function computes \f$ h = A \cdot d \f$ and, in the same pass over the rows of the
+// system matrix, the dot product \f$ d^T h \f$. In case shared memory parallelization is
+// enabled and the system is large enough, the rows are distributed among the threads. The
+// partial results of the threads are combined in a fixed order such that the result only
+// depends on the number of threads.
+*/
+real CG::multiply( const CMatMxN& A )
+{
+   const size_t n( d_.size() );
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   if( !isSerialSectionActive() && !isParallelSectionActive() && n >= SMP_SMATDVECMULT_THRESHOLD )
+   {
+      real dh( 0 );
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+      partials_.assign( 2UL*omp_get_max_threads(), real(0) );
+
+      BLAZE_PARALLEL_SECTION
+      {
+#pragma omp parallel shared( A )
+         {
+            const size_t parts( omp_get_num_threads() );
+            const size_t part ( omp_get_thread_num()  );
+
+            partials_[2UL*part] = multiply( A, d_, h_, ( part*n )/parts, ( (part+1UL)*n )/parts );
+         }
+      }
+
+      const size_t parts( partials_.size()/2UL );
+#else
+      const size_t parts( min( TheThreadBackend::size()*SMP_TASKS_PER_THREAD, n ) );
+
+      partials_.resize( 2UL*parts );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         for( size_t part=0UL; part<parts; ++part ) {
+            TheThreadBackend::schedule( KernelTask( KernelTask::multiplyKernel, &A, real(0), d_, h_,
+                                                    NULL, r_, ( part*n )/parts, ( (part+1UL)*n )/parts,
+                                                    true, &partials_[2UL*part] ) );
+         }
+
+         TheThreadBackend::wait();
+      }
+#endif
+
+      for( size_t part=0UL; part<parts; ++part ) {
+         dh += partials_[2UL*part];
+      }
+
+      return dh;
+   }
+#endif
+
+   return multiply( A, d_, h_, 0UL, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Updates the unknowns and the residual.
+//
+// \param alpha The step size.
+// \param x The vector of unknowns.
+// \param dot \a true in case the dot product of the new residual is required, \a false if not.
+// \return The dot product of the new residual with itself (0 in case \a dot is \a false).
+//
+// This function computes \f$ x = x + \alpha d \f$ and \f$ r = r + \alpha h \f$ and, in the same
+// pass over the vectors, the dot product \f$ r^T r \f$ and the maximum norm of the new residual.
+// The maximum norm is stored as the current precision of the solution. The dot product is only
+// computed in case \a dot is \a true, since the preconditioned CG method requires the dot product
+// of the residual and the preconditioned residual instead. In case shared memory parallelization
+// is enabled and the system is large enough, the elements are distributed among the threads.
+// The partial results of the threads are combined in a fixed order such that the result only
+// depends on the number of threads.
+*/
+real CG::update( real alpha, VecN& x, bool dot )
+{
+   const size_t n( r_.size() );
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   if( !isSerialSectionActive() && !isParallelSectionActive() && n >= SMP_DVECREDUCE_THRESHOLD )
+   {
+      real rr( 0 ), norm( 0 );
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+      partials_.assign( 2UL*omp_get_max_threads(), real(0) );
+
+      BLAZE_PARALLEL_SECTION
+      {
+#pragma omp parallel shared( x )
+         {
+            const size_t parts( omp_get_num_threads() );
+            const size_t part ( omp_get_thread_num()  );
+
+            partials_[2UL*part] = update( alpha, d_, h_, x, r_, ( part*n )/parts, ( (part+1UL)*n )/parts,
+                                          dot, partials_[2UL*part+1UL] );
+         }
+      }
+
+      const size_t parts( partials_.size()/2UL );
+#else
+      const size_t parts( min( TheThreadBackend::size()*SMP_TASKS_PER_THREAD, n ) );
+
+      partials_.resize( 2UL*parts );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         for( size_t part=0UL; part<parts; ++part ) {
+            TheThreadBackend::schedule( KernelTask( KernelTask::updateKernel, NULL, alpha, d_, h_,
+                                                    &x, r_, ( part*n )/parts, ( (part+1UL)*n )/parts,
+                                                    dot, &partials_[2UL*part] ) );
+         }
+
+         TheThreadBackend::wait();
+      }
+#endif
+
+      for( size_t part=0UL; part<parts; ++part ) {
+         rr  += partials_[2UL*part];
+         norm = max( norm, partials_[2UL*part+1UL] );
+      }
+
+      lastPrecision_ = norm;
+      return rr;
+   }
+#endif
+
+   return update( alpha, d_, h_, x, r_, 0UL, n, dot, lastPrecision_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the product of the system matrix and the search direction for a range of rows.
+//
+// \param A The system matrix.
+// \param d The search direction.
+// \param h The resulting product of the system matrix and the search direction.
+// \param begin The first row of the range.
+// \param end One past the last row of the range.
+// \return The partial dot product of the search direction and the product.
+*/
+real CG::multiply( const CMatMxN& A, const VecN& d, VecN& h, size_t begin, size_t end )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   real dh( 0 );
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      real tmp( 0 );
+
+      const ConstIterator last( A.end( i ) );
+      for( ConstIterator element=A.begin( i ); element!=last; ++element )
+         tmp += element->value() * d[element->index()];
+
+      h[i] = tmp;
+      dh  += d[i] * tmp;
+   }
+
+   return dh;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Updates the unknowns and the residual for a range of elements.
+//
+// \param alpha The step size.
+// \param d The search direction.
+// \param h The product of the system matrix and the search direction.
+// \param x The vector of unknowns.
+// \param r The residual.
+// \param begin The first element of the range.
+// \param end One past the last element of the range.
+// \param dot \a true in case the partial dot product of the new residual is required, \a false if not.
+// \param norm The resulting partial maximum norm of the new residual.
+// \return The partial dot product of the new residual with itself (0 in case \a dot is \a false).
+*/
+real CG::update( real alpha, const VecN& d, const VecN& h, VecN& x, VecN& r,
+                 size_t begin, size_t end, bool dot, real& norm )
+{
+   real rr( 0 ), rmax( 0 );
+
+   if( dot ) {
+      for( size_t i=begin; i<end; ++i )
+      {
+         x[i] += alpha * d[i];
+
+         const real tmp( r[i] + alpha * h[i] );
+         r[i]  = tmp;
+         rr   += tmp * tmp;
+         rmax  = max( rmax, std::fabs( tmp ) );
+      }
+   }
+   else {
+      for( size_t i=begin; i<end; ++i )
+      {
+         x[i] += alpha * d[i];
+
+         const real tmp( r[i] + alpha * h[i] );
+         r[i]  = tmp;
+         rmax  = max( rmax, std::fabs( tmp ) );
+      }
+   }
+
+   norm = rmax;
+
+   return rr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPLICIT TEMPLATE INSTANTIATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !defined(_MSC_VER)
+template bool CG::solve<JacobiPreconditioner>( const CMatMxN&, const VecN&, VecN&, const JacobiPreconditioner& );
+template bool CG::solve<SSORPreconditioner>( const CMatMxN&, const VecN&, VecN&, const SSORPreconditioner& );
+template bool CG::solve<ICPreconditioner>( const CMatMxN&, const VecN&, VecN&, const ICPreconditioner& );
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
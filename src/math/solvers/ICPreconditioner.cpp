@@ -0,0 +1,228 @@
+//*************************************************************************************************
+/*!
+//  \file src/math/solvers/ICPreconditioner.cpp
+//  \brief Source file for the incomplete Cholesky preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/solvers/ICPreconditioner.h>
+#include <blaze/util/Assert.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the ICPreconditioner class.
+*/
+ICPreconditioner::ICPreconditioner()
+   : L_       ()  // The strictly lower triangular part of the incomplete factor
+   , diagonal_()  // The inverse diagonal elements of the incomplete factor
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ICPreconditioner class.
+//
+// \param A The symmetric positive definite system matrix.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument Invalid diagonal element in the system matrix.
+// \exception std::runtime_error Breakdown of the incomplete Cholesky factorization.
+*/
+ICPreconditioner::ICPreconditioner( const CMatMxN& A )
+   : L_       ()  // The strictly lower triangular part of the incomplete factor
+   , diagonal_()  // The inverse diagonal elements of the incomplete factor
+{
+   setup( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets up the preconditioner for the given system matrix.
+//
+// \param A The symmetric positive definite system matrix.
+// \return void
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument Invalid diagonal element in the system matrix.
+// \exception std::runtime_error Breakdown of the incomplete Cholesky factorization.
+//
+// This function computes the incomplete Cholesky factor of the given matrix row by row. Only
+// the lower triangular part of the system matrix is accessed, i.e. the matrix is assumed to be
+// symmetric. The element \f$ l_{ij} \f$ of the factor is computed from the sparse dot product
+// of the rows \a i and \a j of the factor, which are merged by means of their sorted indices.
+*/
+void ICPreconditioner::setup( const CMatMxN& A )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   const size_t n( A.rows() );
+
+   if( A.columns() != n )
+      throw std::invalid_argument( "System matrix is not square" );
+
+   // Counting the non-zero elements of the strictly lower triangular part
+   size_t nonzeros( 0 );
+
+   for( size_t i=0; i<n; ++i ) {
+      const ConstIterator end( A.end( i ) );
+      for( ConstIterator element=A.begin( i ); element!=end && element->index()<i; ++element )
+         ++nonzeros;
+   }
+
+   CMatMxN L( n, n, nonzeros );
+   std::vector<size_t> indices;
+   std::vector<real>   values;
+
+   diagonal_.resize( n, false );
+
+   // Computing the incomplete factor row by row
+   for( size_t i=0; i<n; ++i )
+   {
+      indices.clear();
+      values.clear();
+
+      bool diagonal( false );
+
+      const ConstIterator end( A.end( i ) );
+      for( ConstIterator element=A.begin( i ); element!=end && element->index()<=i; ++element )
+      {
+         const size_t j( element->index() );
+
+         // Computing the dot product of the rows i and j of the factor
+         real tmp( element->value() );
+
+         if( j < i ) {
+            ConstIterator other( L.begin( j ) );
+            const ConstIterator last( L.end( j ) );
+
+            for( size_t k=0; k<indices.size() && other!=last; ) {
+               if( indices[k] < other->index() ) ++k;
+               else if( other->index() < indices[k] ) ++other;
+               else { tmp -= values[k] * other->value(); ++k; ++other; }
+            }
+
+            indices.push_back( j );
+            values.push_back( tmp * diagonal_[j] );
+         }
+         else {
+            for( size_t k=0; k<values.size(); ++k )
+               tmp -= values[k] * values[k];
+
+            if( tmp <= real(0) )
+               throw std::runtime_error( "Breakdown of the incomplete Cholesky factorization" );
+
+            diagonal_[i] = real(1) / std::sqrt( tmp );
+            diagonal = true;
+         }
+      }
+
+      if( !diagonal )
+         throw std::invalid_argument( "Invalid diagonal element in the system matrix" );
+
+      for( size_t k=0; k<indices.size(); ++k )
+         L.append( i, indices[k], values[k] );
+      L.finalize( i );
+   }
+
+   L_.swap( L );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given residual.
+//
+// \param r The residual vector \f$ r \f$.
+// \param z The resulting preconditioned residual \f$ z = (L L^T)^{-1} r \f$.
+// \return void
+//
+// The preconditioned residual is computed by a forward substitution with the incomplete factor
+// \f$ L \f$ and a backward substitution with its transpose. The latter is performed column by
+// column of \f$ L^T \f$, such that both substitutions traverse the row-major factor.
+*/
+void ICPreconditioner::apply( const VecN& r, VecN& z ) const
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   BLAZE_INTERNAL_ASSERT( r.size() == diagonal_.size(), "Invalid residual vector size" );
+
+   const size_t n( diagonal_.size() );
+
+   z.resize( n, false );
+
+   // Forward substitution with L
+   for( size_t i=0; i<n; ++i )
+   {
+      real tmp( r[i] );
+
+      const ConstIterator end( L_.end( i ) );
+      for( ConstIterator element=L_.begin( i ); element!=end; ++element )
+         tmp -= element->value() * z[element->index()];
+
+      z[i] = tmp * diagonal_[i];
+   }
+
+   // Backward substitution with L^T
+   for( size_t i=n; i-->0; )
+   {
+      const real tmp( z[i] * diagonal_[i] );
+      z[i] = tmp;
+
+      const ConstIterator end( L_.end( i ) );
+      for( ConstIterator element=L_.begin( i ); element!=end; ++element )
+         z[element->index()] -= element->value() * tmp;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
@@ -0,0 +1,110 @@
+//*************************************************************************************************
+/*!
+//  \file src/math/solvers/JacobiPreconditioner.cpp
+//  \brief Source file for the Jacobi preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the JacobiPreconditioner class.
+*/
+JacobiPreconditioner::JacobiPreconditioner()
+   : diagonal_()  // The inverse diagonal elements of the system matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the JacobiPreconditioner class.
+//
+// \param A The system matrix.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument Invalid diagonal element in the system matrix.
+*/
+JacobiPreconditioner::JacobiPreconditioner( const CMatMxN& A )
+   : diagonal_()  // The inverse diagonal elements of the system matrix
+{
+   setup( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets up the preconditioner for the given system matrix.
+//
+// \param A The system matrix.
+// \return void
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument Invalid diagonal element in the system matrix.
+*/
+void JacobiPreconditioner::setup( const CMatMxN& A )
+{
+   const size_t n( A.rows() );
+
+   if( A.columns() != n )
+      throw std::invalid_argument( "System matrix is not square" );
+
+   diagonal_.resize( n, false );
+
+   for( size_t i=0; i<n; ++i ) {
+      const real tmp( A(i,i) );
+      if( tmp == real(0) )
+         throw std::invalid_argument( "Invalid diagonal element in the system matrix" );
+      diagonal_[i] = real(1) / tmp;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
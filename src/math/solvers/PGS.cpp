@@ -53,6 +53,10 @@ namespace blaze {
 */
 PGS::PGS()
    : diagonal_()  // Vector for the diagonal entries of the LCP matrix
+   , blocks_  ()  // Vector for the diagonal entries or the 3x3 diagonal blocks of the LCP matrix
+   , inverses_()  // Vector for the inverse 3x3 diagonal blocks of contact LCP matrices
+   , colors_  ()  // The offsets of the colors within the contact list
+   , contacts_()  // The list of contacts sorted by color
 {}
 //*************************************************************************************************
 
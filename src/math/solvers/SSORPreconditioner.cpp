@@ -0,0 +1,181 @@
+//*************************************************************************************************
+/*!
+//  \file src/math/solvers/SSORPreconditioner.cpp
+//  \brief Source file for the SSOR preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/solvers/SSORPreconditioner.h>
+#include <blaze/util/Assert.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the SSORPreconditioner class.
+//
+// \param omega The relaxation parameter \f$ \omega \in (0,2) \f$.
+// \exception std::invalid_argument Invalid relaxation parameter.
+*/
+SSORPreconditioner::SSORPreconditioner( real omega )
+   : omega_   ( omega )  // The relaxation parameter
+   , A_       ()         // The system matrix
+   , diagonal_()         // The inverse diagonal elements of the system matrix
+{
+   if( omega <= real(0) || omega >= real(2) )
+      throw std::invalid_argument( "Invalid relaxation parameter" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the SSORPreconditioner class.
+//
+// \param A The system matrix.
+// \param omega The relaxation parameter \f$ \omega \in (0,2) \f$.
+// \exception std::invalid_argument Invalid relaxation parameter.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument Invalid diagonal element in the system matrix.
+*/
+SSORPreconditioner::SSORPreconditioner( const CMatMxN& A, real omega )
+   : omega_   ( omega )  // The relaxation parameter
+   , A_       ()         // The system matrix
+   , diagonal_()         // The inverse diagonal elements of the system matrix
+{
+   if( omega <= real(0) || omega >= real(2) )
+      throw std::invalid_argument( "Invalid relaxation parameter" );
+
+   setup( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets up the preconditioner for the given system matrix.
+//
+// \param A The system matrix.
+// \return void
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument Invalid diagonal element in the system matrix.
+*/
+void SSORPreconditioner::setup( const CMatMxN& A )
+{
+   const size_t n( A.rows() );
+
+   if( A.columns() != n )
+      throw std::invalid_argument( "System matrix is not square" );
+
+   diagonal_.resize( n, false );
+
+   for( size_t i=0; i<n; ++i ) {
+      const real tmp( A(i,i) );
+      if( tmp == real(0) )
+         throw std::invalid_argument( "Invalid diagonal element in the system matrix" );
+      diagonal_[i] = real(1) / tmp;
+   }
+
+   A_ = A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given residual.
+//
+// \param r The residual vector \f$ r \f$.
+// \param z The resulting preconditioned residual \f$ z = M^{-1} r \f$.
+// \return void
+//
+// The preconditioned residual is computed by a forward substitution with \f$ D + \omega L \f$,
+// a scaling by \f$ D \f$ and a backward substitution with \f$ D + \omega L^T \f$, where the
+// strictly lower and upper triangular parts are taken from the according rows of the system
+// matrix.
+*/
+void SSORPreconditioner::apply( const VecN& r, VecN& z ) const
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   BLAZE_INTERNAL_ASSERT( r.size() == diagonal_.size(), "Invalid residual vector size" );
+
+   const size_t n( diagonal_.size() );
+
+   z.resize( n, false );
+
+   // Forward substitution with ( D + omega*L )
+   for( size_t i=0; i<n; ++i )
+   {
+      real tmp( 0 );
+
+      const ConstIterator end( A_.end( i ) );
+      for( ConstIterator element=A_.begin( i ); element!=end && element->index()<i; ++element )
+         tmp += element->value() * z[element->index()];
+
+      z[i] = ( r[i] - omega_ * tmp ) * diagonal_[i];
+   }
+
+   // Backward substitution with ( D + omega*L^T ), including the scaling by D
+   for( size_t i=n; i-->0; )
+   {
+      real tmp( 0 );
+
+      const ConstIterator end( A_.end( i ) );
+      for( ConstIterator element=A_.begin( i ); element!=end; ++element ) {
+         if( element->index() > i )
+            tmp += element->value() * z[element->index()];
+      }
+
+      z[i] -= omega_ * tmp * diagonal_[i];
+   }
+
+   z *= omega_ * ( real(2) - omega_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze